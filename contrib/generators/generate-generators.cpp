@@ -0,0 +1,130 @@
+// Copyright (c) 2020 The Firo Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+// Derives the mainnet Lelantus and Sigma generators exactly like
+// lelantus::Params and sigma::Params do and prints them as a header that is
+// compiled into the client, see README.md.
+
+#include <secp256k1/include/GroupElement.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace secp_primitives;
+
+static std::string ToHex(const GroupElement& point)
+{
+    static const char digits[] = "0123456789abcdef";
+    unsigned char buffer[GroupElement::serialize_size];
+    point.serialize(buffer);
+
+    std::string hex;
+    for (unsigned char c : buffer) {
+        hex.push_back(digits[c >> 4]);
+        hex.push_back(digits[c & 0x0f]);
+    }
+    return hex;
+}
+
+static void PrintTable(const char* name, const std::vector<GroupElement>& points)
+{
+    printf("static const char* const %s[] = {\n", name);
+    for (auto& point : points) {
+        printf("    \"%s\",\n", ToHex(point).c_str());
+    }
+    printf("};\n\n");
+}
+
+static void Lelantus()
+{
+    const int n_sigma = 16, m_sigma = 4, n_rangeProof = 64, max_m_rangeProof = 16;
+
+    unsigned char buff[32] = {0};
+    GroupElement base, g;
+    base.set_base_g();
+    base.normalSha256(buff);
+    g.generate(buff);
+
+    std::vector<GroupElement> h_sigma(n_sigma * m_sigma);
+    unsigned char buff0[32] = {0};
+    g.normalSha256(buff0);
+    h_sigma[0].generate(buff0);
+    for (int i = 1; i < n_sigma * m_sigma; ++i) {
+        unsigned char next[32] = {0};
+        h_sigma[i - 1].normalSha256(next);
+        h_sigma[i].generate(next);
+    }
+
+    std::vector<GroupElement> g_rangeProof(n_rangeProof * max_m_rangeProof), h_rangeProof(n_rangeProof * max_m_rangeProof);
+    g_rangeProof[0].generate(buff0);
+    unsigned char buff1[32] = {0};
+    g_rangeProof[0].normalSha256(buff1);
+    h_rangeProof[0].generate(buff1);
+    for (int i = 1; i < n_rangeProof * max_m_rangeProof; ++i) {
+        unsigned char next[32] = {0};
+        h_rangeProof[i - 1].normalSha256(next);
+        g_rangeProof[i].generate(next);
+        unsigned char next2[32] = {0};
+        g_rangeProof[i].normalSha256(next2);
+        h_rangeProof[i].generate(next2);
+    }
+
+    printf("#ifndef FIRO_LIBLELANTUS_GENERATORS_H\n");
+    printf("#define FIRO_LIBLELANTUS_GENERATORS_H\n\n");
+    printf("// Generated by contrib/generators/generate-generators lelantus, do not edit.\n");
+    printf("// Serialized mainnet generators of lelantus::Params.\n\n");
+    printf("namespace lelantus {\n\n");
+    printf("static const char* const generators_g = \"%s\";\n\n", ToHex(g).c_str());
+    PrintTable("generators_sigma_h", h_sigma);
+    PrintTable("generators_bulletproofs_g", g_rangeProof);
+    PrintTable("generators_bulletproofs_h", h_rangeProof);
+    printf("} // namespace lelantus\n\n");
+    printf("#endif // FIRO_LIBLELANTUS_GENERATORS_H\n");
+}
+
+static void Sigma()
+{
+    const int n = 4, m = 7;
+
+    unsigned char buff[32] = {0};
+    GroupElement base, g;
+    base.set_base_g();
+    base.sha256(buff);
+    g.generate(buff);
+
+    std::vector<GroupElement> h(n * m);
+    unsigned char buff0[32] = {0};
+    g.sha256(buff0);
+    h[0].generate(buff0);
+    for (int i = 1; i < n * m; ++i) {
+        unsigned char next[32] = {0};
+        h[i - 1].sha256(next);
+        h[i].generate(next);
+    }
+
+    printf("#ifndef FIRO_SIGMA_GENERATORS_H\n");
+    printf("#define FIRO_SIGMA_GENERATORS_H\n\n");
+    printf("// Generated by contrib/generators/generate-generators sigma, do not edit.\n");
+    printf("// Serialized mainnet generators of sigma::Params.\n\n");
+    printf("namespace sigma {\n\n");
+    printf("static const char* const generators_g = \"%s\";\n\n", ToHex(g).c_str());
+    PrintTable("generators_h", h);
+    printf("} // namespace sigma\n\n");
+    printf("#endif // FIRO_SIGMA_GENERATORS_H\n");
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc == 2 && strcmp(argv[1], "lelantus") == 0) {
+        Lelantus();
+    } else if (argc == 2 && strcmp(argv[1], "sigma") == 0) {
+        Sigma();
+    } else {
+        fprintf(stderr, "Usage: %s lelantus|sigma\n", argv[0]);
+        return 1;
+    }
+    return 0;
+}
@@ -195,6 +195,7 @@ testScripts = [
     'sigma_spend_extra_validation.py',
     'sigma_mint_validation.py',
     'sigma_mintspend.py',
+    'mobile_anonymityset.py',
     'sigma_blocklimit.py',
     'hdmint_mempool_zap.py',
     'sigma_zapwalletmints_unconf_trans.py',
@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+import base64
+
+from test_framework.test_framework import BitcoinTestFramework
+from test_framework.util import assert_equal, assert_raises_message, JSONRPCException
+
+# getanonymityset, getusedcoinserials and their lelantus equivalents: full sets,
+# the increments since a block and the compact encoding
+class MobileAnonymitySetTest(BitcoinTestFramework):
+    def __init__(self):
+        super().__init__()
+        self.num_nodes = 1
+        self.setup_clean_chain = False
+
+    def run_test(self):
+        node = self.nodes[0]
+        sigma_denom = '100000000'
+
+        node.generate(551 - node.getblockcount())
+
+        # sigma anonymity set
+        node.mint(1)
+        node.generate(6)
+
+        first = node.getanonymityset(sigma_denom, '1')
+        assert_equal(1, len(first['serializedCoins']))
+
+        # nothing was minted since
+        assert_equal(
+            {'blockHash': first['blockHash'], 'serializedCoins': []},
+            node.getanonymityset(sigma_denom, '1', first['blockHash']))
+
+        node.mint(1)
+        node.mint(1)
+        node.generate(6)
+
+        full = node.getanonymityset(sigma_denom, '1')
+        delta = node.getanonymityset(sigma_denom, '1', first['blockHash'])
+        assert_equal(2, len(delta['serializedCoins']))
+        assert_equal(full['blockHash'], delta['blockHash'])
+        # the newest coins come first
+        assert_equal(full['serializedCoins'], delta['serializedCoins'] + first['serializedCoins'])
+
+        self.verify_compact(
+            node.getanonymityset(sigma_denom, '1', '', True)['serializedCoins'],
+            full['serializedCoins'], 34)
+        self.verify_compact(
+            node.getanonymityset(sigma_denom, '1', first['blockHash'], True)['serializedCoins'],
+            delta['serializedCoins'], 34)
+
+        # sigma serials
+        serials = node.getusedcoinserials()
+        node.spendmany('', {node.getnewaddress(): 1})
+        node.generate(1)
+
+        full_serials = node.getusedcoinserials()
+        delta_serials = node.getusedcoinserials(serials['blockHash'])
+        assert_equal(1, len(delta_serials['serials']))
+        assert_equal(node.getbestblockhash(), delta_serials['blockHash'])
+        assert_equal(sorted(full_serials['serials']), sorted(serials['serials'] + delta_serials['serials']))
+
+        self.verify_compact(node.getusedcoinserials('', True)['serials'], full_serials['serials'], 32)
+        self.verify_compact(node.getusedcoinserials(serials['blockHash'], True)['serials'], delta_serials['serials'], 32)
+
+        # a block which is unknown or no longer in the active chain is refused
+        tip = node.getbestblockhash()
+        node.invalidateblock(tip)
+        assert_raises_message(JSONRPCException, 'Block is not in the active chain',
+            node.getusedcoinserials, tip)
+        assert_raises_message(JSONRPCException, 'Block is not in the active chain',
+            node.getanonymityset, sigma_denom, '1', tip)
+        node.reconsiderblock(tip)
+        assert_equal(tip, node.getbestblockhash())
+
+        assert_raises_message(JSONRPCException, 'Block not found',
+            node.getanonymityset, sigma_denom, '1', '00' * 32)
+        assert_raises_message(JSONRPCException, 'Block not found',
+            node.getlelantususedcoinserials, '00' * 32)
+
+        # lelantus anonymity set, with the tags of the coins
+        node.generate(1000 - node.getblockcount())
+
+        node.mintlelantus(1)
+        node.generate(6)
+
+        first = node.getlelantusanonymityset(1)
+        assert len(first['coins']) > 0
+        assert_equal(
+            {'blockHash': first['blockHash'], 'coins': []},
+            node.getlelantusanonymityset(1, first['blockHash']))
+
+        node.mintlelantus(2)
+        node.generate(6)
+
+        full = node.getlelantusanonymityset(1)
+        delta = node.getlelantusanonymityset(1, first['blockHash'])
+        assert len(delta['coins']) > 0
+        assert_equal(full['blockHash'], delta['blockHash'])
+        assert_equal(full['coins'], delta['coins'] + first['coins'])
+
+        self.verify_compact_lelantus(node.getlelantusanonymityset(1, '', True)['coins'], full['coins'])
+        self.verify_compact_lelantus(node.getlelantusanonymityset(1, first['blockHash'], True)['coins'], delta['coins'])
+
+        # lelantus serials
+        serials = node.getlelantususedcoinserials()
+        assert_equal([], serials['serials'])
+        node.joinsplit({node.getnewaddress(): 0.5})
+        node.generate(1)
+
+        full_serials = node.getlelantususedcoinserials()
+        delta_serials = node.getlelantususedcoinserials(serials['blockHash'])
+        assert len(delta_serials['serials']) > 0
+        assert_equal(node.getbestblockhash(), delta_serials['blockHash'])
+        assert_equal(sorted(full_serials['serials']), sorted(delta_serials['serials']))
+
+        self.verify_compact(node.getlelantususedcoinserials('', True)['serials'], full_serials['serials'], 32)
+        self.verify_compact(node.getlelantususedcoinserials(serials['blockHash'], True)['serials'], delta_serials['serials'], 32)
+
+    # the compact form is the concatenation of the elements listed as hex
+    def verify_compact(self, compact, elements, size):
+        data = base64.b64decode(compact)
+        assert_equal(len(elements) * size, len(data))
+        assert_equal(elements, [data[i:i + size].hex() for i in range(0, len(data), size)])
+
+    # lelantus coins are followed by their tags, which are listed as hashes
+    def verify_compact_lelantus(self, compact, coins):
+        data = base64.b64decode(compact)
+        assert_equal(len(coins) * 66, len(data))
+        assert_equal(coins, [[data[i:i + 34].hex(), data[i + 34:i + 66][::-1].hex()] for i in range(0, len(data), 66)])
+
+if __name__ == '__main__':
+    MobileAnonymitySetTest().main()
@@ -19,6 +19,7 @@ class ZMQTest (BitcoinTestFramework):
         self.num_nodes = 4
 
     port = 28332
+    streamport = 28333
 
     def setup_nodes(self):
         self.zmqContext = zmq.Context()
@@ -26,8 +27,10 @@ class ZMQTest (BitcoinTestFramework):
         self.zmqSubSocket.setsockopt(zmq.SUBSCRIBE, b"hashblock")
         self.zmqSubSocket.setsockopt(zmq.SUBSCRIBE, b"hashtx")
         self.zmqSubSocket.connect("tcp://127.0.0.1:%i" % self.port)
+        self.node0_args = ['-zmqpubhashtx=tcp://127.0.0.1:'+str(self.port), '-zmqpubhashblock=tcp://127.0.0.1:'+str(self.port),
+                           '-zmqstreamblock=tcp://127.0.0.1:'+str(self.streamport)]
         return start_nodes(self.num_nodes, self.options.tmpdir, extra_args=[
-            ['-zmqpubhashtx=tcp://127.0.0.1:'+str(self.port), '-zmqpubhashblock=tcp://127.0.0.1:'+str(self.port)],
+            self.node0_args,
             [],
             [],
             []
@@ -92,6 +95,85 @@ class ZMQTest (BitcoinTestFramework):
 
         assert_equal(hashRPC, hashZMQ) #blockhash from generate must be equal to the hash received over zmq
 
+        self.test_block_stream()
+
+    def subscribe_block_stream(self, height):
+        socket = self.zmqContext.socket(zmq.DEALER)
+        socket.setsockopt(zmq.RCVTIMEO, 60000)
+        socket.setsockopt(zmq.LINGER, 0)
+        socket.connect("tcp://127.0.0.1:%i" % self.streamport)
+        socket.send_multipart([b"subscribe", struct.pack('<I', height)])
+        return socket
+
+    def receive_stream_message(self, socket, sequence):
+        msg = socket.recv_multipart()
+        assert_equal(struct.unpack('<I', msg[1])[0], sequence)
+        return msg[0], struct.unpack('<I', msg[2])[0], msg[3:]
+
+    def receive_stream_block(self, socket, sequence, height):
+        command, msgHeight, body = self.receive_stream_message(socket, sequence)
+        assert_equal(command, b"block")
+        assert_equal(msgHeight, height)
+        node = self.nodes[0]
+        assert_equal(bytes_to_hex_str(body[0]), node.getblock(node.getblockhash(height), False))
+        assert(len(body[1]) > 0) # undo data, at least the spent output count
+
+    def test_block_stream(self):
+        print("block stream...")
+        node = self.nodes[0]
+        tip = node.getblockcount()
+
+        # blocks already on disk are sent from the start height on
+        start = tip - 5
+        socket = self.subscribe_block_stream(start)
+        sequence = 0
+        for height in range(start, tip + 1):
+            self.receive_stream_block(socket, sequence, height)
+            sequence += 1
+
+        # then new blocks as they are connected
+        node.generate(2)
+        self.sync_all()
+        for height in range(tip + 1, tip + 3):
+            self.receive_stream_block(socket, sequence, height)
+            sequence += 1
+        tip += 2
+
+        # blocks that leave the active chain are disconnected tip first before the new branch follows
+        isolate_node(node)
+        orphaned = node.generate(2)
+        for height in range(tip + 1, tip + 3):
+            self.receive_stream_block(socket, sequence, height)
+            sequence += 1
+        self.nodes[2].generate(4)
+        sync_blocks(self.nodes[1:])
+        reconnect_isolated_node(node, 1)
+        sync_blocks(self.nodes)
+
+        for height, blockhash in [(tip + 2, orphaned[1]), (tip + 1, orphaned[0])]:
+            command, msgHeight, body = self.receive_stream_message(socket, sequence)
+            assert_equal(command, b"disconnect")
+            assert_equal(msgHeight, height)
+            assert_equal(bytes_to_hex_str(body[0]), blockhash)
+            sequence += 1
+        for height in range(tip + 1, tip + 5):
+            self.receive_stream_block(socket, sequence, height)
+            sequence += 1
+        socket.close()
+
+        # a block that can't be read ends the subscription with an error
+        stop_node(node, 0)
+        revfile = os.path.join(self.options.tmpdir, "node0", "regtest", "blocks", "rev00000.dat")
+        with open(revfile, "r+b") as f:
+            f.truncate(0)
+        self.nodes[0] = start_node(0, self.options.tmpdir, self.node0_args + ['-checklevel=0'])
+        socket = self.subscribe_block_stream(1)
+        command, msgHeight, body = self.receive_stream_message(socket, 0)
+        assert_equal(command, b"error")
+        assert_equal(msgHeight, 1)
+        assert_equal(body[0], b"block data not available")
+        socket.close()
+
 
 if __name__ == '__main__':
     ZMQTest ().main ()
@@ -0,0 +1,110 @@
+// Copyright (c) 2020 The Firo Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+
+#include "chainparams.h"
+#include "dandelion.h"
+#include "hash.h"
+#include "net.h"
+#include "net_processing.h"
+#include "netmessagemaker.h"
+#include "random.h"
+#include "utiltime.h"
+
+#include <cassert>
+#include <cstring>
+
+// Message handling of a peer while the node has Dandelion transactions embargoed.
+// Every message collects the ended embargoes before it is processed, the cost of
+// that shouldn't depend on how many transactions are embargoed.
+
+namespace {
+
+struct MessageSetup {
+    CConnman connman;
+    CNode node;
+    std::atomic<bool> interrupt;
+    CSerializedNetMsg msg;
+    std::vector<unsigned char> header;
+    std::vector<uint256> embargoed;
+
+    MessageSetup(size_t nEmbargoes)
+        : connman(0x1337, 0x1337),
+          node(0, NODE_NETWORK, 0, INVALID_SOCKET, CAddress(), 0, 0, "", true),
+          interrupt(false)
+    {
+        RegisterNodeSignals(GetNodeSignals());
+
+        node.SetSendVersion(PROTOCOL_VERSION);
+        GetNodeSignals().InitializeNode(&node, connman);
+        node.nVersion = PROTOCOL_VERSION;
+        node.fSuccessfullyConnected = true;
+
+        // a message which is handled without a reply
+        msg = CNetMsgMaker(PROTOCOL_VERSION).Make(NetMsgType::FEEFILTER, CAmount(1000));
+        uint256 hash = Hash(msg.data.data(), msg.data.data() + msg.data.size());
+        CMessageHeader hdr(Params().MessageStart(), msg.command.c_str(), msg.data.size());
+        memcpy(hdr.pchChecksum, hash.begin(), CMessageHeader::CHECKSUM_SIZE);
+        CVectorWriter{SER_NETWORK, INIT_PROTO_VERSION, header, 0, hdr};
+
+        // none of them ends while the benchmark runs
+        int64_t nEmbargo = GetTimeMicros() + 3600 * 1000000LL;
+        for (size_t i = 0; i < nEmbargoes; i++) {
+            embargoed.push_back(GetRandHash());
+            dandelionEmbargoes.Insert(embargoed.back(), nEmbargo + GetRand(600 * 1000000));
+        }
+    }
+
+    ~MessageSetup()
+    {
+        for (const uint256& hash : embargoed)
+            dandelionEmbargoes.Remove(hash);
+
+        bool fUpdateConnectionTime = false;
+        GetNodeSignals().FinalizeNode(node.GetId(), fUpdateConnectionTime);
+        UnregisterNodeSignals(GetNodeSignals());
+    }
+
+    //! Queues the message like the socket handler thread does
+    void Receive()
+    {
+        CNetMessage netMsg(Params().MessageStart(), SER_NETWORK, INIT_PROTO_VERSION);
+        netMsg.readHeader((const char*)header.data(), header.size());
+        netMsg.readData((const char*)msg.data.data(), msg.data.size());
+        assert(netMsg.complete());
+
+        LOCK(node.cs_vProcessMsg);
+        node.nProcessQueueSize += msg.data.size() + CMessageHeader::HEADER_SIZE;
+        node.vProcessMsg.push_back(std::move(netMsg));
+    }
+};
+
+void ProcessMessagesWithEmbargoes(benchmark::State& state, size_t nEmbargoes)
+{
+    SelectParams(CBaseChainParams::MAIN);
+    MessageSetup setup(nEmbargoes);
+
+    while (state.KeepRunning()) {
+        setup.Receive();
+        ProcessMessages(&setup.node, setup.connman, setup.interrupt);
+        assert(!setup.node.fDisconnect);
+    }
+    assert(dandelionEmbargoes.Size() >= nEmbargoes);
+}
+
+} // namespace
+
+static void DandelionProcessMessages(benchmark::State& state)
+{
+    ProcessMessagesWithEmbargoes(state, 0);
+}
+
+static void DandelionProcessMessagesEmbargoed(benchmark::State& state)
+{
+    ProcessMessagesWithEmbargoes(state, 100000);
+}
+
+BENCHMARK(DandelionProcessMessages);
+BENCHMARK(DandelionProcessMessagesEmbargoed);
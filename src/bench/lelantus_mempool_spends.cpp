@@ -0,0 +1,141 @@
+// Copyright (c) 2020 The Firo Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+
+#include "chainparams.h"
+#include "lelantus.h"
+#include "liblelantus/joinsplit.h"
+#include "script/script.h"
+#include "streams.h"
+#include "txmempool.h"
+#include "version.h"
+
+#include <cassert>
+
+// Cost of reading the spend inputs and amounts of a mempool full of joinsplits, as
+// needed for the lelantus limits. The mempool is walked by ancestor score and every
+// entry goes through the limits of BlockAssembler::TestPrivacySpends, not through block
+// template creation: CreateNewBlock ends with TestBlockValidity, which would need a
+// chain with a distinct minted coin and proof for every entry, and its time would be
+// the proof verification rather than the transaction selection. The spend metadata
+// cached in the mempool entries is compared to parsing the joinsplits, which is what
+// block assembly used to do.
+
+namespace {
+
+const int MEMPOOL_JOINSPLITS = 1000;
+
+struct MempoolSetup {
+    std::vector<CTransactionRef> txs;
+    CTxMemPool pool;
+
+    MempoolSetup() : pool(CFeeRate(0)) {
+        auto params = lelantus::Params::get_default();
+
+        std::vector<lelantus::PrivateCoin> coins;
+        for (int i = 0; i < 3; i++)
+            coins.emplace_back(params, (i + 1) * COIN);
+
+        std::map<uint32_t, std::vector<lelantus::PublicCoin>> anonymitySets;
+        for (int i = 0; i < 10; i++) {
+            GroupElement e;
+            e.randomize();
+            anonymitySets[1].emplace_back(e);
+        }
+        std::vector<std::pair<lelantus::PrivateCoin, uint32_t>> cin;
+        for (const auto& coin : coins) {
+            anonymitySets[1].push_back(coin.getPublicCoin());
+            cin.emplace_back(coin, 1);
+        }
+
+        // one proof is enough, the joinsplits only differ in their transparent outputs
+        CAmount fee = CENT;
+        CAmount vout = 6 * COIN - fee;
+        lelantus::JoinSplit joinSplit(params, cin, anonymitySets, vout, {}, fee, {{1, uint256()}}, uint256());
+
+        CDataStream serialized(SER_NETWORK, PROTOCOL_VERSION);
+        serialized << joinSplit;
+
+        CTxIn in;
+        in.scriptSig << OP_LELANTUSJOINSPLIT;
+        in.scriptSig.insert(in.scriptSig.end(), serialized.begin(), serialized.end());
+
+        LockPoints lp;
+        for (int i = 0; i < MEMPOOL_JOINSPLITS; i++) {
+            CMutableTransaction tx;
+            tx.vin.push_back(in);
+            tx.vout.emplace_back(vout - i, CScript() << OP_TRUE);
+            txs.push_back(MakeTransactionRef(tx));
+            pool.addUnchecked(tx.GetHash(), CTxMemPoolEntry(txs.back(), fee + i, 0, 1, 0, false, 4, lp));
+        }
+    }
+};
+
+MempoolSetup& GetMempoolSetup()
+{
+    static MempoolSetup setup;
+    return setup;
+}
+
+template<typename GetSpend>
+void WalkMempool(benchmark::State& state, GetSpend getSpend)
+{
+    MempoolSetup& setup = GetMempoolSetup();
+    auto& consensus = Params(CBaseChainParams::MAIN).GetConsensus();
+
+    while (state.KeepRunning()) {
+        LOCK(setup.pool.cs);
+        size_t nInputs = 0;
+        CAmount nAmount = 0;
+        int nIncluded = 0;
+        for (auto it = setup.pool.mapTx.get<ancestor_score>().begin(); it != setup.pool.mapTx.get<ancestor_score>().end(); ++it) {
+            size_t nTxInputs;
+            CAmount nTxAmount;
+            getSpend(*it, nTxInputs, nTxAmount);
+            if (nTxInputs > consensus.nMaxLelantusInputPerTransaction || nTxAmount > consensus.nMaxValueLelantusSpendPerTransaction)
+                continue;
+            if (nInputs + nTxInputs > consensus.nMaxLelantusInputPerBlock || nAmount + nTxAmount > consensus.nMaxValueLelantusSpendPerBlock)
+                continue;
+            nInputs += nTxInputs;
+            nAmount += nTxAmount;
+            nIncluded++;
+        }
+        assert(nIncluded > 0);
+    }
+}
+
+} // namespace
+
+static void LelantusMempoolSpendLimitsCached(benchmark::State& state)
+{
+    WalkMempool(state, [](const CTxMemPoolEntry& entry, size_t& nInputs, CAmount& nAmount) {
+        nInputs = entry.GetPrivacySpend().nInputs;
+        nAmount = entry.GetPrivacySpend().nAmount;
+    });
+}
+
+static void LelantusMempoolSpendLimitsParsed(benchmark::State& state)
+{
+    WalkMempool(state, [](const CTxMemPoolEntry& entry, size_t& nInputs, CAmount& nAmount) {
+        nInputs = lelantus::GetSpendInputs(entry.GetTx());
+        nAmount = lelantus::GetSpendTransparentAmount(entry.GetTx());
+    });
+}
+
+static void LelantusMempoolEntry(benchmark::State& state)
+{
+    MempoolSetup& setup = GetMempoolSetup();
+    LockPoints lp;
+
+    size_t i = 0;
+    while (state.KeepRunning()) {
+        CTxMemPoolEntry entry(setup.txs[i++ % setup.txs.size()], CENT, 0, 1, 0, false, 4, lp);
+        assert(entry.GetPrivacySpend().nInputs == 3);
+    }
+}
+
+BENCHMARK(LelantusMempoolSpendLimitsCached);
+BENCHMARK(LelantusMempoolSpendLimitsParsed);
+BENCHMARK(LelantusMempoolEntry);
@@ -0,0 +1,106 @@
+// Copyright (c) 2020 The Firo Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+
+#include "arith_uint256.h"
+#include "chainparams.h"
+#include "random.h"
+#include "tinyformat.h"
+#include "uint256.h"
+
+#include "elysium/elysium.h"
+#include "elysium/mdex.h"
+#include "elysium/sp.h"
+#include "elysium/tally.h"
+
+#include <boost/filesystem.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace elysium;
+
+static const uint32_t BENCH_PROPERTY = 3;
+static const unsigned BENCH_MAKERS = 50;
+static const unsigned BENCH_PRICE_LEVELS = 500;
+static const unsigned BENCH_BOOK_DEPTH = 5000;
+
+static uint256 BenchTxid(uint64_t n)
+{
+    return ArithToUint256(arith_uint256(n));
+}
+
+// Replays synthetic order flow against a single pair: makers place asks at
+// spread out prices and cancel them again, takers place bids crossing the
+// lowest levels of the book, so the depth of the book stays about the same.
+static void MetaDExOrderFlow(benchmark::State& state)
+{
+    SelectParams(CBaseChainParams::REGTEST);
+
+    boost::filesystem::path path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("bench_metadex_%%%%-%%%%");
+    boost::filesystem::create_directories(path);
+
+    _my_sps = new CMPSPInfo(path / "MP_spinfo", true);
+    p_txlistdb = new CMPTxList(path / "MP_txlist", true);
+    t_tradelistdb = new CMPTradeList(path / "MP_tradelist", true);
+
+    std::vector<std::string> makers;
+    for (unsigned i = 0; i < BENCH_MAKERS; i++) {
+        makers.push_back(strprintf("maker%u", i));
+    }
+    const std::string taker = "taker";
+
+    FastRandomContext rng(true);
+    int block = 1;
+    uint64_t n = 0;
+
+    auto ask = [&](const std::string& maker, int64_t price) {
+        n++;
+        update_tally_map(maker, BENCH_PROPERTY, 100, BALANCE);
+        MetaDEx_ADD(maker, BENCH_PROPERTY, 100, block, ELYSIUM_PROPERTY_ELYSIUM, 100 * price, BenchTxid(n), n % 1000);
+    };
+
+    for (unsigned i = 0; i < BENCH_BOOK_DEPTH; i++) {
+        ask(makers[rng.randrange(BENCH_MAKERS)], 1000 + rng.randrange(BENCH_PRICE_LEVELS));
+        if (i % 100 == 0) block++;
+    }
+
+    while (state.KeepRunning()) {
+        const std::string& maker = makers[rng.randrange(BENCH_MAKERS)];
+        int64_t price = 1000 + rng.randrange(BENCH_PRICE_LEVELS);
+
+        switch (n % 4) {
+        case 0:
+        case 1:
+            ask(maker, price);
+            break;
+        case 2:
+            // buys a few units at the lowest prices of the book
+            n++;
+            update_tally_map(taker, ELYSIUM_PROPERTY_ELYSIUM, 300 * price, BALANCE);
+            MetaDEx_ADD(taker, ELYSIUM_PROPERTY_ELYSIUM, 300 * price, block, BENCH_PROPERTY, 300, BenchTxid(n), n % 1000);
+            break;
+        case 3:
+            n++;
+            MetaDEx_CANCEL_AT_PRICE(BenchTxid(n), block, maker, BENCH_PROPERTY, 100, ELYSIUM_PROPERTY_ELYSIUM, 100 * price);
+            break;
+        }
+
+        if (n % 100 == 0) block++;
+    }
+
+    MetaDEx_SHUTDOWN();
+
+    metadex.clear();
+    mp_tally_map.clear();
+
+    delete t_tradelistdb; t_tradelistdb = nullptr;
+    delete p_txlistdb; p_txlistdb = nullptr;
+    delete _my_sps; _my_sps = nullptr;
+
+    boost::filesystem::remove_all(path);
+}
+
+BENCHMARK(MetaDExOrderFlow);
@@ -0,0 +1,92 @@
+// Copyright (c) 2020 The Firo Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+
+#include "sigma/sigmaplus_prover.h"
+#include "sigma/sigmaplus_verifier.h"
+
+#include <cassert>
+
+// Cost of batch verifying M sigma proofs over the same anonymity set. The set is smaller than
+// on mainnet (4^5 instead of 4^7 coins) to keep generating the proofs quick, that makes the
+// terms of every single proof weigh more against the multiexponentiation over the set.
+
+namespace {
+
+typedef sigma::SigmaPlusProver<Scalar, GroupElement> Prover;
+typedef sigma::SigmaPlusVerifier<Scalar, GroupElement> Verifier;
+typedef sigma::SigmaPlusProof<Scalar, GroupElement> Proof;
+
+const int n = 4;
+const int m = 5;
+const int N = 1024;
+const int MAX_PROOFS = 50;
+
+struct BatchSetup {
+    GroupElement g;
+    std::vector<GroupElement> h;
+    std::vector<GroupElement> coins;
+    std::vector<Scalar> serials;
+    std::vector<Proof> proofs;
+
+    BatchSetup() : h(n * m), coins(N) {
+        g.randomize();
+        for (auto &gen : h)
+            gen.randomize();
+        for (auto &coin : coins)
+            coin.randomize();
+
+        std::vector<Scalar> randomness(MAX_PROOFS);
+        serials.resize(MAX_PROOFS);
+        for (int i = 0; i < MAX_PROOFS; i++) {
+            serials[i].randomize();
+            randomness[i].randomize();
+            coins[i * (N / MAX_PROOFS)] = g * serials[i] + h[0] * randomness[i];
+        }
+
+        Prover prover(g, h, n, m);
+        for (int i = 0; i < MAX_PROOFS; i++) {
+            std::vector<GroupElement> commits(coins);
+            GroupElement gs = g * serials[i].negate();
+            for (auto &commit : commits)
+                commit += gs;
+
+            proofs.emplace_back(n, m);
+            prover.proof(commits, i * (N / MAX_PROOFS), randomness[i], false, proofs.back());
+        }
+    }
+};
+
+const BatchSetup& GetBatchSetup()
+{
+    static BatchSetup setup;
+    return setup;
+}
+
+void SigmaBatchVerify(benchmark::State& state, int M)
+{
+    const BatchSetup &setup = GetBatchSetup();
+    Verifier verifier(setup.g, setup.h, n, m);
+
+    std::vector<Scalar> serials(setup.serials.begin(), setup.serials.begin() + M);
+    std::vector<Proof> proofs(setup.proofs.begin(), setup.proofs.begin() + M);
+    std::vector<bool> fPadding(M, false);
+    std::vector<size_t> setSizes(M, N);
+
+    while (state.KeepRunning()) {
+        bool valid = verifier.batch_verify(setup.coins, serials, fPadding, setSizes, proofs);
+        assert(valid);
+    }
+}
+
+} // namespace
+
+static void SigmaBatchVerify1(benchmark::State& state) { SigmaBatchVerify(state, 1); }
+static void SigmaBatchVerify10(benchmark::State& state) { SigmaBatchVerify(state, 10); }
+static void SigmaBatchVerify50(benchmark::State& state) { SigmaBatchVerify(state, 50); }
+
+BENCHMARK(SigmaBatchVerify1);
+BENCHMARK(SigmaBatchVerify10);
+BENCHMARK(SigmaBatchVerify50);
@@ -0,0 +1,258 @@
+// Copyright (c) 2020 The Firo Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "blockfilter.h"
+
+#include "clientversion.h"
+#include "coins.h"
+#include "hash.h"
+#include "lelantus.h"
+#include "primitives/block.h"
+#include "primitives/zerocoin.h"
+#include "script/script.h"
+#include "sigma.h"
+#include "streams.h"
+#include "undo.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+/** Maps x uniformly into [0, n), the upper 64 bits of x * n */
+uint64_t MapIntoRange(uint64_t x, uint64_t n)
+{
+#ifdef __SIZEOF_INT128__
+    return (static_cast<unsigned __int128>(x) * static_cast<unsigned __int128>(n)) >> 64;
+#else
+    uint64_t x_hi = x >> 32, x_lo = x & 0xFFFFFFFF;
+    uint64_t n_hi = n >> 32, n_lo = n & 0xFFFFFFFF;
+
+    uint64_t ac = x_hi * n_hi;
+    uint64_t ad = x_hi * n_lo;
+    uint64_t bc = x_lo * n_hi;
+    uint64_t bd = x_lo * n_lo;
+
+    uint64_t mid34 = (bd >> 32) + (bc & 0xFFFFFFFF) + (ad & 0xFFFFFFFF);
+    return ac + (bc >> 32) + (ad >> 32) + (mid34 >> 32);
+#endif
+}
+
+class BitWriter
+{
+public:
+    explicit BitWriter(std::vector<unsigned char>& data) : data(data), buffer(0), offset(0) {}
+
+    //! Writes the nbits low bits of value, most significant first
+    void Write(uint64_t value, int nbits)
+    {
+        while (nbits > 0) {
+            int bits = std::min(8 - offset, nbits);
+            buffer |= ((value >> (nbits - bits)) & ((1 << bits) - 1)) << (8 - offset - bits);
+            offset += bits;
+            nbits -= bits;
+            if (offset == 8) {
+                Flush();
+            }
+        }
+    }
+
+    void Flush()
+    {
+        if (offset == 0) {
+            return;
+        }
+        data.push_back(buffer);
+        buffer = 0;
+        offset = 0;
+    }
+
+private:
+    std::vector<unsigned char>& data;
+    unsigned char buffer;
+    int offset;
+};
+
+class BitReader
+{
+public:
+    BitReader(const std::vector<unsigned char>& data, size_t pos) : data(data), pos(pos), offset(8) {}
+
+    uint64_t Read(int nbits)
+    {
+        uint64_t value = 0;
+        while (nbits > 0) {
+            if (offset == 8) {
+                if (pos >= data.size()) {
+                    throw std::ios_base::failure("block filter is truncated");
+                }
+                buffer = data[pos++];
+                offset = 0;
+            }
+            int bits = std::min(8 - offset, nbits);
+            value <<= bits;
+            value |= (buffer >> (8 - offset - bits)) & ((1 << bits) - 1);
+            offset += bits;
+            nbits -= bits;
+        }
+        return value;
+    }
+
+private:
+    const std::vector<unsigned char>& data;
+    size_t pos;
+    unsigned char buffer;
+    int offset;
+};
+
+void GolombRiceEncode(BitWriter& writer, uint64_t value)
+{
+    for (uint64_t q = value >> GCSFilter::P; q > 0; q--) {
+        writer.Write(1, 1);
+    }
+    writer.Write(0, 1);
+    writer.Write(value, GCSFilter::P);
+}
+
+uint64_t GolombRiceDecode(BitReader& reader)
+{
+    uint64_t q = 0;
+    while (reader.Read(1) == 1) {
+        q++;
+    }
+    return (q << GCSFilter::P) + reader.Read(GCSFilter::P);
+}
+
+} // namespace
+
+GCSFilter::GCSFilter() : GCSFilter(uint256(), ElementSet())
+{
+}
+
+GCSFilter::GCSFilter(const uint256& blockHash, std::vector<unsigned char> encoded_)
+    : k0(blockHash.GetUint64(0)), k1(blockHash.GetUint64(1)), encoded(std::move(encoded_))
+{
+    CDataStream stream(encoded, SER_DISK, CLIENT_VERSION);
+    uint64_t n = ReadCompactSize(stream);
+    if (n > std::numeric_limits<uint32_t>::max()) {
+        throw std::ios_base::failure("block filter has too many elements");
+    }
+    N = static_cast<uint32_t>(n);
+    F = static_cast<uint64_t>(N) * M;
+}
+
+GCSFilter::GCSFilter(const uint256& blockHash, const ElementSet& elements)
+    : k0(blockHash.GetUint64(0)), k1(blockHash.GetUint64(1)), N(elements.size())
+{
+    F = static_cast<uint64_t>(N) * M;
+
+    CVectorWriter stream(SER_DISK, CLIENT_VERSION, encoded, 0);
+    WriteCompactSize(stream, N);
+
+    BitWriter writer(encoded);
+    uint64_t last = 0;
+    for (uint64_t value : BuildHashedSet(elements)) {
+        GolombRiceEncode(writer, value - last);
+        last = value;
+    }
+    writer.Flush();
+}
+
+uint64_t GCSFilter::HashToRange(const Element& element) const
+{
+    uint64_t hash = CSipHasher(k0, k1).Write(element.data(), element.size()).Finalize();
+    return MapIntoRange(hash, F);
+}
+
+std::vector<uint64_t> GCSFilter::BuildHashedSet(const ElementSet& elements) const
+{
+    std::vector<uint64_t> hashed;
+    hashed.reserve(elements.size());
+    for (const Element& element : elements) {
+        hashed.push_back(HashToRange(element));
+    }
+    std::sort(hashed.begin(), hashed.end());
+    return hashed;
+}
+
+bool GCSFilter::MatchInternal(const std::vector<uint64_t>& queries) const
+{
+    BitReader reader(encoded, GetSizeOfCompactSize(N));
+
+    // both the filter and the queries are sorted, walk them together
+    uint64_t value = 0;
+    size_t q = 0;
+    for (uint32_t i = 0; i < N && q < queries.size(); i++) {
+        value += GolombRiceDecode(reader);
+
+        while (q < queries.size() && queries[q] < value) {
+            q++;
+        }
+        if (q < queries.size() && queries[q] == value) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool GCSFilter::Match(const Element& element) const
+{
+    return MatchInternal({HashToRange(element)});
+}
+
+bool GCSFilter::MatchAny(const ElementSet& elements) const
+{
+    return MatchInternal(BuildHashedSet(elements));
+}
+
+GCSFilter::ElementSet BlockFilterElements(const CBlock& block, const CBlockUndo& blockundo)
+{
+    GCSFilter::ElementSet elements;
+
+    for (const CTransactionRef& tx : block.vtx) {
+        for (const CTxOut& txout : tx->vout) {
+            const CScript& script = txout.scriptPubKey;
+            if (script.empty() || script[0] == OP_RETURN) {
+                continue;
+            }
+            elements.emplace(script.begin(), script.end());
+        }
+    }
+
+    for (const CTxUndo& txundo : blockundo.vtxundo) {
+        for (const Coin& prevout : txundo.vprevout) {
+            const CScript& script = prevout.out.scriptPubKey;
+            if (script.empty()) {
+                continue;
+            }
+            elements.emplace(script.begin(), script.end());
+        }
+    }
+
+    if (block.sigmaTxInfo) {
+        for (const auto& mint : block.sigmaTxInfo->mints) {
+            elements.insert(BlockFilterElement(primitives::GetPubCoinValueHash(mint.getValue())));
+        }
+        for (const auto& serial : block.sigmaTxInfo->spentSerials) {
+            elements.insert(BlockFilterElement(primitives::GetSerialHash(serial.first)));
+        }
+    }
+
+    if (block.lelantusTxInfo) {
+        for (const auto& mint : block.lelantusTxInfo->mints) {
+            elements.insert(BlockFilterElement(primitives::GetPubCoinValueHash(mint.first.getValue())));
+            const uint256& mintTag = mint.second.second;
+            if (!mintTag.IsNull()) {
+                elements.insert(BlockFilterElement(mintTag));
+            }
+        }
+        for (const auto& serial : block.lelantusTxInfo->spentSerials) {
+            elements.insert(BlockFilterElement(primitives::GetSerialHash(serial.first)));
+        }
+    }
+
+    return elements;
+}
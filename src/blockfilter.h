@@ -0,0 +1,69 @@
+// Copyright (c) 2020 The Firo Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef FIRO_BLOCKFILTER_H
+#define FIRO_BLOCKFILTER_H
+
+#include "uint256.h"
+
+#include <set>
+#include <stdint.h>
+#include <vector>
+
+class CBlock;
+class CBlockUndo;
+
+/**
+ * Golomb-coded set of the elements a block touches, in the style of BIP 158.
+ *
+ * Elements are hashed with SipHash keyed by the block hash and mapped into
+ * [0, N * M), the sorted values are stored as Golomb-Rice coded differences.
+ * A query for an element which is not in the set matches with probability 1/M.
+ */
+class GCSFilter
+{
+public:
+    typedef std::vector<unsigned char> Element;
+    typedef std::set<Element> ElementSet;
+
+    //! BIP 158 basic filter parameters
+    static const uint8_t P = 19;
+    static const uint32_t M = 784931;
+
+    GCSFilter();
+    GCSFilter(const uint256& blockHash, std::vector<unsigned char> encoded);
+    GCSFilter(const uint256& blockHash, const ElementSet& elements);
+
+    uint32_t GetN() const { return N; }
+    const std::vector<unsigned char>& GetEncoded() const { return encoded; }
+
+    bool Match(const Element& element) const;
+    //! Whether any of the elements is in the set, faster than matching them one by one
+    bool MatchAny(const ElementSet& elements) const;
+
+private:
+    uint64_t HashToRange(const Element& element) const;
+    std::vector<uint64_t> BuildHashedSet(const ElementSet& elements) const;
+    bool MatchInternal(const std::vector<uint64_t>& queries) const;
+
+    uint64_t k0, k1;
+    uint32_t N;
+    uint64_t F;
+    std::vector<unsigned char> encoded;
+};
+
+/**
+ * Elements of the wallet matching filter of a block: output scripts, scripts of
+ * the spent outputs, pubcoin hashes and tags of the mints, and hashes of the spent
+ * sigma and lelantus serials. The mints and serials are taken from the tx infos
+ * filled in while the block is connected.
+ */
+GCSFilter::ElementSet BlockFilterElements(const CBlock& block, const CBlockUndo& blockundo);
+
+inline GCSFilter::Element BlockFilterElement(const uint256& hash)
+{
+    return GCSFilter::Element(hash.begin(), hash.end());
+}
+
+#endif // FIRO_BLOCKFILTER_H
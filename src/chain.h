@@ -19,6 +19,7 @@
 #include "util.h"
 #include "chainparams.h"
 #include "coin_containers.h"
+#include "coin_arena.h"
 #include "streams.h"
 
 #include <vector>
@@ -240,14 +241,14 @@ public:
 /////////////////////// Sigma index entries. ////////////////////////////////////////////
 
     //! Public coin values of mints in this block, ordered by serialized value of public coin
-    //! Maps <denomination,id> to vector of public coins
-    std::map<pair<sigma::CoinDenomination, int>, vector<sigma::PublicCoin>> sigmaMintedPubCoins;
+    //! Maps <denomination,id> to public coins, the coins are kept in an arena (see coin_arena.h)
+    sigma::block_mint_container sigmaMintedPubCoins;
     //! Map id to <public coin, tag>
-    std::map<int, vector<std::pair<lelantus::PublicCoin, uint256>>>  lelantusMintedPubCoins;
+    lelantus::block_mint_container lelantusMintedPubCoins;
 
     //! Values of coin serials spent in this block
-    sigma::spend_info_container sigmaSpentSerials;
-    std::unordered_map<Scalar, int> lelantusSpentSerials;
+    sigma::block_spend_container sigmaSpentSerials;
+    lelantus::block_spend_container lelantusSpentSerials;
     void SetNull()
     {
         phashBlock = NULL;
@@ -495,7 +496,7 @@ public:
                 for(auto& itr : lelantusPubCoins) {
                     if(!itr.second.empty()) {
                         for(auto& coin : itr.second)
-                        lelantusMintedPubCoins[itr.first].push_back(std::make_pair(coin, uint256()));
+                        lelantusMintedPubCoins.Add(itr.first, std::make_pair(coin, uint256()));
                     }
                 }
             } else
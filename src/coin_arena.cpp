@@ -0,0 +1,118 @@
+// Copyright (c) 2020 The Firo Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "coin_arena.h"
+
+#include "crypto/common.h"
+
+CCoinArena::CCoinArena(size_t recordSize) : recordSize(recordSize), nRecords(0)
+{
+}
+
+uint32_t CCoinArena::Append(uint32_t count)
+{
+    uint32_t first = nRecords;
+    nRecords += count;
+    while (chunks.size() * CHUNK_RECORDS < nRecords)
+        chunks.emplace_back(new unsigned char[CHUNK_RECORDS * recordSize]);
+    return first;
+}
+
+size_t CCoinArena::DynamicMemoryUsage() const
+{
+    return chunks.size() * CHUNK_RECORDS * recordSize + chunks.capacity() * sizeof(chunks[0]);
+}
+
+namespace sigma {
+
+CCoinArena& CMintArenaCodec::Arena()
+{
+    static CCoinArena arena(size);
+    return arena;
+}
+
+void CMintArenaCodec::Encode(unsigned char* record, const value_type& coin)
+{
+    record = coin.getValue().serializeAffine(record);
+    record[0] = static_cast<unsigned char>(coin.getDenomination());
+}
+
+void CMintArenaCodec::Decode(const unsigned char* record, value_type& coin)
+{
+    GroupElement value;
+    record = value.deserializeAffine(record);
+    coin = PublicCoin(value, static_cast<CoinDenomination>(record[0]));
+}
+
+CCoinArena& CSpendArenaCodec::Arena()
+{
+    static CCoinArena arena(size);
+    return arena;
+}
+
+void CSpendArenaCodec::Encode(unsigned char* record, const value_type& serial)
+{
+    record = serial.first.serialize(record);
+    record[0] = static_cast<unsigned char>(serial.second.denomination);
+    WriteLE32(record + 1, serial.second.coinGroupId);
+}
+
+void CSpendArenaCodec::Decode(const unsigned char* record, value_type& serial)
+{
+    record = serial.first.deserialize(record);
+    serial.second.denomination = static_cast<CoinDenomination>(record[0]);
+    serial.second.coinGroupId = ReadLE32(record + 1);
+}
+
+} // namespace sigma
+
+namespace lelantus {
+
+CCoinArena& CMintArenaCodec::Arena()
+{
+    static CCoinArena arena(size);
+    return arena;
+}
+
+void CMintArenaCodec::Encode(unsigned char* record, const value_type& mint)
+{
+    record = mint.first.getValue().serializeAffine(record);
+    std::memcpy(record, mint.second.begin(), 32);
+}
+
+void CMintArenaCodec::Decode(const unsigned char* record, value_type& mint)
+{
+    GroupElement value;
+    record = value.deserializeAffine(record);
+    mint.first = PublicCoin(value);
+    std::memcpy(mint.second.begin(), record, 32);
+}
+
+CCoinArena& CSpendArenaCodec::Arena()
+{
+    static CCoinArena arena(size);
+    return arena;
+}
+
+void CSpendArenaCodec::Encode(unsigned char* record, const value_type& serial)
+{
+    record = serial.first.serialize(record);
+    WriteLE32(record, serial.second);
+}
+
+void CSpendArenaCodec::Decode(const unsigned char* record, value_type& serial)
+{
+    record = serial.first.deserialize(record);
+    serial.second = ReadLE32(record);
+}
+
+} // namespace lelantus
+
+size_t CoinArenaDynamicMemoryUsage()
+{
+    return sigma::CMintArenaCodec::Arena().DynamicMemoryUsage()
+        + sigma::CSpendArenaCodec::Arena().DynamicMemoryUsage()
+        + lelantus::CMintArenaCodec::Arena().DynamicMemoryUsage()
+        + lelantus::CSpendArenaCodec::Arena().DynamicMemoryUsage();
+}
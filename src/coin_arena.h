@@ -0,0 +1,350 @@
+// Copyright (c) 2020 The Firo Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef FIRO_COIN_ARENA_H
+#define FIRO_COIN_ARENA_H
+
+#include "coin_containers.h"
+#include "serialize.h"
+#include "uint256.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/**
+ * Append only store of fixed size records. The block index keeps the mints and
+ * serials of every block in a few of these instead of per block maps of heap
+ * allocated coins.
+ *
+ * Records are allocated in chunks and referenced by their index, the arena itself
+ * never moves them. A range that can't grow in place is copied to the end of the
+ * arena though (CCoinArenaRange::push_back) and its old records are abandoned.
+ *
+ * Abandoned records leak until the arenas are rebuilt from the block index database
+ * on the next start:
+ *  - old copies of relocated ranges. Every copy doubles the room of the range, so
+ *    they add up to less than twice the coins of the range.
+ *  - previous records of blocks connected again. A disconnected block keeps its
+ *    records, but ConnectBlock clears the containers of the block and adds its
+ *    coins again.
+ * Every reconnection so leaks one record per coin and serial of the block: 97 bytes
+ * per lelantus mint, 36 per lelantus serial, 66 per sigma mint and 37 per sigma
+ * serial. The waste of a run is bounded by the coins of the blocks reorgs brought
+ * back, which stays small next to the index unless the node keeps switching between
+ * deep forks for a long time; restarting reclaims it.
+ *
+ * Not thread safe, guarded by cs_main together with the block index.
+ */
+class CCoinArena
+{
+public:
+    static const uint32_t CHUNK_RECORDS = 4096;
+
+    explicit CCoinArena(size_t recordSize);
+
+    CCoinArena(const CCoinArena&) = delete;
+    CCoinArena& operator=(const CCoinArena&) = delete;
+
+    //! Appends uninitialized records and returns the index of the first one
+    uint32_t Append(uint32_t count);
+
+    unsigned char* Get(uint32_t index) {
+        return chunks[index / CHUNK_RECORDS].get() + (index % CHUNK_RECORDS) * recordSize;
+    }
+
+    const unsigned char* Get(uint32_t index) const {
+        return chunks[index / CHUNK_RECORDS].get() + (index % CHUNK_RECORDS) * recordSize;
+    }
+
+    uint32_t Size() const { return nRecords; }
+
+    size_t DynamicMemoryUsage() const;
+
+private:
+    const size_t recordSize;
+    uint32_t nRecords;
+    std::vector<std::unique_ptr<unsigned char[]>> chunks;
+};
+
+/**
+ * Contiguous run of records of an arena, decoded on access. Codec provides the
+ * arena, the record size and the conversion from and to value_type.
+ */
+template <typename Codec>
+class CCoinArenaRange
+{
+public:
+    typedef typename Codec::value_type value_type;
+
+    class const_iterator
+    {
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef typename Codec::value_type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const value_type* pointer;
+        typedef value_type reference;
+
+        explicit const_iterator(uint32_t index) : index(index) {}
+
+        value_type operator*() const {
+            value_type value;
+            Codec::Decode(Codec::Arena().Get(index), value);
+            return value;
+        }
+
+        const_iterator& operator++() { ++index; return *this; }
+        const_iterator operator++(int) { const_iterator tmp(*this); ++index; return tmp; }
+
+        bool operator==(const const_iterator& other) const { return index == other.index; }
+        bool operator!=(const const_iterator& other) const { return index != other.index; }
+
+    private:
+        uint32_t index;
+    };
+
+    CCoinArenaRange() : first(0), count(0), capacity(0) {}
+
+    // Copies share the records, the room left for more stays with the original
+    CCoinArenaRange(const CCoinArenaRange& other) : first(other.first), count(other.count), capacity(other.count) {}
+    CCoinArenaRange(CCoinArenaRange&& other) = default;
+
+    CCoinArenaRange& operator=(const CCoinArenaRange& other) {
+        first = other.first;
+        count = other.count;
+        capacity = other.count;
+        return *this;
+    }
+    CCoinArenaRange& operator=(CCoinArenaRange&& other) = default;
+
+    uint32_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    const_iterator begin() const { return const_iterator(first); }
+    const_iterator end() const { return const_iterator(first + count); }
+
+    value_type operator[](uint32_t i) const {
+        value_type value;
+        Codec::Decode(Codec::Arena().Get(first + i), value);
+        return value;
+    }
+
+    void push_back(const value_type& value) {
+        CCoinArena& arena = Codec::Arena();
+        if (count == capacity) {
+            if (capacity > 0 && first + capacity == arena.Size()) {
+                arena.Append(1);
+                capacity++;
+            } else {
+                // something else was appended after the range, move it to the end of the arena.
+                // Leave room for more so ranges filled in turns don't move on every record.
+                uint32_t newCapacity = capacity > 0 ? capacity * 2 : 1;
+                uint32_t newFirst = arena.Append(newCapacity);
+                for (uint32_t i = 0; i < count; i++)
+                    std::memcpy(arena.Get(newFirst + i), arena.Get(first + i), Codec::size);
+                first = newFirst;
+                capacity = newCapacity;
+            }
+        }
+
+        Codec::Encode(arena.Get(first + count), value);
+        count++;
+    }
+
+private:
+    uint32_t first;
+    uint32_t count;
+    uint32_t capacity;
+};
+
+/**
+ * Mints of a block grouped by Key, serialized like std::map<Key, std::vector<Coin>>
+ * so the block index database format doesn't change.
+ */
+template <typename Key, typename Codec>
+class CBlockMintedCoins
+{
+public:
+    typedef CCoinArenaRange<Codec> range_type;
+    typedef typename Codec::value_type coin_type;
+    typedef std::pair<Key, range_type> value_type;
+    typedef typename std::vector<value_type>::const_iterator const_iterator;
+
+    const_iterator begin() const { return entries.begin(); }
+    const_iterator end() const { return entries.end(); }
+
+    bool empty() const { return entries.empty(); }
+    size_t size() const { return entries.size(); }
+
+    size_t count(const Key& key) const {
+        auto it = LowerBound(key);
+        return it != entries.end() && it->first == key ? 1 : 0;
+    }
+
+    //! Coins of the given group, empty if the block has none
+    range_type Get(const Key& key) const {
+        auto it = LowerBound(key);
+        return it != entries.end() && it->first == key ? it->second : range_type();
+    }
+
+    void Add(const Key& key, const coin_type& coin) {
+        Entry(key).push_back(coin);
+    }
+
+    void clear() {
+        std::vector<value_type>().swap(entries);
+    }
+
+    template <typename Stream>
+    void Serialize(Stream& s) const {
+        WriteCompactSize(s, entries.size());
+        for (const auto& entry : entries) {
+            ::Serialize(s, entry.first);
+            WriteCompactSize(s, entry.second.size());
+            for (const auto& coin : entry.second)
+                ::Serialize(s, coin);
+        }
+    }
+
+    template <typename Stream>
+    void Unserialize(Stream& s) {
+        clear();
+        unsigned int nEntries = ReadCompactSize(s);
+        for (unsigned int i = 0; i < nEntries; i++) {
+            Key key;
+            ::Unserialize(s, key);
+            // groups without coins are kept, they are in the database from older versions
+            range_type& range = Entry(key);
+            unsigned int nCoins = ReadCompactSize(s);
+            for (unsigned int j = 0; j < nCoins; j++) {
+                coin_type coin;
+                ::Unserialize(s, coin);
+                range.push_back(coin);
+            }
+        }
+    }
+
+private:
+    typename std::vector<value_type>::const_iterator LowerBound(const Key& key) const {
+        return std::lower_bound(entries.begin(), entries.end(), key,
+            [](const value_type& entry, const Key& key) { return entry.first < key; });
+    }
+
+    range_type& Entry(const Key& key) {
+        auto it = std::lower_bound(entries.begin(), entries.end(), key,
+            [](const value_type& entry, const Key& key) { return entry.first < key; });
+        if (it == entries.end() || it->first != key)
+            it = entries.insert(it, value_type(key, range_type()));
+        return it->second;
+    }
+
+    // sorted by key
+    std::vector<value_type> entries;
+};
+
+/**
+ * Serials spent in a block, serialized like std::unordered_map<Scalar, Info>.
+ * The block never spends a serial twice so they aren't deduplicated.
+ */
+template <typename Codec>
+class CBlockSpentSerials
+{
+public:
+    typedef typename Codec::value_type value_type;
+    typedef typename CCoinArenaRange<Codec>::const_iterator const_iterator;
+
+    const_iterator begin() const { return serials.begin(); }
+    const_iterator end() const { return serials.end(); }
+
+    bool empty() const { return serials.empty(); }
+    size_t size() const { return serials.size(); }
+
+    void insert(const value_type& serial) {
+        serials.push_back(serial);
+    }
+
+    void clear() {
+        serials = CCoinArenaRange<Codec>();
+    }
+
+    template <typename Stream>
+    void Serialize(Stream& s) const {
+        WriteCompactSize(s, serials.size());
+        for (const auto& serial : serials)
+            ::Serialize(s, serial);
+    }
+
+    template <typename Stream>
+    void Unserialize(Stream& s) {
+        clear();
+        unsigned int nSerials = ReadCompactSize(s);
+        for (unsigned int i = 0; i < nSerials; i++) {
+            value_type serial;
+            ::Unserialize(s, serial);
+            serials.push_back(serial);
+        }
+    }
+
+private:
+    CCoinArenaRange<Codec> serials;
+};
+
+namespace sigma {
+
+struct CMintArenaCodec {
+    typedef PublicCoin value_type;
+    static const size_t size = GroupElement::affine_size + 1;
+
+    static CCoinArena& Arena();
+    static void Encode(unsigned char* record, const value_type& coin);
+    static void Decode(const unsigned char* record, value_type& coin);
+};
+
+struct CSpendArenaCodec {
+    typedef std::pair<Scalar, CSpendCoinInfo> value_type;
+    static const size_t size = Scalar::memoryRequired() + 1 + 4;
+
+    static CCoinArena& Arena();
+    static void Encode(unsigned char* record, const value_type& serial);
+    static void Decode(const unsigned char* record, value_type& serial);
+};
+
+using block_mint_container = CBlockMintedCoins<std::pair<CoinDenomination, int>, CMintArenaCodec>;
+using block_spend_container = CBlockSpentSerials<CSpendArenaCodec>;
+
+} // namespace sigma
+
+namespace lelantus {
+
+struct CMintArenaCodec {
+    typedef std::pair<PublicCoin, uint256> value_type;
+    static const size_t size = GroupElement::affine_size + 32;
+
+    static CCoinArena& Arena();
+    static void Encode(unsigned char* record, const value_type& mint);
+    static void Decode(const unsigned char* record, value_type& mint);
+};
+
+struct CSpendArenaCodec {
+    typedef std::pair<Scalar, int> value_type;
+    static const size_t size = Scalar::memoryRequired() + 4;
+
+    static CCoinArena& Arena();
+    static void Encode(unsigned char* record, const value_type& serial);
+    static void Decode(const unsigned char* record, value_type& serial);
+};
+
+using block_mint_container = CBlockMintedCoins<int, CMintArenaCodec>;
+using block_spend_container = CBlockSpentSerials<CSpendArenaCodec>;
+
+} // namespace lelantus
+
+//! Memory used by the coins and serials of the block index
+size_t CoinArenaDynamicMemoryUsage();
+
+#endif // FIRO_COIN_ARENA_H
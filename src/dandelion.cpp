@@ -0,0 +1,91 @@
+// Copyright (c) 2020 The Firo Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "dandelion.h"
+
+#include "memusage.h"
+
+#include <algorithm>
+
+CDandelionEmbargoes dandelionEmbargoes;
+
+CDandelionEmbargoes::CDandelionEmbargoes(int64_t nSlotMicrosIn, size_t nSlots)
+    : nSlotMicros(nSlotMicrosIn), vSlots(nSlots), nCurrentSlot(-1)
+{
+    assert(nSlotMicros > 0 && nSlots > 0);
+}
+
+bool CDandelionEmbargoes::Insert(const uint256& hash, int64_t nEmbargo)
+{
+    LOCK(cs);
+    if (!mapEmbargoes.emplace(hash, nEmbargo).second)
+        return false;
+
+    // embargoes which ended already are collected with the current slot
+    int64_t nSlot = std::max<int64_t>(nEmbargo / nSlotMicros, nCurrentSlot);
+    vSlots[nSlot % vSlots.size()].push_back(hash);
+    return true;
+}
+
+bool CDandelionEmbargoes::Contains(const uint256& hash) const
+{
+    LOCK(cs);
+    return mapEmbargoes.count(hash) != 0;
+}
+
+bool CDandelionEmbargoes::Remove(const uint256& hash)
+{
+    LOCK(cs);
+    return mapEmbargoes.erase(hash) != 0;
+}
+
+std::vector<uint256> CDandelionEmbargoes::PopExpired(int64_t nTime)
+{
+    LOCK(cs);
+    std::vector<uint256> result;
+
+    int64_t nSlots = vSlots.size();
+    int64_t nTargetSlot = std::max<int64_t>(nTime / nSlotMicros, nCurrentSlot);
+    // the current slot is visited again, it may hold embargoes ending later in it
+    int64_t nFirstSlot = std::max<int64_t>({nCurrentSlot, nTargetSlot - nSlots + 1, 0});
+
+    for (int64_t nSlot = nFirstSlot; nSlot <= nTargetSlot; nSlot++) {
+        std::vector<uint256>& slot = vSlots[nSlot % nSlots];
+        size_t nKept = 0;
+        for (const uint256& hash : slot) {
+            auto it = mapEmbargoes.find(hash);
+            if (it == mapEmbargoes.end())
+                continue; // removed
+            if (it->second <= nTime) {
+                result.push_back(hash);
+                mapEmbargoes.erase(it);
+                continue;
+            }
+            // wrapped around the wheel, or filed again after being removed
+            slot[nKept++] = hash;
+        }
+        if (nKept == 0)
+            std::vector<uint256>().swap(slot);
+        else
+            slot.resize(nKept);
+    }
+
+    nCurrentSlot = nTargetSlot;
+    return result;
+}
+
+size_t CDandelionEmbargoes::Size() const
+{
+    LOCK(cs);
+    return mapEmbargoes.size();
+}
+
+size_t CDandelionEmbargoes::DynamicMemoryUsage() const
+{
+    LOCK(cs);
+    size_t nUsage = memusage::DynamicUsage(mapEmbargoes) + memusage::DynamicUsage(vSlots);
+    for (const std::vector<uint256>& slot : vSlots)
+        nUsage += memusage::DynamicUsage(slot);
+    return nUsage;
+}
@@ -0,0 +1,57 @@
+// Copyright (c) 2020 The Firo Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef FIRO_DANDELION_H
+#define FIRO_DANDELION_H
+
+#include "sync.h"
+#include "saltedhasher.h"
+#include "uint256.h"
+
+#include <unordered_map>
+#include <vector>
+
+/** Width of a slot of the embargo timer wheel (microseconds) */
+static const int64_t DANDELION_EMBARGO_SLOT_MICROS = 1000000;
+/** Number of slots of the embargo timer wheel, embargoes further out wrap around */
+static const size_t DANDELION_EMBARGO_SLOTS = 256;
+
+/**
+ * Dandelion transactions which are embargoed until a time, after which they are
+ * fluffed unless they were seen in the mempool.
+ *
+ * The embargoes are looked up by hash and filed into the slots of a timer wheel by
+ * their end, so collecting the ended embargoes only visits the slots which passed
+ * since the last collection. Removed embargoes are dropped from the wheel lazily.
+ */
+class CDandelionEmbargoes
+{
+public:
+    CDandelionEmbargoes(int64_t nSlotMicros = DANDELION_EMBARGO_SLOT_MICROS, size_t nSlots = DANDELION_EMBARGO_SLOTS);
+
+    //! Embargoes the transaction until nEmbargo, false if it is embargoed already
+    bool Insert(const uint256& hash, int64_t nEmbargo);
+    bool Contains(const uint256& hash) const;
+    bool Remove(const uint256& hash);
+
+    //! Removes the embargoes which ended at nTime and returns their transactions
+    std::vector<uint256> PopExpired(int64_t nTime);
+
+    size_t Size() const;
+    size_t DynamicMemoryUsage() const;
+
+private:
+    mutable CCriticalSection cs;
+
+    const int64_t nSlotMicros;
+    std::unordered_map<uint256, int64_t, StaticSaltedHasher> mapEmbargoes;
+    std::vector<std::vector<uint256>> vSlots;
+    //! Slot up to which the ended embargoes were collected, -1 before the first collection
+    int64_t nCurrentSlot;
+};
+
+/** Embargoes of the Dandelion transactions relayed by this node */
+extern CDandelionEmbargoes dandelionEmbargoes;
+
+#endif // FIRO_DANDELION_H
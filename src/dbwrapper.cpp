@@ -15,13 +15,112 @@
 #include <memenv.h>
 #include <stdint.h>
 
-static leveldb::Options GetOptions(size_t nCacheSize)
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <sstream>
+
+namespace {
+
+/** LRU block cache counting its hits and misses */
+class CCountingCache : public leveldb::Cache
+{
+public:
+    CCountingCache(size_t capacity, dbwrapper_private::CacheCounters& counters) :
+        cache(leveldb::NewLRUCache(capacity)), counters(counters) {}
+
+    Handle* Insert(const leveldb::Slice& key, void* value, size_t charge,
+                   void (*deleter)(const leveldb::Slice& key, void* value)) override
+    {
+        return cache->Insert(key, value, charge, deleter);
+    }
+
+    Handle* Lookup(const leveldb::Slice& key) override
+    {
+        Handle* handle = cache->Lookup(key);
+        if (handle)
+            counters.nHits++;
+        else
+            counters.nMisses++;
+        return handle;
+    }
+
+    void Release(Handle* handle) override { cache->Release(handle); }
+    void* Value(Handle* handle) override { return cache->Value(handle); }
+    void Erase(const leveldb::Slice& key) override { cache->Erase(key); }
+    uint64_t NewId() override { return cache->NewId(); }
+    void Prune() override { cache->Prune(); }
+    size_t TotalCharge() const override { return cache->TotalCharge(); }
+
+private:
+    std::unique_ptr<leveldb::Cache> cache;
+    dbwrapper_private::CacheCounters& counters;
+};
+
+std::mutex cs_openDBs;
+std::set<const CDBWrapper*> setOpenDBs;
+
+/** Value of the last "<name>:<value>" entry of a multi argument for the database */
+bool GetDBArg(const std::string& strArg, const std::string& strName, int64_t& nValue)
+{
+    if (strName.empty() || !mapMultiArgs.count(strArg))
+        return false;
+
+    bool fFound = false;
+    for (const std::string& strEntry : mapMultiArgs.at(strArg)) {
+        size_t pos = strEntry.rfind(':');
+        if (pos != std::string::npos && strEntry.substr(0, pos) == strName) {
+            nValue = atoi64(strEntry.substr(pos + 1));
+            fFound = true;
+        }
+    }
+    return fFound;
+}
+
+} // namespace
+
+CDBTuning GetDBTuning(const std::string& strName, size_t nCacheSize)
+{
+    CDBTuning tuning;
+    tuning.nBlockCacheSize = nCacheSize / 2;
+    tuning.nWriteBufferSize = nCacheSize / 4; // up to two write buffers may be held in memory simultaneously
+    tuning.nMaxFileSize = leveldb::Options().max_file_size;
+
+    if (strName == "blockindex") {
+        // the address, spent and timestamp indexes are appended to with every block,
+        // fewer and larger tables keep compactions down
+        tuning.nMaxFileSize = 32 << 20;
+    }
+
+    int64_t nValue;
+    if (GetDBArg("-dbblockcache", strName, nValue))
+        tuning.nBlockCacheSize = std::max<int64_t>(nValue, 1) << 20;
+    if (GetDBArg("-dbwritebuffer", strName, nValue))
+        tuning.nWriteBufferSize = std::max<int64_t>(nValue, 1) << 20;
+    if (GetDBArg("-dbfilesize", strName, nValue))
+        tuning.nMaxFileSize = std::max<int64_t>(nValue, 1) << 20;
+
+    return tuning;
+}
+
+std::vector<CDBStats> GetDBStats()
+{
+    std::lock_guard<std::mutex> lock(cs_openDBs);
+    std::vector<CDBStats> result;
+    for (const CDBWrapper* db : setOpenDBs)
+        result.push_back(db->GetStats());
+    return result;
+}
+
+static leveldb::Options GetOptions(const CDBTuning& tuning, dbwrapper_private::CacheCounters& counters)
 {
     leveldb::Options options;
-    options.block_cache = leveldb::NewLRUCache(nCacheSize / 2);
-    options.write_buffer_size = nCacheSize / 4; // up to two write buffers may be held in memory simultaneously
+    options.block_cache = new CCountingCache(tuning.nBlockCacheSize, counters);
+    options.write_buffer_size = tuning.nWriteBufferSize;
+    options.max_file_size = tuning.nMaxFileSize;
     options.filter_policy = leveldb::NewBloomFilterPolicy(10);
-    options.compression = leveldb::kNoCompression;
+    options.compression = leveldb::kNoCompression; // the bundled leveldb is built without Snappy
     options.max_open_files = 64;
     if (leveldb::kMajorVersion > 1 || (leveldb::kMajorVersion == 1 && leveldb::kMinorVersion >= 16)) {
         // LevelDB versions before 1.16 consider short writes to be corruption. Only trigger error
@@ -31,14 +130,16 @@ static leveldb::Options GetOptions(size_t nCacheSize)
     return options;
 }
 
-CDBWrapper::CDBWrapper(const boost::filesystem::path& path, size_t nCacheSize, bool fMemory, bool fWipe, bool obfuscate)
+CDBWrapper::CDBWrapper(const boost::filesystem::path& path, size_t nCacheSize, bool fMemory, bool fWipe, bool obfuscate, const std::string& name)
+    : strName(name)
 {
     penv = NULL;
     readoptions.verify_checksums = true;
     iteroptions.verify_checksums = true;
     iteroptions.fill_cache = false;
     syncoptions.sync = true;
-    options = GetOptions(nCacheSize);
+    tuning = GetDBTuning(strName, nCacheSize);
+    options = GetOptions(tuning, cacheCounters);
     options.create_if_missing = true;
     if (fMemory) {
         penv = leveldb::NewMemEnv(leveldb::Env::Default());
@@ -55,6 +156,11 @@ CDBWrapper::CDBWrapper(const boost::filesystem::path& path, size_t nCacheSize, b
     leveldb::Status status = leveldb::DB::Open(options, path.string(), &pdb);
     dbwrapper_private::HandleError(status);
     LogPrintf("Opened LevelDB successfully\n");
+    if (!strName.empty()) {
+        LogPrintf("Tuning of %s: %.1fMiB block cache, %.1fMiB write buffer, %.1fMiB files\n", strName,
+            tuning.nBlockCacheSize * (1.0 / 1024 / 1024), tuning.nWriteBufferSize * (1.0 / 1024 / 1024),
+            tuning.nMaxFileSize * (1.0 / 1024 / 1024));
+    }
 
     // The base-case obfuscation key, which is a noop.
     obfuscate_key = std::vector<unsigned char>(OBFUSCATE_KEY_NUM_BYTES, '\000');
@@ -74,10 +180,19 @@ CDBWrapper::CDBWrapper(const boost::filesystem::path& path, size_t nCacheSize, b
     }
 
     LogPrintf("Using obfuscation key for %s: %s\n", path.string(), HexStr(obfuscate_key));
+
+    if (!strName.empty()) {
+        std::lock_guard<std::mutex> lock(cs_openDBs);
+        setOpenDBs.insert(this);
+    }
 }
 
 CDBWrapper::~CDBWrapper()
 {
+    {
+        std::lock_guard<std::mutex> lock(cs_openDBs);
+        setOpenDBs.erase(this);
+    }
     delete pdb;
     pdb = NULL;
     delete options.filter_policy;
@@ -88,6 +203,51 @@ CDBWrapper::~CDBWrapper()
     options.env = NULL;
 }
 
+CDBStats CDBWrapper::GetStats() const
+{
+    CDBStats stats;
+    stats.strName = strName;
+    stats.tuning = tuning;
+    stats.nBlockCacheUsage = options.block_cache->TotalCharge();
+    stats.nCacheHits = cacheCounters.nHits;
+    stats.nCacheMisses = cacheCounters.nMisses;
+    stats.nMemoryUsage = 0;
+    stats.dCompactionSeconds = 0;
+    stats.dCompactionReadMB = 0;
+    stats.dCompactionWriteMB = 0;
+
+    std::string strValue;
+    if (pdb->GetProperty("leveldb.approximate-memory-usage", &strValue))
+        stats.nMemoryUsage = atoi64(strValue);
+
+    for (int level = 0; ; level++) {
+        if (!pdb->GetProperty("leveldb.num-files-at-level" + std::to_string(level), &strValue))
+            break;
+        stats.vLevelFiles.push_back(atoi(strValue));
+    }
+
+    // rows of "leveldb.stats" after the three header lines are
+    // level, files, size (MB), compaction time (s), read (MB), written (MB)
+    if (pdb->GetProperty("leveldb.stats", &strValue)) {
+        std::istringstream lines(strValue);
+        std::string line;
+        for (int i = 0; std::getline(lines, line); i++) {
+            if (i < 3)
+                continue;
+            std::istringstream row(line);
+            int level, files;
+            double size, seconds, read, written;
+            if (row >> level >> files >> size >> seconds >> read >> written) {
+                stats.dCompactionSeconds += seconds;
+                stats.dCompactionReadMB += read;
+                stats.dCompactionWriteMB += written;
+            }
+        }
+    }
+
+    return stats;
+}
+
 bool CDBWrapper::WriteBatch(CDBBatch& batch, bool fSync)
 {
     leveldb::Status status = pdb->Write(fSync ? syncoptions : writeoptions, &batch.batch);
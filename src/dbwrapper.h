@@ -17,9 +17,54 @@
 #include <leveldb/db.h>
 #include <leveldb/write_batch.h>
 
+#include <atomic>
+#include <string>
+#include <vector>
+
 static const size_t DBWRAPPER_PREALLOC_KEY_SIZE = 64;
 static const size_t DBWRAPPER_PREALLOC_VALUE_SIZE = 1024;
 
+/**
+ * LevelDB tuning of a database. The cache budget of the database is split between
+ * the block cache and the write buffers, up to two of which are held in memory.
+ */
+struct CDBTuning
+{
+    size_t nBlockCacheSize;
+    size_t nWriteBufferSize;
+    //! Size of the table files written by compactions
+    size_t nMaxFileSize;
+};
+
+/**
+ * Tuning of the database strName given nCacheSize bytes of cache: the built in profile
+ * of the database with the -dbblockcache, -dbwritebuffer and -dbfilesize overrides for
+ * it applied.
+ */
+CDBTuning GetDBTuning(const std::string& strName, size_t nCacheSize);
+
+/** Statistics of an open database, see GetDBStats() */
+struct CDBStats
+{
+    std::string strName;
+    CDBTuning tuning;
+    size_t nBlockCacheUsage;
+    //! Lookups of the block cache which found the block
+    uint64_t nCacheHits;
+    uint64_t nCacheMisses;
+    //! Block cache and memtables, as estimated by leveldb
+    uint64_t nMemoryUsage;
+    //! Table files per level
+    std::vector<int> vLevelFiles;
+    //! Time spent compacting and data read and written by compactions, over all levels
+    double dCompactionSeconds;
+    double dCompactionReadMB;
+    double dCompactionWriteMB;
+};
+
+/** Statistics of the open named databases */
+std::vector<CDBStats> GetDBStats();
+
 class dbwrapper_error : public std::runtime_error
 {
 public:
@@ -42,6 +87,13 @@ void HandleError(const leveldb::Status& status);
  */
 const std::vector<unsigned char>& GetObfuscateKey(const CDBWrapper &w);
 
+/** Lookups of the block cache of a database */
+struct CacheCounters
+{
+    std::atomic<uint64_t> nHits{0};
+    std::atomic<uint64_t> nMisses{0};
+};
+
 };
 
 /** Batch of changes queued to be written to a CDBWrapper */
@@ -225,6 +277,15 @@ private:
     //! the database itself
     leveldb::DB* pdb;
 
+    //! name the database is tuned and reported by, empty for unnamed databases
+    std::string strName;
+
+    //! tuning the database was opened with
+    CDBTuning tuning;
+
+    //! lookups of the block cache
+    dbwrapper_private::CacheCounters cacheCounters;
+
     //! a key used for optional XOR-obfuscation of the database
     std::vector<unsigned char> obfuscate_key;
 
@@ -244,10 +305,14 @@ public:
      * @param[in] fWipe       If true, remove all existing data.
      * @param[in] obfuscate   If true, store data obfuscated via simple XOR. If false, XOR
      *                        with a zero'd byte array.
+     * @param[in] name        Selects the tuning profile, named databases are listed by GetDBStats().
      */
-    CDBWrapper(const boost::filesystem::path& path, size_t nCacheSize, bool fMemory = false, bool fWipe = false, bool obfuscate = false);
+    CDBWrapper(const boost::filesystem::path& path, size_t nCacheSize, bool fMemory = false, bool fWipe = false, bool obfuscate = false, const std::string& name = "");
     ~CDBWrapper();
 
+    const std::string& GetName() const { return strName; }
+    CDBStats GetStats() const;
+
     template <typename K>
     bool ReadDataStream(const K& key, CDataStream& ssValue) const
     {
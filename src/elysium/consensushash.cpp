@@ -286,7 +286,7 @@ uint256 GetMetaDExHash(const uint32_t propertyId)
 
     std::vector<std::pair<arith_uint256, std::string> > vecMetaDExTrades;
     for (md_PropertiesMap::const_iterator my_it = metadex.begin(); my_it != metadex.end(); ++my_it) {
-        if (propertyId == 0 || propertyId == my_it->first) {
+        if (propertyId == 0 || propertyId == my_it->first.first) {
             const md_PricesMap& prices = my_it->second;
             for (md_PricesMap::const_iterator it = prices.begin(); it != prices.end(); ++it) {
                 const md_Set& indexes = it->second;
@@ -30,9 +30,12 @@
 
 #include "../base58.h"
 #include "../chainparams.h"
+#include "../clientversion.h"
 #include "../wallet/coincontrol.h"
 #include "../coins.h"
 #include "../core_io.h"
+#include "../ctpl.h"
+#include "../hash.h"
 #include "../init.h"
 #include "../validation.h"
 #include "../net.h"
@@ -40,6 +43,8 @@
 #include "../primitives/transaction.h"
 #include "../script/script.h"
 #include "../script/standard.h"
+#include "../serialize.h"
+#include "../streams.h"
 #include "../sync.h"
 #include "../tinyformat.h"
 #include "../uint256.h"
@@ -64,16 +69,20 @@
 #include <openssl/sha.h>
 
 #include "leveldb/db.h"
+#include "leveldb/write_batch.h"
 
 #include <assert.h>
 #include <stdint.h>
 #include <stdio.h>
 
+#include <deque>
 #include <fstream>
+#include <future>
 #include <map>
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 using boost::algorithm::token_compress_on;
@@ -117,7 +126,15 @@ bool autoCommit = true;
 //! Number of "Dev ELYSIUM" of the last processed block
 static int64_t elysium_prev = 0;
 
-static boost::filesystem::path MPPersistencePath;
+//! Directory of the persisted state files
+boost::filesystem::path MPPersistencePath;
+
+//! Block of the most recent balance snapshot, which the next balance delta is based on
+static uint256 lastBalanceSnapshot;
+//! Number of balance deltas written on top of the most recent full balance snapshot
+static int nBalanceDeltas = 0;
+//! Addresses with balance changes since the most recent balance snapshot
+static std::unordered_set<std::string> dirtyTallies;
 
 static int elysiumInitialized = 0;
 
@@ -488,6 +505,7 @@ bool elysium::update_tally_map(const std::string& who, uint32_t propertyId, int6
 
     CMPTally& tally = my_it->second;
     bRet = tally.updateMoney(propertyId, amount, ttype);
+    if (bRet) dirtyTallies.insert(who);
 
     after = getMPbalance(who, propertyId, ttype);
     if (!bRet) {
@@ -1125,12 +1143,49 @@ public:
     }
 };
 
+/** A block read by the initial scan, along with the transactions, which may carry packets. */
+struct CScannedBlock
+{
+    CBlock block;
+    std::vector<unsigned> candidates;
+    bool fRead;
+
+    CScannedBlock() : fRead(false) {}
+};
+
+/**
+ * Reads a block from disk and prefilters its transactions.
+ *
+ * Only the height independent marker checks are done, which don't touch any
+ * state, so this can be run from worker threads in parallel.
+ */
+static CScannedBlock ReadAndClassifyBlock(const CBlockIndex* pblockindex)
+{
+    CScannedBlock scanned;
+
+    if (!ReadBlockFromDisk(scanned.block, pblockindex, Params().GetConsensus())) {
+        return scanned;
+    }
+    scanned.fRead = true;
+
+    for (unsigned i = 0; i < scanned.block.vtx.size(); i++) {
+        if (MayHavePacket(*scanned.block.vtx[i])) {
+            scanned.candidates.push_back(i);
+        }
+    }
+
+    return scanned;
+}
+
 /**
  * Scans the blockchain for meta transactions.
  *
  * It scans the blockchain, starting at the given block index, to the current
  * tip, much like as if new block were arriving and being processed on the fly.
  *
+ * Blocks are read and prefiltered ahead of time by a pool of worker threads, and
+ * only the transactions, which may carry packets, are processed in order.
+ *
  * Every 30 seconds the progress of the scan is reported.
  *
  * In case the current block being processed is not part of the active chain, or
@@ -1159,6 +1214,20 @@ static int elysium_initial_scan(int nFirstBlock)
     // used to print the progress to the console and notifies the UI
     ProgressReporter progressReporter(chainActive[nFirstBlock], chainActive[nLastBlock]);
 
+    int nThreads = GetArg("-elysiumscanthreads", DEFAULT_ELYSIUM_SCAN_THREADS);
+    if (nThreads <= 0) {
+        nThreads = std::max(GetNumCores(), 1);
+    }
+
+    // blocks are read ahead and prefiltered by the pool, while the chain can't change,
+    // because cs_main is held by the caller for the whole scan
+    ctpl::thread_pool workerPool(nThreads);
+    RenameThreadPool(workerPool, "elysium-scan");
+
+    const size_t nMaxPrefetch = nThreads * ELYSIUM_SCAN_PREFETCH_PER_THREAD;
+    std::deque<std::future<CScannedBlock>> prefetched;
+    int nNextBlock = nFirstBlock;
+
     for (nBlock = nFirstBlock; nBlock <= nLastBlock; ++nBlock)
     {
         if (ShutdownRequested()) {
@@ -1166,8 +1235,19 @@ static int elysium_initial_scan(int nFirstBlock)
             break;
         }
 
+        while (prefetched.size() < nMaxPrefetch && nNextBlock <= nLastBlock) {
+            const CBlockIndex* pnext = chainActive[nNextBlock++];
+            if (NULL == pnext) {
+                nNextBlock = nLastBlock + 1;
+                break;
+            }
+            prefetched.push_back(workerPool.push([pnext](int) {
+                return ReadAndClassifyBlock(pnext);
+            }));
+        }
+
         CBlockIndex* pblockindex = chainActive[nBlock];
-        if (NULL == pblockindex) break;
+        if (NULL == pblockindex || prefetched.empty()) break;
         std::string strBlockHash = pblockindex->GetBlockHash().GetHex();
 
         if (elysium_debug_ely) PrintToLog("%s(%d; max=%d):%s, line %d, file: %s\n",
@@ -1179,18 +1259,21 @@ static int elysium_initial_scan(int nFirstBlock)
         }
 
         // Get block to parse.
-        CBlock block;
+        CScannedBlock scanned = prefetched.front().get();
+        prefetched.pop_front();
 
-        if (!ReadBlockFromDisk(block, pblockindex, Params().GetConsensus())) {
+        if (!scanned.fRead) {
             break;
         }
 
+        const CBlock& block = scanned.block;
+
         // Parse block.
         unsigned parsed = 0;
 
         elysium_handler_block_begin(nBlock, pblockindex);
 
-        for (unsigned i = 0; i < block.vtx.size(); i++) {
+        for (unsigned i : scanned.candidates) {
             if (elysium_handler_tx(*block.vtx[i], nBlock, i, pblockindex)) {
                 parsed++;
             }
@@ -1203,6 +1286,9 @@ static int elysium_initial_scan(int nFirstBlock)
         nTxsTotal += block.vtx.size();
     }
 
+    workerPool.clear_queue();
+    workerPool.stop(true);
+
     if (nBlock < nLastBlock) {
         PrintToLog("Scan stopped early at block %d of block %d\n", nBlock, nLastBlock);
     }
@@ -1420,6 +1506,9 @@ int input_mp_mdexorder_string(const std::string& s)
     return 0;
 }
 
+/**
+ * Loads a legacy text state file, as written by earlier versions.
+ */
 static int elysium_file_load(const string &filename, int what, bool verifyHash = false)
 {
   int lines = 0;
@@ -1544,6 +1633,300 @@ static char const * const statePrefix[NUM_FILETYPES] = {
     "mdexorders",
 };
 
+//! Version of the binary state file format
+static const int STATE_FILE_VERSION = 1;
+
+//! Kinds of binary state files
+enum StateFileKind : uint8_t {
+    //! The file contains the complete state
+    STATE_FILE_FULL = 0,
+    //! The file contains the balances changed since the previous block's snapshot
+    STATE_FILE_DELTA = 1,
+};
+
+/** Header of a binary state file. */
+struct CStateFileHeader
+{
+    int nVersion;
+    uint8_t nKind;
+    //! Block of the snapshot a delta is applied on top of, null for full snapshots
+    uint256 baseBlock;
+
+    CStateFileHeader() : nVersion(STATE_FILE_VERSION), nKind(STATE_FILE_FULL) {}
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream, typename Operation>
+    inline void SerializationOp(Stream& s, Operation ser_action) {
+        READWRITE(nVersion);
+        READWRITE(nKind);
+        READWRITE(baseBlock);
+    }
+};
+
+/** Balances of a single property, as stored in binary state files. */
+struct CPersistedBalance
+{
+    uint32_t propertyId;
+    int64_t balance;
+    int64_t sellReserved;
+    int64_t acceptReserved;
+    int64_t metadexReserved;
+
+    CPersistedBalance() : propertyId(0), balance(0), sellReserved(0), acceptReserved(0), metadexReserved(0) {}
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream, typename Operation>
+    inline void SerializationOp(Stream& s, Operation ser_action) {
+        READWRITE(propertyId);
+        READWRITE(balance);
+        READWRITE(sellReserved);
+        READWRITE(acceptReserved);
+        READWRITE(metadexReserved);
+    }
+};
+
+static boost::filesystem::path state_file_path(const uint256& blockHash, int what, const char* extension)
+{
+    return MPPersistencePath / strprintf("%s-%s.%s", statePrefix[what], blockHash.ToString(), extension);
+}
+
+static std::vector<CPersistedBalance> get_persisted_balances(CMPTally& tally)
+{
+    std::vector<CPersistedBalance> balances;
+
+    tally.init();
+    uint32_t propertyId = 0;
+    while (0 != (propertyId = tally.next())) {
+        CPersistedBalance entry;
+        entry.propertyId = propertyId;
+        entry.balance = tally.getMoney(propertyId, BALANCE);
+        entry.sellReserved = tally.getMoney(propertyId, SELLOFFER_RESERVE);
+        entry.acceptReserved = tally.getMoney(propertyId, ACCEPT_RESERVE);
+        entry.metadexReserved = tally.getMoney(propertyId, METADEX_RESERVE);
+
+        // we don't allow 0 balances to read in, so if we don't write them
+        // it makes things match up better between persisted state and processed state
+        if (0 == entry.balance && 0 == entry.sellReserved && 0 == entry.acceptReserved && 0 == entry.metadexReserved) {
+            continue;
+        }
+
+        balances.push_back(entry);
+    }
+
+    return balances;
+}
+
+static void set_persisted_balances(const std::string& address, const std::vector<CPersistedBalance>& balances)
+{
+    // replace the whole tally, an empty set of balances removes the address
+    mp_tally_map.erase(address);
+    if (balances.empty()) {
+        return;
+    }
+
+    CMPTally& tally = mp_tally_map[address];
+    for (const CPersistedBalance& entry : balances) {
+        if (entry.balance) tally.updateMoney(entry.propertyId, entry.balance, BALANCE);
+        if (entry.sellReserved) tally.updateMoney(entry.propertyId, entry.sellReserved, SELLOFFER_RESERVE);
+        if (entry.acceptReserved) tally.updateMoney(entry.propertyId, entry.acceptReserved, ACCEPT_RESERVE);
+        if (entry.metadexReserved) tally.updateMoney(entry.propertyId, entry.metadexReserved, METADEX_RESERVE);
+    }
+}
+
+template <typename Stream>
+static void read_elysium_balances(Stream& reader)
+{
+    bool fMore = false;
+    reader >> fMore;
+    while (fMore) {
+        std::string address;
+        std::vector<CPersistedBalance> balances;
+        reader >> address >> balances;
+        set_persisted_balances(address, balances);
+        reader >> fMore;
+    }
+}
+
+template <typename Stream>
+static bool read_mp_metadex(Stream& reader)
+{
+    metadex.clear();
+
+    uint64_t nOrders = ReadCompactSize(reader);
+    for (uint64_t i = 0; i < nOrders; ++i) {
+        CMPMetaDEx order;
+        reader >> order;
+        if (!MetaDEx_INSERT(order)) return false;
+    }
+
+    return true;
+}
+
+static bool read_state_header(const uint256& blockHash, int what, CStateFileHeader& header)
+{
+    CAutoFile file(fopen(state_file_path(blockHash, what, "bin").string().c_str(), "rb"), SER_DISK, CLIENT_VERSION);
+    if (file.IsNull()) {
+        return false;
+    }
+
+    try {
+        file >> header;
+    } catch (const std::exception&) {
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Loads a binary state file as of the given block and verifies its checksum.
+ *
+ * Balance deltas are applied on top of the snapshot of the previous block, which
+ * is loaded first.
+ *
+ * @return The number of balance deltas applied on top of a full snapshot, or -1 on failure
+ */
+static int elysium_state_load(const uint256& blockHash, int what, int depth = 0)
+{
+    const std::string strFile = state_file_path(blockHash, what, "bin").string();
+
+    if (elysium_debug_persistence) {
+        PrintToLog("%s(%s), line %d, file: %s\n", __FUNCTION__, strFile, __LINE__, __FILE__);
+    }
+
+    CAutoFile file(fopen(strFile.c_str(), "rb"), SER_DISK, CLIENT_VERSION);
+    if (file.IsNull()) {
+        if (elysium_debug_persistence) PrintToLog("%s(%s): file not found\n", __FUNCTION__, strFile);
+        return -1;
+    }
+
+    int res = 0;
+    CHashVerifier<CAutoFile> verifier(&file);
+
+    try {
+        CStateFileHeader header;
+        verifier >> header;
+
+        if (header.nVersion != STATE_FILE_VERSION) {
+            PrintToLog("%s(%s): unsupported state file version %d\n", __FUNCTION__, strFile, header.nVersion);
+            return -1;
+        }
+
+        if (header.nKind == STATE_FILE_DELTA) {
+            if (what != FILETYPE_BALANCES || depth >= MAX_STATE_HISTORY) {
+                return -1;
+            }
+            res = elysium_state_load(header.baseBlock, what, depth + 1);
+            if (res < 0) {
+                return -1;
+            }
+            ++res;
+        } else if (header.nKind == STATE_FILE_FULL) {
+            if (what == FILETYPE_BALANCES) mp_tally_map.clear();
+        } else {
+            return -1;
+        }
+
+        switch (what) {
+        case FILETYPE_BALANCES:
+            read_elysium_balances(verifier);
+            break;
+
+        case FILETYPE_OFFERS:
+            verifier >> my_offers;
+            break;
+
+        case FILETYPE_ACCEPTS:
+            verifier >> my_accepts;
+            break;
+
+        case FILETYPE_GLOBALS:
+        {
+            int64_t elysiumPrev = 0;
+            uint32_t nextSPID = 0;
+            uint32_t nextTestSPID = 0;
+            verifier >> elysiumPrev >> nextSPID >> nextTestSPID;
+
+            elysium_prev = elysiumPrev;
+            _my_sps->init(nextSPID, nextTestSPID);
+            break;
+        }
+
+        case FILETYPE_CROWDSALES:
+            verifier >> my_crowds;
+            break;
+
+        case FILETYPE_MDEXORDERS:
+            if (!read_mp_metadex(verifier)) {
+                res = -1;
+            }
+            break;
+
+        default:
+            return -1;
+        }
+
+        uint256 hashChecksum;
+        file >> hashChecksum;
+
+        if (res >= 0 && hashChecksum != verifier.GetHash()) {
+            PrintToLog("File %s loaded, but failed hash validation!\n", strFile);
+            res = -1;
+        }
+    } catch (const std::exception& e) {
+        PrintToLog("%s(%s): deserialize or I/O error - %s\n", __FUNCTION__, strFile, e.what());
+        return -1;
+    }
+
+    PrintToLog("%s(%s), res= %d\n", __FUNCTION__, strFile, res);
+
+    return res;
+}
+
+/**
+ * Loads the persisted state as of the given block.
+ *
+ * Binary state files are preferred, legacy text files are used as fallback.
+ */
+bool elysium_load_state(CBlockIndex const *pBlockIndex)
+{
+    const uint256& blockHash = pBlockIndex->GetBlockHash();
+
+    // the next balance snapshot is only written as delta, if the loaded state is binary
+    lastBalanceSnapshot.SetNull();
+    nBalanceDeltas = 0;
+
+    if (boost::filesystem::exists(state_file_path(blockHash, FILETYPE_BALANCES, "bin"))) {
+        int nDeltas = 0;
+        for (int i = 0; i < NUM_FILETYPES; ++i) {
+            int res = elysium_state_load(blockHash, i);
+            if (res < 0) {
+                return false;
+            }
+            if (i == FILETYPE_BALANCES) {
+                nDeltas = res;
+            }
+        }
+
+        lastBalanceSnapshot = blockHash;
+        nBalanceDeltas = nDeltas;
+        dirtyTallies.clear();
+        return true;
+    }
+
+    for (int i = 0; i < NUM_FILETYPES; ++i) {
+        const std::string strFile = state_file_path(blockHash, i, "dat").string();
+        if (elysium_file_load(strFile, i, true) < 0) {
+            return false;
+        }
+    }
+
+    dirtyTallies.clear();
+    return true;
+}
+
 // returns the height of the state loaded
 static int load_most_relevant_state()
 {
@@ -1591,7 +1974,7 @@ static int load_most_relevant_state()
     std::vector<std::string> vstr;
     boost::split(vstr, fName, boost::is_any_of("-."), token_compress_on);
     if (  vstr.size() == 3 &&
-          boost::equals(vstr[2], "dat")) {
+          (boost::equals(vstr[2], "bin") || boost::equals(vstr[2], "dat"))) {
       uint256 blockHash;
       blockHash.SetHex(vstr[1]);
       CBlockIndex *pBlockIndex = GetBlockIndex(blockHash);
@@ -1612,24 +1995,14 @@ static int load_most_relevant_state()
   int abortRollBackBlock;
   if (curTip != NULL) abortRollBackBlock = curTip->nHeight - (MAX_STATE_HISTORY+1);
   while (NULL != curTip && persistedBlocks.size() > 0 && curTip->nHeight > abortRollBackBlock) {
-    if (persistedBlocks.find(spBlockIndex->GetBlockHash()) != persistedBlocks.end()) {
-      int success = -1;
-      for (int i = 0; i < NUM_FILETYPES; ++i) {
-        boost::filesystem::path path = MPPersistencePath / strprintf("%s-%s.dat", statePrefix[i], curTip->GetBlockHash().ToString());
-        const std::string strFile = path.string();
-        success = elysium_file_load(strFile, i, true);
-        if (success < 0) {
-          break;
-        }
-      }
-
-      if (success >= 0) {
+    if (persistedBlocks.find(curTip->GetBlockHash()) != persistedBlocks.end()) {
+      if (elysium_load_state(curTip)) {
         res = curTip->nHeight;
         break;
       }
 
       // remove this from the persistedBlock Set
-      persistedBlocks.erase(spBlockIndex->GetBlockHash());
+      persistedBlocks.erase(curTip->GetBlockHash());
     }
 
     // go to the previous block
@@ -1652,177 +2025,127 @@ static int load_most_relevant_state()
   return res;
 }
 
-static int write_elysium_balances(std::ofstream& file, SHA256_CTX* shaCtx)
+template <typename Stream>
+static void write_elysium_balances(Stream& writer)
 {
-    std::unordered_map<std::string, CMPTally>::iterator iter;
-    for (iter = mp_tally_map.begin(); iter != mp_tally_map.end(); ++iter) {
-        bool emptyWallet = true;
-
-        std::string lineOut = (*iter).first;
-        lineOut.append("=");
-        CMPTally& curAddr = (*iter).second;
-        curAddr.init();
-        uint32_t propertyId = 0;
-        while (0 != (propertyId = curAddr.next())) {
-            int64_t balance = (*iter).second.getMoney(propertyId, BALANCE);
-            int64_t sellReserved = (*iter).second.getMoney(propertyId, SELLOFFER_RESERVE);
-            int64_t acceptReserved = (*iter).second.getMoney(propertyId, ACCEPT_RESERVE);
-            int64_t metadexReserved = (*iter).second.getMoney(propertyId, METADEX_RESERVE);
-
-            // we don't allow 0 balances to read in, so if we don't write them
-            // it makes things match up better between persisted state and processed state
-            if (0 == balance && 0 == sellReserved && 0 == acceptReserved && 0 == metadexReserved) {
-                continue;
-            }
-
-            emptyWallet = false;
-
-            lineOut.append(strprintf("%d:%d,%d,%d,%d;",
-                    propertyId,
-                    balance,
-                    sellReserved,
-                    acceptReserved,
-                    metadexReserved));
+    for (std::unordered_map<std::string, CMPTally>::iterator iter = mp_tally_map.begin(); iter != mp_tally_map.end(); ++iter) {
+        std::vector<CPersistedBalance> balances = get_persisted_balances(iter->second);
+        if (balances.empty()) {
+            continue;
         }
 
-        if (false == emptyWallet) {
-            // add the line to the hash
-            SHA256_Update(shaCtx, lineOut.c_str(), lineOut.length());
-
-            // write the line
-            file << lineOut << endl;
-        }
+        writer << true << iter->first << balances;
     }
 
-    return 0;
+    writer << false;
 }
 
-static int write_mp_offers(ofstream &file, SHA256_CTX *shaCtx)
+template <typename Stream>
+static void write_elysium_balance_delta(Stream& writer)
 {
-  OfferMap::const_iterator iter;
-  for (iter = my_offers.begin(); iter != my_offers.end(); ++iter) {
-    // decompose the key for address
-    std::vector<std::string> vstr;
-    boost::split(vstr, (*iter).first, boost::is_any_of("-"), token_compress_on);
-    CMPOffer const &offer = (*iter).second;
-    offer.saveOffer(file, shaCtx, vstr[0]);
-  }
+    for (std::unordered_set<std::string>::const_iterator iter = dirtyTallies.begin(); iter != dirtyTallies.end(); ++iter) {
+        std::vector<CPersistedBalance> balances;
 
+        std::unordered_map<std::string, CMPTally>::iterator my_it = mp_tally_map.find(*iter);
+        if (my_it != mp_tally_map.end()) {
+            balances = get_persisted_balances(my_it->second);
+        }
 
-  return 0;
-}
-
-static int write_mp_metadex(ofstream &file, SHA256_CTX *shaCtx)
-{
-  for (md_PropertiesMap::iterator my_it = metadex.begin(); my_it != metadex.end(); ++my_it)
-  {
-    md_PricesMap & prices = my_it->second;
-    for (md_PricesMap::iterator it = prices.begin(); it != prices.end(); ++it)
-    {
-      md_Set & indexes = (it->second);
-      for (md_Set::iterator it = indexes.begin(); it != indexes.end(); ++it)
-      {
-        CMPMetaDEx meta = *it;
-        meta.saveOffer(file, shaCtx);
-      }
+        // an empty set of balances removes the address when loading
+        writer << true << *iter << balances;
     }
-  }
 
-  return 0;
+    writer << false;
 }
 
-static int write_mp_accepts(ofstream &file, SHA256_CTX *shaCtx)
+template <typename Stream>
+static void write_mp_metadex(Stream& writer)
 {
-  AcceptMap::const_iterator iter;
-  for (iter = my_accepts.begin(); iter != my_accepts.end(); ++iter) {
-    // decompose the key for address
-    std::vector<std::string> vstr;
-    boost::split(vstr, (*iter).first, boost::is_any_of("-+"), token_compress_on);
-    CMPAccept const &accept = (*iter).second;
-    accept.saveAccept(file, shaCtx, vstr[0], vstr[1]);
-  }
-
-  return 0;
-}
-
-static int write_globals_state(ofstream &file, SHA256_CTX *shaCtx)
-{
-  unsigned int nextSPID = _my_sps->peekNextSPID(ELYSIUM_PROPERTY_ELYSIUM);
-  unsigned int nextTestSPID = _my_sps->peekNextSPID(ELYSIUM_PROPERTY_TELYSIUM);
-  std::string lineOut = strprintf("%d,%d,%d",
-    elysium_prev,
-    nextSPID,
-    nextTestSPID);
-
-  // add the line to the hash
-  SHA256_Update(shaCtx, lineOut.c_str(), lineOut.length());
+    uint64_t nOrders = 0;
+    for (md_PropertiesMap::const_iterator my_it = metadex.begin(); my_it != metadex.end(); ++my_it) {
+        for (md_PricesMap::const_iterator it = my_it->second.begin(); it != my_it->second.end(); ++it) {
+            nOrders += it->second.size();
+        }
+    }
 
-  // write the line
-  file << lineOut << endl;
+    WriteCompactSize(writer, nOrders);
 
-  return 0;
+    for (md_PropertiesMap::const_iterator my_it = metadex.begin(); my_it != metadex.end(); ++my_it) {
+        for (md_PricesMap::const_iterator it = my_it->second.begin(); it != my_it->second.end(); ++it) {
+            for (md_Set::const_iterator order = it->second.begin(); order != it->second.end(); ++order) {
+                writer << *order;
+            }
+        }
+    }
 }
 
-static int write_mp_crowdsales(std::ofstream& file, SHA256_CTX* shaCtx)
+template <typename Stream>
+static void write_globals_state(Stream& writer)
 {
-    for (CrowdMap::const_iterator it = my_crowds.begin(); it != my_crowds.end(); ++it) {
-        // decompose the key for address
-        const CMPCrowd& crowd = it->second;
-        crowd.saveCrowdSale(file, shaCtx, it->first);
-    }
+    uint32_t nextSPID = _my_sps->peekNextSPID(ELYSIUM_PROPERTY_ELYSIUM);
+    uint32_t nextTestSPID = _my_sps->peekNextSPID(ELYSIUM_PROPERTY_TELYSIUM);
 
-    return 0;
+    writer << elysium_prev << nextSPID << nextTestSPID;
 }
 
-static int write_state_file( CBlockIndex const *pBlockIndex, int what )
+static bool write_state_file( CBlockIndex const *pBlockIndex, int what, bool fDelta = false )
 {
-  boost::filesystem::path path = MPPersistencePath / strprintf("%s-%s.dat", statePrefix[what], pBlockIndex->GetBlockHash().ToString());
-  const std::string strFile = path.string();
+  const std::string strFile = state_file_path(pBlockIndex->GetBlockHash(), what, "bin").string();
 
-  std::ofstream file;
-  file.open(strFile.c_str());
+  CAutoFile file(fopen(strFile.c_str(), "wb"), SER_DISK, CLIENT_VERSION);
+  if (file.IsNull()) {
+    PrintToLog("%s(%s): failed to open file\n", __FUNCTION__, strFile);
+    return false;
+  }
 
-  SHA256_CTX shaCtx;
-  SHA256_Init(&shaCtx);
+  try {
+    CHashedSourceWriter<CAutoFile> writer(&file);
 
-  int result = 0;
+    CStateFileHeader header;
+    if (fDelta) {
+      header.nKind = STATE_FILE_DELTA;
+      header.baseBlock = lastBalanceSnapshot;
+    }
+    writer << header;
 
-  switch(what) {
-  case FILETYPE_BALANCES:
-    result = write_elysium_balances(file, &shaCtx);
-    break;
+    switch(what) {
+    case FILETYPE_BALANCES:
+      if (fDelta) {
+        write_elysium_balance_delta(writer);
+      } else {
+        write_elysium_balances(writer);
+      }
+      break;
 
-  case FILETYPE_OFFERS:
-    result = write_mp_offers(file, &shaCtx);
-    break;
+    case FILETYPE_OFFERS:
+      writer << my_offers;
+      break;
 
-  case FILETYPE_ACCEPTS:
-    result = write_mp_accepts(file, &shaCtx);
-    break;
+    case FILETYPE_ACCEPTS:
+      writer << my_accepts;
+      break;
 
-  case FILETYPE_GLOBALS:
-    result = write_globals_state(file, &shaCtx);
-    break;
+    case FILETYPE_GLOBALS:
+      write_globals_state(writer);
+      break;
 
-  case FILETYPE_CROWDSALES:
-      result = write_mp_crowdsales(file, &shaCtx);
+    case FILETYPE_CROWDSALES:
+      writer << my_crowds;
       break;
 
-  case FILETYPE_MDEXORDERS:
-      result = write_mp_metadex(file, &shaCtx);
+    case FILETYPE_MDEXORDERS:
+      write_mp_metadex(writer);
       break;
-  }
+    }
 
-  // generate and wite the double hash of all the contents written
-  uint256 hash1;
-  SHA256_Final((unsigned char*)&hash1, &shaCtx);
-  uint256 hash2;
-  SHA256((unsigned char*)&hash1, sizeof(hash1), (unsigned char*)&hash2);
-  file << "!" << hash2.ToString() << endl;
+    // append the double hash of all the contents written
+    file << writer.GetHash();
+  } catch (const std::exception& e) {
+    PrintToLog("%s(%s): I/O error - %s\n", __FUNCTION__, strFile, e.what());
+    return false;
+  }
 
-  file.flush();
-  file.close();
-  return result;
+  return true;
 }
 
 static bool is_state_prefix( std::string const &str )
@@ -1855,7 +2178,7 @@ static void prune_state_files( CBlockIndex const *topIndex )
     boost::split(vstr, fName, boost::is_any_of("-."), token_compress_on);
     if (  vstr.size() == 3 &&
           is_state_prefix(vstr[0]) &&
-          boost::equals(vstr[2], "dat")) {
+          (boost::equals(vstr[2], "bin") || boost::equals(vstr[2], "dat"))) {
       uint256 blockHash;
       blockHash.SetHex(vstr[1]);
       statefulBlockHashes.insert(blockHash);
@@ -1865,6 +2188,8 @@ static void prune_state_files( CBlockIndex const *topIndex )
   }
 
   // for each blockHash in the set, determine the distance from the given block
+  std::set<uint256> staleBlockHashes;
+  std::set<uint256> keptBlockHashes;
   std::set<uint256>::const_iterator iter;
   for (iter = statefulBlockHashes.begin(); iter != statefulBlockHashes.end(); ++iter) {
     // look up the CBlockIndex for height info
@@ -1880,26 +2205,58 @@ static void prune_state_files( CBlockIndex const *topIndex )
         PrintToLog("State from Block:%s is no longer need, removing files (not in index)\n", (*iter).ToString());
       }
      }
+      staleBlockHashes.insert(*iter);
+    } else {
+      keptBlockHashes.insert(*iter);
+    }
+  }
 
-      // destroy the associated files!
-      std::string strBlockHash = iter->ToString();
-      for (int i = 0; i < NUM_FILETYPES; ++i) {
-        boost::filesystem::path path = MPPersistencePath / strprintf("%s-%s.dat", statePrefix[i], strBlockHash);
-        boost::filesystem::remove(path);
+  // balance deltas of the remaining state still need the snapshots they are based on
+  for (iter = keptBlockHashes.begin(); iter != keptBlockHashes.end(); ++iter) {
+    CStateFileHeader header;
+    uint256 blockHash = *iter;
+    while (read_state_header(blockHash, FILETYPE_BALANCES, header) && header.nKind == STATE_FILE_DELTA) {
+      blockHash = header.baseBlock;
+      if (staleBlockHashes.erase(blockHash) == 0) {
+        break;
       }
     }
   }
+
+  for (iter = staleBlockHashes.begin(); iter != staleBlockHashes.end(); ++iter) {
+    // destroy the associated files!
+    for (int i = 0; i < NUM_FILETYPES; ++i) {
+      boost::filesystem::remove(state_file_path(*iter, i, "bin"));
+      boost::filesystem::remove(state_file_path(*iter, i, "dat"));
+    }
+  }
 }
 
 int elysium_save_state( CBlockIndex const *pBlockIndex )
 {
+    // balances are written as delta, if they can be based on the snapshot of the previous block
+    bool fDelta = !lastBalanceSnapshot.IsNull() &&
+            nBalanceDeltas < MAX_STATE_DELTAS &&
+            pBlockIndex->pprev != NULL &&
+            pBlockIndex->pprev->GetBlockHash() == lastBalanceSnapshot;
+
     // write the new state as of the given block
-    write_state_file(pBlockIndex, FILETYPE_BALANCES);
-    write_state_file(pBlockIndex, FILETYPE_OFFERS);
-    write_state_file(pBlockIndex, FILETYPE_ACCEPTS);
-    write_state_file(pBlockIndex, FILETYPE_GLOBALS);
-    write_state_file(pBlockIndex, FILETYPE_CROWDSALES);
-    write_state_file(pBlockIndex, FILETYPE_MDEXORDERS);
+    bool fSuccess = write_state_file(pBlockIndex, FILETYPE_BALANCES, fDelta);
+    fSuccess &= write_state_file(pBlockIndex, FILETYPE_OFFERS);
+    fSuccess &= write_state_file(pBlockIndex, FILETYPE_ACCEPTS);
+    fSuccess &= write_state_file(pBlockIndex, FILETYPE_GLOBALS);
+    fSuccess &= write_state_file(pBlockIndex, FILETYPE_CROWDSALES);
+    fSuccess &= write_state_file(pBlockIndex, FILETYPE_MDEXORDERS);
+
+    if (fSuccess) {
+        lastBalanceSnapshot = pBlockIndex->GetBlockHash();
+        nBalanceDeltas = fDelta ? nBalanceDeltas + 1 : 0;
+    } else {
+        // start over with a full snapshot
+        lastBalanceSnapshot.SetNull();
+        nBalanceDeltas = 0;
+    }
+    dirtyTallies.clear();
 
     // clean-up the directory
     prune_state_files(pBlockIndex);
@@ -1918,6 +2275,9 @@ void clear_all_state()
 
     // Memory based storage
     mp_tally_map.clear();
+    dirtyTallies.clear();
+    lastBalanceSnapshot.SetNull();
+    nBalanceDeltas = 0;
     my_offers.clear();
     my_accepts.clear();
     my_crowds.clear();
@@ -2403,26 +2763,122 @@ std::string CElysiumTransactionDB::FetchInvalidReason(const uint256& txid)
     return error_str(processingResult);
 }
 
-std::set<int> CMPTxList::GetSeedBlocks(int startHeight, int endHeight)
+namespace {
+
+// Secondary indexes are stored next to the records they refer to. Their keys start with '#', which
+// sorts before any txid or address, followed by a letter identifying the index. Numbers are zero
+// padded, so that entries of an index are ordered by block.
+
+const std::string BLOCK_INDEX_PREFIX = "#h";
+const size_t INDEX_PREFIX_LENGTH = 2;
+const size_t INDEX_NUMBER_LENGTH = 10;
+const size_t TXID_LENGTH = 64;
+
+bool IsIndexKey(const leveldb::Slice& key)
 {
-    std::set<int> setSeedBlocks;
+    return key.size() > 0 && key[0] == '#';
+}
 
-    if (!pdb) return setSeedBlocks;
+std::string BlockIndexKey(int block, const std::string& key = "")
+{
+    return strprintf("#h%010d%s", std::max(block, 0), key);
+}
 
-    Iterator* it = NewIterator();
+int ParseBlockIndexKey(const leveldb::Slice& indexKey, std::string& key)
+{
+    std::string strKey = indexKey.ToString();
+    key = strKey.substr(INDEX_PREFIX_LENGTH + INDEX_NUMBER_LENGTH);
+    return atoi(strKey.substr(INDEX_PREFIX_LENGTH, INDEX_NUMBER_LENGTH));
+}
 
-    for (it->SeekToFirst(); it->Valid(); it->Next()) {
-        std::string itData = it->value().ToString();
-        std::vector<std::string> vstr;
-        boost::split(vstr, itData, boost::is_any_of(":"), boost::token_compress_on);
-        if (4 != vstr.size()) continue; // unexpected number of tokens
+std::string TypeIndexKey(unsigned int type, int block = 0, const std::string& key = "")
+{
+    return strprintf("#t%010u%010d%s", type, std::max(block, 0), key);
+}
+
+std::string TypeIndexPrefix(unsigned int type)
+{
+    return strprintf("#t%010u", type);
+}
+
+std::string CancelIndexKey(const std::string& cancelledTxid, const std::string& key = "")
+{
+    return strprintf("#c%s%s", cancelledTxid, key);
+}
+
+/** Returns the index entries of a record of the transaction database. */
+std::vector<std::string> TxListIndexKeys(const std::string& key, const std::string& value)
+{
+    std::vector<std::string> indexKeys;
+    std::vector<std::string> vstr;
+    boost::split(vstr, value, boost::is_any_of(":"), token_compress_on);
+
+    if (4 == vstr.size()) {
+        // master record: valid:block:type:value
         int block = atoi(vstr[1]);
-        if (block >= startHeight && block <= endHeight) {
-            setSeedBlocks.insert(block);
+        indexKeys.push_back(BlockIndexKey(block, key));
+        indexKeys.push_back(TypeIndexKey(atoi(vstr[2]), block, key));
+    } else if (3 == vstr.size() && vstr[0].size() == TXID_LENGTH) {
+        // MetaDEx cancel sub record: txid:propertyid:value
+        indexKeys.push_back(CancelIndexKey(vstr[0], key));
+    }
+
+    return indexKeys;
+}
+
+} // namespace
+
+leveldb::Status CMPTxList::writeRecord(const std::string& key, const std::string& value)
+{
+    leveldb::WriteBatch batch;
+
+    // replace the index entries of an overwritten record
+    std::string oldValue;
+    if (pdb->Get(readoptions, key, &oldValue).ok()) {
+        for (const std::string& indexKey : TxListIndexKeys(key, oldValue)) {
+            batch.Delete(indexKey);
         }
     }
 
-    delete it;
+    batch.Put(key, value);
+    for (const std::string& indexKey : TxListIndexKeys(key, value)) {
+        batch.Put(indexKey, "");
+    }
+
+    ++nWritten;
+    return pdb->Write(writeoptions, &batch);
+}
+
+std::vector<std::string> CMPTxList::getRecordsOfType(unsigned int type, int startBlock, size_t skip, size_t count)
+{
+    std::vector<std::string> keys;
+
+    if (!pdb) return keys;
+
+    const size_t keyOffset = INDEX_PREFIX_LENGTH + 2 * INDEX_NUMBER_LENGTH;
+    IterateRange(TypeIndexKey(type, startBlock), PrefixEnd(TypeIndexPrefix(type)),
+        [&keys, keyOffset](const leveldb::Slice& indexKey, const leveldb::Slice&) {
+            keys.push_back(indexKey.ToString().substr(keyOffset));
+            return true;
+        }, skip, count);
+
+    return keys;
+}
+
+std::set<int> CMPTxList::GetSeedBlocks(int startHeight, int endHeight)
+{
+    std::set<int> setSeedBlocks;
+
+    if (!pdb) return setSeedBlocks;
+
+    if (endHeight < startHeight || endHeight < 0) return setSeedBlocks;
+
+    IterateRange(BlockIndexKey(startHeight), PrefixEnd(BlockIndexKey(endHeight)),
+        [&setSeedBlocks](const leveldb::Slice& indexKey, const leveldb::Slice&) {
+            std::string key;
+            setSeedBlocks.insert(ParseBlockIndexKey(indexKey, key));
+            return true;
+        });
 
     return setSeedBlocks;
 }
@@ -2430,24 +2886,14 @@ std::set<int> CMPTxList::GetSeedBlocks(int startHeight, int endHeight)
 bool CMPTxList::CheckForFreezeTxs(int blockHeight)
 {
     assert(pdb);
-    Iterator* it = NewIterator();
 
-    for (it->SeekToFirst(); it->Valid(); it->Next()) {
-        std::string itData = it->value().ToString();
-        std::vector<std::string> vstr;
-        boost::split(vstr, itData, boost::is_any_of(":"), token_compress_on);
-        if (4 != vstr.size()) continue;
-        int block = atoi(vstr[1]);
-        if (block < blockHeight) continue;
-        uint16_t txtype = atoi(vstr[2]);
-        if (txtype == ELYSIUM_TYPE_FREEZE_PROPERTY_TOKENS || txtype == ELYSIUM_TYPE_UNFREEZE_PROPERTY_TOKENS ||
-            txtype == ELYSIUM_TYPE_ENABLE_FREEZING || txtype == ELYSIUM_TYPE_DISABLE_FREEZING) {
-            delete it;
+    for (unsigned int txtype : {ELYSIUM_TYPE_FREEZE_PROPERTY_TOKENS, ELYSIUM_TYPE_UNFREEZE_PROPERTY_TOKENS,
+            ELYSIUM_TYPE_ENABLE_FREEZING, ELYSIUM_TYPE_DISABLE_FREEZING}) {
+        if (!getRecordsOfType(txtype, blockHeight, 0, 1).empty()) {
             return true;
         }
     }
 
-    delete it;
     return false;
 }
 
@@ -2456,26 +2902,24 @@ bool CMPTxList::LoadFreezeState(int blockHeight)
     assert(pdb);
     std::vector<std::pair<std::string, uint256> > loadOrder;
     int txnsLoaded = 0;
-    Iterator* it = NewIterator();
     PrintToLog("Loading freeze state from levelDB\n");
 
-    for (it->SeekToFirst(); it->Valid(); it->Next()) {
-        std::string itData = it->value().ToString();
-        std::vector<std::string> vstr;
-        boost::split(vstr, itData, boost::is_any_of(":"), token_compress_on);
-        if (4 != vstr.size()) continue;
-        uint16_t txtype = atoi(vstr[2]);
-        if (txtype != ELYSIUM_TYPE_FREEZE_PROPERTY_TOKENS && txtype != ELYSIUM_TYPE_UNFREEZE_PROPERTY_TOKENS &&
-            txtype != ELYSIUM_TYPE_ENABLE_FREEZING && txtype != ELYSIUM_TYPE_DISABLE_FREEZING) continue;
-        if (atoi(vstr[0]) != 1) continue; // invalid, ignore
-        uint256 txid = uint256S(it->key().ToString());
-        int txPosition = p_ElysiumTXDB->FetchTransactionPosition(txid);
-        std::string sortKey = strprintf("%06d%010d", atoi(vstr[1]), txPosition);
-        loadOrder.push_back(std::make_pair(sortKey, txid));
+    for (unsigned int txtype : {ELYSIUM_TYPE_FREEZE_PROPERTY_TOKENS, ELYSIUM_TYPE_UNFREEZE_PROPERTY_TOKENS,
+            ELYSIUM_TYPE_ENABLE_FREEZING, ELYSIUM_TYPE_DISABLE_FREEZING}) {
+        for (const std::string& key : getRecordsOfType(txtype)) {
+            std::string itData;
+            if (!pdb->Get(readoptions, key, &itData).ok()) continue;
+            std::vector<std::string> vstr;
+            boost::split(vstr, itData, boost::is_any_of(":"), token_compress_on);
+            if (4 != vstr.size()) continue;
+            if (atoi(vstr[0]) != 1) continue; // invalid, ignore
+            uint256 txid = uint256S(key);
+            int txPosition = p_ElysiumTXDB->FetchTransactionPosition(txid);
+            std::string sortKey = strprintf("%06d%010d", atoi(vstr[1]), txPosition);
+            loadOrder.push_back(std::make_pair(sortKey, txid));
+        }
     }
 
-    delete it;
-
     std::sort (loadOrder.begin(), loadOrder.end());
 
     for (std::vector<std::pair<std::string, uint256> >::iterator it = loadOrder.begin(); it != loadOrder.end(); ++it) {
@@ -2534,20 +2978,18 @@ void CMPTxList::LoadActivations(int blockHeight)
 {
     if (!pdb) return;
 
-    Slice skey, svalue;
-    Iterator* it = NewIterator();
-
     PrintToLog("Loading feature activations from levelDB\n");
 
     std::vector<std::pair<int64_t, uint256> > loadOrder;
 
-    for (it->SeekToFirst(); it->Valid(); it->Next()) {
-        std::string itData = it->value().ToString();
+    for (const std::string& key : getRecordsOfType(ELYSIUM_MESSAGE_TYPE_ACTIVATION)) {
+        std::string itData;
+        if (!pdb->Get(readoptions, key, &itData).ok()) continue;
         std::vector<std::string> vstr;
         boost::split(vstr, itData, boost::is_any_of(":"), token_compress_on);
         if (4 != vstr.size()) continue; // unexpected number of tokens
-        if (atoi(vstr[2]) != ELYSIUM_MESSAGE_TYPE_ACTIVATION || atoi(vstr[0]) != 1) continue; // we only care about valid activations
-        uint256 txid = uint256S(it->key().ToString());;
+        if (atoi(vstr[0]) != 1) continue; // we only care about valid activations
+        uint256 txid = uint256S(key);
         loadOrder.push_back(std::make_pair(atoi(vstr[1]), txid));
     }
 
@@ -2591,7 +3033,6 @@ void CMPTxList::LoadActivations(int blockHeight)
             continue;
         }
     }
-    delete it;
     CheckLiveActivations(blockHeight);
 
     // This alert never expires as long as custom activations are used
@@ -2604,18 +3045,17 @@ void CMPTxList::LoadActivations(int blockHeight)
 void CMPTxList::LoadAlerts(int blockHeight)
 {
     if (!pdb) return;
-    Slice skey, svalue;
-    Iterator* it = NewIterator();
 
     std::vector<std::pair<int64_t, uint256> > loadOrder;
 
-    for (it->SeekToFirst(); it->Valid(); it->Next()) {
-        std::string itData = it->value().ToString();
+    for (const std::string& key : getRecordsOfType(ELYSIUM_MESSAGE_TYPE_ALERT)) {
+        std::string itData;
+        if (!pdb->Get(readoptions, key, &itData).ok()) continue;
         std::vector<std::string> vstr;
         boost::split(vstr, itData, boost::is_any_of(":"), token_compress_on);
         if (4 != vstr.size()) continue; // unexpected number of tokens
-        if (atoi(vstr[2]) != ELYSIUM_MESSAGE_TYPE_ALERT || atoi(vstr[0]) != 1) continue; // not a valid alert
-        uint256 txid = uint256S(it->key().ToString());;
+        if (atoi(vstr[0]) != 1) continue; // not a valid alert
+        uint256 txid = uint256S(key);
         loadOrder.push_back(std::make_pair(atoi(vstr[1]), txid));
     }
 
@@ -2654,7 +3094,6 @@ void CMPTxList::LoadAlerts(int blockHeight)
         }
     }
 
-    delete it;
     int64_t blockTime = 0;
     CBlockIndex* pBlockIndex = chainActive[blockHeight-1];
     if (pBlockIndex != NULL) {
@@ -2667,26 +3106,17 @@ void CMPTxList::LoadAlerts(int blockHeight)
 
 uint256 CMPTxList::findMetaDExCancel(const uint256 txid)
 {
-  std::vector<std::string> vstr;
-  string txidStr = txid.ToString();
-  Slice skey, svalue;
   uint256 cancelTxid;
-  Iterator* it = NewIterator();
-  for(it->SeekToFirst(); it->Valid(); it->Next())
-  {
-      skey = it->key();
-      svalue = it->value();
-      string svalueStr = svalue.ToString();
-      boost::split(vstr, svalueStr, boost::is_any_of(":"), token_compress_on);
-      // obtain the existing affected tx count
-      if (3 <= vstr.size())
-      {
-          if (vstr[0] == txidStr) { delete it; cancelTxid.SetHex(skey.ToString()); return cancelTxid; }
-      }
-  }
+  if (!pdb) return cancelTxid;
 
-  delete it;
-  return uint256();
+  // the sub record key starts with the txid of the cancel
+  const std::string prefix = CancelIndexKey(txid.ToString());
+  IteratePrefix(prefix, [&cancelTxid, &prefix](const leveldb::Slice& indexKey, const leveldb::Slice&) {
+      cancelTxid.SetHex(indexKey.ToString().substr(prefix.size()));
+      return false;
+  });
+
+  return cancelTxid;
 }
 
 /*
@@ -2767,38 +3197,26 @@ int CMPTxList::getNumberOfSubRecords(const uint256& txid)
 int CMPTxList::getMPTransactionCountTotal()
 {
     int count = 0;
-    Slice skey, svalue;
-    Iterator* it = NewIterator();
-    for(it->SeekToFirst(); it->Valid(); it->Next())
-    {
-        skey = it->key();
-        if (skey.ToString().length() == 64) { ++count; } //extra entries for cancels and purchases are more than 64 chars long
-    }
-    delete it;
+    IteratePrefix(BLOCK_INDEX_PREFIX, [&count](const leveldb::Slice& indexKey, const leveldb::Slice&) {
+        std::string key;
+        ParseBlockIndexKey(indexKey, key);
+        // only master records are in the block index, the extra master records of MetaDEx cancels
+        // carry a suffix after the txid and are not counted
+        if (key.length() == TXID_LENGTH) { ++count; }
+        return true;
+    });
     return count;
 }
 
 int CMPTxList::getMPTransactionCountBlock(int block)
 {
     int count = 0;
-    Slice skey, svalue;
-    Iterator* it = NewIterator();
-    for(it->SeekToFirst(); it->Valid(); it->Next())
-    {
-        skey = it->key();
-        svalue = it->value();
-        if (skey.ToString().length() == 64)
-        {
-            string strValue = svalue.ToString();
-            std::vector<std::string> vstr;
-            boost::split(vstr, strValue, boost::is_any_of(":"), token_compress_on);
-            if (4 == vstr.size())
-            {
-                if (atoi(vstr[1]) == block) { ++count; }
-            }
-        }
-    }
-    delete it;
+    IteratePrefix(BlockIndexKey(block), [&count](const leveldb::Slice& indexKey, const leveldb::Slice&) {
+        std::string key;
+        ParseBlockIndexKey(indexKey, key);
+        if (key.length() == TXID_LENGTH) { ++count; }
+        return true;
+    });
     return count;
 }
 
@@ -2889,7 +3307,7 @@ void CMPTxList::recordMetaDExCancelTX(const uint256 &txidMaster, const uint256 &
        PrintToLog("METADEXCANCELDEBUG : Writing master record %s(%s, valid=%s, block= %d, type= %d, number of affected transactions= %d)\n", __FUNCTION__, txidMaster.ToString(), fValid ? "YES":"NO", nBlock, type, refNumber);
        if (pdb)
        {
-           status = pdb->Put(writeoptions, key, value);
+           status = writeRecord(key, value);
            PrintToLog("METADEXCANCELDEBUG : %s(): %s, line %d, file: %s\n", __FUNCTION__, status.ToString(), __LINE__, __FILE__);
        }
 
@@ -2901,7 +3319,7 @@ void CMPTxList::recordMetaDExCancelTX(const uint256 &txidMaster, const uint256 &
        PrintToLog("METADEXCANCELDEBUG : Writing sub-record %s with value %s\n", subKey, subValue);
        if (pdb)
        {
-           subStatus = pdb->Put(writeoptions, subKey, subValue);
+           subStatus = writeRecord(subKey, subValue);
            PrintToLog("METADEXCANCELDEBUG : %s(): %s, line %d, file: %s\n", __FUNCTION__, subStatus.ToString(), __LINE__, __FILE__);
        }
 }
@@ -2962,7 +3380,7 @@ void CMPTxList::recordPaymentTX(const uint256 &txid, bool fValid, int nBlock, un
        PrintToLog("DEXPAYDEBUG : Writing master record %s(%s, valid=%s, block= %d, type= %d, number of payments= %lu)\n", __FUNCTION__, txid.ToString(), fValid ? "YES":"NO", nBlock, type, numberOfPayments);
        if (pdb)
        {
-           status = pdb->Put(writeoptions, key, value);
+           status = writeRecord(key, value);
            PrintToLog("DEXPAYDEBUG : %s(): %s, line %d, file: %s\n", __FUNCTION__, status.ToString(), __LINE__, __FILE__);
        }
 
@@ -2974,7 +3392,7 @@ void CMPTxList::recordPaymentTX(const uint256 &txid, bool fValid, int nBlock, un
        PrintToLog("DEXPAYDEBUG : Writing sub-record %s with value %s\n", subKey, subValue);
        if (pdb)
        {
-           subStatus = pdb->Put(writeoptions, subKey, subValue);
+           subStatus = writeRecord(subKey, subValue);
            PrintToLog("DEXPAYDEBUG : %s(): %s, line %d, file: %s\n", __FUNCTION__, subStatus.ToString(), __LINE__, __FILE__);
        }
 }
@@ -2996,8 +3414,7 @@ Status status;
 
   if (pdb)
   {
-    status = pdb->Put(writeoptions, key, value);
-    ++nWritten;
+    status = writeRecord(key, value);
     if (elysium_debug_txdb) PrintToLog("%s(): %s, line %d, file: %s\n", __FUNCTION__, status.ToString(), __LINE__, __FILE__);
   }
 }
@@ -3045,6 +3462,7 @@ Slice skey, svalue;
   for(it->SeekToFirst(); it->Valid(); it->Next())
   {
     skey = it->key();
+    if (IsIndexKey(skey)) continue; // index entries only refer to the records
     svalue = it->value();
     ++count;
     PrintToLog("entry #%8d= %s:%s\n", count, skey.ToString(), svalue.ToString());
@@ -3058,43 +3476,49 @@ Slice skey, svalue;
 // pass in bDeleteFound = true to erase each entry found within the block range
 bool CMPTxList::isMPinBlockRange(int starting_block, int ending_block, bool bDeleteFound)
 {
-leveldb::Slice skey, svalue;
-unsigned int count = 0;
-std::vector<std::string> vstr;
-int block;
-unsigned int n_found = 0;
-
-  leveldb::Iterator* it = NewIterator();
-
-  for(it->SeekToFirst(); it->Valid(); it->Next())
-  {
-    skey = it->key();
-    svalue = it->value();
-
-    ++count;
-
-    string strvalue = it->value().ToString();
-
-    // parse the string returned, find the validity flag/bit & other parameters
-    boost::split(vstr, strvalue, boost::is_any_of(":"), token_compress_on);
+  unsigned int n_found = 0;
 
-    // only care about the block number/height here
-    if (2 <= vstr.size())
-    {
-      block = atoi(vstr[1]);
+  if (ending_block < starting_block || ending_block < 0) return false;
+
+  std::vector<std::string> keys;
+  IterateRange(BlockIndexKey(starting_block), PrefixEnd(BlockIndexKey(ending_block)),
+      [&keys](const leveldb::Slice& indexKey, const leveldb::Slice&) {
+          std::string key;
+          ParseBlockIndexKey(indexKey, key);
+          keys.push_back(key);
+          return true;
+      });
+
+  leveldb::WriteBatch batch;
+  for (const std::string& key : keys) {
+      std::string value;
+      if (!pdb->Get(readoptions, key, &value).ok()) continue;
+
+      ++n_found;
+      PrintToLog("%s() DELETING: %s=%s\n", __FUNCTION__, key, value);
+      if (bDeleteFound) {
+          batch.Delete(key);
+          for (const std::string& indexKey : TxListIndexKeys(key, value)) {
+              batch.Delete(indexKey);
+          }
 
-      if ((starting_block <= block) && (block <= ending_block))
-      {
-        ++n_found;
-        PrintToLog("%s() DELETING: %s=%s\n", __FUNCTION__, skey.ToString(), svalue.ToString());
-        if (bDeleteFound) pdb->Delete(writeoptions, skey);
+          // sub records of payments, cancels and "send all"s are keyed by the master key and a suffix,
+          // e.g. the cancel sub records referenced by findMetaDExCancel() go along with their master
+          const std::string subPrefix = key.length() == TXID_LENGTH ? key + "-" : key;
+          IteratePrefix(subPrefix, [&batch, &key](const leveldb::Slice& subKey, const leveldb::Slice& subValue) {
+              if (subKey == key) return true;
+              batch.Delete(subKey);
+              for (const std::string& indexKey : TxListIndexKeys(subKey.ToString(), subValue.ToString())) {
+                  batch.Delete(indexKey);
+              }
+              return true;
+          });
       }
-    }
   }
 
-  PrintToLog("%s(%d, %d); n_found= %d\n", __FUNCTION__, starting_block, ending_block, n_found);
+  if (bDeleteFound && n_found) pdb->Write(writeoptions, &batch);
 
-  delete it;
+  PrintToLog("%s(%d, %d); n_found= %d\n", __FUNCTION__, starting_block, ending_block, n_found);
 
   return (n_found);
 }
@@ -3104,16 +3528,7 @@ std::string CMPSTOList::getMySTOReceipts(string filterAddress)
 {
   if (!pdb) return "";
   string mySTOReceipts = "";
-  Slice skey, svalue;
-  Iterator* it = NewIterator();
-  for(it->SeekToFirst(); it->Valid(); it->Next()) {
-      skey = it->key();
-      string recipientAddress = skey.ToString();
-      if(!IsMyAddress(recipientAddress)) continue; // not ours, not interested
-      if((!filterAddress.empty()) && (filterAddress != recipientAddress)) continue; // not the filtered address
-      // ours, get info
-      svalue = it->value();
-      string strValue = svalue.ToString();
+  auto addReceipts = [&mySTOReceipts](const std::string& recipientAddress, const std::string& strValue) {
       // break into individual receipts
       std::vector<std::string> vstr;
       boost::split(vstr, strValue, boost::is_any_of(","), token_compress_on);
@@ -3126,8 +3541,22 @@ std::string CMPSTOList::getMySTOReceipts(string filterAddress)
               if(txidMatch==std::string::npos) mySTOReceipts += svstr[0]+":"+svstr[1]+":"+recipientAddress+":"+svstr[2]+",";
           }
       }
+  };
+  if (!filterAddress.empty()) {
+      // the address is the key, no need to look at other recipients
+      string strValue;
+      if (IsMyAddress(filterAddress) && pdb->Get(readoptions, filterAddress, &strValue).ok()) {
+          addReceipts(filterAddress, strValue);
+      }
+  } else {
+      // addresses are stored after the index entries
+      IterateRange(PrefixEnd("#"), "", [&addReceipts](const leveldb::Slice& key, const leveldb::Slice& value) {
+          string recipientAddress = key.ToString();
+          if(!IsMyAddress(recipientAddress)) return true; // not ours, not interested
+          addReceipts(recipientAddress, value.ToString());
+          return true;
+      });
   }
-  delete it;
   // above code will leave a trailing comma - strip it
   if (mySTOReceipts.size() > 0) mySTOReceipts.resize(mySTOReceipts.size()-1);
   return mySTOReceipts;
@@ -3150,14 +3579,18 @@ void CMPSTOList::getRecipients(const uint256 txid, string filterAddress, UniValu
   // the fee is variable based on version of STO - provide number of recipients and allow calling function to work out fee
   *numRecipients = 0;
 
-  Slice skey, svalue;
-  Iterator* it = NewIterator();
-  for(it->SeekToFirst(); it->Valid(); it->Next())
+  // only look at the recipients of this transaction
+  std::vector<std::string> recipients;
+  const std::string prefix = strprintf("#t%s", txid.ToString());
+  IteratePrefix(prefix, [&recipients, &prefix](const leveldb::Slice& indexKey, const leveldb::Slice&) {
+      recipients.push_back(indexKey.ToString().substr(prefix.size()));
+      return true;
+  });
+
+  for (const std::string& recipientAddress : recipients)
   {
-      skey = it->key();
-      string recipientAddress = skey.ToString();
-      svalue = it->value();
-      string strValue = svalue.ToString();
+      string strValue;
+      if (!pdb->Get(readoptions, recipientAddress, &strValue).ok()) continue;
       // see if txid is in the data
       size_t txidMatch = strValue.find(txid.ToString());
       if(txidMatch!=std::string::npos)
@@ -3189,7 +3622,6 @@ void CMPSTOList::getRecipients(const uint256 txid, string filterAddress, UniValu
                       } catch (const boost::bad_lexical_cast &e)
                       {
                           PrintToLog("DEBUG STO - error in converting values from leveldb\n");
-                          delete it;
                           return; //(something went wrong)
                       }
                       UniValue recipient(UniValue::VOBJ);
@@ -3211,7 +3643,6 @@ void CMPSTOList::getRecipients(const uint256 txid, string filterAddress, UniValu
       }
   }
 
-  delete it;
   return;
 }
 
@@ -3234,43 +3665,30 @@ void CMPSTOList::recordSTOReceive(string address, const uint256 &txid, int nBloc
 {
   if (!pdb) return;
 
-  bool addressExists = s_stolistdb->exists(address);
-  if (addressExists)
-  {
-      //retrieve existing record
-      std::vector<std::string> vstr;
-      string strValue;
-      Status status = pdb->Get(readoptions, address, &strValue);
-      if (status.ok())
-      {
-          // add details to record
-          // see if we are overwriting (check)
-          size_t txidMatch = strValue.find(txid.ToString());
-          if(txidMatch!=std::string::npos) PrintToLog("STODEBUG : Duplicating entry for %s : %s\n",address,txid.ToString());
-
-          const string key = address;
-          const string newValue = strprintf("%s:%d:%u:%lu,", txid.ToString(), nBlock, propertyId, amount);
-          strValue += newValue;
-          // write updated record
-          Status status;
-          if (pdb)
-          {
-              status = pdb->Put(writeoptions, key, strValue);
-              PrintToLog("STODBDEBUG : %s(): %s, line %d, file: %s\n", __FUNCTION__, status.ToString(), __LINE__, __FILE__);
-          }
-      }
-  }
-  else
+  const string key = address;
+  const string newValue = strprintf("%s:%d:%u:%lu,", txid.ToString(), nBlock, propertyId, amount);
+  string strValue;
+
+  //retrieve existing record
+  Status status = pdb->Get(readoptions, address, &strValue);
+  if (status.ok())
   {
-      const string key = address;
-      const string value = strprintf("%s:%d:%u:%lu,", txid.ToString(), nBlock, propertyId, amount);
-      Status status;
-      if (pdb)
-      {
-          status = pdb->Put(writeoptions, key, value);
-          PrintToLog("STODBDEBUG : %s(): %s, line %d, file: %s\n", __FUNCTION__, status.ToString(), __LINE__, __FILE__);
-      }
+      // add details to record
+      // see if we are overwriting (check)
+      size_t txidMatch = strValue.find(txid.ToString());
+      if(txidMatch!=std::string::npos) PrintToLog("STODEBUG : Duplicating entry for %s : %s\n",address,txid.ToString());
   }
+  strValue += newValue;
+
+  // write updated record, together with the index entries of the receipt
+  leveldb::WriteBatch batch;
+  batch.Put(key, strValue);
+  batch.Put(strprintf("#t%s%s", txid.ToString(), address), "");
+  batch.Put(BlockIndexKey(nBlock, address + txid.ToString()), "");
+
+  status = pdb->Write(writeoptions, &batch);
+  ++nWritten;
+  PrintToLog("STODBDEBUG : %s(): %s, line %d, file: %s\n", __FUNCTION__, status.ToString(), __LINE__, __FILE__);
 }
 
 void CMPSTOList::printAll()
@@ -3282,6 +3700,7 @@ void CMPSTOList::printAll()
   for(it->SeekToFirst(); it->Valid(); it->Next())
   {
     skey = it->key();
+    if (IsIndexKey(skey)) continue; // index entries only refer to the records
     svalue = it->value();
     ++count;
     PrintToLog("entry #%8d= %s:%s\n", count, skey.ToString(), svalue.ToString());
@@ -3303,11 +3722,23 @@ void CMPSTOList::printStats()
 int CMPSTOList::deleteAboveBlock(int blockNum)
 {
   unsigned int n_found = 0;
+  std::set<std::string> addresses;
+  leveldb::WriteBatch batch;
+
+  // the block index gives the recipients of the affected receipts
+  IterateRange(BlockIndexKey(blockNum), PrefixEnd(BLOCK_INDEX_PREFIX), [&](const leveldb::Slice& indexKey, const leveldb::Slice&) {
+      std::string addressAndTxid;
+      ParseBlockIndexKey(indexKey, addressAndTxid);
+      addresses.insert(addressAndTxid.substr(0, addressAndTxid.size() - TXID_LENGTH));
+      batch.Delete(indexKey);
+      return true;
+  });
+
   std::vector<std::string> vecSTORecords;
-  leveldb::Iterator* it = NewIterator();
-  for (it->SeekToFirst(); it->Valid(); it->Next()) {
+  for (const std::string& address : addresses) {
       std::string newValue;
-      std::string oldValue = it->value().ToString();
+      std::string oldValue;
+      if (!pdb->Get(readoptions, address, &oldValue).ok()) continue;
       bool needsUpdate = false;
       boost::split(vecSTORecords, oldValue, boost::is_any_of(","), boost::token_compress_on);
       for (uint32_t i = 0; i<vecSTORecords.size(); i++) {
@@ -3318,24 +3749,91 @@ int CMPSTOList::deleteAboveBlock(int blockNum)
               newValue += vecSTORecords[i].append(","); // STO before the reorg, add data back to new value string
           } else {
               needsUpdate = true;
+              batch.Delete(strprintf("#t%s%s", vecSTORecordFields[0], address));
           }
       }
       if (needsUpdate) { // rewrite record with existing key and new value
           ++n_found;
-          leveldb::Status status = pdb->Put(writeoptions, it->key().ToString(), newValue);
+          batch.Put(address, newValue);
           PrintToLog("DEBUG STO - rewriting STO data after reorg\n");
-          PrintToLog("STODBDEBUG : %s(): %s, line %d, file: %s\n", __FUNCTION__, status.ToString(), __LINE__, __FILE__);
       }
   }
 
-  PrintToLog("%s(%d); stodb updated records= %d\n", __FUNCTION__, blockNum, n_found);
+  leveldb::Status status = pdb->Write(writeoptions, &batch);
+  PrintToLog("STODBDEBUG : %s(): %s, line %d, file: %s\n", __FUNCTION__, status.ToString(), __LINE__, __FILE__);
 
-  delete it;
+  PrintToLog("%s(%d); stodb updated records= %d\n", __FUNCTION__, blockNum, n_found);
 
   return (n_found);
 }
 
 // MPTradeList here
+namespace {
+
+std::string AddressIndexPrefix(const std::string& address)
+{
+    return strprintf("#a%s:", address);
+}
+
+std::string MatchIndexPrefix(const std::string& txid)
+{
+    return strprintf("#m%s", txid);
+}
+
+std::string PairIndexPrefix(uint32_t propertyIdSideA, uint32_t propertyIdSideB)
+{
+    return strprintf("#p%010u%010u", propertyIdSideA, propertyIdSideB);
+}
+
+/** Returns the index entries, as key and value, of a record of the trade database. */
+std::vector<std::pair<std::string, std::string>> TradeListIndexEntries(const std::string& key, const std::string& value)
+{
+    std::vector<std::pair<std::string, std::string>> entries;
+    std::vector<std::string> vstr;
+    boost::split(vstr, value, boost::is_any_of(":"), token_compress_on);
+
+    if (key.size() == TXID_LENGTH && 5 == vstr.size()) {
+        // new trade: address:propertyidforsale:propertyiddesired:block:index
+        int block = atoi(vstr[3]);
+        entries.emplace_back(strprintf("%s%010d%010d%s", AddressIndexPrefix(vstr[0]), block, atoi(vstr[4]), key), vstr[1] + ":" + vstr[2]);
+        entries.emplace_back(BlockIndexKey(block, key), "");
+    } else if (key.size() == 2 * TXID_LENGTH + 1 && 8 == vstr.size()) {
+        // matched trade: address1:address2:property1:property2:amount1:amount2:block:fee
+        int block = atoi(vstr[6]);
+        std::string txid1 = key.substr(0, TXID_LENGTH);
+        std::string txid2 = key.substr(TXID_LENGTH + 1);
+        entries.emplace_back(MatchIndexPrefix(txid1) + txid2, key);
+        entries.emplace_back(MatchIndexPrefix(txid2) + txid1, key);
+        entries.emplace_back(strprintf("%s%010d%s", PairIndexPrefix(atoi(vstr[2]), atoi(vstr[3])), block, key), "");
+        entries.emplace_back(BlockIndexKey(block, key), "");
+    }
+
+    return entries;
+}
+
+} // namespace
+
+leveldb::Status CMPTradeList::writeRecord(const std::string& key, const std::string& value)
+{
+    leveldb::WriteBatch batch;
+
+    // replace the index entries of an overwritten record
+    std::string oldValue;
+    if (pdb->Get(readoptions, key, &oldValue).ok()) {
+        for (const auto& entry : TradeListIndexEntries(key, oldValue)) {
+            batch.Delete(entry.first);
+        }
+    }
+
+    batch.Put(key, value);
+    for (const auto& entry : TradeListIndexEntries(key, value)) {
+        batch.Put(entry.first, entry.second);
+    }
+
+    ++nWritten;
+    return pdb->Write(writeoptions, &batch);
+}
+
 bool CMPTradeList::getMatchingTrades(const uint256& txid, uint32_t propertyId, UniValue& tradeArray, int64_t& totalSold, int64_t& totalReceived)
 {
   if (!pdb) return false;
@@ -3346,11 +3844,18 @@ bool CMPTradeList::getMatchingTrades(const uint256& txid, uint32_t propertyId, U
 
   std::vector<std::string> vstr;
   string txidStr = txid.ToString();
-  leveldb::Iterator* it = NewIterator();
-  for(it->SeekToFirst(); it->Valid(); it->Next()) {
-      // search key to see if this is a matching trade
-      std::string strKey = it->key().ToString();
-      std::string strValue = it->value().ToString();
+
+  // obtain the keys of the matches of this trade, ordered by key
+  std::vector<std::string> matchKeys;
+  IteratePrefix(MatchIndexPrefix(txidStr), [&matchKeys](const leveldb::Slice&, const leveldb::Slice& value) {
+      matchKeys.push_back(value.ToString());
+      return true;
+  });
+  std::sort(matchKeys.begin(), matchKeys.end());
+
+  for (const std::string& strKey : matchKeys) {
+      std::string strValue;
+      if (!pdb->Get(readoptions, strKey, &strValue).ok()) continue;
       std::string matchTxid;
       size_t txidMatch = strKey.find(txidStr);
       if (txidMatch == std::string::npos) continue; // no match
@@ -3406,8 +3911,6 @@ bool CMPTradeList::getMatchingTrades(const uint256& txid, uint32_t propertyId, U
       ++count;
   }
 
-  // clean up
-  delete it;
   if (count) { return true; } else { return false; }
 }
 
@@ -3420,13 +3923,22 @@ bool CompareTradePair(const std::pair<int64_t, UniValue>& firstJSONObj, const st
 void CMPTradeList::getTradesForPair(uint32_t propertyIdSideA, uint32_t propertyIdSideB, UniValue& responseArray, uint64_t count)
 {
   if (!pdb) return;
-  leveldb::Iterator* it = NewIterator();
+
+  // obtain the most recent matches of each side of the pair, which contain the most recent of the pair
+  std::vector<std::string> matchKeys;
+  auto addMatch = [&matchKeys](const leveldb::Slice& indexKey, const leveldb::Slice&) {
+      matchKeys.push_back(indexKey.ToString().substr(INDEX_PREFIX_LENGTH + 3 * INDEX_NUMBER_LENGTH));
+      return true;
+  };
+  IteratePrefix(PairIndexPrefix(propertyIdSideA, propertyIdSideB), addMatch, 0, count, true);
+  IteratePrefix(PairIndexPrefix(propertyIdSideB, propertyIdSideA), addMatch, 0, count, true);
+
   std::vector<std::pair<int64_t, UniValue> > vecResponse;
   bool propertyIdSideAIsDivisible = isPropertyDivisible(propertyIdSideA);
   bool propertyIdSideBIsDivisible = isPropertyDivisible(propertyIdSideB);
-  for(it->SeekToFirst(); it->Valid(); it->Next()) {
-      std::string strKey = it->key().ToString();
-      std::string strValue = it->value().ToString();
+  for (const std::string& strKey : matchKeys) {
+      std::string strValue;
+      if (!pdb->Get(readoptions, strKey, &strValue).ok()) continue;
       std::vector<std::string> vecKeys;
       std::vector<std::string> vecValues;
       uint256 sellerTxid, matchingTxid;
@@ -3504,8 +4016,6 @@ void CMPTradeList::getTradesForPair(uint32_t propertyIdSideA, uint32_t propertyI
   for (std::vector<UniValue>::iterator it = responseArrayValues.begin(); it != responseArrayValues.end(); ++it) {
       responseArray.push_back(*it);
   }
-
-  delete it;
 }
 
 // obtains a vector of txids where the supplied address participated in a trade (needed for gettradehistory_MP)
@@ -3514,41 +4024,29 @@ void CMPTradeList::getTradesForPair(uint32_t propertyIdSideA, uint32_t propertyI
 void CMPTradeList::getTradesForAddress(std::string address, std::vector<uint256>& vecTransactions, uint32_t propertyIdFilter)
 {
   if (!pdb) return;
-  std::map<std::string,uint256> mapTrades;
-  leveldb::Iterator* it = NewIterator();
-  for(it->SeekToFirst(); it->Valid(); it->Next()) {
-      std::string strKey = it->key().ToString();
-      std::string strValue = it->value().ToString();
+  // the address index is ordered by block and index, and holds the traded properties
+  IteratePrefix(AddressIndexPrefix(address), [&](const leveldb::Slice& indexKey, const leveldb::Slice& value) {
+      std::string strKey = indexKey.ToString();
+      std::string strValue = value.ToString();
       std::vector<std::string> vecValues;
-      if (strKey.size() != 64) continue; // only interested in trades
-      uint256 txid = uint256S(strKey);
-      size_t addressMatch = strValue.find(address);
-      if (addressMatch == std::string::npos) continue;
       boost::split(vecValues, strValue, boost::is_any_of(":"), token_compress_on);
-      if (vecValues.size() != 5) {
-          PrintToLog("TRADEDB error - unexpected number of tokens in value (%s)\n", strValue);
-          continue;
+      if (vecValues.size() != 2 || strKey.size() < TXID_LENGTH) {
+          PrintToLog("TRADEDB error - unexpected index entry (%s:%s)\n", strKey, strValue);
+          return true;
       }
-      uint32_t propertyIdForSale = boost::lexical_cast<uint32_t>(vecValues[1]);
-      uint32_t propertyIdDesired = boost::lexical_cast<uint32_t>(vecValues[2]);
-      int64_t blockNum = boost::lexical_cast<uint32_t>(vecValues[3]);
-      int64_t txIndex = boost::lexical_cast<uint32_t>(vecValues[4]);
-      if (propertyIdFilter != 0 && propertyIdFilter != propertyIdForSale && propertyIdFilter != propertyIdDesired) continue;
-      std::string sortKey = strprintf("%06d%010d", blockNum, txIndex);
-      mapTrades.insert(std::make_pair(sortKey, txid));
-  }
-  delete it;
-  for (std::map<std::string,uint256>::iterator it = mapTrades.begin(); it != mapTrades.end(); it++) {
-      vecTransactions.push_back(it->second);
-  }
+      uint32_t propertyIdForSale = boost::lexical_cast<uint32_t>(vecValues[0]);
+      uint32_t propertyIdDesired = boost::lexical_cast<uint32_t>(vecValues[1]);
+      if (propertyIdFilter != 0 && propertyIdFilter != propertyIdForSale && propertyIdFilter != propertyIdDesired) return true;
+      vecTransactions.push_back(uint256S(strKey.substr(strKey.size() - TXID_LENGTH)));
+      return true;
+  });
 }
 
 void CMPTradeList::recordNewTrade(const uint256& txid, const std::string& address, uint32_t propertyIdForSale, uint32_t propertyIdDesired, int blockNum, int blockIndex)
 {
   if (!pdb) return;
   std::string strValue = strprintf("%s:%d:%d:%d:%d", address, propertyIdForSale, propertyIdDesired, blockNum, blockIndex);
-  Status status = pdb->Put(writeoptions, txid.ToString(), strValue);
-  ++nWritten;
+  Status status = writeRecord(txid.ToString(), strValue);
   if (elysium_debug_tradedb) PrintToLog("%s(): %s\n", __FUNCTION__, status.ToString());
 }
 
@@ -3560,8 +4058,7 @@ void CMPTradeList::recordMatchedTrade(const uint256 txid1, const uint256 txid2,
   Status status;
   if (pdb)
   {
-    status = pdb->Put(writeoptions, key, value);
-    ++nWritten;
+    status = writeRecord(key, value);
     if (elysium_debug_tradedb) PrintToLog("%s(): %s\n", __FUNCTION__, status.ToString());
   }
 }
@@ -3573,31 +4070,31 @@ void CMPTradeList::recordMatchedTrade(const uint256 txid1, const uint256 txid2,
  */
 int CMPTradeList::deleteAboveBlock(int blockNum)
 {
-  leveldb::Slice skey, svalue;
-  unsigned int count = 0;
-  std::vector<std::string> vstr;
-  int block = 0;
   unsigned int n_found = 0;
-  leveldb::Iterator* it = NewIterator();
-  for(it->SeekToFirst(); it->Valid(); it->Next())
-  {
-    skey = it->key();
-    svalue = it->value();
-    ++count;
-    string strvalue = it->value().ToString();
-    boost::split(vstr, strvalue, boost::is_any_of(":"), token_compress_on);
-    if (7 == vstr.size()) block = atoi(vstr[6]); // trade matches have 7 tokens, key is txid+txid, only care about block
-    if (5 == vstr.size()) block = atoi(vstr[3]); // trades have 5 tokens, key is txid, only care about block
-    if (block >= blockNum) {
-        ++n_found;
-        PrintToLog("%s() DELETING FROM TRADEDB: %s=%s\n", __FUNCTION__, skey.ToString(), svalue.ToString());
-        pdb->Delete(writeoptions, skey);
-    }
+
+  std::vector<std::string> keys;
+  IterateRange(BlockIndexKey(blockNum), PrefixEnd(BLOCK_INDEX_PREFIX), [&keys](const leveldb::Slice& indexKey, const leveldb::Slice&) {
+      std::string key;
+      ParseBlockIndexKey(indexKey, key);
+      keys.push_back(key);
+      return true;
+  });
+
+  leveldb::WriteBatch batch;
+  for (const std::string& key : keys) {
+      std::string value;
+      if (!pdb->Get(readoptions, key, &value).ok()) continue;
+      ++n_found;
+      PrintToLog("%s() DELETING FROM TRADEDB: %s=%s\n", __FUNCTION__, key, value);
+      batch.Delete(key);
+      for (const auto& entry : TradeListIndexEntries(key, value)) {
+          batch.Delete(entry.first);
+      }
   }
 
-  PrintToLog("%s(%d); tradedb n_found= %d\n", __FUNCTION__, blockNum, n_found);
+  if (n_found) pdb->Write(writeoptions, &batch);
 
-  delete it;
+  PrintToLog("%s(%d); tradedb n_found= %d\n", __FUNCTION__, blockNum, n_found);
 
   return (n_found);
 }
@@ -3609,14 +4106,12 @@ void CMPTradeList::printStats()
 
 int CMPTradeList::getMPTradeCountTotal()
 {
+    // every trade and match has exactly one entry in the block index
     int count = 0;
-    Slice skey, svalue;
-    Iterator* it = NewIterator();
-    for(it->SeekToFirst(); it->Valid(); it->Next())
-    {
+    IteratePrefix(BLOCK_INDEX_PREFIX, [&count](const leveldb::Slice&, const leveldb::Slice&) {
         ++count;
-    }
-    delete it;
+        return true;
+    });
     return count;
 }
 
@@ -3629,6 +4124,7 @@ void CMPTradeList::printAll()
   for(it->SeekToFirst(); it->Valid(); it->Next())
   {
     skey = it->key();
+    if (IsIndexKey(skey)) continue; // index entries only refer to the records
     svalue = it->value();
     ++count;
     PrintToLog("entry #%8d= %s:%s\n", count, skey.ToString(), svalue.ToString());
@@ -3784,6 +4280,9 @@ int elysium_handler_block_end(int nBlockNow, CBlockIndex const * pBlockIndex,
         PrintToLog("develysium for block %d: %d, Elysium balance: %d\n", nBlockNow, develysium, FormatDivisibleMP(balance));
     }
 
+    // write sigma mints and spends of this block in one batch
+    sigmaDb->Flush();
+
     // check the alert status, do we need to do anything else here?
     CheckExpiredAlerts(nBlockNow, pBlockIndex->GetBlockTime());
 
@@ -34,11 +34,18 @@ class CTransaction;
 using std::string;
 
 int const MAX_STATE_HISTORY = 50;
+//! Maximum number of balance deltas written on top of a full balance snapshot
+int const MAX_STATE_DELTAS = 10;
+
+//! Default number of threads reading blocks during the initial scan, 0 means one per core
+int const DEFAULT_ELYSIUM_SCAN_THREADS = 0;
+//! Number of blocks read ahead of the initial scan per thread
+int const ELYSIUM_SCAN_PREFETCH_PER_THREAD = 8;
 
 constexpr size_t ELYSIUM_MAX_SIMPLE_MINTS = std::numeric_limits<uint8_t>::max();
 
 // increment this value to force a refresh of the state (similar to --startclean)
-#define DB_VERSION 6
+#define DB_VERSION 7
 
 // maximum size of string fields
 #define SP_STRING_FIELD_LEN 256
@@ -130,7 +137,9 @@ public:
     std::string FetchInvalidReason(const uint256& txid);
 };
 
-/** LevelDB based storage for STO recipients.
+/** LevelDB based storage for STO recipients, with the recipient address as key.
+ *
+ * Receipts are indexed by transaction ("#t<txid><address>") and by block ("#h<block><address><txid>").
  */
 class CMPSTOList : public CDBBase
 {
@@ -156,6 +165,10 @@ public:
 };
 
 /** LevelDB based storage for the trade history. Trades are listed with key "txid1+txid2".
+ *
+ * New trades are indexed by address ("#a<address>:<block><index><txid>"), matches by the transactions
+ * involved ("#m<txid><txid>") and by property pair ("#p<property><property><block><key>"), and all
+ * records by block ("#h<block><key>").
  */
 class CMPTradeList : public CDBBase
 {
@@ -181,9 +194,15 @@ public:
     void getTradesForAddress(std::string address, std::vector<uint256>& vecTransactions, uint32_t propertyIdFilter = 0);
     void getTradesForPair(uint32_t propertyIdSideA, uint32_t propertyIdSideB, UniValue& response, uint64_t count);
     int getMPTradeCountTotal();
+
+private:
+    leveldb::Status writeRecord(const std::string& key, const std::string& value);
 };
 
 /** LevelDB based storage for transactions, with txid as key and validity bit, and other data as value.
+ *
+ * Master records are indexed by block ("#h<block><key>") and by type ("#t<type><block><key>"), MetaDEx
+ * cancel sub records by the cancelled transaction ("#c<txid><key>").
  */
 class CMPTxList : public CDBBase
 {
@@ -232,6 +251,12 @@ public:
     void printAll();
 
     bool isMPinBlockRange(int, int, bool);
+
+    /** Returns the keys of the master records of the given type in ascending block order. */
+    std::vector<std::string> getRecordsOfType(unsigned int type, int startBlock = 0, size_t skip = 0, size_t count = std::numeric_limits<size_t>::max());
+
+private:
+    leveldb::Status writeRecord(const std::string& key, const std::string& value);
 };
 
 //! Available balances of wallet properties
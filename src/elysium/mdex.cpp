@@ -25,11 +25,14 @@
 #include <assert.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <fstream>
 #include <limits>
 #include <map>
 #include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
 typedef boost::multiprecision::cpp_dec_float_100 dec_float;
 typedef boost::multiprecision::checked_int128_t int128_t;
@@ -42,18 +45,97 @@ using namespace elysium;
 //! Global map for price and order data
 md_PropertiesMap elysium::metadex;
 
-md_PricesMap* elysium::get_Prices(uint32_t prop)
+md_PricesMap* elysium::get_Prices(uint32_t prop, uint32_t propDesired)
 {
-    md_PropertiesMap::iterator it = metadex.find(prop);
+    md_PropertiesMap::iterator it = metadex.find(std::make_pair(prop, propDesired));
 
     if (it != metadex.end()) return &(it->second);
 
     return (md_PricesMap*) NULL;
 }
 
-md_Set* elysium::get_Indexes(md_PricesMap* p, rational_t price)
+struct PriceLevel_compare
 {
-    md_PricesMap::iterator it = p->find(price);
+    bool operator()(const md_PriceLevel& level, const rational_t& price) const
+    {
+        return level.first < price;
+    }
+};
+
+/** Locates the price level with exactly the given price, or returns the end of the book. */
+static md_PricesMap::iterator FindPriceLevel(md_PricesMap& prices, const rational_t& price)
+{
+    md_PricesMap::iterator it = std::lower_bound(prices.begin(), prices.end(), price, PriceLevel_compare());
+
+    if (it != prices.end() && it->first == price) return it;
+
+    return prices.end();
+}
+
+static bool IsPriceLevelEmpty(const md_PriceLevel& level)
+{
+    return level.second.empty();
+}
+
+/** Returns the first book of a property for sale, or the end of the map. */
+static md_PropertiesMap::iterator BeginProperty(uint32_t prop)
+{
+    return metadex.lower_bound(std::make_pair(prop, uint32_t(0)));
+}
+
+/** Returns the book following the last book of a property for sale. */
+static md_PropertiesMap::iterator EndProperty(uint32_t prop)
+{
+    return metadex.upper_bound(std::make_pair(prop, std::numeric_limits<uint32_t>::max()));
+}
+
+/**
+ * Removes the orders for which the predicate returns true, and keeps the
+ * remaining orders in their original order. The predicate is applied to
+ * the orders in order, so it may also act on each removed order.
+ */
+template<typename Predicate>
+static void RemoveOrdersIf(md_Set& orders, Predicate remove)
+{
+    md_Set::iterator last = orders.begin();
+    for (md_Set::iterator it = orders.begin(); it != orders.end(); ++it) {
+        if (remove(*it)) continue;
+        if (last != it) *last = std::move(*it);
+        ++last;
+    }
+    orders.erase(last, orders.end());
+}
+
+/** Drops empty price levels and erases the book, if no level is left. */
+static void PruneBook(md_PropertiesMap::iterator book)
+{
+    md_PricesMap& prices = book->second;
+
+    prices.erase(std::remove_if(prices.begin(), prices.end(), IsPriceLevelEmpty), prices.end());
+
+    if (prices.empty()) metadex.erase(book);
+}
+
+/** Moves the remaining amount of an order back from reserve to balance. */
+static void ReleaseOrder(const CMPMetaDEx& order)
+{
+    assert(update_tally_map(order.getAddr(), order.getProperty(), -order.getAmountRemaining(), METADEX_RESERVE));
+    assert(update_tally_map(order.getAddr(), order.getProperty(), order.getAmountRemaining(), BALANCE));
+}
+
+/** Moves the remaining amount of an order back from reserve to balance and records the cancellation. */
+static void CancelOrder(const CMPMetaDEx& order, const uint256& txid, unsigned int block)
+{
+    ReleaseOrder(order);
+
+    // record the cancellation
+    bool bValid = true;
+    p_txlistdb->recordMetaDExCancelTX(txid, order.getHash(), bValid, block, order.getProperty(), order.getAmountRemaining());
+}
+
+md_Set* elysium::get_Indexes(md_PricesMap* p, const rational_t& price)
+{
+    md_PricesMap::iterator it = FindPriceLevel(*p, price);
 
     if (it != p->end()) return &(it->second);
 
@@ -136,49 +218,47 @@ static MatchReturnType x_Trade(CMPMetaDEx* const pnew)
 {
     const uint32_t propertyForSale = pnew->getProperty();
     const uint32_t propertyDesired = pnew->getDesProperty();
+    const rational_t buyersPrice = pnew->inversePrice();
     MatchReturnType NewReturn = NOTHING;
     bool bBuyerSatisfied = false;
+    bool bLevelEmptied = false;
 
     if (elysium_debug_metadex1) PrintToLog("%s(%s: prop=%d, desprop=%d, desprice= %s);newo: %s\n",
-        __FUNCTION__, pnew->getAddr(), propertyForSale, propertyDesired, xToString(pnew->inversePrice()), pnew->ToString());
+        __FUNCTION__, pnew->getAddr(), propertyForSale, propertyDesired, xToString(buyersPrice), pnew->ToString());
 
-    md_PricesMap* const ppriceMap = get_Prices(propertyDesired);
+    // the opposite side of the market sells the desired property for the property offered
+    md_PropertiesMap::iterator bookIt = metadex.find(std::make_pair(propertyDesired, propertyForSale));
 
     // nothing for the desired property exists in the market, sorry!
-    if (!ppriceMap) {
+    if (bookIt == metadex.end()) {
         PrintToLog("%s()=%d:%s NOT FOUND ON THE MARKET\n", __FUNCTION__, NewReturn, getTradeReturnType(NewReturn));
         return NewReturn;
     }
 
-    // within the desired property map (given one property) iterate over the items looking at prices
-    for (md_PricesMap::iterator priceIt = ppriceMap->begin(); priceIt != ppriceMap->end(); ++priceIt) { // check all prices
-        const rational_t sellersPrice = priceIt->first;
+    md_PricesMap& prices = bookIt->second;
+
+    // within the book of the pair iterate over the price levels, starting with the lowest price
+    for (md_PricesMap::iterator priceIt = prices.begin(); priceIt != prices.end(); ++priceIt) {
+        const rational_t& sellersPrice = priceIt->first;
 
         if (elysium_debug_metadex2) PrintToLog("comparing prices: desprice %s needs to be GREATER THAN OR EQUAL TO %s\n",
-            xToString(pnew->inversePrice()), xToString(sellersPrice));
+            xToString(buyersPrice), xToString(sellersPrice));
 
         // Is the desired price check satisfied? The buyer's inverse price must be larger than that of the seller.
-        if (pnew->inversePrice() < sellersPrice) {
-            continue;
+        // Price levels are sorted, so none of the following levels can satisfy the check either.
+        if (buyersPrice < sellersPrice) {
+            break;
         }
 
-        md_Set* const pofferSet = &(priceIt->second);
+        md_Set& offers = priceIt->second;
 
-        // at good (single) price level and property iterate over offers looking at all parameters to find the match
-        md_Set::iterator offerIt = pofferSet->begin();
-        while (offerIt != pofferSet->end()) { // specific price, check all properties
-            const CMPMetaDEx* const pold = &(*offerIt);
-            assert(pold->unitPrice() == sellersPrice);
+        // at good (single) price level iterate over offers looking at all parameters to find the match
+        for (md_Set::iterator offerIt = offers.begin(); offerIt != offers.end(); ++offerIt) {
+            CMPMetaDEx* const pold = &(*offerIt);
 
             if (elysium_debug_metadex1) PrintToLog("Looking at existing: %s (its prop= %d, its des prop= %d) = %s\n",
                 xToString(sellersPrice), pold->getProperty(), pold->getDesProperty(), pold->ToString());
 
-            // does the desired property match?
-            if (pold->getDesProperty() != propertyForSale) {
-                ++offerIt;
-                continue;
-            }
-
             if (elysium_debug_metadex1) PrintToLog("MATCH FOUND, Trade: %s = %s\n", xToString(sellersPrice), pold->ToString());
 
             // match found, execute trade now!
@@ -198,8 +278,7 @@ static MatchReturnType x_Trade(CMPMetaDEx* const pnew)
             assert(pnew->getProperty() != pnew->getDesProperty());
             assert(pnew->getProperty() == pold->getDesProperty());
             assert(pold->getProperty() == pnew->getDesProperty());
-            assert(pold->unitPrice() <= pnew->inversePrice());
-            assert(pnew->unitPrice() <= pold->inversePrice());
+            assert(sellersPrice <= buyersPrice);
 
             ///////////////////////////
 
@@ -219,7 +298,6 @@ static MatchReturnType x_Trade(CMPMetaDEx* const pnew)
             if (nCouldBuy == 0) {
                 if (elysium_debug_metadex1) PrintToLog(
                         "-- buyer has not enough tokens for sale to purchase one unit!\n");
-                ++offerIt;
                 continue;
             }
 
@@ -234,10 +312,9 @@ static MatchReturnType x_Trade(CMPMetaDEx* const pnew)
             // orders shall not execute, and no representable fill is made
             const rational_t xEffectivePrice(nWouldPay, nCouldBuy);
 
-            if (xEffectivePrice > pnew->inversePrice()) {
+            if (xEffectivePrice > buyersPrice) {
                 if (elysium_debug_metadex1) PrintToLog(
                         "-- effective price is too expensive: %s\n", xToString(xEffectivePrice));
-                ++offerIt;
                 continue;
             }
 
@@ -252,8 +329,8 @@ static MatchReturnType x_Trade(CMPMetaDEx* const pnew)
             ///////////////////////////
 
             // postconditions
-            assert(xEffectivePrice >= pold->unitPrice());
-            assert(xEffectivePrice <= pnew->inversePrice());
+            assert(xEffectivePrice >= sellersPrice);
+            assert(xEffectivePrice <= buyersPrice);
             assert(0 <= seller_amountLeft);
             assert(0 <= buyer_amountLeft);
             assert(seller_amountForSale == seller_amountLeft + buyer_amountGot);
@@ -290,8 +367,8 @@ static MatchReturnType x_Trade(CMPMetaDEx* const pnew)
 
             NewReturn = TRADED;
 
-            CMPMetaDEx seller_replacement = *pold; // < can be moved into last if block
-            seller_replacement.setAmountRemaining(seller_amountLeft, "seller_replacement");
+            // update the old seller element in place, filled orders are dropped once the price level is processed
+            pold->setAmountRemaining(seller_amountLeft, "seller_replacement");
 
             pnew->setAmountRemaining(buyer_amountLeft, "buyer");
 
@@ -313,25 +390,22 @@ static MatchReturnType x_Trade(CMPMetaDEx* const pnew)
             t_tradelistdb->recordMatchedTrade(pold->getHash(), pnew->getHash(), // < might just pass pold, pnew
                 pold->getAddr(), pnew->getAddr(), pold->getDesProperty(), pnew->getDesProperty(), seller_amountGot, buyer_amountGotAfterFee, pnew->getBlock(), tradingFee);
 
-            if (elysium_debug_metadex1) PrintToLog("++ erased old: %s\n", offerIt->ToString());
-            // erase the old seller element
-            pofferSet->erase(offerIt++);
-
-            // insert the updated one in place of the old
-            if (0 < seller_replacement.getAmountRemaining()) {
-                PrintToLog("++ inserting seller_replacement: %s\n", seller_replacement.ToString());
-                pofferSet->insert(seller_replacement);
-            }
-
             if (bBuyerSatisfied) {
                 assert(buyer_amountLeft == 0);
                 break;
             }
-        } // specific price, check all properties
+        } // specific price, check all offers
+
+        // erase the filled seller elements
+        RemoveOrdersIf(offers, [](const CMPMetaDEx& offer) { return offer.getAmountRemaining() == 0; });
+
+        if (offers.empty()) bLevelEmptied = true;
 
         if (bBuyerSatisfied) break;
     } // check all prices
 
+    if (bLevelEmptied) PruneBook(bookIt);
+
     PrintToLog("%s()=%d:%s\n", __FUNCTION__, NewReturn, getTradeReturnType(NewReturn));
 
     return NewReturn;
@@ -426,28 +500,6 @@ std::string CMPMetaDEx::ToString() const
         property, FormatMP(property, amount_forsale), desired_property, FormatMP(desired_property, amount_desired));
 }
 
-void CMPMetaDEx::saveOffer(std::ofstream& file, SHA256_CTX* shaCtx) const
-{
-    std::string lineOut = strprintf("%s,%d,%d,%d,%d,%d,%d,%d,%s,%d",
-        addr,
-        block,
-        amount_forsale,
-        property,
-        amount_desired,
-        desired_property,
-        subaction,
-        idx,
-        txid.ToString(),
-        amount_remaining
-    );
-
-    // add the line to the hash
-    SHA256_Update(shaCtx, lineOut.c_str(), lineOut.length());
-
-    // write the line
-    file << lineOut << std::endl;
-}
-
 bool MetaDEx_compare::operator()(const CMPMetaDEx &lhs, const CMPMetaDEx &rhs) const
 {
     if (lhs.getBlock() == rhs.getBlock()) return lhs.getIdx() < rhs.getIdx();
@@ -456,35 +508,28 @@ bool MetaDEx_compare::operator()(const CMPMetaDEx &lhs, const CMPMetaDEx &rhs) c
 
 bool elysium::MetaDEx_INSERT(const CMPMetaDEx& objMetaDEx)
 {
-    // Create an empty price map (to use in case price map for this property does not already exist)
-    md_PricesMap temp_prices;
-    // Attempt to obtain the price map for the property
-    md_PricesMap *p_prices = get_Prices(objMetaDEx.getProperty());
-
-    // Create an empty set of metadex objects (to use in case no set currently exists at this price)
-    md_Set temp_indexes;
-    md_Set *p_indexes = NULL;
+    const rational_t price = objMetaDEx.unitPrice();
 
-    // Prepare for return code
-    std::pair <md_Set::iterator, bool> ret;
+    // Obtain the book of the property pair, it is created, if it does not already exist
+    md_PricesMap& prices = metadex[std::make_pair(objMetaDEx.getProperty(), objMetaDEx.getDesProperty())];
 
-    // Attempt to obtain a set of metadex objects for this price from the price map
-    if (p_prices) p_indexes = get_Indexes(p_prices, objMetaDEx.unitPrice());
-    // See if the set was populated, if not no set exists at this price level, use the empty set that we created earlier
-    if (!p_indexes) p_indexes = &temp_indexes;
-
-    // Attempt to insert the metadex object into the set
-    ret = p_indexes->insert(objMetaDEx);
-    if (false == ret.second) return false;
+    // Locate the price level, or create it in place, if no order exists at this price
+    md_PricesMap::iterator levelIt = std::lower_bound(prices.begin(), prices.end(), price, PriceLevel_compare());
+    if (levelIt == prices.end() || levelIt->first != price) {
+        levelIt = prices.insert(levelIt, md_PriceLevel(price, md_Set()));
+    }
 
-    // If a prices map did not exist for this property, set p_prices to the temp empty price map
-    if (!p_prices) p_prices = &temp_prices;
+    md_Set& indexes = levelIt->second;
+    MetaDEx_compare compare;
 
-    // Update the prices map with the new set at this price
-    (*p_prices)[objMetaDEx.unitPrice()] = *p_indexes;
+    // Orders usually arrive in block order and are appended, otherwise the position is searched
+    md_Set::iterator position = indexes.end();
+    if (!indexes.empty() && !compare(indexes.back(), objMetaDEx)) {
+        position = std::lower_bound(indexes.begin(), indexes.end(), objMetaDEx, compare);
+        if (!compare(objMetaDEx, *position)) return false;
+    }
 
-    // Set the metadex map for the property to the updated (or new if it didn't exist) price map
-    metadex[objMetaDEx.getProperty()] = *p_prices;
+    indexes.insert(position, objMetaDEx);
 
     return true;
 }
@@ -529,50 +574,35 @@ int elysium::MetaDEx_CANCEL_AT_PRICE(const uint256& txid, unsigned int block, co
 {
     int rc = METADEX_ERROR -20;
     CMPMetaDEx mdex(sender_addr, 0, prop, amount, property_desired, amount_desired, uint256(), 0, CMPTransaction::CANCEL_AT_PRICE);
-    md_PricesMap* prices = get_Prices(prop);
-    const CMPMetaDEx* p_mdex = NULL;
 
     if (elysium_debug_metadex1) PrintToLog("%s():%s\n", __FUNCTION__, mdex.ToString());
 
     if (elysium_debug_metadex2) MetaDEx_debug_print();
 
-    if (!prices) {
+    if (BeginProperty(prop) == EndProperty(prop)) {
         PrintToLog("%s() NOTHING FOUND for %s\n", __FUNCTION__, mdex.ToString());
         return rc -1;
     }
 
-    // within the desired property map (given one property) iterate over the items
-    for (md_PricesMap::iterator my_it = prices->begin(); my_it != prices->end(); ++my_it) {
-        rational_t sellers_price = my_it->first;
+    md_PropertiesMap::iterator bookIt = metadex.find(std::make_pair(prop, property_desired));
+    if (bookIt == metadex.end()) return rc;
 
-        if (mdex.unitPrice() != sellers_price) continue;
+    // within the book of the pair only the level at the given price is affected
+    md_PricesMap::iterator levelIt = FindPriceLevel(bookIt->second, mdex.unitPrice());
+    if (levelIt == bookIt->second.end()) return rc;
 
-        md_Set* indexes = &(my_it->second);
+    RemoveOrdersIf(levelIt->second, [&](const CMPMetaDEx& order) {
+        if (elysium_debug_metadex3) PrintToLog("%s(): %s\n", __FUNCTION__, order.ToString());
 
-        for (md_Set::iterator iitt = indexes->begin(); iitt != indexes->end();) {
-            p_mdex = &(*iitt);
+        if (order.getAddr() != sender_addr) return false;
 
-            if (elysium_debug_metadex3) PrintToLog("%s(): %s\n", __FUNCTION__, p_mdex->ToString());
+        rc = 0;
+        PrintToLog("%s(): REMOVING %s\n", __FUNCTION__, order.ToString());
+        CancelOrder(order, txid, block);
+        return true;
+    });
 
-            if ((p_mdex->getDesProperty() != property_desired) || (p_mdex->getAddr() != sender_addr)) {
-                ++iitt;
-                continue;
-            }
-
-            rc = 0;
-            PrintToLog("%s(): REMOVING %s\n", __FUNCTION__, p_mdex->ToString());
-
-            // move from reserve to main
-            assert(update_tally_map(p_mdex->getAddr(), p_mdex->getProperty(), -p_mdex->getAmountRemaining(), METADEX_RESERVE));
-            assert(update_tally_map(p_mdex->getAddr(), p_mdex->getProperty(), p_mdex->getAmountRemaining(), BALANCE));
-
-            // record the cancellation
-            bool bValid = true;
-            p_txlistdb->recordMetaDExCancelTX(txid, p_mdex->getHash(), bValid, block, p_mdex->getProperty(), p_mdex->getAmountRemaining());
-
-            indexes->erase(iitt++);
-        }
-    }
+    PruneBook(bookIt);
 
     if (elysium_debug_metadex2) MetaDEx_debug_print();
 
@@ -582,47 +612,35 @@ int elysium::MetaDEx_CANCEL_AT_PRICE(const uint256& txid, unsigned int block, co
 int elysium::MetaDEx_CANCEL_ALL_FOR_PAIR(const uint256& txid, unsigned int block, const std::string& sender_addr, uint32_t prop, uint32_t property_desired)
 {
     int rc = METADEX_ERROR -30;
-    md_PricesMap* prices = get_Prices(prop);
-    const CMPMetaDEx* p_mdex = NULL;
 
     PrintToLog("%s(%d,%d)\n", __FUNCTION__, prop, property_desired);
 
     if (elysium_debug_metadex3) MetaDEx_debug_print();
 
-    if (!prices) {
+    if (BeginProperty(prop) == EndProperty(prop)) {
         PrintToLog("%s() NOTHING FOUND\n", __FUNCTION__);
         return rc -1;
     }
 
-    // within the desired property map (given one property) iterate over the items
-    for (md_PricesMap::iterator my_it = prices->begin(); my_it != prices->end(); ++my_it) {
-        md_Set* indexes = &(my_it->second);
-
-        for (md_Set::iterator iitt = indexes->begin(); iitt != indexes->end();) {
-            p_mdex = &(*iitt);
+    md_PropertiesMap::iterator bookIt = metadex.find(std::make_pair(prop, property_desired));
+    if (bookIt == metadex.end()) return rc;
 
-            if (elysium_debug_metadex3) PrintToLog("%s(): %s\n", __FUNCTION__, p_mdex->ToString());
+    // within the book of the pair iterate over the price levels
+    for (md_PricesMap::iterator my_it = bookIt->second.begin(); my_it != bookIt->second.end(); ++my_it) {
+        RemoveOrdersIf(my_it->second, [&](const CMPMetaDEx& order) {
+            if (elysium_debug_metadex3) PrintToLog("%s(): %s\n", __FUNCTION__, order.ToString());
 
-            if ((p_mdex->getDesProperty() != property_desired) || (p_mdex->getAddr() != sender_addr)) {
-                ++iitt;
-                continue;
-            }
+            if (order.getAddr() != sender_addr) return false;
 
             rc = 0;
-            PrintToLog("%s(): REMOVING %s\n", __FUNCTION__, p_mdex->ToString());
-
-            // move from reserve to main
-            assert(update_tally_map(p_mdex->getAddr(), p_mdex->getProperty(), -p_mdex->getAmountRemaining(), METADEX_RESERVE));
-            assert(update_tally_map(p_mdex->getAddr(), p_mdex->getProperty(), p_mdex->getAmountRemaining(), BALANCE));
-
-            // record the cancellation
-            bool bValid = true;
-            p_txlistdb->recordMetaDExCancelTX(txid, p_mdex->getHash(), bValid, block, p_mdex->getProperty(), p_mdex->getAmountRemaining());
-
-            indexes->erase(iitt++);
-        }
+            PrintToLog("%s(): REMOVING %s\n", __FUNCTION__, order.ToString());
+            CancelOrder(order, txid, block);
+            return true;
+        });
     }
 
+    PruneBook(bookIt);
+
     if (elysium_debug_metadex3) MetaDEx_debug_print();
 
     return rc;
@@ -630,6 +648,9 @@ int elysium::MetaDEx_CANCEL_ALL_FOR_PAIR(const uint256& txid, unsigned int block
 
 /**
  * Scans the orderbook and remove everything for an address.
+ *
+ * Cancellations are recorded per property for sale, ordered by price and position,
+ * independent of the desired property of the orders.
  */
 int elysium::MetaDEx_CANCEL_EVERYTHING(const uint256& txid, unsigned int block, const std::string& sender_addr, unsigned char ecosystem)
 {
@@ -641,44 +662,50 @@ int elysium::MetaDEx_CANCEL_EVERYTHING(const uint256& txid, unsigned int block,
 
     PrintToLog("<<<<<<\n");
 
-    for (md_PropertiesMap::iterator my_it = metadex.begin(); my_it != metadex.end(); ++my_it) {
-        unsigned int prop = my_it->first;
+    md_PropertiesMap::iterator my_it = metadex.begin();
+    while (my_it != metadex.end()) {
+        uint32_t prop = my_it->first.first;
+        md_PropertiesMap::iterator endIt = EndProperty(prop);
 
         // skip property, if it is not in the expected ecosystem
-        if (isMainEcosystemProperty(ecosystem) && !isMainEcosystemProperty(prop)) continue;
-        if (isTestEcosystemProperty(ecosystem) && !isTestEcosystemProperty(prop)) continue;
-
-        PrintToLog(" ## property: %u\n", prop);
-        md_PricesMap& prices = my_it->second;
-
-        for (md_PricesMap::iterator it = prices.begin(); it != prices.end(); ++it) {
-            rational_t price = it->first;
-            md_Set& indexes = it->second;
-
-            PrintToLog("  # Price Level: %s\n", xToString(price));
+        if ((isMainEcosystemProperty(ecosystem) && !isMainEcosystemProperty(prop)) ||
+                (isTestEcosystemProperty(ecosystem) && !isTestEcosystemProperty(prop))) {
+            my_it = endIt;
+            continue;
+        }
 
-            for (md_Set::iterator it = indexes.begin(); it != indexes.end();) {
-                PrintToLog("%s= %s\n", xToString(price), it->ToString());
+        if (elysium_debug_metadex2) PrintToLog(" ## property: %u\n", prop);
 
-                if (it->getAddr() != sender_addr) {
-                    ++it;
-                    continue;
+        // collect the orders of the address in all books of the property
+        std::vector<std::pair<rational_t, const CMPMetaDEx*> > orders;
+        for (md_PropertiesMap::iterator bookIt = my_it; bookIt != endIt; ++bookIt) {
+            for (md_PricesMap::iterator it = bookIt->second.begin(); it != bookIt->second.end(); ++it) {
+                for (md_Set::iterator order = it->second.begin(); order != it->second.end(); ++order) {
+                    if (order->getAddr() == sender_addr) orders.push_back(std::make_pair(it->first, &(*order)));
                 }
+            }
+        }
 
-                rc = 0;
-                PrintToLog("%s(): REMOVING %s\n", __FUNCTION__, it->ToString());
-
-                // move from reserve to balance
-                assert(update_tally_map(it->getAddr(), it->getProperty(), -it->getAmountRemaining(), METADEX_RESERVE));
-                assert(update_tally_map(it->getAddr(), it->getProperty(), it->getAmountRemaining(), BALANCE));
+        std::sort(orders.begin(), orders.end(), [](const std::pair<rational_t, const CMPMetaDEx*>& lhs, const std::pair<rational_t, const CMPMetaDEx*>& rhs) {
+            if (lhs.first != rhs.first) return lhs.first < rhs.first;
+            return MetaDEx_compare()(*lhs.second, *rhs.second);
+        });
 
-                // record the cancellation
-                bool bValid = true;
-                p_txlistdb->recordMetaDExCancelTX(txid, it->getHash(), bValid, block, it->getProperty(), it->getAmountRemaining());
+        for (std::vector<std::pair<rational_t, const CMPMetaDEx*> >::const_iterator it = orders.begin(); it != orders.end(); ++it) {
+            rc = 0;
+            PrintToLog("%s(): REMOVING %s\n", __FUNCTION__, it->second->ToString());
+            CancelOrder(*it->second, txid, block);
+        }
 
-                indexes.erase(it++);
+        while (!orders.empty() && my_it != endIt) {
+            md_PropertiesMap::iterator bookIt = my_it++;
+            for (md_PricesMap::iterator it = bookIt->second.begin(); it != bookIt->second.end(); ++it) {
+                RemoveOrdersIf(it->second, [&](const CMPMetaDEx& order) { return order.getAddr() == sender_addr; });
             }
+            PruneBook(bookIt);
         }
+
+        my_it = endIt;
     }
     PrintToLog(">>>>>>\n");
 
@@ -694,20 +721,22 @@ int elysium::MetaDEx_SHUTDOWN_ALLPAIR()
 {
     int rc = 0;
     PrintToLog("%s()\n", __FUNCTION__);
-    for (md_PropertiesMap::iterator my_it = metadex.begin(); my_it != metadex.end(); ++my_it) {
+    md_PropertiesMap::iterator my_it = metadex.begin();
+    while (my_it != metadex.end()) {
+        const md_PropertyPair& pair = my_it->first;
+        if (pair.first <= ELYSIUM_PROPERTY_TELYSIUM || pair.second <= ELYSIUM_PROPERTY_TELYSIUM) { // ELYSIUM/TELYSIUM side to the trade
+            ++my_it;
+            continue;
+        }
         md_PricesMap& prices = my_it->second;
         for (md_PricesMap::iterator it = prices.begin(); it != prices.end(); ++it) {
             md_Set& indexes = it->second;
-            for (md_Set::iterator it = indexes.begin(); it != indexes.end();) {
-                if (it->getDesProperty() > ELYSIUM_PROPERTY_TELYSIUM && it->getProperty() > ELYSIUM_PROPERTY_TELYSIUM) { // no ELYSIUM/TELYSIUM side to the trade
-                    PrintToLog("%s(): REMOVING %s\n", __FUNCTION__, it->ToString());
-                    // move from reserve to balance
-                    assert(update_tally_map(it->getAddr(), it->getProperty(), -it->getAmountRemaining(), METADEX_RESERVE));
-                    assert(update_tally_map(it->getAddr(), it->getProperty(), it->getAmountRemaining(), BALANCE));
-                    indexes.erase(it++);
-                }
+            for (md_Set::iterator it = indexes.begin(); it != indexes.end(); ++it) {
+                PrintToLog("%s(): REMOVING %s\n", __FUNCTION__, it->ToString());
+                ReleaseOrder(*it);
             }
         }
+        metadex.erase(my_it++);
     }
     return rc;
 }
@@ -723,15 +752,13 @@ int elysium::MetaDEx_SHUTDOWN()
         md_PricesMap& prices = my_it->second;
         for (md_PricesMap::iterator it = prices.begin(); it != prices.end(); ++it) {
             md_Set& indexes = it->second;
-            for (md_Set::iterator it = indexes.begin(); it != indexes.end();) {
+            for (md_Set::iterator it = indexes.begin(); it != indexes.end(); ++it) {
                 PrintToLog("%s(): REMOVING %s\n", __FUNCTION__, it->ToString());
-                // move from reserve to balance
-                assert(update_tally_map(it->getAddr(), it->getProperty(), -it->getAmountRemaining(), METADEX_RESERVE));
-                assert(update_tally_map(it->getAddr(), it->getProperty(), it->getAmountRemaining(), BALANCE));
-                indexes.erase(it++);
+                ReleaseOrder(*it);
             }
         }
     }
+    metadex.clear();
     return rc;
 }
 
@@ -739,14 +766,18 @@ int elysium::MetaDEx_SHUTDOWN()
 // allows search to be optimized if propertyIdForSale is specified
 bool elysium::MetaDEx_isOpen(const uint256& txid, uint32_t propertyIdForSale)
 {
-    for (md_PropertiesMap::iterator my_it = metadex.begin(); my_it != metadex.end(); ++my_it) {
-        if (propertyIdForSale != 0 && propertyIdForSale != my_it->first) continue;
+    md_PropertiesMap::iterator my_it = metadex.begin();
+    md_PropertiesMap::iterator endIt = metadex.end();
+    if (propertyIdForSale != 0) {
+        my_it = BeginProperty(propertyIdForSale);
+        endIt = EndProperty(propertyIdForSale);
+    }
+    for (; my_it != endIt; ++my_it) {
         md_PricesMap & prices = my_it->second;
         for (md_PricesMap::iterator it = prices.begin(); it != prices.end(); ++it) {
             md_Set & indexes = (it->second);
             for (md_Set::iterator it = indexes.begin(); it != indexes.end(); ++it) {
-                CMPMetaDEx obj = *it;
-                if( obj.getHash().GetHex() == txid.GetHex() ) return true;
+                if (it->getHash() == txid) return true;
             }
         }
     }
@@ -809,9 +840,10 @@ void elysium::MetaDEx_debug_print(bool bShowPriceLevel, bool bDisplay)
 {
     PrintToLog("<<<\n");
     for (md_PropertiesMap::iterator my_it = metadex.begin(); my_it != metadex.end(); ++my_it) {
-        uint32_t prop = my_it->first;
+        uint32_t prop = my_it->first.first;
+        uint32_t propDesired = my_it->first.second;
 
-        PrintToLog(" ## property: %u\n", prop);
+        PrintToLog(" ## property: %u, desired property: %u\n", prop, propDesired);
         md_PricesMap& prices = my_it->second;
 
         for (md_PricesMap::iterator it = prices.begin(); it != prices.end(); ++it) {
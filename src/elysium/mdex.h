@@ -3,6 +3,7 @@
 
 #include "elysium/tx.h"
 
+#include "serialize.h"
 #include "uint256.h"
 
 #include <boost/lexical_cast.hpp>
@@ -18,6 +19,8 @@
 #include <map>
 #include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
 typedef boost::rational<boost::multiprecision::checked_int128_t> rational_t;
 
@@ -99,7 +102,21 @@ public:
     /** Used for display of unit prices with 50 decimal places at RPC layer. */
     std::string displayFullUnitPrice() const;
 
-    void saveOffer(std::ofstream& file, SHA256_CTX* shaCtx) const;
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream, typename Operation>
+    inline void SerializationOp(Stream& s, Operation ser_action) {
+        READWRITE(block);
+        READWRITE(txid);
+        READWRITE(idx);
+        READWRITE(property);
+        READWRITE(amount_forsale);
+        READWRITE(desired_property);
+        READWRITE(amount_desired);
+        READWRITE(amount_remaining);
+        READWRITE(subaction);
+        READWRITE(addr);
+    }
 };
 
 namespace elysium
@@ -110,19 +127,22 @@ struct MetaDEx_compare
 };
 
 // ---------------
-//! Set of objects sorted by block+idx
-typedef std::set<CMPMetaDEx, MetaDEx_compare> md_Set;
-//! Map of prices; there is a set of sorted objects for each price
-typedef std::map<rational_t, md_Set> md_PricesMap;
-//! Map of properties; there is a map of prices for each property
-typedef std::map<uint32_t, md_PricesMap> md_PropertiesMap;
+//! Orders resting at a single price level, stored contiguously and sorted by block+idx
+typedef std::vector<CMPMetaDEx> md_Set;
+//! A price level; the key is the normalized unit price, computed once when the order is inserted
+typedef std::pair<rational_t, md_Set> md_PriceLevel;
+//! Price levels of a property pair, stored contiguously and sorted by ascending unit price
+typedef std::vector<md_PriceLevel> md_PricesMap;
+//! Property pair, made of the property for sale and the desired property
+typedef std::pair<uint32_t, uint32_t> md_PropertyPair;
+//! Map of property pairs; there is a book of price levels for each pair
+typedef std::map<md_PropertyPair, md_PricesMap> md_PropertiesMap;
 
 //! Global map for price and order data
 extern md_PropertiesMap metadex;
 
-// TODO: explore a property-pair, instead of a single property as map's key........
-md_PricesMap* get_Prices(uint32_t prop);
-md_Set* get_Indexes(md_PricesMap* p, rational_t price);
+md_PricesMap* get_Prices(uint32_t prop, uint32_t propDesired);
+md_Set* get_Indexes(md_PricesMap* p, const rational_t& price);
 // ---------------
 
 int MetaDEx_ADD(const std::string& sender_addr, uint32_t, int64_t, int block, uint32_t property_desired, int64_t amount_desired, const uint256& txid, unsigned int idx);
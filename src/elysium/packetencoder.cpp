@@ -55,7 +55,7 @@ const CBitcoinAddress& GetSystemAddress()
     return isNonMainNet() ? testAddress : mainAddress;
 }
 
-boost::optional<PacketClass> DeterminePacketClass(const CTransaction& tx, int height)
+static boost::optional<PacketClass> InspectOutputs(const CTransaction& tx, const boost::optional<int>& height)
 {
     // Inspect all outputs.
     auto& sysAddr = GetSystemAddress();
@@ -70,7 +70,7 @@ boost::optional<PacketClass> DeterminePacketClass(const CTransaction& tx, int he
             continue;
         }
 
-        if (!IsAllowedOutputType(type, height)) {
+        if (height && !IsAllowedOutputType(type, *height)) {
             continue;
         }
 
@@ -106,6 +106,16 @@ boost::optional<PacketClass> DeterminePacketClass(const CTransaction& tx, int he
     return boost::none;
 }
 
+boost::optional<PacketClass> DeterminePacketClass(const CTransaction& tx, int height)
+{
+    return InspectOutputs(tx, height);
+}
+
+bool MayHavePacket(const CTransaction& tx)
+{
+    return InspectOutputs(tx, boost::none) != boost::none;
+}
+
 } // namespace elysium
 
 namespace std {
@@ -137,6 +137,14 @@ extern const std::array<unsigned char, 6> magic;
 const CBitcoinAddress& GetSystemAddress();
 boost::optional<PacketClass> DeterminePacketClass(const CTransaction& tx, int height);
 
+/**
+ * Checks whether a transaction may carry a packet at any block height.
+ *
+ * This is a superset of DeterminePacketClass(), which doesn't depend on consensus
+ * parameters, and can therefore be used to prefilter transactions from any thread.
+ **/
+bool MayHavePacket(const CTransaction& tx);
+
 /**
  * Embedds a payload in obfuscated multisig outputs, then adds P2PKH output to system address.
  *
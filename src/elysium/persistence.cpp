@@ -9,6 +9,8 @@
 
 #include <boost/filesystem/path.hpp>
 
+#include <memory>
+
 #include <stdint.h>
 
 /**
@@ -53,6 +55,82 @@ void CDBBase::Clear()
             n, status.ToString(), (n > 0 ? (0.001 * nTime / n) : 0), 0.001 * nTime);
 }
 
+/**
+ * Visits the entries with keys in the range [first, last).
+ */
+size_t CDBBase::IterateRange(const std::string& first, const std::string& last,
+    const std::function<bool(const leveldb::Slice&, const leveldb::Slice&)>& visitor,
+    size_t skip, size_t limit, bool reverse) const
+{
+    size_t visited = 0;
+    std::unique_ptr<leveldb::Iterator> it(NewIterator());
+
+    if (reverse) {
+        if (last.empty()) {
+            it->SeekToLast();
+        } else {
+            it->Seek(last);
+            if (it->Valid()) {
+                it->Prev();
+            } else {
+                it->SeekToLast();
+            }
+        }
+    } else {
+        it->Seek(first);
+    }
+
+    for (; it->Valid() && visited < limit; reverse ? it->Prev() : it->Next()) {
+        auto key = it->key();
+
+        if (reverse ? key.compare(first) < 0 : (!last.empty() && key.compare(last) >= 0)) {
+            break;
+        }
+
+        if (skip) {
+            --skip;
+            continue;
+        }
+
+        ++visited;
+
+        if (!visitor(key, it->value())) {
+            break;
+        }
+    }
+
+    return visited;
+}
+
+/**
+ * Visits the entries with keys starting with the given prefix.
+ */
+size_t CDBBase::IteratePrefix(const std::string& prefix,
+    const std::function<bool(const leveldb::Slice&, const leveldb::Slice&)>& visitor,
+    size_t skip, size_t limit, bool reverse) const
+{
+    return IterateRange(prefix, PrefixEnd(prefix), visitor, skip, limit, reverse);
+}
+
+/**
+ * Returns the smallest key greater than all keys starting with the given prefix.
+ */
+std::string CDBBase::PrefixEnd(const std::string& prefix)
+{
+    std::string end = prefix;
+
+    while (!end.empty()) {
+        auto& last = reinterpret_cast<unsigned char&>(end.back());
+        if (last != 0xff) {
+            ++last;
+            return end;
+        }
+        end.pop_back();
+    }
+
+    return end;
+}
+
 /**
  * Deinitializes and closes the database.
  */
@@ -5,6 +5,10 @@
 
 #include <boost/filesystem/path.hpp>
 
+#include <functional>
+#include <limits>
+#include <string>
+
 #include <assert.h>
 #include <stddef.h>
 
@@ -69,6 +73,40 @@ protected:
         return pdb->NewIterator(iteroptions);
     }
 
+    /**
+     * Visits the entries with keys in the range [first, last), in key order or in reverse order.
+     *
+     * The first entries of the range are passed over, as given by skip, and at most limit entries
+     * are visited, which allows to page through large ranges. An empty last key means the range is
+     * not bounded. The visitor can stop the iteration by returning false.
+     *
+     * @param first    The first key of the range
+     * @param last     The key after the last key of the range
+     * @param visitor  Called with the key and value of each visited entry
+     * @param skip     The number of entries to skip
+     * @param limit    The maximum number of entries to visit
+     * @param reverse  Whether to iterate from the end of the range
+     * @return The number of visited entries
+     */
+    size_t IterateRange(const std::string& first, const std::string& last,
+        const std::function<bool(const leveldb::Slice&, const leveldb::Slice&)>& visitor,
+        size_t skip = 0, size_t limit = std::numeric_limits<size_t>::max(), bool reverse = false) const;
+
+    /**
+     * Visits the entries with keys starting with the given prefix.
+     *
+     * @see IterateRange
+     */
+    size_t IteratePrefix(const std::string& prefix,
+        const std::function<bool(const leveldb::Slice&, const leveldb::Slice&)>& visitor,
+        size_t skip = 0, size_t limit = std::numeric_limits<size_t>::max(), bool reverse = false) const;
+
+    /**
+     * Returns the smallest key greater than all keys starting with the given prefix, or an
+     * empty string, if there is no such key.
+     */
+    static std::string PrefixEnd(const std::string& prefix);
+
     /**
      * Opens or creates a LevelDB based database.
      *
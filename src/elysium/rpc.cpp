@@ -1426,15 +1426,13 @@ UniValue elysium_getorderbook(const JSONRPCRequest& request)
     std::vector<CMPMetaDEx> vecMetaDexObjects;
     {
         LOCK(cs_main);
-        for (md_PropertiesMap::const_iterator my_it = metadex.begin(); my_it != metadex.end(); ++my_it) {
+        md_PropertiesMap::const_iterator my_it = metadex.lower_bound(std::make_pair(propertyIdForSale, uint32_t(0)));
+        for (; my_it != metadex.end() && my_it->first.first == propertyIdForSale; ++my_it) {
+            if (filterDesired && my_it->first.second != propertyIdDesired) continue;
             const md_PricesMap& prices = my_it->second;
             for (md_PricesMap::const_iterator it = prices.begin(); it != prices.end(); ++it) {
                 const md_Set& indexes = it->second;
-                for (md_Set::const_iterator it = indexes.begin(); it != indexes.end(); ++it) {
-                    const CMPMetaDEx& obj = *it;
-                    if (obj.getProperty() != propertyIdForSale) continue;
-                    if (!filterDesired || obj.getDesProperty() == propertyIdDesired) vecMetaDexObjects.push_back(obj);
-                }
+                vecMetaDexObjects.insert(vecMetaDexObjects.end(), indexes.begin(), indexes.end());
             }
         }
     }
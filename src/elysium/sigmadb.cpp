@@ -244,13 +244,20 @@ void SafeSeekToPreviousKey(leveldb::Iterator *it, const leveldb::Slice& key)
 SigmaDatabase *sigmaDb;
 
 constexpr uint16_t SigmaDatabase::MAX_GROUP_SIZE;
+constexpr size_t SigmaDatabase::MAX_CACHED_GROUPS;
 
 // Database structure
 // Index height and commitment
 // 0<prob_id><denom><group_id><idx>=<GroupElement><int>
 // Sequence of mint sorted following blockchain
 // 1<seq uint64>=key
-SigmaDatabase::SigmaDatabase(const boost::filesystem::path& path, bool wipe, uint16_t groupSize)
+//
+// Entries are kept in memory until Flush() is called, which is done once per block, so a block with many mints
+// and spends costs a single synchronous write instead of one per entry.
+SigmaDatabase::SigmaDatabase(const boost::filesystem::path& path, bool wipe, uint16_t groupSize) :
+    nextSequence(0),
+    nextSequenceLoaded(false),
+    groupUses(0)
 {
     auto status = Open(path, wipe);
     if (!status.ok()) {
@@ -262,6 +269,11 @@ SigmaDatabase::SigmaDatabase(const boost::filesystem::path& path, bool wipe, uin
 
 SigmaDatabase::~SigmaDatabase()
 {
+    try {
+        Flush();
+    } catch (const std::exception& e) {
+        PrintToLog("%s: failed to write pending sigma entries: %s\n", __func__, e.what());
+    }
 }
 
 std::pair<SigmaMintGroup, SigmaMintIndex> SigmaDatabase::RecordMint(
@@ -270,29 +282,48 @@ std::pair<SigmaMintGroup, SigmaMintIndex> SigmaDatabase::RecordMint(
     const SigmaPublicKey& pubKey,
     int height)
 {
-    auto lastGroup = GetLastGroupId(propertyId, denomination);
-    auto mints = GetMintCount(propertyId, denomination, lastGroup);
+    SigmaMintGroup lastGroup;
+    size_t nextIdx;
 
-    if (mints > groupSize) {
-        throw std::runtime_error("mints count is exceed group limit");
-    }
-    auto nextIdx = mints;
+    {
+        LOCK(cs);
 
-    if (mints == groupSize) {
-        lastGroup++;
-        nextIdx = 0;
-    }
+        lastGroup = GetLastGroupId(propertyId, denomination);
+        auto mints = GetMintCount(propertyId, denomination, lastGroup);
+
+        if (mints > groupSize) {
+            throw std::runtime_error("mints count is exceed group limit");
+        }
+        nextIdx = mints;
 
-    // Add mint entry.
-    auto keyData = CreateMintKey(propertyId, denomination, lastGroup, nextIdx);
-    auto key = GetSlice(keyData);
+        if (mints == groupSize) {
+            lastGroup++;
+            nextIdx = 0;
+        }
+
+        // Add mint entry.
+        auto keyData = CreateMintKey(propertyId, denomination, lastGroup, nextIdx);
+        auto key = GetSlice(keyData);
+
+        std::vector<uint8_t> buffer(pubKey.commitment.memoryRequired());
+        pubKey.commitment.serialize(buffer.data());
 
-    std::vector<uint8_t> buffer(pubKey.commitment.memoryRequired());
-    pubKey.commitment.serialize(buffer.data());
+        AddEntry(key, GetSlice(buffer), height);
 
-    AddEntry(key, GetSlice(buffer), height);
+        lastGroups[std::make_pair(propertyId, denomination)] = std::make_pair(lastGroup, nextIdx + 1);
 
-    // Raise event.
+        // Keep decoded group in sync so the next spend of this group does not need to read it again.
+        auto cached = groups.find(std::make_tuple(propertyId, denomination, lastGroup));
+        if (cached != groups.end()) {
+            if (cached->second.mints.size() == nextIdx) {
+                cached->second.mints.push_back(pubKey);
+            } else {
+                groups.erase(cached);
+            }
+        }
+    }
+
+    // Raise event outside of the lock, handlers are free to read the database.
     MintAdded(propertyId, denomination, lastGroup, nextIdx, pubKey, height);
 
     return std::make_pair(lastGroup, nextIdx);
@@ -308,7 +339,10 @@ void SigmaDatabase::RecordSpendSerial(
     auto serialData = SerializeSpendSerial(serial);
     auto keyData = CreateSpendSerialKey(propertyId, denomination, serialData);
 
-    AddEntry(GetSlice(keyData), leveldb::Slice(std::string(spendTx.begin(), spendTx.end())), height);
+    {
+        LOCK(cs);
+        AddEntry(GetSlice(keyData), leveldb::Slice(std::string(spendTx.begin(), spendTx.end())), height);
+    }
 
     SpendAdded(propertyId, denomination, serial, spendTx);
 }
@@ -353,96 +387,109 @@ public:
 
 void SigmaDatabase::DeleteAll(int startBlock)
 {
-    auto nextSequence = GetNextSequence();
-    if (nextSequence == 0) {
-        // No mint to delete
-        return;
-    }
+    std::vector<std::function<void()>> defers; // functions to be called after delete whole keys
 
-    // Seek to most recent history.
-    auto lastSequence = nextSequence - 1;
-    auto sequenceKey = CreateSequenceKey(lastSequence);
+    {
+        LOCK(cs);
 
-    auto it = NewIterator();
-    it->Seek(GetSlice(sequenceKey));
+        // History of pending entries need to be in the database before walking it backward.
+        Flush();
 
-    leveldb::WriteBatch batch;
-    std::vector<std::function<void()>> defers; // functions to be called after delete whole keys
-    for (; it->Valid() && IsSequenceEntry(it.get()); it->Prev()) {
+        auto nextSequence = GetNextSequence();
+        if (nextSequence == 0) {
+            // No mint to delete
+            return;
+        }
 
-        CDataStream deserialized(
-            it->value().data(),
-            it->value().data() + it->value().size(),
-            SER_DISK, CLIENT_VERSION
-        );
+        // Seek to most recent history.
+        auto lastSequence = nextSequence - 1;
+        auto sequenceKey = CreateSequenceKey(lastSequence);
 
-        // Check if it need to delete then push it to batch
-        History entry;
-        deserialized >> entry;
+        auto it = NewIterator();
+        it->Seek(GetSlice(sequenceKey));
 
-        if (entry.block < startBlock) {
-            // We iterate in the latest to oldest that mean we can stop as soon as we found it block number is lower
-            // than theshold.
-            break;
-        }
+        leveldb::WriteBatch batch;
+        for (; it->Valid() && IsSequenceEntry(it.get()); it->Prev()) {
+
+            CDataStream deserialized(
+                it->value().data(),
+                it->value().data() + it->value().size(),
+                SER_DISK, CLIENT_VERSION
+            );
 
-        // intentionally using if instead of switch to separate scope
-        if (entry.op == OpCode::StoreMint) {
-            auto key = GetSlice(entry.data);
-
-            // retrieve meta data of mint
-            uint32_t propertyId;
-            uint8_t denomination;
-            uint32_t groupId;
-            uint16_t count;
-            if (!ParseMintKey(key, propertyId, denomination, groupId, count)) {
-                throw std::runtime_error("fail to parse mint key");
+            // Check if it need to delete then push it to batch
+            History entry;
+            deserialized >> entry;
+
+            if (entry.block < startBlock) {
+                // We iterate in the latest to oldest that mean we can stop as soon as we found it block number is lower
+                // than theshold.
+                break;
             }
 
-            // get commitment
-            std::string data;
-            auto status = pdb->Get(readoptions, key, &data);
-            if (!status.ok()) {
-                throw std::runtime_error("fail to get mint");
+            // intentionally using if instead of switch to separate scope
+            if (entry.op == OpCode::StoreMint) {
+                auto key = GetSlice(entry.data);
+
+                // retrieve meta data of mint
+                uint32_t propertyId;
+                uint8_t denomination;
+                uint32_t groupId;
+                uint16_t count;
+                if (!ParseMintKey(key, propertyId, denomination, groupId, count)) {
+                    throw std::runtime_error("fail to parse mint key");
+                }
+
+                // get commitment
+                std::string data;
+                auto status = pdb->Get(readoptions, key, &data);
+                if (!status.ok()) {
+                    throw std::runtime_error("fail to get mint");
+                }
+                CDataStream pubkeyDeserialized(data.data(), data.data() + data.size(), SER_DISK, CLIENT_VERSION);
+                SigmaPublicKey pub;
+                pubkeyDeserialized >> pub;
+
+                // function to trigger event
+                defers.push_back([this, propertyId, denomination, pub]() {
+                    MintRemoved(propertyId, denomination, pub);
+                });
+
+                groups.erase(std::make_tuple(propertyId, denomination, groupId));
+                lastGroups.erase(std::make_pair(propertyId, denomination));
+
+                batch.Delete(GetSlice(entry.data));
+            } else if (entry.op == OpCode::StoreSpendSerial) {
+                auto key = GetSlice(entry.data);
+
+                // retrieve meta data of spend
+                uint32_t propertyId;
+                uint8_t denomination;
+                SpendSerial serialData;
+                ParseSpendSerialKey(key, propertyId, denomination, serialData);
+
+                secp_primitives::Scalar serial;
+                serial.deserialize(serialData.data());
+
+                // function to trigger event
+                defers.push_back([this, propertyId, denomination, serial]() {
+                    SpendRemoved(propertyId, denomination, serial);
+                });
+
+                batch.Delete(key);
+            } else {
+                throw std::runtime_error("opcode is invalid");
             }
-            CDataStream pubkeyDeserialized(data.data(), data.data() + data.size(), SER_DISK, CLIENT_VERSION);
-            SigmaPublicKey pub;
-            pubkeyDeserialized >> pub;
-
-            // function to trigger event
-            defers.push_back([this, propertyId, denomination, pub]() {
-                MintRemoved(propertyId, denomination, pub);
-            });
-
-            batch.Delete(GetSlice(entry.data));
-        } else if (entry.op == OpCode::StoreSpendSerial) {
-            auto key = GetSlice(entry.data);
-
-            // retrieve meta data of spend
-            uint32_t propertyId;
-            uint8_t denomination;
-            SpendSerial serialData;
-            ParseSpendSerialKey(key, propertyId, denomination, serialData);
-
-            secp_primitives::Scalar serial;
-            serial.deserialize(serialData.data());
-
-            // function to trigger event
-            defers.push_back([this, propertyId, denomination, serial]() {
-                SpendRemoved(propertyId, denomination, serial);
-            });
-
-            batch.Delete(key);
-        } else {
-            throw std::runtime_error("opcode is invalid");
+
+            batch.Delete(it->key());
         }
 
-        batch.Delete(it->key());
-    }
+        auto status = pdb->Write(syncoptions, &batch);
+        if (!status.ok()) {
+            throw std::runtime_error("Fail to update database");
+        }
 
-    auto status = pdb->Write(syncoptions, &batch);
-    if (!status.ok()) {
-        throw std::runtime_error("Fail to update database");
+        this->nextSequenceLoaded = false;
     }
 
     for (auto &defer : defers) {
@@ -520,33 +567,13 @@ size_t SigmaDatabase::GetAnonimityGroup(
     uint32_t propertyId, uint8_t denomination, uint32_t groupId, size_t count,
     std::function<void(elysium::SigmaPublicKey&)> insertF)
 {
-    auto firstKey = CreateMintKey(propertyId, denomination, groupId, 0);
+    LOCK(cs);
 
-    auto it = NewIterator();
-    it->Seek(GetSlice(firstKey));
-
-    uint32_t mintPropId, mintGroupId;
-    uint16_t mintIdx;
-    uint8_t mintDenom;
+    auto& mints = GetCachedGroup(propertyId, denomination, groupId);
 
     size_t i = 0;
-    for (; i < count && it->Valid(); i++, it->Next()) {
-        if (!ParseMintKey(it->key(), mintPropId, mintDenom, mintGroupId, mintIdx) ||
-            mintPropId != propertyId ||
-            mintDenom != denomination ||
-            mintGroupId != groupId) {
-            break;
-        }
-
-        if (mintIdx != i) {
-            throw std::runtime_error("GetAnonimityGroup() : coin index is out of order");
-        }
-
-        auto pub = ParseMint(it->value().ToString());
-
-        if (!pub.IsMember()) {
-            throw std::runtime_error("GetAnonimityGroup() : coin is invalid");
-        }
+    for (; i < count && i < mints.size(); i++) {
+        auto pub = mints[i];
         insertF(pub);
     }
 
@@ -557,19 +584,22 @@ uint32_t SigmaDatabase::GetLastGroupId(
     uint32_t propertyId,
     uint8_t denomination)
 {
-    auto key = CreateMintKey(propertyId, denomination, UINT32_MAX, UINT16_MAX);
-    uint32_t groupId = 0;
+    LOCK(cs);
 
-    auto it = NewIterator();
-    SafeSeekToPreviousKey(it.get(), GetSlice(key));
+    auto last = lastGroups.find(std::make_pair(propertyId, denomination));
+    if (last != lastGroups.end()) {
+        return last->second.first;
+    }
 
-    if (it->Valid()) {
-        auto key = it->key();
+    auto key = CreateMintKey(propertyId, denomination, UINT32_MAX, UINT16_MAX);
+    uint32_t groupId = 0;
 
+    std::string found;
+    if (FindPreviousKey(GetSlice(key), found)) {
         uint32_t mintPropId, mintGroupId;
         uint16_t mintIdx;
         uint8_t mintDenom;
-        if (ParseMintKey(key, mintPropId, mintDenom, mintGroupId, mintIdx)
+        if (ParseMintKey(found, mintPropId, mintDenom, mintGroupId, mintIdx)
             && propertyId == mintPropId
             && denomination == mintDenom) {
             groupId = mintGroupId;
@@ -582,19 +612,22 @@ uint32_t SigmaDatabase::GetLastGroupId(
 size_t SigmaDatabase::GetMintCount(
     uint32_t propertyId, uint8_t denomination, uint32_t groupId)
 {
-    auto key = CreateMintKey(propertyId, denomination, groupId, UINT16_MAX);
-    size_t count = 0;
+    LOCK(cs);
 
-    auto it = NewIterator();
-    SafeSeekToPreviousKey(it.get(), GetSlice(key));
+    auto last = lastGroups.find(std::make_pair(propertyId, denomination));
+    if (last != lastGroups.end() && last->second.first == groupId) {
+        return last->second.second;
+    }
 
-    if (it->Valid()) {
-        auto key = it->key();
+    auto key = CreateMintKey(propertyId, denomination, groupId, UINT16_MAX);
+    size_t count = 0;
 
+    std::string found;
+    if (FindPreviousKey(GetSlice(key), found)) {
         uint32_t mintPropId, mintGroupId;
         uint16_t mintIdx;
         uint8_t mintDenom;
-        if (ParseMintKey(key, mintPropId, mintDenom, mintGroupId, mintIdx)
+        if (ParseMintKey(found, mintPropId, mintDenom, mintGroupId, mintIdx)
             && propertyId == mintPropId
             && denomination == mintDenom
             && groupId == mintGroupId) {
@@ -607,38 +640,46 @@ size_t SigmaDatabase::GetMintCount(
 
 uint64_t SigmaDatabase::GetNextSequence()
 {
+    LOCK(cs);
+
+    if (nextSequenceLoaded) {
+        return nextSequence;
+    }
+
     auto key = CreateSequenceKey(UINT64_MAX);
-    auto it = NewIterator();
 
-    uint64_t nextSequence = 0;
-    SafeSeekToPreviousKey(it.get(), GetSlice(key));
+    uint64_t next = 0;
+    std::string found;
 
-    if (it->Valid() && it->key().size() > 0 && it->key().data()[0] == static_cast<char>(KeyType::Sequence)) {
-        if (it->key().size() != SEQUENCE_KEY_SIZE) {
+    if (FindPreviousKey(GetSlice(key), found) && found.size() > 0 && found[0] == static_cast<char>(KeyType::Sequence)) {
+        if (found.size() != SEQUENCE_KEY_SIZE) {
             throw std::runtime_error("key size is invalid");
         }
-        auto lastKey = it->key();
-        std::memcpy(&nextSequence, lastKey.data() + sizeof(KeyType), sizeof(nextSequence));
-        elysium::swapByteOrder(nextSequence);
-        nextSequence++;
+        std::memcpy(&next, found.data() + sizeof(KeyType), sizeof(next));
+        elysium::swapByteOrder(next);
+        next++;
     }
 
+    nextSequence = next;
+    nextSequenceLoaded = true;
+
     return nextSequence;
 }
 
 elysium::SigmaPublicKey SigmaDatabase::GetMint(
     uint32_t propertyId, uint8_t denomination, uint32_t groupId, uint16_t index)
 {
+    LOCK(cs);
+
+    auto cached = groups.find(std::make_tuple(propertyId, denomination, groupId));
+    if (cached != groups.end() && index < cached->second.mints.size()) {
+        return cached->second.mints[index];
+    }
+
     auto key = CreateMintKey(propertyId, denomination, groupId, index);
 
     std::string val;
-    auto status = pdb->Get(
-        readoptions,
-        GetSlice(key),
-        &val
-    );
-
-    if (status.ok()) {
+    if (GetEntry(GetSlice(key), val)) {
         return ParseMint(val);
     }
 
@@ -651,26 +692,52 @@ bool SigmaDatabase::HasSpendSerial(
     auto serialData = SerializeSpendSerial(serial);
     auto keyData = CreateSpendSerialKey(propertyId, denomination, serialData);
     std::string data;
-    auto status = pdb->Get(readoptions, GetSlice(keyData), &data);
 
-    if (status.ok()) {
+    LOCK(cs);
+
+    if (GetEntry(GetSlice(keyData), data)) {
         spendTx = uint256(std::vector<unsigned char>(data.begin(), data.end()));
         return true;
     }
 
-    if (status.IsNotFound()) {
-        return false;
+    return false;
+}
+
+void SigmaDatabase::Flush()
+{
+    LOCK(cs);
+
+    if (pendingEntries.empty()) {
+        return;
+    }
+
+    leveldb::WriteBatch batch;
+
+    for (auto& entry : pendingEntries) {
+        batch.Put(entry.first, entry.second);
     }
 
-    throw std::runtime_error("Error on serial checking");
+    auto status = pdb->Write(syncoptions, &batch);
+    if (!status.ok()) {
+        throw std::runtime_error("Failed to write database: " + status.ToString());
+    }
+
+    pendingEntries.clear();
 }
 
-void SigmaDatabase::AddEntry(const leveldb::Slice& key, const leveldb::Slice& value, int block)
+void SigmaDatabase::Clear()
 {
-    leveldb::WriteBatch batch;
+    LOCK(cs);
+
+    pendingEntries.clear();
+    ClearCaches();
+
+    CDBBase::Clear();
+}
 
-    // Add entry writting to batch first.
-    batch.Put(key, value);
+void SigmaDatabase::AddEntry(const leveldb::Slice& key, const leveldb::Slice& value, int block)
+{
+    AssertLockHeld(cs);
 
     // Prepare history object.
     History history;
@@ -686,20 +753,169 @@ void SigmaDatabase::AddEntry(const leveldb::Slice& key, const leveldb::Slice& va
     history.block = block;
     history.data.insert(history.data.end(), key.data(), key.data() + key.size());
 
-    // Add history writing to batch.
     auto next = GetNextSequence();
     auto sequenceKey = CreateSequenceKey(next);
 
     CDataStream serialized(SER_DISK, CLIENT_VERSION);
     serialized << history;
 
-    batch.Put(GetSlice(sequenceKey), GetSlice(serialized.vch));
+    // Both entry and its history will be written on the next flush.
+    pendingEntries[key.ToString()] = value.ToString();
+    pendingEntries[GetSlice(sequenceKey).ToString()] = std::string(serialized.begin(), serialized.end());
 
-    // Execute batch.
-    auto status = pdb->Write(syncoptions, &batch);
-    if (!status.ok()) {
-        throw std::runtime_error("Failed to write database: " + status.ToString());
+    nextSequence = next + 1;
+}
+
+bool SigmaDatabase::GetEntry(const leveldb::Slice& key, std::string& value)
+{
+    AssertLockHeld(cs);
+
+    auto pending = pendingEntries.find(key.ToString());
+    if (pending != pendingEntries.end()) {
+        value = pending->second;
+        return true;
+    }
+
+    auto status = pdb->Get(readoptions, key, &value);
+
+    if (status.ok()) {
+        return true;
+    }
+
+    if (status.IsNotFound()) {
+        return false;
+    }
+
+    throw std::runtime_error("Failed to read database: " + status.ToString());
+}
+
+bool SigmaDatabase::FindPreviousKey(const leveldb::Slice& key, std::string& found)
+{
+    AssertLockHeld(cs);
+
+    bool valid = false;
+
+    auto it = NewIterator();
+    SafeSeekToPreviousKey(it.get(), key);
+
+    if (it->Valid()) {
+        found = it->key().ToString();
+        valid = true;
+    }
+
+    auto pending = pendingEntries.lower_bound(key.ToString());
+    if (pending != pendingEntries.begin()) {
+        pending--;
+        if (!valid || pending->first > found) {
+            found = pending->first;
+            valid = true;
+        }
+    }
+
+    return valid;
+}
+
+const std::vector<SigmaPublicKey>& SigmaDatabase::GetCachedGroup(
+    PropertyId propertyId, SigmaDenomination denomination, SigmaMintGroup groupId)
+{
+    AssertLockHeld(cs);
+
+    auto key = std::make_tuple(propertyId, denomination, groupId);
+    auto it = groups.find(key);
+
+    if (it == groups.end()) {
+        auto mints = ReadGroup(propertyId, denomination, groupId);
+
+        if (groups.size() >= MAX_CACHED_GROUPS) {
+            auto oldest = groups.begin();
+            for (auto group = groups.begin(); group != groups.end(); group++) {
+                if (group->second.lastUse < oldest->second.lastUse) {
+                    oldest = group;
+                }
+            }
+            groups.erase(oldest);
+        }
+
+        it = groups.emplace(key, CachedGroup{0, std::move(mints)}).first;
     }
+
+    it->second.lastUse = ++groupUses;
+
+    return it->second.mints;
+}
+
+std::vector<SigmaPublicKey> SigmaDatabase::ReadGroup(
+    PropertyId propertyId, SigmaDenomination denomination, SigmaMintGroup groupId)
+{
+    AssertLockHeld(cs);
+
+    auto firstKey = CreateMintKey(propertyId, denomination, groupId, 0);
+
+    auto isGroupKey = [&] (const leveldb::Slice& key) {
+        uint32_t mintPropId, mintGroupId;
+        uint16_t mintIdx;
+        uint8_t mintDenom;
+
+        return ParseMintKey(key, mintPropId, mintDenom, mintGroupId, mintIdx) &&
+            mintPropId == propertyId &&
+            mintDenom == denomination &&
+            mintGroupId == groupId;
+    };
+
+    // Merge mints in the database with the pending one, both are sorted by key and never overlap.
+    auto it = NewIterator();
+    it->Seek(GetSlice(firstKey));
+
+    auto pending = pendingEntries.lower_bound(GetSlice(firstKey).ToString());
+
+    std::vector<SigmaPublicKey> mints;
+
+    while (true) {
+        bool fromDb = it->Valid() && isGroupKey(it->key());
+        bool fromPending = pending != pendingEntries.end() && isGroupKey(pending->first);
+
+        if (fromDb && fromPending) {
+            fromDb = it->key().compare(pending->first) < 0;
+            fromPending = !fromDb;
+        } else if (!fromDb && !fromPending) {
+            break;
+        }
+
+        uint32_t mintPropId, mintGroupId;
+        uint16_t mintIdx;
+        uint8_t mintDenom;
+        ParseMintKey(fromDb ? it->key() : leveldb::Slice(pending->first), mintPropId, mintDenom, mintGroupId, mintIdx);
+
+        if (mintIdx != mints.size()) {
+            throw std::runtime_error("GetAnonimityGroup() : coin index is out of order");
+        }
+
+        auto pub = ParseMint(fromDb ? it->value().ToString() : pending->second);
+
+        if (!pub.IsMember()) {
+            throw std::runtime_error("GetAnonimityGroup() : coin is invalid");
+        }
+
+        mints.push_back(std::move(pub));
+
+        if (fromDb) {
+            it->Next();
+        } else {
+            pending++;
+        }
+    }
+
+    return mints;
+}
+
+void SigmaDatabase::ClearCaches()
+{
+    AssertLockHeld(cs);
+
+    nextSequence = 0;
+    nextSequenceLoaded = false;
+    lastGroups.clear();
+    groups.clear();
 }
 
 std::unique_ptr<leveldb::Iterator> SigmaDatabase::NewIterator() const
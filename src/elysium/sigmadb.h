@@ -6,6 +6,7 @@
 #include "property.h"
 #include "sigmaprimitives.h"
 
+#include "../sync.h"
 #include "../uint256.h"
 
 #include <univalue.h>
@@ -15,7 +16,10 @@
 
 #include <leveldb/slice.h>
 
+#include <map>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include <inttypes.h>
@@ -42,6 +46,11 @@ public:
      */
     static constexpr uint16_t MAX_GROUP_SIZE = 16384;
 
+    /**
+     * Maximum number of decoded anonymity groups to keep in memory.
+     */
+    static constexpr size_t MAX_CACHED_GROUPS = 32;
+
 public:
     SigmaDatabase(const boost::filesystem::path& path, bool wipe, uint16_t groupSize = 0);
     ~SigmaDatabase() override;
@@ -86,6 +95,18 @@ public:
 
     void DeleteAll(int startBlock);
 
+    /**
+     * Writes all entries recorded since the last flush to the database in a single batch.
+     *
+     * Entries that have not been flushed are already visible to all read functions.
+     */
+    void Flush();
+
+    /**
+     * Deletes all entries, including the pending one, and drops the caches.
+     */
+    void Clear();
+
     uint32_t GetLastGroupId(uint32_t propertyId, uint8_t denomination);
     size_t GetMintCount(uint32_t propertyId, uint8_t denomination, uint32_t groupId);
     uint64_t GetNextSequence();
@@ -105,10 +126,41 @@ protected:
     void AddEntry(const leveldb::Slice& key, const leveldb::Slice& value, int block);
 
 private:
+    typedef std::tuple<PropertyId, SigmaDenomination, SigmaMintGroup> GroupKey;
+
+    struct CachedGroup
+    {
+        uint64_t lastUse;
+        std::vector<SigmaPublicKey> mints;
+    };
+
     void RecordGroupSize(uint16_t groupSize);
 
     std::unique_ptr<leveldb::Iterator> NewIterator() const;
 
+    bool GetEntry(const leveldb::Slice& key, std::string& value);
+    bool FindPreviousKey(const leveldb::Slice& key, std::string& found);
+
+    const std::vector<SigmaPublicKey>& GetCachedGroup(PropertyId property, SigmaDenomination denomination, SigmaMintGroup group);
+    std::vector<SigmaPublicKey> ReadGroup(PropertyId property, SigmaDenomination denomination, SigmaMintGroup group);
+
+    void ClearCaches();
+
+    CCriticalSection cs;
+
+    //! Entries recorded since the last flush, ordered the same way as in the database.
+    std::map<std::string, std::string> pendingEntries;
+
+    //! Sequence number of the next history entry, loaded on demand.
+    uint64_t nextSequence;
+    bool nextSequenceLoaded;
+
+    //! Last group and number of mints in it for each property and denomination that got a mint recorded.
+    std::map<std::pair<PropertyId, SigmaDenomination>, std::pair<SigmaMintGroup, size_t>> lastGroups;
+
+    std::map<GroupKey, CachedGroup> groups;
+    uint64_t groupUses;
+
 protected:
     uint16_t InitGroupSize(uint16_t groupSize);
     uint16_t GetGroupSize();
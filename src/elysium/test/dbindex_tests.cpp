@@ -0,0 +1,221 @@
+#include "../dex.h"
+#include "../elysium.h"
+#include "../sp.h"
+#include "../tx.h"
+
+#include "../../arith_uint256.h"
+#include "../../test/test_bitcoin.h"
+#include "../../uint256.h"
+
+#include <univalue.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <set>
+#include <string>
+#include <vector>
+
+namespace elysium {
+namespace {
+
+const std::string alice = "a1kBxXVmbLVVkwJvTpAfCNDDMrN4v2eqDu";
+const std::string bob = "a5BsYu2QFK3Qj6EGyUfpbS3S1zB8JY7TtD";
+
+class DbIndexTestingSetup : public TestingSetup
+{
+public:
+    DbIndexTestingSetup() : TestingSetup(CBaseChainParams::REGTEST)
+    {
+        _my_sps = new CMPSPInfo(pathTemp / "MP_spinfo_test", true);
+        p_txlistdb = new CMPTxList(pathTemp / "MP_txlist_test", true);
+        t_tradelistdb = new CMPTradeList(pathTemp / "MP_tradelist_test", true);
+        s_stolistdb = new CMPSTOList(pathTemp / "MP_stolist_test", true);
+    }
+
+    ~DbIndexTestingSetup()
+    {
+        delete s_stolistdb; s_stolistdb = nullptr;
+        delete t_tradelistdb; t_tradelistdb = nullptr;
+        delete p_txlistdb; p_txlistdb = nullptr;
+        delete _my_sps; _my_sps = nullptr;
+    }
+
+    uint256 Txid(int block, unsigned idx)
+    {
+        return ArithToUint256(arith_uint256(block) * 1000 + idx);
+    }
+
+    std::vector<std::string> Keys(const std::vector<uint256>& txids)
+    {
+        std::vector<std::string> keys;
+        for (auto& txid : txids) {
+            keys.push_back(txid.ToString());
+        }
+        return keys;
+    }
+};
+
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(elysium_dbindex_tests, DbIndexTestingSetup)
+
+BOOST_AUTO_TEST_CASE(txlist_block_and_type_index)
+{
+    p_txlistdb->recordTX(Txid(12, 1), true, 12, ELYSIUM_MESSAGE_TYPE_ALERT, 0);
+    p_txlistdb->recordTX(Txid(10, 1), true, 10, ELYSIUM_MESSAGE_TYPE_ALERT, 0);
+    p_txlistdb->recordTX(Txid(10, 2), true, 10, ELYSIUM_TYPE_SIMPLE_SEND, 100);
+    p_txlistdb->recordTX(Txid(11, 1), false, 11, ELYSIUM_MESSAGE_TYPE_ALERT, 0);
+    p_txlistdb->recordTX(Txid(20, 1), true, 20, ELYSIUM_TYPE_SIMPLE_SEND, 100);
+
+    BOOST_CHECK_EQUAL(5, p_txlistdb->getMPTransactionCountTotal());
+    BOOST_CHECK_EQUAL(2, p_txlistdb->getMPTransactionCountBlock(10));
+    BOOST_CHECK_EQUAL(0, p_txlistdb->getMPTransactionCountBlock(13));
+
+    BOOST_CHECK((std::set<int>{10, 11, 12}) == p_txlistdb->GetSeedBlocks(10, 19));
+    BOOST_CHECK((std::set<int>{11, 12, 20}) == p_txlistdb->GetSeedBlocks(11, 20));
+
+    // ordered by block, regardless of the insertion order
+    BOOST_CHECK(Keys({Txid(10, 1), Txid(11, 1), Txid(12, 1)}) == p_txlistdb->getRecordsOfType(ELYSIUM_MESSAGE_TYPE_ALERT));
+    BOOST_CHECK(Keys({Txid(11, 1), Txid(12, 1)}) == p_txlistdb->getRecordsOfType(ELYSIUM_MESSAGE_TYPE_ALERT, 11));
+    BOOST_CHECK(Keys({Txid(11, 1)}) == p_txlistdb->getRecordsOfType(ELYSIUM_MESSAGE_TYPE_ALERT, 0, 1, 1));
+    BOOST_CHECK(p_txlistdb->getRecordsOfType(ELYSIUM_MESSAGE_TYPE_ALERT, 0, 3).empty());
+    BOOST_CHECK(Keys({Txid(10, 2), Txid(20, 1)}) == p_txlistdb->getRecordsOfType(ELYSIUM_TYPE_SIMPLE_SEND));
+
+    // reorg of blocks 11 and above
+    BOOST_CHECK(p_txlistdb->isMPinBlockRange(11, 20, false));
+    BOOST_CHECK(p_txlistdb->exists(Txid(12, 1)));
+    BOOST_CHECK(p_txlistdb->isMPinBlockRange(11, 20, true));
+    BOOST_CHECK(!p_txlistdb->isMPinBlockRange(11, 20, false));
+
+    BOOST_CHECK(!p_txlistdb->exists(Txid(11, 1)));
+    BOOST_CHECK(!p_txlistdb->exists(Txid(20, 1)));
+    BOOST_CHECK(p_txlistdb->exists(Txid(10, 1)));
+    BOOST_CHECK_EQUAL(2, p_txlistdb->getMPTransactionCountTotal());
+    BOOST_CHECK(Keys({Txid(10, 1)}) == p_txlistdb->getRecordsOfType(ELYSIUM_MESSAGE_TYPE_ALERT));
+    BOOST_CHECK((std::set<int>{10}) == p_txlistdb->GetSeedBlocks(0, 100));
+}
+
+BOOST_AUTO_TEST_CASE(txlist_overwritten_record)
+{
+    p_txlistdb->recordTX(Txid(10, 1), true, 10, ELYSIUM_TYPE_SIMPLE_SEND, 100);
+    p_txlistdb->recordTX(Txid(10, 1), true, 11, ELYSIUM_TYPE_SIMPLE_SEND, 100);
+
+    BOOST_CHECK_EQUAL(1, p_txlistdb->getMPTransactionCountTotal());
+    BOOST_CHECK_EQUAL(0, p_txlistdb->getMPTransactionCountBlock(10));
+    BOOST_CHECK_EQUAL(1, p_txlistdb->getMPTransactionCountBlock(11));
+}
+
+BOOST_AUTO_TEST_CASE(txlist_metadex_cancel)
+{
+    BOOST_CHECK(p_txlistdb->findMetaDExCancel(Txid(10, 1)).IsNull());
+
+    p_txlistdb->recordMetaDExCancelTX(Txid(11, 1), Txid(10, 1), true, 11, 3, 100);
+    p_txlistdb->recordMetaDExCancelTX(Txid(11, 1), Txid(10, 2), true, 11, 3, 50);
+
+    BOOST_CHECK_EQUAL(2, p_txlistdb->getNumberOfMetaDExCancels(Txid(11, 1)));
+    BOOST_CHECK(Txid(11, 1) == p_txlistdb->findMetaDExCancel(Txid(10, 1)));
+    BOOST_CHECK(Txid(11, 1) == p_txlistdb->findMetaDExCancel(Txid(10, 2)));
+    BOOST_CHECK(p_txlistdb->findMetaDExCancel(Txid(10, 3)).IsNull());
+
+    // the sub records are removed together with the reorged cancel
+    BOOST_CHECK(p_txlistdb->isMPinBlockRange(11, 11, true));
+    BOOST_CHECK_EQUAL(0, p_txlistdb->getNumberOfMetaDExCancels(Txid(11, 1)));
+    BOOST_CHECK(p_txlistdb->findMetaDExCancel(Txid(10, 1)).IsNull());
+    BOOST_CHECK(p_txlistdb->findMetaDExCancel(Txid(10, 2)).IsNull());
+    BOOST_CHECK(p_txlistdb->getKeyValue(STR_REF_SUBKEY_TXID_REF_COMBO(Txid(11, 1).ToString() + "-C", 1)).empty());
+}
+
+BOOST_AUTO_TEST_CASE(tradelist_address_pair_and_block_index)
+{
+    t_tradelistdb->recordNewTrade(Txid(12, 1), alice, 1, 2, 12, 1);
+    t_tradelistdb->recordNewTrade(Txid(10, 2), alice, 1, 2, 10, 2);
+    t_tradelistdb->recordNewTrade(Txid(10, 1), alice, 3, 1, 10, 1);
+    t_tradelistdb->recordNewTrade(Txid(11, 1), bob, 2, 1, 11, 1);
+
+    t_tradelistdb->recordMatchedTrade(Txid(11, 1), Txid(10, 2), bob, alice, 2, 1, 50, 100, 11, 0);
+    t_tradelistdb->recordMatchedTrade(Txid(12, 1), Txid(11, 1), alice, bob, 1, 2, 30, 15, 12, 0);
+
+    std::vector<uint256> trades;
+    t_tradelistdb->getTradesForAddress(alice, trades);
+    BOOST_CHECK(trades == (std::vector<uint256>{Txid(10, 1), Txid(10, 2), Txid(12, 1)}));
+
+    trades.clear();
+    t_tradelistdb->getTradesForAddress(alice, trades, 3);
+    BOOST_CHECK(trades == (std::vector<uint256>{Txid(10, 1)}));
+
+    UniValue tradeArray(UniValue::VARR);
+    int64_t totalSold, totalReceived;
+    BOOST_CHECK(t_tradelistdb->getMatchingTrades(Txid(11, 1), 2, tradeArray, totalSold, totalReceived));
+    BOOST_CHECK_EQUAL(2, tradeArray.size());
+    BOOST_CHECK_EQUAL(65, totalSold);
+    BOOST_CHECK_EQUAL(130, totalReceived);
+
+    // most recent trade of the pair, from either side
+    UniValue pairTrades(UniValue::VARR);
+    t_tradelistdb->getTradesForPair(1, 2, pairTrades, 1);
+    BOOST_CHECK_EQUAL(1, pairTrades.size());
+    BOOST_CHECK_EQUAL(12, pairTrades[0]["block"].get_int64());
+
+    pairTrades.clear();
+    t_tradelistdb->getTradesForPair(2, 1, pairTrades, 10);
+    BOOST_CHECK_EQUAL(2, pairTrades.size());
+    BOOST_CHECK_EQUAL(11, pairTrades[0]["block"].get_int64());
+    BOOST_CHECK_EQUAL(12, pairTrades[1]["block"].get_int64());
+
+    BOOST_CHECK_EQUAL(6, t_tradelistdb->getMPTradeCountTotal());
+
+    // reorg of block 12
+    BOOST_CHECK_EQUAL(2, t_tradelistdb->deleteAboveBlock(12));
+    BOOST_CHECK_EQUAL(4, t_tradelistdb->getMPTradeCountTotal());
+
+    trades.clear();
+    t_tradelistdb->getTradesForAddress(alice, trades);
+    BOOST_CHECK(trades == (std::vector<uint256>{Txid(10, 1), Txid(10, 2)}));
+
+    tradeArray.clear();
+    BOOST_CHECK(t_tradelistdb->getMatchingTrades(Txid(11, 1), 2, tradeArray, totalSold, totalReceived));
+    BOOST_CHECK_EQUAL(1, tradeArray.size());
+
+    tradeArray.clear();
+    BOOST_CHECK(!t_tradelistdb->getMatchingTrades(Txid(12, 1), 1, tradeArray, totalSold, totalReceived));
+}
+
+BOOST_AUTO_TEST_CASE(stolist_transaction_and_block_index)
+{
+    s_stolistdb->recordSTOReceive(alice, Txid(10, 1), 10, 3, 100);
+    s_stolistdb->recordSTOReceive(bob, Txid(10, 1), 10, 3, 50);
+    s_stolistdb->recordSTOReceive(alice, Txid(11, 1), 11, 3, 70);
+
+    UniValue recipients(UniValue::VARR);
+    uint64_t total = 0, numRecipients = 0;
+    s_stolistdb->getRecipients(Txid(10, 1), "*", &recipients, &total, &numRecipients);
+    BOOST_CHECK_EQUAL(2, recipients.size());
+    BOOST_CHECK_EQUAL(2, numRecipients);
+    BOOST_CHECK_EQUAL(150, total);
+
+    recipients.clear();
+    total = 0;
+    s_stolistdb->getRecipients(Txid(10, 1), bob, &recipients, &total, &numRecipients);
+    BOOST_CHECK_EQUAL(1, recipients.size());
+    BOOST_CHECK_EQUAL(2, numRecipients);
+    BOOST_CHECK_EQUAL(50, total);
+
+    // reorg of block 11
+    BOOST_CHECK_EQUAL(1, s_stolistdb->deleteAboveBlock(11));
+
+    recipients.clear();
+    total = 0;
+    s_stolistdb->getRecipients(Txid(11, 1), "*", &recipients, &total, &numRecipients);
+    BOOST_CHECK_EQUAL(0, recipients.size());
+    BOOST_CHECK_EQUAL(0, numRecipients);
+
+    recipients.clear();
+    total = 0;
+    s_stolistdb->getRecipients(Txid(10, 1), "*", &recipients, &total, &numRecipients);
+    BOOST_CHECK_EQUAL(2, recipients.size());
+    BOOST_CHECK_EQUAL(150, total);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace elysium
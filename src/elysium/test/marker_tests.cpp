@@ -230,6 +230,39 @@ BOOST_AUTO_TEST_CASE(class_class_c)
     }
 }
 
+BOOST_AUTO_TEST_CASE(may_have_packet)
+{
+    {
+        CMutableTransaction mutableTx;
+        mutableTx.vout.push_back(OpReturn_Unrelated());
+        mutableTx.vout.push_back(PayToPubKeyHash_Unrelated());
+        mutableTx.vout.push_back(PayToBareMultisig_1of3());
+        mutableTx.vout.push_back(PayToScriptHash_Unrelated());
+
+        CTransaction tx(mutableTx);
+        BOOST_CHECK(!MayHavePacket(tx));
+    }
+    {
+        CMutableTransaction mutableTx;
+        mutableTx.vout.push_back(PayToPubKeyHash_Elysium());
+        mutableTx.vout.push_back(PayToBareMultisig_1of3());
+
+        CTransaction tx(mutableTx);
+        BOOST_CHECK(MayHavePacket(tx));
+    }
+    {
+        // class C isn't allowed at this height, but the transaction is still a candidate
+        int nBlock = ConsensusParams().NULLDATA_BLOCK - 1;
+
+        CMutableTransaction mutableTx;
+        mutableTx.vout.push_back(OpReturn_PlainMarker());
+
+        CTransaction tx(mutableTx);
+        BOOST_CHECK_EQUAL(DeterminePacketClass(tx, nBlock), boost::none);
+        BOOST_CHECK(MayHavePacket(tx));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace elysium
@@ -0,0 +1,239 @@
+#include "../elysium.h"
+#include "../mdex.h"
+#include "../property.h"
+#include "../sp.h"
+#include "../tally.h"
+
+#include "../../arith_uint256.h"
+#include "../../test/test_bitcoin.h"
+#include "../../uint256.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+namespace elysium {
+namespace {
+
+const std::string alice = "a1kBxXVmbLVVkwJvTpAfCNDDMrN4v2eqDu";
+const std::string bob = "a5BsYu2QFK3Qj6EGyUfpbS3S1zB8JY7TtD";
+const std::string carol = "aMWjbEAVqXZAB56JbA8MBSUvmxGxJsiAT4";
+
+const uint32_t PROPERTY_TOKEN = 3;
+const uint32_t PROPERTY_OTHER = 4;
+
+class MetaDExTestingSetup : public TestingSetup
+{
+public:
+    MetaDExTestingSetup() : TestingSetup(CBaseChainParams::REGTEST)
+    {
+        _my_sps = new CMPSPInfo(pathTemp / "MP_spinfo_test", true);
+        p_txlistdb = new CMPTxList(pathTemp / "MP_txlist_test", true);
+        t_tradelistdb = new CMPTradeList(pathTemp / "MP_tradelist_test", true);
+
+        metadex.clear();
+        mp_tally_map.clear();
+    }
+
+    ~MetaDExTestingSetup()
+    {
+        metadex.clear();
+        mp_tally_map.clear();
+
+        delete t_tradelistdb; t_tradelistdb = nullptr;
+        delete p_txlistdb; p_txlistdb = nullptr;
+        delete _my_sps; _my_sps = nullptr;
+    }
+
+    uint256 Txid(int block, unsigned idx)
+    {
+        return ArithToUint256(arith_uint256(block) * 1000 + idx);
+    }
+
+    int Add(const std::string& addr, uint32_t property, int64_t amount, uint32_t desired, int64_t amountDesired, int block, unsigned idx = 1)
+    {
+        update_tally_map(addr, property, amount, BALANCE);
+        return MetaDEx_ADD(addr, property, amount, block, desired, amountDesired, Txid(block, idx), idx);
+    }
+
+    CMPMetaDEx Order(const std::string& addr, uint32_t property, int64_t amount, uint32_t desired, int64_t amountDesired, int block, unsigned idx = 1)
+    {
+        return CMPMetaDEx(addr, block, property, amount, desired, amountDesired, Txid(block, idx), idx, CMPTransaction::ADD);
+    }
+
+    std::vector<int64_t> Remaining(uint32_t property, uint32_t desired)
+    {
+        std::vector<int64_t> remaining;
+        md_PricesMap* prices = get_Prices(property, desired);
+        if (prices) {
+            for (md_PricesMap::const_iterator it = prices->begin(); it != prices->end(); ++it) {
+                for (md_Set::const_iterator order = it->second.begin(); order != it->second.end(); ++order) {
+                    remaining.push_back(order->getAmountRemaining());
+                }
+            }
+        }
+        return remaining;
+    }
+};
+
+} // empty namespace
+
+BOOST_FIXTURE_TEST_SUITE(elysium_mdex_tests, MetaDExTestingSetup)
+
+BOOST_AUTO_TEST_CASE(insert_keeps_pairs_prices_and_positions_sorted)
+{
+    BOOST_CHECK(MetaDEx_INSERT(Order(alice, PROPERTY_TOKEN, 100, ELYSIUM_PROPERTY_ELYSIUM, 200, 10)));
+    BOOST_CHECK(MetaDEx_INSERT(Order(bob, PROPERTY_TOKEN, 100, ELYSIUM_PROPERTY_ELYSIUM, 100, 11)));
+    BOOST_CHECK(MetaDEx_INSERT(Order(carol, PROPERTY_TOKEN, 50, ELYSIUM_PROPERTY_ELYSIUM, 100, 12)));
+    BOOST_CHECK(MetaDEx_INSERT(Order(carol, PROPERTY_TOKEN, 30, ELYSIUM_PROPERTY_ELYSIUM, 60, 9)));
+    BOOST_CHECK(MetaDEx_INSERT(Order(alice, PROPERTY_TOKEN, 10, PROPERTY_OTHER, 10, 10, 2)));
+
+    // an order at the same position is rejected
+    BOOST_CHECK(!MetaDEx_INSERT(Order(bob, PROPERTY_TOKEN, 10, ELYSIUM_PROPERTY_ELYSIUM, 20, 12)));
+
+    BOOST_CHECK_EQUAL(metadex.size(), 2);
+
+    md_PricesMap* prices = get_Prices(PROPERTY_TOKEN, ELYSIUM_PROPERTY_ELYSIUM);
+    BOOST_REQUIRE(prices);
+    BOOST_REQUIRE_EQUAL(prices->size(), 2);
+    BOOST_CHECK(prices->at(0).first == rational_t(1, 1));
+    BOOST_CHECK(prices->at(1).first == rational_t(2, 1));
+
+    md_Set* orders = get_Indexes(prices, rational_t(2, 1));
+    BOOST_REQUIRE(orders);
+    BOOST_REQUIRE_EQUAL(orders->size(), 3);
+    BOOST_CHECK_EQUAL(orders->at(0).getBlock(), 9);
+    BOOST_CHECK_EQUAL(orders->at(1).getBlock(), 10);
+    BOOST_CHECK_EQUAL(orders->at(2).getBlock(), 12);
+
+    BOOST_CHECK(!get_Indexes(prices, rational_t(3, 1)));
+    BOOST_CHECK(!get_Prices(ELYSIUM_PROPERTY_ELYSIUM, PROPERTY_TOKEN));
+}
+
+BOOST_AUTO_TEST_CASE(trade_fills_best_price_first)
+{
+    BOOST_CHECK_EQUAL(Add(alice, PROPERTY_TOKEN, 100, ELYSIUM_PROPERTY_ELYSIUM, 200, 10), 0);
+    BOOST_CHECK_EQUAL(Add(bob, PROPERTY_TOKEN, 100, ELYSIUM_PROPERTY_ELYSIUM, 100, 11), 0);
+    BOOST_CHECK_EQUAL(Add(carol, PROPERTY_TOKEN, 100, ELYSIUM_PROPERTY_ELYSIUM, 100, 12), 0);
+    BOOST_CHECK_EQUAL(Add(carol, PROPERTY_TOKEN, 100, PROPERTY_OTHER, 1, 12, 2), 0);
+
+    // buys 150 tokens at a price of 1, which fills Bob and half of Carol's order
+    BOOST_CHECK_EQUAL(Add(alice, ELYSIUM_PROPERTY_ELYSIUM, 150, PROPERTY_TOKEN, 150, 13), 0);
+
+    BOOST_CHECK_EQUAL(getMPbalance(alice, PROPERTY_TOKEN, BALANCE), 150);
+    BOOST_CHECK_EQUAL(getMPbalance(alice, ELYSIUM_PROPERTY_ELYSIUM, BALANCE), 0);
+    BOOST_CHECK_EQUAL(getMPbalance(bob, ELYSIUM_PROPERTY_ELYSIUM, BALANCE), 100);
+    BOOST_CHECK_EQUAL(getMPbalance(bob, PROPERTY_TOKEN, METADEX_RESERVE), 0);
+    BOOST_CHECK_EQUAL(getMPbalance(carol, ELYSIUM_PROPERTY_ELYSIUM, BALANCE), 50);
+    BOOST_CHECK_EQUAL(getMPbalance(carol, PROPERTY_TOKEN, METADEX_RESERVE), 150);
+
+    // the filled order is gone, the partially filled order keeps its position
+    BOOST_CHECK(Remaining(PROPERTY_TOKEN, ELYSIUM_PROPERTY_ELYSIUM) == std::vector<int64_t>({50, 100}));
+    BOOST_CHECK(Remaining(PROPERTY_TOKEN, PROPERTY_OTHER) == std::vector<int64_t>({100}));
+    BOOST_CHECK(!get_Prices(ELYSIUM_PROPERTY_ELYSIUM, PROPERTY_TOKEN));
+
+    BOOST_CHECK(MetaDEx_isOpen(Txid(12, 1), PROPERTY_TOKEN));
+    BOOST_CHECK(!MetaDEx_isOpen(Txid(11, 1)));
+    BOOST_CHECK(!MetaDEx_isOpen(Txid(13, 1)));
+}
+
+BOOST_AUTO_TEST_CASE(trade_skips_unrepresentable_fills)
+{
+    // 3 tokens for 2 units, of which a single token is left
+    BOOST_CHECK(MetaDEx_INSERT(CMPMetaDEx(bob, 10, PROPERTY_TOKEN, 3, ELYSIUM_PROPERTY_ELYSIUM, 2, Txid(10, 1), 1, CMPTransaction::ADD, 1)));
+    update_tally_map(bob, PROPERTY_TOKEN, 1, METADEX_RESERVE);
+
+    BOOST_CHECK_EQUAL(Add(carol, PROPERTY_TOKEN, 4, ELYSIUM_PROPERTY_ELYSIUM, 3, 11), 0);
+
+    // buying the last token of Bob would cost 1 unit, which is above the price of 3 units for 4 tokens
+    BOOST_CHECK_EQUAL(Add(alice, ELYSIUM_PROPERTY_ELYSIUM, 3, PROPERTY_TOKEN, 4, 12), 0);
+
+    BOOST_CHECK_EQUAL(getMPbalance(alice, PROPERTY_TOKEN, BALANCE), 4);
+    BOOST_CHECK_EQUAL(getMPbalance(alice, ELYSIUM_PROPERTY_ELYSIUM, BALANCE), 0);
+    BOOST_CHECK_EQUAL(getMPbalance(carol, ELYSIUM_PROPERTY_ELYSIUM, BALANCE), 3);
+    BOOST_CHECK(Remaining(PROPERTY_TOKEN, ELYSIUM_PROPERTY_ELYSIUM) == std::vector<int64_t>({1}));
+    BOOST_CHECK(!get_Prices(ELYSIUM_PROPERTY_ELYSIUM, PROPERTY_TOKEN));
+}
+
+BOOST_AUTO_TEST_CASE(trade_remainder_is_added_to_book)
+{
+    BOOST_CHECK_EQUAL(Add(bob, PROPERTY_TOKEN, 100, ELYSIUM_PROPERTY_ELYSIUM, 100, 10), 0);
+    BOOST_CHECK_EQUAL(Add(alice, ELYSIUM_PROPERTY_ELYSIUM, 300, PROPERTY_TOKEN, 300, 11), 0);
+
+    BOOST_CHECK(!get_Prices(PROPERTY_TOKEN, ELYSIUM_PROPERTY_ELYSIUM));
+    BOOST_CHECK(Remaining(ELYSIUM_PROPERTY_ELYSIUM, PROPERTY_TOKEN) == std::vector<int64_t>({200}));
+    BOOST_CHECK_EQUAL(getMPbalance(alice, ELYSIUM_PROPERTY_ELYSIUM, METADEX_RESERVE), 200);
+    BOOST_CHECK_EQUAL(getMPbalance(alice, PROPERTY_TOKEN, BALANCE), 100);
+}
+
+BOOST_AUTO_TEST_CASE(cancel_at_price_and_pair)
+{
+    BOOST_CHECK_EQUAL(Add(alice, PROPERTY_TOKEN, 100, ELYSIUM_PROPERTY_ELYSIUM, 100, 10), 0);
+    BOOST_CHECK_EQUAL(Add(alice, PROPERTY_TOKEN, 100, ELYSIUM_PROPERTY_ELYSIUM, 200, 11), 0);
+    BOOST_CHECK_EQUAL(Add(bob, PROPERTY_TOKEN, 50, ELYSIUM_PROPERTY_ELYSIUM, 50, 12), 0);
+
+    BOOST_CHECK_EQUAL(MetaDEx_CANCEL_AT_PRICE(Txid(13, 1), 13, alice, PROPERTY_TOKEN, 10, ELYSIUM_PROPERTY_ELYSIUM, 10), 0);
+    BOOST_CHECK(Remaining(PROPERTY_TOKEN, ELYSIUM_PROPERTY_ELYSIUM) == std::vector<int64_t>({50, 100}));
+    BOOST_CHECK_EQUAL(getMPbalance(alice, PROPERTY_TOKEN, BALANCE), 100);
+    BOOST_CHECK_EQUAL(getMPbalance(alice, PROPERTY_TOKEN, METADEX_RESERVE), 100);
+
+    // no order of the address at this price
+    BOOST_CHECK_EQUAL(MetaDEx_CANCEL_AT_PRICE(Txid(14, 1), 14, alice, PROPERTY_TOKEN, 10, ELYSIUM_PROPERTY_ELYSIUM, 10), METADEX_ERROR -20);
+
+    BOOST_CHECK_EQUAL(MetaDEx_CANCEL_ALL_FOR_PAIR(Txid(15, 1), 15, alice, PROPERTY_TOKEN, ELYSIUM_PROPERTY_ELYSIUM), 0);
+    BOOST_CHECK(Remaining(PROPERTY_TOKEN, ELYSIUM_PROPERTY_ELYSIUM) == std::vector<int64_t>({50}));
+    BOOST_CHECK_EQUAL(getMPbalance(alice, PROPERTY_TOKEN, BALANCE), 200);
+    BOOST_CHECK_EQUAL(getMPbalance(alice, PROPERTY_TOKEN, METADEX_RESERVE), 0);
+
+    BOOST_CHECK_EQUAL(MetaDEx_CANCEL_ALL_FOR_PAIR(Txid(16, 1), 16, alice, PROPERTY_TOKEN, ELYSIUM_PROPERTY_ELYSIUM), METADEX_ERROR -30);
+    BOOST_CHECK_EQUAL(MetaDEx_CANCEL_ALL_FOR_PAIR(Txid(17, 1), 17, alice, PROPERTY_OTHER, ELYSIUM_PROPERTY_ELYSIUM), METADEX_ERROR -31);
+
+    BOOST_CHECK_EQUAL(MetaDEx_CANCEL_AT_PRICE(Txid(18, 1), 18, bob, PROPERTY_TOKEN, 1, ELYSIUM_PROPERTY_ELYSIUM, 1), 0);
+    BOOST_CHECK(metadex.empty());
+}
+
+BOOST_AUTO_TEST_CASE(cancel_everything_in_ecosystem)
+{
+    const uint32_t testToken = TEST_ECO_PROPERTY_1;
+
+    BOOST_CHECK_EQUAL(Add(alice, PROPERTY_TOKEN, 100, ELYSIUM_PROPERTY_ELYSIUM, 100, 10), 0);
+    BOOST_CHECK_EQUAL(Add(alice, PROPERTY_TOKEN, 100, PROPERTY_OTHER, 100, 11), 0);
+    BOOST_CHECK_EQUAL(Add(bob, PROPERTY_TOKEN, 100, PROPERTY_OTHER, 300, 12), 0);
+    BOOST_CHECK_EQUAL(Add(alice, testToken, 100, ELYSIUM_PROPERTY_TELYSIUM, 100, 13), 0);
+
+    BOOST_CHECK_EQUAL(MetaDEx_CANCEL_EVERYTHING(Txid(14, 1), 14, alice, 1), 0);
+
+    BOOST_CHECK(!get_Prices(PROPERTY_TOKEN, ELYSIUM_PROPERTY_ELYSIUM));
+    BOOST_CHECK(Remaining(PROPERTY_TOKEN, PROPERTY_OTHER) == std::vector<int64_t>({100}));
+    BOOST_CHECK(Remaining(testToken, ELYSIUM_PROPERTY_TELYSIUM) == std::vector<int64_t>({100}));
+    BOOST_CHECK_EQUAL(getMPbalance(alice, PROPERTY_TOKEN, BALANCE), 200);
+
+    BOOST_CHECK_EQUAL(MetaDEx_CANCEL_EVERYTHING(Txid(15, 1), 15, alice, 1), METADEX_ERROR -40);
+    BOOST_CHECK_EQUAL(MetaDEx_CANCEL_EVERYTHING(Txid(16, 1), 16, alice, 2), 0);
+    BOOST_CHECK(!get_Prices(testToken, ELYSIUM_PROPERTY_TELYSIUM));
+}
+
+BOOST_AUTO_TEST_CASE(shutdown_allpair_keeps_elysium_pairs)
+{
+    BOOST_CHECK_EQUAL(Add(alice, PROPERTY_TOKEN, 100, ELYSIUM_PROPERTY_ELYSIUM, 100, 10), 0);
+    BOOST_CHECK_EQUAL(Add(alice, PROPERTY_TOKEN, 100, PROPERTY_OTHER, 100, 11), 0);
+    BOOST_CHECK_EQUAL(Add(bob, PROPERTY_OTHER, 10, PROPERTY_TOKEN, 100, 12), 0);
+
+    BOOST_CHECK_EQUAL(MetaDEx_SHUTDOWN_ALLPAIR(), 0);
+
+    BOOST_CHECK_EQUAL(metadex.size(), 1);
+    BOOST_CHECK(get_Prices(PROPERTY_TOKEN, ELYSIUM_PROPERTY_ELYSIUM));
+    BOOST_CHECK_EQUAL(getMPbalance(alice, PROPERTY_TOKEN, BALANCE), 100);
+    BOOST_CHECK_EQUAL(getMPbalance(bob, PROPERTY_OTHER, BALANCE), 10);
+
+    BOOST_CHECK_EQUAL(MetaDEx_SHUTDOWN(), 0);
+    BOOST_CHECK(metadex.empty());
+    BOOST_CHECK_EQUAL(getMPbalance(alice, PROPERTY_TOKEN, BALANCE), 200);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace elysium
@@ -709,6 +709,95 @@ BOOST_AUTO_TEST_CASE(delete_both_mint_and_spend)
     BOOST_CHECK(uint256() == outSpendTx2);
 }
 
+BOOST_AUTO_TEST_CASE(pending_entries_are_readable_before_flush)
+{
+    auto db = CreateDb();
+    auto mints = CreateMints(3);
+    SigmaPrivateKey key;
+    key.Generate();
+    auto spendTx = uint256S("1");
+
+    db->Flush();
+    for (auto& mint : mints) {
+        db->RecordMint(1, 1, mint, 10);
+    }
+    db->RecordSpendSerial(1, 1, key.serial, 10, spendTx);
+
+    uint256 outSpendTx;
+    BOOST_CHECK_EQUAL(4, db->GetNextSequence());
+    BOOST_CHECK_EQUAL(3, db->GetMintCount(1, 1, 0));
+    BOOST_CHECK_EQUAL(mints[1], db->GetMint(1, 1, 0, 1));
+    BOOST_CHECK_EQUAL(mints, db->GetAnonimityGroupAsVector(1, 1, 0, 100));
+    BOOST_CHECK(db->HasSpendSerial(1, 1, key.serial, outSpendTx));
+    BOOST_CHECK(spendTx == outSpendTx);
+}
+
+BOOST_AUTO_TEST_CASE(flushed_entries_are_persisted)
+{
+    auto mints = CreateMints(2);
+
+    {
+        auto db = CreateDb();
+        db->RecordMint(1, 1, mints[0], 10);
+        db->Flush();
+        db->RecordMint(1, 1, mints[1], 11);
+        BOOST_CHECK_EQUAL(mints, db->GetAnonimityGroupAsVector(1, 1, 0, 100));
+    }
+
+    // pending entry is written when database is closed
+    auto db = CreateDb();
+    BOOST_CHECK_EQUAL(2, db->GetNextSequence());
+    BOOST_CHECK_EQUAL(0, db->GetLastGroupId(1, 1));
+    BOOST_CHECK_EQUAL(2, db->GetMintCount(1, 1, 0));
+    BOOST_CHECK_EQUAL(mints, db->GetAnonimityGroupAsVector(1, 1, 0, 100));
+
+    db->DeleteAll(11);
+    BOOST_CHECK_EQUAL(GetFirstN(mints, 1), db->GetAnonimityGroupAsVector(1, 1, 0, 100));
+}
+
+BOOST_AUTO_TEST_CASE(cached_group_follow_new_and_deleted_mints)
+{
+    auto db = CreateDb();
+    auto mints = CreateMints(TEST_MAX_COINS_PER_GROUP + 2);
+
+    for (size_t i = 0; i < TEST_MAX_COINS_PER_GROUP; i++) {
+        db->RecordMint(1, 1, mints[i], 10);
+    }
+    db->Flush();
+
+    // load group to the cache then add more mints
+    BOOST_CHECK_EQUAL(GetFirstN(mints, 2), db->GetAnonimityGroupAsVector(1, 1, 0, 2));
+
+    db->RecordMint(1, 1, mints[TEST_MAX_COINS_PER_GROUP], 11);
+    db->RecordMint(1, 1, mints[TEST_MAX_COINS_PER_GROUP + 1], 11);
+
+    BOOST_CHECK_EQUAL(GetFirstN(mints, TEST_MAX_COINS_PER_GROUP), db->GetAnonimityGroupAsVector(1, 1, 0, 100));
+    BOOST_CHECK_EQUAL(
+        std::vector<SigmaPublicKey>(mints.begin() + TEST_MAX_COINS_PER_GROUP, mints.end()),
+        db->GetAnonimityGroupAsVector(1, 1, 1, 100)
+    );
+
+    // mints of block 11 must not be served from the cache after they are removed
+    db->DeleteAll(11);
+
+    BOOST_CHECK_EQUAL(0, db->GetLastGroupId(1, 1));
+    BOOST_CHECK_EQUAL(TEST_MAX_COINS_PER_GROUP, db->GetMintCount(1, 1, 0));
+    BOOST_CHECK(db->GetAnonimityGroupAsVector(1, 1, 1, 100).empty());
+
+    db->DeleteAll(10);
+
+    BOOST_CHECK_EQUAL(0, db->GetNextSequence());
+    BOOST_CHECK_EQUAL(0, db->GetMintCount(1, 1, 0));
+    BOOST_CHECK(db->GetAnonimityGroupAsVector(1, 1, 0, 100).empty());
+
+    // new mints after reorg go to the same position as the removed one
+    BOOST_CHECK_EQUAL(
+        std::make_pair(SigmaMintGroup(0), SigmaMintIndex(0)),
+        db->RecordMint(1, 1, mints[1], 10)
+    );
+    BOOST_CHECK_EQUAL(std::vector<SigmaPublicKey>{mints[1]}, db->GetAnonimityGroupAsVector(1, 1, 0, 100));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace elysium
@@ -0,0 +1,130 @@
+#include "elysium/elysium.h"
+#include "elysium/sp.h"
+#include "elysium/tally.h"
+
+#include "utils_tx.h"
+
+#include "chain.h"
+#include "validation.h"
+
+#include "test/test_bitcoin.h"
+
+#include <stdint.h>
+
+#include <map>
+#include <string>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+using namespace elysium;
+
+namespace {
+
+typedef std::map<std::string, std::map<uint32_t, int64_t>> Tallies;
+
+Tallies GetTallies()
+{
+    Tallies tallies;
+    for (auto& entry : mp_tally_map) {
+        CMPTally& tally = entry.second;
+        tally.init();
+        uint32_t propertyId = 0;
+        while (0 != (propertyId = tally.next())) {
+            int64_t balance = tally.getMoney(propertyId, BALANCE);
+            if (balance) tallies[entry.first][propertyId] = balance;
+        }
+    }
+    return tallies;
+}
+
+struct StatePersistenceTestingSetup : public TestChain100Setup
+{
+    CMPSPInfo* prevSps;
+    boost::filesystem::path prevPersistencePath;
+
+    StatePersistenceTestingSetup() : prevSps(_my_sps), prevPersistencePath(MPPersistencePath)
+    {
+        _my_sps = new CMPSPInfo(pathTemp / "MP_spinfo_test", false);
+        MPPersistencePath = pathTemp / "MP_persist_test";
+        boost::filesystem::create_directories(MPPersistencePath);
+        mp_tally_map.clear();
+    }
+
+    ~StatePersistenceTestingSetup()
+    {
+        mp_tally_map.clear();
+
+        delete _my_sps;
+        _my_sps = prevSps;
+        MPPersistencePath = prevPersistencePath;
+    }
+};
+
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(elysium_state_persistence_tests, StatePersistenceTestingSetup)
+
+BOOST_AUTO_TEST_CASE(snapshots_with_deltas_roundtrip)
+{
+    LOCK(cs_main);
+
+    const std::string addresses[] = {
+        "a1kBxXVmbLVVkwJvTpAfCNDDMrN4v2eqDu",
+        "TEkfVSqbDMNcsL1SEFVC2Wj89mQ6pVAYHp",
+        "TAfJDHC1o7gkDknVG3pSFZCosYNXYMgp5r",
+        "TEVwEdvyvDXrRVYUsLj5ijaZbMdT7mRTKu",
+        "TM3ET1YxTk9WR3XGjkifXjhpLJD9xdYGsy",
+    };
+    const size_t nAddresses = sizeof(addresses) / sizeof(addresses[0]);
+
+    // change a few balances per block and save the state, which writes a full
+    // snapshot every MAX_STATE_DELTAS + 1 blocks and balance deltas in between
+    std::map<int, Tallies> expected;
+    for (int nHeight = 1; nHeight <= chainActive.Height(); nHeight++) {
+        update_tally_map(addresses[nHeight % nAddresses], 3, nHeight, BALANCE);
+        if (nHeight % 3 == 0) {
+            update_tally_map(addresses[(nHeight + 1) % nAddresses], 4, 2 * nHeight, BALANCE);
+        }
+
+        // empty an address now and then, which removes it from the state
+        const std::string& emptied = addresses[(nHeight + 2) % nAddresses];
+        if (nHeight % 7 == 0) {
+            for (uint32_t propertyId : {3, 4}) {
+                int64_t balance = getMPbalance(emptied, propertyId, BALANCE);
+                if (balance) update_tally_map(emptied, propertyId, -balance, BALANCE);
+            }
+        }
+
+        BOOST_CHECK_EQUAL(0, elysium_save_state(chainActive[nHeight]));
+        expected[nHeight] = GetTallies();
+    }
+
+    // every state within the history is reconstructed from the remaining files
+    int nTip = chainActive.Height();
+    for (int nHeight = nTip - MAX_STATE_HISTORY; nHeight <= nTip; nHeight++) {
+        mp_tally_map.clear();
+        BOOST_CHECK(elysium_load_state(chainActive[nHeight]));
+        BOOST_CHECK(GetTallies() == expected[nHeight]);
+    }
+
+    // older states are pruned, unless a retained delta is based on them: the
+    // oldest retained state is a delta on the snapshot of block 45
+    BOOST_CHECK(!elysium_load_state(chainActive[20]));
+    BOOST_CHECK(!elysium_load_state(chainActive[44]));
+    mp_tally_map.clear();
+    BOOST_CHECK(elysium_load_state(chainActive[45]));
+    BOOST_CHECK(GetTallies() == expected[45]);
+
+    // saving on top of a loaded state continues the chain of deltas
+    BOOST_CHECK(elysium_load_state(chainActive[nTip - 1]));
+    update_tally_map(addresses[0], 3, 1000, BALANCE);
+    BOOST_CHECK_EQUAL(0, elysium_save_state(chainActive[nTip]));
+    Tallies replaced = GetTallies();
+
+    mp_tally_map.clear();
+    BOOST_CHECK(elysium_load_state(chainActive[nTip]));
+    BOOST_CHECK(GetTallies() == replaced);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
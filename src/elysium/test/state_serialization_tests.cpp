@@ -0,0 +1,108 @@
+#include "elysium/dex.h"
+#include "elysium/mdex.h"
+#include "elysium/sp.h"
+
+#include "clientversion.h"
+#include "hash.h"
+#include "streams.h"
+#include "uint256.h"
+
+#include "test/test_bitcoin.h"
+
+#include <stdint.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_FIXTURE_TEST_SUITE(elysium_state_serialization_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(metadex_roundtrip)
+{
+    CMPMetaDEx order("a1kBxXVmbLVVkwJvTpAfCNDDMrN4v2eqDu", 172, 3, 1000, 1, 2000,
+            uint256S("ff"), 7, 1, 500);
+
+    CDataStream ss(SER_DISK, CLIENT_VERSION);
+    ss << order;
+
+    CMPMetaDEx decoded;
+    ss >> decoded;
+
+    BOOST_CHECK(ss.empty());
+    BOOST_CHECK_EQUAL(order.ToString(), decoded.ToString());
+    BOOST_CHECK_EQUAL(order.getAmountRemaining(), decoded.getAmountRemaining());
+    BOOST_CHECK_EQUAL(order.getIdx(), decoded.getIdx());
+    BOOST_CHECK_EQUAL(order.getAddr(), decoded.getAddr());
+}
+
+BOOST_AUTO_TEST_CASE(dex_roundtrip)
+{
+    elysium::OfferMap offers;
+    offers.insert(std::make_pair("a-1", CMPOffer(100, 5000, 1, 10000, 1000, 10, uint256S("01"))));
+
+    elysium::AcceptMap accepts;
+    accepts.insert(std::make_pair("a-1+b", CMPAccept(2000, 1500, 101, 10, 1, 5000, 10000, uint256S("01"))));
+
+    CDataStream ss(SER_DISK, CLIENT_VERSION);
+    ss << offers << accepts;
+
+    elysium::OfferMap decodedOffers;
+    elysium::AcceptMap decodedAccepts;
+    ss >> decodedOffers >> decodedAccepts;
+
+    BOOST_CHECK(ss.empty());
+    BOOST_CHECK_EQUAL(decodedOffers.size(), 1);
+    BOOST_CHECK_EQUAL(decodedOffers["a-1"].getOfferAmountOriginal(), 5000);
+    BOOST_CHECK_EQUAL(decodedOffers["a-1"].getXZCDesiredOriginal(), 10000);
+    BOOST_CHECK_EQUAL(decodedOffers["a-1"].getMinFee(), 1000);
+    BOOST_CHECK(decodedOffers["a-1"].getHash() == uint256S("01"));
+
+    BOOST_CHECK_EQUAL(decodedAccepts.size(), 1);
+    BOOST_CHECK_EQUAL(decodedAccepts["a-1+b"].getAcceptAmount(), 2000);
+    BOOST_CHECK_EQUAL(decodedAccepts["a-1+b"].getAcceptBlock(), 101);
+    BOOST_CHECK_EQUAL(decodedAccepts["a-1+b"].getOfferAmountOriginal(), 5000);
+}
+
+BOOST_AUTO_TEST_CASE(crowdsale_roundtrip)
+{
+    CMPCrowd crowd(3, 100, 1, 1500000000, 10, 5, 20, 30);
+    crowd.insertDatabase(uint256S("02"), std::vector<int64_t>{1, 2, 3, 4});
+
+    CDataStream ss(SER_DISK, CLIENT_VERSION);
+    ss << crowd;
+
+    CMPCrowd decoded;
+    ss >> decoded;
+
+    BOOST_CHECK(ss.empty());
+    BOOST_CHECK_EQUAL(decoded.getPropertyId(), 3);
+    BOOST_CHECK_EQUAL(decoded.getDeadline(), 1500000000);
+    BOOST_CHECK_EQUAL(decoded.getUserCreated(), 20);
+    BOOST_CHECK_EQUAL(decoded.getIssuerCreated(), 30);
+    BOOST_CHECK(decoded.getDatabase() == crowd.getDatabase());
+}
+
+BOOST_AUTO_TEST_CASE(hashed_writer_matches_verifier)
+{
+    CDataStream ss(SER_DISK, CLIENT_VERSION);
+
+    CHashedSourceWriter<CDataStream> writer(&ss);
+    writer << std::string("balances") << uint32_t(3) << int64_t(-1);
+    uint256 written = writer.GetHash();
+
+    BOOST_CHECK(written == (CHashWriter(SER_DISK, CLIENT_VERSION) << std::string("balances") << uint32_t(3) << int64_t(-1)).GetHash());
+
+    std::string name;
+    uint32_t propertyId;
+    int64_t amount;
+    CHashVerifier<CDataStream> verifier(&ss);
+    verifier >> name >> propertyId >> amount;
+
+    BOOST_CHECK(ss.empty());
+    BOOST_CHECK_EQUAL(name, "balances");
+    BOOST_CHECK(written == verifier.GetHash());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,6 +1,9 @@
 #ifndef ELYSIUM_TEST_UTILS_TX_H
 #define ELYSIUM_TEST_UTILS_TX_H
 
+#include <boost/filesystem/path.hpp>
+
+class CBlockIndex;
 class CTxOut;
 
 CTxOut PayToPubKeyHash_Elysium();
@@ -18,5 +21,8 @@ CTxOut OpReturn_SimpleSend();
 CTxOut OpReturn_MultiSimpleSend();
 CTxOut NonStandardOutput();
 
+// State persistence of elysium.cpp, not part of its interface
+extern boost::filesystem::path MPPersistencePath;
+bool elysium_load_state(CBlockIndex const *pBlockIndex);
 
 #endif // ELYSIUM_TEST_UTILS_TX_H
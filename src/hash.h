@@ -250,6 +250,31 @@ public:
     }
 };
 
+/** Writes data to an underlying stream, while hashing the written data. */
+template<typename Source>
+class CHashedSourceWriter : public CHashWriter
+{
+private:
+    Source* source;
+
+public:
+    CHashedSourceWriter(Source* source_) : CHashWriter(source_->GetType(), source_->GetVersion()), source(source_) {}
+
+    void write(const char* pch, size_t nSize)
+    {
+        source->write(pch, nSize);
+        CHashWriter::write(pch, nSize);
+    }
+
+    template<typename T>
+    CHashedSourceWriter<Source>& operator<<(const T& obj)
+    {
+        // Serialize to this stream
+        ::Serialize(*this, obj);
+        return (*this);
+    }
+};
+
 /** Compute the 256-bit hash of an object's serialization. */
 template<typename T>
 uint256 SerializeHash(const T& obj, int nType=SER_GETHASH, int nVersion=PROTOCOL_VERSION)
@@ -34,6 +34,10 @@ CHDMintTracker::CHDMintTracker(std::string strWalletFile)
     mapSerialHashes.clear();
     mapLelantusSerialHashes.clear();
     mapPendingSpends.clear();
+    mapPubcoinHashes.clear();
+    mapLelantusPubcoinHashes.clear();
+    setUnusedSerialHashes.clear();
+    setUnusedLelantusSerialHashes.clear();
     fInitialized = false;
 }
 
@@ -79,8 +83,11 @@ bool CHDMintTracker::Archive(CMintMeta& meta)
 {
     uint256 hashPubcoin = meta.GetPubCoinValueHash();
 
-    if (HasSerialHash(meta.hashSerial))
-        mapSerialHashes.at(meta.hashSerial).isArchived = true;
+    if (HasSerialHash(meta.hashSerial)) {
+        CMintMeta archived = mapSerialHashes.at(meta.hashSerial);
+        archived.isArchived = true;
+        SetMeta(archived);
+    }
 
    CWalletDB walletdb(strWalletFile);
     CHDMint dMint;
@@ -97,8 +104,11 @@ bool CHDMintTracker::Archive(CLelantusMintMeta& meta)
 {
     uint256 hashPubcoin = meta.GetPubCoinValueHash();
 
-    if (HasLelantusSerialHash(meta.hashSerial))
-        mapLelantusSerialHashes.at(meta.hashSerial).isArchived = true;
+    if (HasLelantusSerialHash(meta.hashSerial)) {
+        CLelantusMintMeta archived = mapLelantusSerialHashes.at(meta.hashSerial);
+        archived.isArchived = true;
+        SetMeta(archived);
+    }
 
     CWalletDB walletdb(strWalletFile);
     CHDMint dMint;
@@ -172,26 +182,20 @@ bool CHDMintTracker::GetMetaFromSerial(const uint256 &hashSerial, CLelantusMintM
  */
 bool CHDMintTracker::GetMetaFromPubcoin(const uint256& hashPubcoin, CMintMeta& mMeta)
 {
-    for (auto it : mapSerialHashes) {
-        if (it.second.GetPubCoinValueHash() == hashPubcoin){
-            mMeta = it.second;
-            return true;
-        }
-    }
+    auto it = mapPubcoinHashes.find(hashPubcoin);
+    if (it == mapPubcoinHashes.end())
+        return false;
 
-    return false;
+    return GetMetaFromSerial(it->second, mMeta);
 }
 
 bool CHDMintTracker::GetLelantusMetaFromPubcoin(const uint256& hashPubcoin, CLelantusMintMeta& mMeta)
 {
-    for (auto it : mapLelantusSerialHashes) {
-        if (it.second.GetPubCoinValueHash() == hashPubcoin){
-            mMeta = it.second;
-            return true;
-        }
-    }
+    auto it = mapLelantusPubcoinHashes.find(hashPubcoin);
+    if (it == mapLelantusPubcoinHashes.end())
+        return false;
 
-    return false;
+    return GetMetaFromSerial(it->second, mMeta);
 }
 
 /**
@@ -221,11 +225,8 @@ std::vector<uint256> CHDMintTracker::GetSerialHashes()
  */
 bool CHDMintTracker::HasPubcoinHash(const uint256& hashPubcoin, CWalletDB& walletdb) const
 {
-    for (auto const & it : mapSerialHashes) {
-        CMintMeta meta = it.second;
-        if (meta.GetPubCoinValueHash() == hashPubcoin)
-            return true;
-    }
+    if (mapPubcoinHashes.count(hashPubcoin))
+        return true;
 
     for (auto const & it : mapLelantusSerialHashes) {
         CLelantusMintMeta meta = it.second;
@@ -329,7 +330,7 @@ bool CHDMintTracker::UpdateState(const CMintMeta& meta)
             CT_UPDATED);
     }
 
-    mapSerialHashes[meta.hashSerial] = meta;
+    SetMeta(meta);
 
     return true;
 }
@@ -378,11 +379,42 @@ bool CHDMintTracker::UpdateState(const CLelantusMintMeta& meta)
             std::string("Update (") + std::to_string((double)dMint.GetAmount() / COIN) + "mint)",
             CT_UPDATED);
 
-    mapLelantusSerialHashes[meta.hashSerial] = meta;
+    SetMeta(meta);
 
     return true;
 }
 
+/**
+ * Store a mint object in memory.
+ *
+ * Every change of the in-memory mints goes through here so that the pubcoin lookup
+ * and the set of unused mints stay in line with them.
+ *
+ * @param meta the mint object to store
+ * @return void
+ */
+void CHDMintTracker::SetMeta(const CMintMeta& meta)
+{
+    mapSerialHashes[meta.hashSerial] = meta;
+    mapPubcoinHashes[meta.GetPubCoinValueHash()] = meta.hashSerial;
+
+    if (meta.isUsed || meta.isArchived)
+        setUnusedSerialHashes.erase(meta.hashSerial);
+    else
+        setUnusedSerialHashes.insert(meta.hashSerial);
+}
+
+void CHDMintTracker::SetMeta(const CLelantusMintMeta& meta)
+{
+    mapLelantusSerialHashes[meta.hashSerial] = meta;
+    mapLelantusPubcoinHashes[meta.GetPubCoinValueHash()] = meta.hashSerial;
+
+    if (meta.isUsed || meta.isArchived)
+        setUnusedLelantusSerialHashes.erase(meta.hashSerial);
+    else
+        setUnusedLelantusSerialHashes.insert(meta.hashSerial);
+}
+
 /**
  * Add a mint object to memory.
  *
@@ -410,7 +442,7 @@ void CHDMintTracker::Add(CWalletDB& walletdb, const CHDMint& dMint, bool isNew,
     meta.isArchived = isArchived;
     meta.isDeterministic = true;
     meta.isSeedCorrect = true;
-    mapSerialHashes[meta.hashSerial] = meta;
+    SetMeta(meta);
 
     pwalletMain->NotifyZerocoinChanged(
         pwalletMain,
@@ -434,7 +466,7 @@ void CHDMintTracker::AddLelantus(CWalletDB& walletdb, const CHDMint& dMint, bool
     meta.amount = dMint.GetAmount();
     meta.isArchived = isArchived;
     meta.isSeedCorrect = true;
-    mapLelantusSerialHashes[meta.hashSerial] = meta;
+    SetMeta(meta);
 
     pwalletMain->NotifyZerocoinChanged(
             pwalletMain,
@@ -462,7 +494,7 @@ void CHDMintTracker::Add(CWalletDB& walletdb, const CSigmaEntry& sigma, bool isN
     meta.isArchived = isArchived;
     meta.isDeterministic = false;
     meta.isSeedCorrect = true;
-    mapSerialHashes[meta.hashSerial] = meta;
+    SetMeta(meta);
 
     if (isNew)
         walletdb.WriteSigmaEntry(sigma);
@@ -516,72 +548,14 @@ void CHDMintTracker::SetPubcoinNotUsed(const uint256& hashPubcoin)
 }
 
 
-/**
- * Check mempool for the spend associated with the mint serial hash passed
- *
- * @param setMempool the set of txid hashes in the mempool
- * @param hashSerial the mint serial hash to check for
- * @return success
- */
-bool CHDMintTracker::IsMempoolSpendOurs(const std::set<uint256>& setMempool, const uint256& hashSerial){
-    for(auto& mempoolTxid : setMempool){
-        CTransactionRef ptx = txpools.get(mempoolTxid);
-        if(!ptx) {
-            continue;
-        }
-
-        const CTransaction &tx = *ptx;
-        for (const CTxIn& txin : tx.vin) {
-            if (txin.IsSigmaSpend()) {
-                std::unique_ptr<sigma::CoinSpend> spend;
-                uint32_t pubcoinId;
-                try {
-                    std::tie(spend, pubcoinId) = sigma::ParseSigmaSpend(txin);
-                } catch (CBadTxIn &) {
-                    return false;
-                } catch (std::ios_base::failure &) {
-                    return false;
-                }
-
-                uint256 mempoolHashSerial = primitives::GetSerialHash(spend->getCoinSerialNumber());
-                if(mempoolHashSerial==hashSerial){
-                    return true;
-                }
-            }
-
-            if (txin.IsLelantusJoinSplit()) {
-                std::unique_ptr<lelantus::JoinSplit> joinsplit;
-                try {
-                    joinsplit = lelantus::ParseLelantusJoinSplit(txin);
-                } catch (CBadTxIn &) {
-                    return false;
-                } catch (std::ios_base::failure &) {
-                    return false;
-                }
-
-                const std::vector<Scalar>& serials = joinsplit->getCoinSerialNumbers();
-                for(const auto& serial: serials) {
-                    uint256 mempoolHashSerial = primitives::GetSerialHash(serial);
-                    if(mempoolHashSerial==hashSerial){
-                        return true;
-                    }
-                }
-            }
-        }
-    }
-
-    return false;
-}
-
 /**
  * Update the in-memory CMintMeta object for the current mempool
  *
- * @param setMempool the set of txid hashes in the mempool
  * @param mint the CMintMeta object to check for
- * @param fSpend if this mint object is being updated as a result of a spend transaction
+ * @param fSpendInMempool if the mint is spent by a transaction in the mempool
  * @return success
  */
-bool CHDMintTracker::UpdateMetaStatus(const std::set<uint256>& setMempool, CMintMeta& mint, bool fSpend)
+bool CHDMintTracker::UpdateMetaStatus(CMintMeta& mint, bool fSpendInMempool)
 {
     uint256 hashPubcoin = mint.GetPubCoinValueHash();
     //! Check whether this mint has been spent and is considered 'pending' or 'confirmed'
@@ -596,8 +570,8 @@ bool CHDMintTracker::UpdateMetaStatus(const std::set<uint256>& setMempool, CMint
     bool isPendingSpend = static_cast<bool>(mapPendingSpends.count(mint.hashSerial));
 
     // Mempool might hold pending spend
-    if(!isPendingSpend && fSpend)
-        isPendingSpend = IsMempoolSpendOurs(setMempool, mint.hashSerial);
+    if(!isPendingSpend && fSpendInMempool)
+        isPendingSpend = true;
 
     LogPrintf("UpdateMetaStatus : isPendingSpend: %d\n", isPendingSpend);
 
@@ -629,7 +603,7 @@ bool CHDMintTracker::UpdateMetaStatus(const std::set<uint256>& setMempool, CMint
 
         LogPrintf("UpdateMetaStatus : mint.txid = %d\n", mint.txid.GetHex());
 
-        if (setMempool.count(mint.txid)) {
+        if (txpools.get(mint.txid)) {
             if(mint.nHeight>-1) mint.nHeight = -1;
             if(mint.nId>-1) mint.nId = -1;
             return true;
@@ -677,7 +651,7 @@ bool CHDMintTracker::UpdateMetaStatus(const std::set<uint256>& setMempool, CMint
     return false;
 }
 
-bool CHDMintTracker::UpdateLelantusMetaStatus(const std::set<uint256>& setMempool, CLelantusMintMeta& mint, bool fSpend)
+bool CHDMintTracker::UpdateLelantusMetaStatus(CLelantusMintMeta& mint, bool fSpendInMempool)
 {
     uint256 hashPubcoin = mint.GetPubCoinValueHash();
     //! Check whether this mint has been spent and is considered 'pending' or 'confirmed'
@@ -692,8 +666,8 @@ bool CHDMintTracker::UpdateLelantusMetaStatus(const std::set<uint256>& setMempoo
     bool isPendingSpend = static_cast<bool>(mapPendingSpends.count(mint.hashSerial));
 
     // Mempool might hold pending spend
-    if(!isPendingSpend && fSpend)
-        isPendingSpend = IsMempoolSpendOurs(setMempool, mint.hashSerial);
+    if(!isPendingSpend && fSpendInMempool)
+        isPendingSpend = true;
 
     LogPrintf("UpdateLelantusMetaStatus : isPendingSpend: %d\n", isPendingSpend);
 
@@ -725,7 +699,7 @@ bool CHDMintTracker::UpdateLelantusMetaStatus(const std::set<uint256>& setMempoo
 
         LogPrintf("UpdateLelantusMetaStatus : mint.txid = %d\n", mint.txid.GetHex());
 
-        if (setMempool.count(mint.txid)) {
+        if (txpools.get(mint.txid)) {
             if(mint.nHeight>-1) mint.nHeight = -1;
             if(mint.nId>-1) mint.nId = -1;
             return true;
@@ -815,7 +789,6 @@ void CHDMintTracker::UpdateMintStateFromBlock(const std::vector<sigma::PublicCoi
     uint160 hashSeedMasterEntry;
     CKeyID seedId;
     int32_t nCount;
-    std::set<uint256> setMempool = GetMempoolTxids();
     for (auto& mint : mints) {
         uint256 hashPubcoin = primitives::GetPubCoinValueHash(mint.getValue());
         CMintMeta meta;
@@ -827,7 +800,7 @@ void CHDMintTracker::UpdateMintStateFromBlock(const std::vector<sigma::PublicCoi
                 mintPoolEntries.push_back(std::make_pair(hashPubcoin, mintPoolEntry));
                 continue;
             }
-            if(UpdateMetaStatus(setMempool, meta)){
+            if(UpdateMetaStatus(meta)){
                 updatedMeta.emplace_back(meta);
             }
         }
@@ -843,7 +816,6 @@ void CHDMintTracker::UpdateMintStateFromBlock(const std::vector<std::pair<lelant
     uint160 hashSeedMasterEntry;
     CKeyID seedId;
     int32_t nCount;
-    std::set<uint256> setMempool = GetMempoolTxids();
     for (auto& mint : mints) {
         uint256 reducedHash;
         if(!walletdb.ReadPubcoinHashes(primitives::GetPubCoinValueHash(mint.first.getValue()), reducedHash)) {
@@ -860,7 +832,7 @@ void CHDMintTracker::UpdateMintStateFromBlock(const std::vector<std::pair<lelant
                 mintPoolEntries.push_back(std::make_pair(reducedHash, mintPoolEntry));
                 continue;
             }
-            if(UpdateLelantusMetaStatus(setMempool, meta)){
+            if(UpdateLelantusMetaStatus(meta)){
                 updatedMeta.emplace_back(meta);
             }
         }
@@ -884,7 +856,6 @@ void CHDMintTracker::UpdateSpendStateFromBlock(const sigma::spend_info_container
     uint160 hashSeedMasterEntry;
     CKeyID seedId;
     int32_t nCount;
-    std::set<uint256> setMempool = GetMempoolTxids();
     for(auto& spentSerial : spentSerials){
         uint256 spentSerialHash = primitives::GetSerialHash(spentSerial.first);
         CMintMeta meta;
@@ -901,7 +872,7 @@ void CHDMintTracker::UpdateSpendStateFromBlock(const sigma::spend_info_container
                 mintPoolEntries.push_back(std::make_pair(hashPubcoin, mintPoolEntry));
                 continue;
             }
-            if(UpdateMetaStatus(setMempool, meta, true)){
+            if(UpdateMetaStatus(meta, !sigma::CSigmaState::GetState()->GetMempoolConflictingTxHash(spentSerial.first).IsNull())){
                 updatedMeta.emplace_back(meta);
             }
         }
@@ -917,7 +888,6 @@ void CHDMintTracker::UpdateSpendStateFromBlock(const std::unordered_map<Scalar,
     uint160 hashSeedMasterEntry;
     CKeyID seedId;
     int32_t nCount;
-    std::set<uint256> setMempool = GetMempoolTxids();
     for(auto& spentSerial : spentSerials){
         uint256 spentSerialHash = primitives::GetSerialHash(spentSerial.first);
         CLelantusMintMeta meta;
@@ -934,7 +904,7 @@ void CHDMintTracker::UpdateSpendStateFromBlock(const std::unordered_map<Scalar,
                 mintPoolEntries.push_back(std::make_pair(hashPubcoin, mintPoolEntry));
                 continue;
             }
-            if(UpdateLelantusMetaStatus(setMempool, meta, true)){
+            if(UpdateLelantusMetaStatus(meta, !lelantus::CLelantusState::GetState()->GetMempoolConflictingTxHash(spentSerial.first).IsNull())){
                 updatedMeta.emplace_back(meta);
             }
         }
@@ -958,7 +928,6 @@ void CHDMintTracker::UpdateMintStateFromMempool(const std::vector<GroupElement>&
     uint160 hashSeedMasterEntry;
     CKeyID seedId;
     int32_t nCount;
-    std::set<uint256> setMempool = GetMempoolTxids();
     for (auto& pubcoin : pubCoins) {
         uint256 hashPubcoin = primitives::GetPubCoinValueHash(pubcoin);
 
@@ -976,7 +945,7 @@ void CHDMintTracker::UpdateMintStateFromMempool(const std::vector<GroupElement>&
                 continue;
             }
 
-            if(UpdateMetaStatus(setMempool, meta)){
+            if(UpdateMetaStatus(meta)){
                 updatedMeta.emplace_back(meta);
             }
         }
@@ -992,7 +961,6 @@ void CHDMintTracker::UpdateLelantusMintStateFromMempool(const std::vector<GroupE
     uint160 hashSeedMasterEntry;
     CKeyID seedId;
     int32_t nCount;
-    std::set<uint256> setMempool = GetMempoolTxids();
     int i = 0;
     for (auto& pubcoin : pubCoins) {
         uint256 reducedHash;
@@ -1017,7 +985,7 @@ void CHDMintTracker::UpdateLelantusMintStateFromMempool(const std::vector<GroupE
                 continue;
             }
 
-            if(UpdateLelantusMetaStatus(setMempool, metaLelantus)){
+            if(UpdateLelantusMetaStatus(metaLelantus)){
                 updatedLelantusMeta.emplace_back(metaLelantus);
             }
 
@@ -1043,7 +1011,6 @@ void CHDMintTracker::UpdateSpendStateFromMempool(const vector<Scalar>& spentSeri
     uint160 hashSeedMasterEntry;
     CKeyID seedId;
     int32_t nCount;
-    std::set<uint256> setMempool = GetMempoolTxids();
     for(auto& spentSerial : spentSerials){
         uint256 spentSerialHash = primitives::GetSerialHash(spentSerial);
         CMintMeta meta;
@@ -1060,7 +1027,7 @@ void CHDMintTracker::UpdateSpendStateFromMempool(const vector<Scalar>& spentSeri
                 mintPoolEntries.push_back(std::make_pair(hashPubcoin, mintPoolEntry));
                 continue;
             }
-            if(UpdateMetaStatus(setMempool, meta, true)){
+            if(UpdateMetaStatus(meta, true)){
                 updatedMeta.emplace_back(meta);
             }
         }
@@ -1076,7 +1043,6 @@ void CHDMintTracker::UpdateJoinSplitStateFromMempool(const vector<Scalar>& spent
     uint160 hashSeedMasterEntry;
     CKeyID seedId;
     int32_t nCount;
-    std::set<uint256> setMempool = GetMempoolTxids();
     for(auto& spentSerial : spentSerials){
         uint256 spentSerialHash = primitives::GetSerialHash(spentSerial);
         CLelantusMintMeta meta;
@@ -1093,7 +1059,7 @@ void CHDMintTracker::UpdateJoinSplitStateFromMempool(const vector<Scalar>& spent
                 mintPoolEntries.push_back(std::make_pair(hashPubcoin, mintPoolEntry));
                 continue;
             }
-            if(UpdateLelantusMetaStatus(setMempool, meta, true)){
+            if(UpdateLelantusMetaStatus(meta, true)){
                 updatedMeta.emplace_back(meta);
             }
         }
@@ -1166,19 +1132,16 @@ std::vector<CMintMeta> CHDMintTracker::ListMints(bool fUnusedOnly, bool fMatureO
     }
 
     std::vector<CMintMeta> vOverWrite;
-    std::set<uint256> setMempool = GetMempoolTxids();
-    for (auto& it : mapSerialHashes) {
-        CMintMeta mint = it.second;
-
+    auto processMint = [&](CMintMeta mint) {
         //This is only intended for unarchived coins
         if (mint.isArchived)
-            continue;
+            return;
 
         // Update the metadata of the mints if requested
         if (fUpdateStatus){
-            if(UpdateMetaStatus(setMempool, mint)) {
+            if(UpdateMetaStatus(mint)) {
                 if (mint.isArchived)
-                    continue;
+                    return;
 
                 // Mint was updated, queue for overwrite
                 vOverWrite.emplace_back(mint);
@@ -1186,18 +1149,28 @@ std::vector<CMintMeta> CHDMintTracker::ListMints(bool fUnusedOnly, bool fMatureO
         }
 
         if (fUnusedOnly && mint.isUsed)
-            continue;
+            return;
 
         if (fMatureOnly) {
             // Not confirmed
             if (!mint.nHeight || !(mint.nHeight + (ZC_MINT_CONFIRMATIONS-1) <= chainActive.Height()))
-                continue;
+                return;
         }
 
         if (!fWrongSeed && !mint.isSeedCorrect)
-            continue;
+            return;
 
         setMints.push_back(mint);
+    };
+
+    // The status is kept up to date by the block and mempool events, so unless a full
+    // re-evaluation is asked for only the unused mints have to be looked at
+    if (fUnusedOnly && !fUpdateStatus) {
+        for (auto const & hashSerial : setUnusedSerialHashes)
+            processMint(mapSerialHashes.at(hashSerial));
+    } else {
+        for (auto const & it : mapSerialHashes)
+            processMint(it.second);
     }
 
     //overwrite any updates
@@ -1210,7 +1183,6 @@ std::vector<CMintMeta> CHDMintTracker::ListMints(bool fUnusedOnly, bool fMatureO
 std::vector<CLelantusMintMeta> CHDMintTracker::ListLelantusMints(bool fUnusedOnly, bool fMatureOnly, bool fUpdateStatus, bool fLoad, bool fWrongSeed)
 {
     std::vector<CLelantusMintMeta> vOverWrite;
-    std::set<uint256> setMempool = GetMempoolTxids();
 
     std::vector<CLelantusMintMeta> setMints;
     LOCK2(cs_main, pwalletMain->cs_wallet);
@@ -1223,18 +1195,16 @@ std::vector<CLelantusMintMeta> CHDMintTracker::ListLelantusMints(bool fUnusedOnl
         LogPrint("zero", "%s: added %d lelantus hdmint from DB\n", __func__, listDeterministicDB.size());
     }
 
-    for (auto& it : mapLelantusSerialHashes) {
-        CLelantusMintMeta mint = it.second;
-
+    auto processMint = [&](CLelantusMintMeta mint) {
         //This is only intended for unarchived coins
         if (mint.isArchived)
-            continue;
+            return;
 
         // Update the metadata of the mints if requested
         if (fUpdateStatus){
-            if(UpdateLelantusMetaStatus(setMempool, mint)) {
+            if(UpdateLelantusMetaStatus(mint)) {
                 if (mint.isArchived)
-                    continue;
+                    return;
 
                 // Mint was updated, queue for overwrite
                 vOverWrite.emplace_back(mint);
@@ -1242,18 +1212,28 @@ std::vector<CLelantusMintMeta> CHDMintTracker::ListLelantusMints(bool fUnusedOnl
         }
 
         if (fUnusedOnly && mint.isUsed)
-            continue;
+            return;
 
         if (fMatureOnly) {
             // Not confirmed
             if (!mint.nHeight || !(mint.nHeight + (ZC_MINT_CONFIRMATIONS-1) <= chainActive.Height()))
-                continue;
+                return;
         }
 
         if (!fWrongSeed && !mint.isSeedCorrect)
-            continue;
+            return;
 
         setMints.push_back(mint);
+    };
+
+    // The status is kept up to date by the block and mempool events, so unless a full
+    // re-evaluation is asked for only the unused mints have to be looked at
+    if (fUnusedOnly && !fUpdateStatus) {
+        for (auto const & hashSerial : setUnusedLelantusSerialHashes)
+            processMint(mapLelantusSerialHashes.at(hashSerial));
+    } else {
+        for (auto const & it : mapLelantusSerialHashes)
+            processMint(it.second);
     }
 
     //overwrite any updates
@@ -1263,21 +1243,6 @@ std::vector<CLelantusMintMeta> CHDMintTracker::ListLelantusMints(bool fUnusedOnl
     return setMints;
 }
 
-/**
- * Get txids of all mempool entries.
- *
- * @return set of mempool txids
- */
-std::set<uint256> CHDMintTracker::GetMempoolTxids(){
-    std::set<uint256> setMempool;
-    setMempool.clear();
-    {
-        LOCK(mempool.cs);
-        txpools.getTransactions(setMempool);
-    }
-    return setMempool;
-}
-
 /**
  * map of serial hashes -> CMintMeta objects
  *
@@ -1286,4 +1251,10 @@ std::set<uint256> CHDMintTracker::GetMempoolTxids(){
 void CHDMintTracker::Clear()
 {
     mapSerialHashes.clear();
+    mapPubcoinHashes.clear();
+    setUnusedSerialHashes.clear();
+    mapLelantusSerialHashes.clear();
+    mapLelantusPubcoinHashes.clear();
+    setUnusedLelantusSerialHashes.clear();
+    mapPendingSpends.clear();
 }
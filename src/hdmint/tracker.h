@@ -21,11 +21,16 @@ private:
     std::map<uint256, CMintMeta> mapSerialHashes;
     std::map<uint256, CLelantusMintMeta> mapLelantusSerialHashes;
     std::map<uint256, uint256> mapPendingSpends; //serialhash, txid of spend
-    bool IsMempoolSpendOurs(const std::set<uint256>& setMempool, const uint256& hashSerial);
-    bool UpdateMetaStatus(const std::set<uint256>& setMempool, CMintMeta& mint, bool fSpend=false);
-    bool UpdateLelantusMetaStatus(const std::set<uint256>& setMempool, CLelantusMintMeta& mint, bool fSpend=false);
-
-    std::set<uint256> GetMempoolTxids();
+    // Kept in step with the maps above by SetMeta, so lookups by pubcoin and listing
+    // of spendable mints don't have to walk every mint the wallet ever had
+    std::map<uint256, uint256> mapPubcoinHashes; //pubcoinhash, serialhash
+    std::map<uint256, uint256> mapLelantusPubcoinHashes; //pubcoinhash, serialhash
+    std::set<uint256> setUnusedSerialHashes; //neither used nor archived
+    std::set<uint256> setUnusedLelantusSerialHashes; //neither used nor archived
+    void SetMeta(const CMintMeta& meta);
+    void SetMeta(const CLelantusMintMeta& meta);
+    bool UpdateMetaStatus(CMintMeta& mint, bool fSpendInMempool=false);
+    bool UpdateLelantusMetaStatus(CLelantusMintMeta& mint, bool fSpendInMempool=false);
 public:
     CHDMintTracker(std::string strWalletFile);
     ~CHDMintTracker();
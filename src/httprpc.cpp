@@ -194,10 +194,15 @@ static bool HTTPReq_JSONRPC(HTTPRequest* req, const std::string &)
         if (valRequest.isObject()) {
             jreq.parse(valRequest);
 
+            std::string strResult;
+            jreq.jsonResult = &strResult;
             UniValue result = tableRPC.execute(jreq);
 
-            // Send reply
-            strReply = JSONRPCReply(result, NullUniValue, jreq.id);
+            // Send reply, streamed results are written by the handler already
+            if (!strResult.empty())
+                strReply = JSONRPCRawReply(strResult, jreq.id);
+            else
+                strReply = JSONRPCReply(result, NullUniValue, jreq.id);
             if (fSanitizeResponse) {
                 strReply = SanitizeInvalidUTF8(strReply);
             }
@@ -42,6 +42,8 @@
 #include "validation.h"
 #include "mtpstate.h"
 #include "batchproof_container.h"
+#include "sigma.h"
+#include "lelantus.h"
 
 #ifdef ENABLE_WALLET
 #include "wallet/wallet.h"
@@ -288,6 +290,9 @@ void Shutdown()
         LOCK(cs_main);
         if (pcoinsTip != NULL) {
             FlushStateToDisk();
+            // lets the next start skip replaying the chain
+            sigma::DumpSigmaState();
+            lelantus::DumpLelantusState();
         }
         delete pcoinsTip;
         pcoinsTip = NULL;
@@ -423,6 +428,9 @@ std::string HelpMessage(HelpMessageMode mode)
     }
     strUsage += HelpMessageOpt("-datadir=<dir>", _("Specify data directory"));
     strUsage += HelpMessageOpt("-dbcache=<n>", strprintf(_("Set database cache size in megabytes (%d to %d, default: %d)"), nMinDbCache, nMaxDbCache, nDefaultDbCache));
+    strUsage += HelpMessageOpt("-dbblockcache=<db>:<n>", _("Set the block cache of database <db> (chainstate, blockindex, evodb or llmq) in megabytes, instead of half of its share of -dbcache (can be specified multiple times)"));
+    strUsage += HelpMessageOpt("-dbfilesize=<db>:<n>", _("Set the size of the table files of database <db> in megabytes (default: 32 for blockindex, 2 otherwise)"));
+    strUsage += HelpMessageOpt("-dbwritebuffer=<db>:<n>", _("Set the write buffer of database <db> in megabytes, instead of a quarter of its share of -dbcache"));
     if (showDebug)
         strUsage += HelpMessageOpt("-feefilter", strprintf("Tell other nodes to filter invs to us by our mempool min fee (default: %u)", DEFAULT_FEEFILTER));
     strUsage += HelpMessageOpt("-loadblock=<file>", _("Imports blocks from external blk000??.dat file on startup"));
@@ -444,6 +452,7 @@ std::string HelpMessage(HelpMessageMode mode)
     strUsage += HelpMessageOpt("-sysperms", _("Create new files with system default permissions, instead of umask 077 (only effective with disabled wallet functionality)"));
 #endif
     strUsage += HelpMessageOpt("-txindex", strprintf(_("Maintain a full transaction index, used by the getrawtransaction rpc call (default: %u)"), DEFAULT_TXINDEX));
+    strUsage += HelpMessageOpt("-blockfilterindex", strprintf(_("Maintain compact filters of the scripts, mints and serials of connected blocks, so wallet rescans can skip the blocks not involving the wallet (default: %u)"), DEFAULT_BLOCKFILTERINDEX));
 
     strUsage += HelpMessageGroup(_("Connection options:"));
     strUsage += HelpMessageOpt("-addnode=<ip>", _("Add a node to connect to and attempt to keep the connection open"));
@@ -499,6 +508,7 @@ std::string HelpMessage(HelpMessageMode mode)
     strUsage += HelpMessageOpt("-zmqpubhashtx=<address>", _("Enable publish hash transaction in <address>"));
     strUsage += HelpMessageOpt("-zmqpubrawblock=<address>", _("Enable publish raw block in <address>"));
     strUsage += HelpMessageOpt("-zmqpubrawtx=<address>", _("Enable publish raw transaction in <address>"));
+    strUsage += HelpMessageOpt("-zmqstreamblock=<address>", _("Enable streaming of blocks with undo data from a requested height in <address>"));
 #endif
 
     strUsage += HelpMessageGroup(_("Debugging/Testing options:"));
@@ -595,6 +605,7 @@ std::string HelpMessage(HelpMessageMode mode)
     strUsage += HelpMessageOpt("-startclean", "Clear all persistence files on startup; triggers reparsing of Elysium transactions");
     strUsage += HelpMessageOpt("-elysiumtxcache=<num>", "The maximum number of transactions in the input transaction cache (default: 500000)");
     strUsage += HelpMessageOpt("-elysiumprogressfrequency=<seconds>", "Time in seconds after which the initial scanning progress is reported (default: 30)");
+    strUsage += HelpMessageOpt("-elysiumscanthreads=<n>", strprintf("The number of threads reading and prefiltering blocks during the initial scan, 0 for one per core (default: %d)", DEFAULT_ELYSIUM_SCAN_THREADS));
     strUsage += HelpMessageOpt("-elysiumdebug=<category>", "Enable or disable log categories, can be \"all\" or \"none\"");
     strUsage += HelpMessageOpt("-autocommit=<flag>", "Enable or disable broadcasting of transactions, when creating transactions (default: 1)");
     strUsage += HelpMessageOpt("-overrideforcedshutdown=<flag>", "Disable force shutdown when error (default: 0)");
@@ -1217,6 +1228,7 @@ bool AppInitParameterInteraction()
     }
     fCheckBlockIndex = GetBoolArg("-checkblockindex", chainparams.DefaultConsistencyChecks());
     fCheckpointsEnabled = GetBoolArg("-checkpoints", DEFAULT_CHECKPOINTS_ENABLED);
+    fBlockFilterIndex = GetBoolArg("-blockfilterindex", DEFAULT_BLOCKFILTERINDEX);
 
     hashAssumeValid = uint256S(GetArg("-assumevalid", chainparams.GetConsensus().defaultAssumeValid.GetHex()));
     if (!hashAssumeValid.IsNull())
@@ -1689,8 +1701,10 @@ bool AppInitMain(boost::thread_group& threadGroup, CScheduler& scheduler)
         nTotalCache = (1 << 22);
     int64_t nBlockTreeDBCache = nTotalCache / 8;
 //    nBlockTreeDBCache = std::min(nBlockTreeDBCache, (GetBoolArg("-txindex", DEFAULT_TXINDEX) ? nMaxBlockDBAndTxIndexCache : nMaxBlockDBCache) << 20);
-    if (nBlockTreeDBCache > (1 << 21) && !GetBoolArg("-txindex", false))
-        nBlockTreeDBCache = (1 << 21); // block tree db cache shouldn't be larger than 2 MiB
+    bool fBlockTreeIndexes = GetBoolArg("-txindex", false) || GetBoolArg("-addressindex", DEFAULT_ADDRESSINDEX)
+        || GetBoolArg("-spentindex", DEFAULT_SPENTINDEX) || GetBoolArg("-timestampindex", DEFAULT_TIMESTAMPINDEX);
+    if (nBlockTreeDBCache > (1 << 21) && !fBlockTreeIndexes)
+        nBlockTreeDBCache = (1 << 21); // block tree db cache shouldn't be larger than 2 MiB without the indexes
     nTotalCache -= nBlockTreeDBCache;
     int64_t nCoinDBCache = std::min(nTotalCache / 2,
                                     (nTotalCache / 4) + (1 << 23)); // use 25%-50% of the remainder for disk cache
@@ -1762,6 +1776,12 @@ bool AppInitMain(boost::thread_group& threadGroup, CScheduler& scheduler)
                     break;
                 }
 
+                // The running address balances are rebuilt along with the chain state
+                if (fReindexChainState && fAddressBalanceIndex && !pblocktree->WipeAddressBalances()) {
+                    strLoadError = _("Error wiping the address balances");
+                    break;
+                }
+
                 if (!fReindex) {
                     CBlockIndex *tip = chainActive.Tip();
                     if (tip && tip->nHeight >= chainparams.GetConsensus().nLelantusStartBlock) {
@@ -84,7 +84,7 @@ bool VerifyMintSchnorrProof(const uint64_t& v, const secp_primitives::GroupEleme
 {
     auto params = lelantus::Params::get_default();
 
-    secp_primitives::GroupElement comm = commit + (params->get_h1() * Scalar(v).negate());
+    secp_primitives::GroupElement comm = commit + params->get_h1_table().mul(Scalar(v).negate());
     SchnorrVerifier verifier(params->get_g(), params->get_h0());
     return verifier.verify(comm, schnorrProof);
 }
@@ -176,6 +176,76 @@ std::unique_ptr<JoinSplit> ParseLelantusJoinSplit(const CTxIn& in)
     return joinsplit;
 }
 
+template<typename Stream>
+static void SkipVector(Stream& s, std::size_t elementSize)
+{
+    s.ignore(ReadCompactSize(s) * elementSize);
+}
+
+void ParseLelantusJoinSplitHeader(const CTxIn& in, JoinSplitHeader& header)
+{
+    if (in.scriptSig.size() < 1) {
+        throw CBadTxIn();
+    }
+
+    CDataStream serialized(
+        std::vector<unsigned char>(in.scriptSig.begin() + 1, in.scriptSig.end()),
+        SER_NETWORK,
+        PROTOCOL_VERSION
+    );
+
+    const std::size_t pointSize = GroupElement::memoryRequired();
+    const std::size_t scalarSize = Scalar::memoryRequired();
+
+    // skip the proof, see LelantusProof, SigmaExtendedProof, RangeProof and SchnorrProof serialization
+    uint64_t sigmaProofs = ReadCompactSize(serialized);
+    for (uint64_t i = 0; i < sigmaProofs; i++) {
+        serialized.ignore(pointSize * 4); // A_, B_, C_, D_
+        SkipVector(serialized, scalarSize); // f_
+        serialized.ignore(scalarSize * 2); // ZA_, ZC_
+        SkipVector(serialized, pointSize); // Gk_
+        SkipVector(serialized, pointSize); // Qk
+        serialized.ignore(scalarSize * 2); // zV_, zR_
+    }
+    serialized.ignore(pointSize * 4 + scalarSize * 3); // A, S, T1, T2, T_x1, T_x2, u
+    serialized.ignore(scalarSize * 3); // a_, b_, c_
+    SkipVector(serialized, pointSize); // L_
+    SkipVector(serialized, pointSize); // R_
+    serialized.ignore(pointSize + scalarSize * 2); // u, P1, T1
+
+    uint8_t coinNum;
+    serialized >> coinNum;
+
+    header.serials.clear();
+    header.serials.reserve(coinNum);
+    header.groupIds.resize(coinNum);
+    for (uint8_t i = 0; i < coinNum; i++) {
+        serialized >> header.groupIds[i];
+        serialized.ignore(64); // signature
+
+        unsigned char pubkeyData[33];
+        serialized.read(reinterpret_cast<char*>(pubkeyData), sizeof(pubkeyData));
+
+        secp256k1_pubkey pubkey;
+        if (!secp256k1_ec_pubkey_parse(OpenSSLContext::get_context(), &pubkey, pubkeyData, sizeof(pubkeyData))) {
+            throw std::invalid_argument("Lelantus joinsplit unserialize failed due to unable to parse ecdsaPubkey.");
+        }
+        header.serials.push_back(lelantus::PrivateCoin::serialNumberFromCompressedPublicKey(pubkeyData));
+    }
+
+    serialized >> header.idAndBlockHashes;
+    serialized >> header.fee;
+    serialized >> header.version;
+}
+
+void ParseLelantusJoinSplitSerials(const CTxIn& in, std::vector<Scalar>& serials, uint64_t& fee)
+{
+    JoinSplitHeader header;
+    ParseLelantusJoinSplitHeader(in, header);
+    serials = std::move(header.serials);
+    fee = header.fee;
+}
+
 bool CheckLelantusBlock(CValidationState &state, const CBlock& block) {
     auto& consensus = ::Params().GetConsensus();
 
@@ -375,14 +445,12 @@ bool CheckLelantusJoinSplitTransaction(
             pair<sigma::CoinDenomination, int> denominationAndId = std::make_pair(denomination, coinGroupId);
 
             auto lelantusParams = lelantus::Params::get_default();
+            // the same for every coin of the group
+            GroupElement denomCommitment = lelantusParams->get_h1_table().mul(Scalar(intDenom));
             while(true) {
-                if(index->sigmaMintedPubCoins.count(denominationAndId) > 0) {
-                    BOOST_FOREACH(
-                    const sigma::PublicCoin &pubCoinValue,
-                    index->sigmaMintedPubCoins[denominationAndId]) {
-                        lelantus::PublicCoin publicCoin(pubCoinValue.getValue() + lelantusParams->get_h1() * intDenom);
-                        anonymity_set.push_back(publicCoin);
-                    }
+                for (const sigma::PublicCoin &pubCoinValue : index->sigmaMintedPubCoins.Get(denominationAndId)) {
+                    lelantus::PublicCoin publicCoin(pubCoinValue.getValue() + denomCommitment);
+                    anonymity_set.push_back(publicCoin);
                 }
                 if (index == coinGroup.firstBlock)
                     break;
@@ -405,12 +473,8 @@ bool CheckLelantusJoinSplitTransaction(
             // This list of public coins is required by function "Verify" of JoinSplit.
 
             while (true) {
-                if(index->lelantusMintedPubCoins.count(idAndHash.first) > 0) {
-                    BOOST_FOREACH(
-                    const auto& pubCoinValue,
-                    index->lelantusMintedPubCoins[idAndHash.first]) {
-                        anonymity_set.push_back(pubCoinValue.first);
-                    }
+                for (const auto& pubCoinValue : index->lelantusMintedPubCoins.Get(idAndHash.first)) {
+                    anonymity_set.push_back(pubCoinValue.first);
                 }
                 if (index == coinGroup.firstBlock)
                     break;
@@ -572,6 +636,62 @@ bool CheckLelantusMintTransaction(
     return true;
 }
 
+bool CheckLelantusJoinSplitHeader(const CTransaction &tx, CValidationState &state)
+{
+    AssertLockHeld(cs_main);
+    Consensus::Params const & consensus = ::Params().GetConsensus();
+
+    if (tx.vin.size() != 1 || !tx.vin[0].scriptSig.IsLelantusJoinSplit())
+        return true;
+
+    JoinSplitHeader header;
+    try {
+        ParseLelantusJoinSplitHeader(tx.vin[0], header);
+    }
+    catch (const std::exception &) {
+        return true;
+    }
+
+    if (header.serials.size() > consensus.nMaxLelantusInputPerTransaction) {
+        return state.DoS(100, false,
+            REJECT_INVALID,
+            "bad-txns-spend-invalid");
+    }
+
+    sigma::CSigmaState *sigmaState = sigma::CSigmaState::GetState();
+    for (const auto& serial : header.serials) {
+        if (!serial.isMember() || serial.isZero())
+            return state.Invalid(false, REJECT_INVALID, "txn-invalid-lelantus-joinsplit-serial");
+        if (!lelantusState.CanAddSpendToMempool(serial) || !sigmaState->CanAddSpendToMempool(serial)) {
+            LogPrintf("CheckLelantusJoinSplitHeader(): lelantus serial number %s has been used\n", serial.tostring());
+            return state.Invalid(false, REJECT_CONFLICT, "txn-mempool-conflict");
+        }
+    }
+
+    // an anonymity set block which isn't a block of the group is not checked, the full
+    // check falls back to the first block of the group for it like consensus does
+    for (const auto& idAndHash : header.idAndBlockHashes) {
+        int coinGroupId = idAndHash.first % (CENT / 1000);
+        int64_t intDenom = (idAndHash.first - coinGroupId);
+        intDenom *= 1000;
+
+        sigma::CoinDenomination denomination;
+        if (header.version == SIGMA_TO_LELANTUS_JOINSPLIT && sigma::IntegerToDenomination(intDenom, denomination)) {
+            sigma::CSigmaState::SigmaCoinGroupInfo coinGroup;
+            if (!sigmaState->GetCoinGroupInfo(denomination, coinGroupId, coinGroup))
+                return state.DoS(100, false, NO_MINT_ZEROCOIN,
+                                 "CheckLelantusJoinSplitHeader: Error: no coins were minted with such parameters");
+        } else {
+            CLelantusState::LelantusCoinGroupInfo coinGroup;
+            if (!lelantusState.GetCoinGroupInfo(idAndHash.first, coinGroup))
+                return state.DoS(100, false, NO_MINT_ZEROCOIN,
+                                 "CheckLelantusJoinSplitHeader: Error: no coins were minted with such parameters");
+        }
+    }
+
+    return true;
+}
+
 bool CheckLelantusTransaction(
         const CTransaction &tx,
         CValidationState &state,
@@ -653,39 +773,10 @@ bool CheckLelantusTransaction(
 
 void RemoveLelantusJoinSplitReferencingBlock(CTxMemPool& pool, CBlockIndex* blockIndex) {
     LOCK2(cs_main, pool.cs);
-    std::vector<CTransaction> txn_to_remove;
-    for (CTxMemPool::txiter mi = pool.mapTx.begin(); mi != pool.mapTx.end(); ++mi) {
-        const CTransaction& tx = mi->GetTx();
-        if (tx.IsLelantusJoinSplit()) {
-            // Run over all the inputs, check if their CoinGroup block hash is equal to
-            // block removed. If any one is equal, remove txn from mempool.
-            for (const CTxIn& txin : tx.vin) {
-                if (txin.IsLelantusJoinSplit()) {
-                    std::unique_ptr<lelantus::JoinSplit> joinsplit;
-
-                    try {
-                        joinsplit = ParseLelantusJoinSplit(txin);
-                    }
-                    catch (const std::ios_base::failure &) {
-                        txn_to_remove.push_back(tx);
-                        break;
-                    }
-
-                    const std::vector<std::pair<uint32_t, uint256>>& coinGroupIdAndBlockHash = joinsplit->getIdAndBlockHashes();
-                    for(const auto& idAndHash : coinGroupIdAndBlockHash) {
-                        if (idAndHash.second == blockIndex->GetBlockHash()) {
-                        // Do not remove transaction immediately, that will invalidate iterator mi.
-                        txn_to_remove.push_back(tx);
-                        break;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    for (const CTransaction& tx: txn_to_remove) {
+    // The joinsplits are indexed by the blocks their anonymity sets end at when they enter the mempool
+    for (const CTransactionRef& tx : pool.getJoinSplitsReferencingBlock(blockIndex->GetBlockHash())) {
         // Remove txn from mempool.
-        pool.removeRecursive(tx);
+        pool.removeRecursive(*tx);
         LogPrintf("DisconnectTipLelantus: removed lelantus joinsplit which referenced a removed blockchain tip.");
     }
 }
@@ -777,6 +868,8 @@ bool ConnectBlockLelantus(
         if (!pblock->lelantusTxInfo->mints.empty()) {
             lelantusState.AddMintsToStateAndBlockIndex(pindexNew, pblock);
         }
+
+        lelantusState.UpdateSnapshot(pindexNew, true);
     }
     else if (!fJustCheck) {
         lelantusState.AddBlock(pindexNew);
@@ -849,8 +942,76 @@ bool GetOutPointFromMintTag(COutPoint& outPoint, const uint256 &pubCoinTag) {
     return GetOutPoint(outPoint, pubCoinValue);
 }
 
+static const uint64_t LELANTUS_STATE_DUMP_VERSION = 1;
+
+// Reads the checkpoint written by DumpLelantusState, the caller checks it against the chain
+static bool ReadLelantusState(CLelantusStateSnapshot &checkpoint) {
+    FILE* filestr = fopen((GetDataDir() / "lelantusstate.dat").string().c_str(), "rb");
+    CAutoFile file(filestr, SER_DISK, CLIENT_VERSION);
+    if (file.IsNull())
+        return false;
+
+    try {
+        CHashVerifier<CAutoFile> verifier(&file);
+        uint64_t version;
+        verifier >> version;
+        if (version != LELANTUS_STATE_DUMP_VERSION)
+            return false;
+        verifier >> checkpoint;
+
+        uint256 hash;
+        file >> hash;
+        if (hash != verifier.GetHash()) {
+            LogPrintf("Lelantus state checkpoint is corrupted, rebuilding the state from the index\n");
+            return false;
+        }
+    } catch (const std::exception& e) {
+        LogPrintf("Failed to read lelantus state checkpoint: %s, rebuilding the state from the index\n", e.what());
+        return false;
+    }
+    return true;
+}
+
+void DumpLelantusState() {
+    auto snapshot = lelantusState.GetSnapshot();
+    if (snapshot->GetHeight() < 0)
+        return;
+
+    int64_t start = GetTimeMicros();
+    try {
+        FILE* filestr = fopen((GetDataDir() / "lelantusstate.dat.new").string().c_str(), "wb");
+        if (!filestr)
+            return;
+
+        CAutoFile file(filestr, SER_DISK, CLIENT_VERSION);
+        CHashedSourceWriter<CAutoFile> writer(&file);
+        writer << LELANTUS_STATE_DUMP_VERSION << *snapshot;
+        file << writer.GetHash();
+
+        FileCommit(file.Get());
+        file.fclose();
+        RenameOver(GetDataDir() / "lelantusstate.dat.new", GetDataDir() / "lelantusstate.dat");
+        LogPrintf("Dumped lelantus state at height %d: %gs\n", snapshot->GetHeight(), (GetTimeMicros() - start) * 0.000001);
+    } catch (const std::exception& e) {
+        LogPrintf("Failed to dump lelantus state: %s. Continuing anyway.\n", e.what());
+    }
+}
+
 bool BuildLelantusStateFromIndex(CChain *chain) {
-    for (CBlockIndex *blockIndex = chain->Genesis(); blockIndex; blockIndex=chain->Next(blockIndex))
+    CBlockIndex *start = chain->Genesis();
+
+    CLelantusStateSnapshot checkpoint;
+    if (start && ReadLelantusState(checkpoint)) {
+        if (lelantusState.LoadSnapshot(checkpoint, chain)) {
+            start = chain->Next((*chain)[checkpoint.GetHeight()]);
+            LogPrintf("Loaded lelantus state checkpoint at height %d\n", checkpoint.GetHeight());
+        } else {
+            LogPrintf("Lelantus state checkpoint at height %d is not in the active chain, rebuilding the state from the index\n",
+                checkpoint.GetHeight());
+        }
+    }
+
+    for (CBlockIndex *blockIndex = start; blockIndex; blockIndex=chain->Next(blockIndex))
     {
         lelantusState.AddBlock(blockIndex);
     }
@@ -881,8 +1042,114 @@ void CLelantusTxInfo::Complete() {
  * Util funtions
  */
 size_t CountCoinInBlock(CBlockIndex *index, int id) {
-    return index->lelantusMintedPubCoins.count(id) > 0
-        ? index->lelantusMintedPubCoins[id].size() : 0;
+    return index->lelantusMintedPubCoins.Get(id).size();
+}
+
+/******************************************************************************/
+// CSurgeConditionTracker
+/******************************************************************************/
+
+void CSurgeConditionTracker::AddMint(int group) {
+    auto it = groups.emplace(group, GroupInfo()).first;
+    it->second.mints += 1;
+    it->second.hasMints = true;
+    Rescan(it);
+}
+
+void CSurgeConditionTracker::RemoveMint(int group) {
+    auto it = groups.emplace(group, GroupInfo()).first;
+    it->second.mints -= 1;
+    it->second.hasMints = true;
+    Rescan(it);
+}
+
+void CSurgeConditionTracker::AddSpend(int group) {
+    auto it = groups.emplace(group, GroupInfo()).first;
+    it->second.spends += 1;
+    Rescan(it);
+}
+
+void CSurgeConditionTracker::RemoveSpend(int group) {
+    auto it = groups.emplace(group, GroupInfo()).first;
+    it->second.spends -= 1;
+    Rescan(it);
+}
+
+void CSurgeConditionTracker::AddExtendedMints(int group, size_t mints) {
+    groups[group].extendedMints = mints;
+    // extended mints of a group are counted when the scan leaves the previous one
+    Rescan(groups.lower_bound(group - 1));
+}
+
+void CSurgeConditionTracker::RemoveExtendedMints(int group) {
+    auto it = groups.find(group);
+    if (it == groups.end())
+        return;
+
+    it->second.extendedMints = 0;
+    Rescan(groups.lower_bound(group - 1));
+}
+
+bool CSurgeConditionTracker::HasMints(int group) const {
+    auto it = groups.find(group);
+    return it != groups.end() && it->second.hasMints;
+}
+
+std::pair<int, int> CSurgeConditionTracker::GetSurgeRange() const {
+    if (surgeGroups.empty())
+        return std::make_pair(0, 0);
+
+    int last = *surgeGroups.begin();
+    return std::make_pair(groups.at(last).entry.start, last);
+}
+
+void CSurgeConditionTracker::Reset() {
+    groups.clear();
+    surgeGroups.clear();
+}
+
+void CSurgeConditionTracker::Rescan(groups_container_t::iterator from) {
+    // a group that was just added has no entry state yet, it is the exit state of the previous one
+    if (from != groups.end() && !from->second.entryValid && from != groups.begin())
+        --from;
+
+    ScanState state;
+    if (from != groups.end() && from->second.entryValid)
+        state = from->second.entry;
+
+    for (auto it = from; it != groups.end(); ++it) {
+        GroupInfo &info = it->second;
+
+        // the rest of the groups haven't changed and are entered the same way as before
+        if (it != from && info.entryValid && info.entry == state)
+            break;
+
+        info.entry = state;
+        info.entryValid = true;
+        surgeGroups.erase(it->first);
+
+        if (!info.hasMints)
+            continue;
+
+        // include serials and mints to accumulators
+        state.serials += info.spends;
+        state.mints += info.mints;
+
+        // serials exceed mints then trigger. Only the first group found matters, the scan
+        // goes on to keep the cached states valid.
+        if (state.serials > state.mints)
+            surgeGroups.insert(it->first);
+
+        auto next = std::next(it);
+        size_t extendedMints = next != groups.end() && next->first == it->first + 1 ?
+            next->second.extendedMints : 0;
+
+        if (state.serials <= state.mints - extendedMints) {
+            state.start = it->first + 1;
+            state.serials = 0;
+            state.mints = extendedMints;
+        }
+    }
 }
 
 /******************************************************************************/
@@ -896,14 +1163,14 @@ CLelantusState::Containers::Containers(std::atomic<bool> & surgeCondition)
 void CLelantusState::Containers::AddMint(lelantus::PublicCoin const & pubCoin, CMintedCoinInfo const & coinInfo, const uint256& tag) {
     mintedPubCoins.insert(std::make_pair(pubCoin, coinInfo));
     tagToPublicCoin.insert(std::make_pair(tag, pubCoin));
-    mintMetaInfo[coinInfo.coinGroupId] += 1;
+    surgeTracker.AddMint(coinInfo.coinGroupId);
     CheckSurgeCondition();
 }
 
 void CLelantusState::Containers::RemoveMint(lelantus::PublicCoin const & pubCoin) {
     mint_info_container::const_iterator iter = mintedPubCoins.find(pubCoin);
     if (iter != mintedPubCoins.end()) {
-        mintMetaInfo[iter->second.coinGroupId] -= 1;
+        surgeTracker.RemoveMint(iter->second.coinGroupId);
         mintedPubCoins.erase(iter);
         CheckSurgeCondition();
         for(auto hashPair =  tagToPublicCoin.begin(); hashPair !=  tagToPublicCoin.end(); hashPair++)
@@ -915,31 +1182,31 @@ void CLelantusState::Containers::RemoveMint(lelantus::PublicCoin const & pubCoin
 }
 
 void CLelantusState::Containers::AddSpend(Scalar const & serial, int coinGroupId) {
-    if (!mintMetaInfo.count(coinGroupId)) {
+    if (!surgeTracker.HasMints(coinGroupId)) {
         throw std::invalid_argument("group id doesn't exist");
     }
 
     usedCoinSerials[serial] = coinGroupId;
-    spendMetaInfo[coinGroupId] += 1;
+    surgeTracker.AddSpend(coinGroupId);
     CheckSurgeCondition();
 }
 
 void CLelantusState::Containers::RemoveSpend(Scalar const & serial) {
     auto iter = usedCoinSerials.find(serial);
     if (iter != usedCoinSerials.end()) {
-        spendMetaInfo[iter->second] -= 1;
+        surgeTracker.RemoveSpend(iter->second);
         usedCoinSerials.erase(iter);
         CheckSurgeCondition();
     }
 }
 
 void CLelantusState::Containers::AddExtendedMints(int group, size_t mints) {
-    extendedMintMetaInfo[group] = mints;
+    surgeTracker.AddExtendedMints(group, mints);
     CheckSurgeCondition();
 }
 
 void CLelantusState::Containers::RemoveExtendedMints(int group) {
-    extendedMintMetaInfo.erase(group);
+    surgeTracker.RemoveExtendedMints(group);
     CheckSurgeCondition();
 }
 
@@ -962,49 +1229,116 @@ bool CLelantusState::Containers::IsSurgeCondition() const {
 void CLelantusState::Containers::Reset() {
     mintedPubCoins.clear();
     usedCoinSerials.clear();
-    mintMetaInfo.clear();
-    spendMetaInfo.clear();
+    surgeTracker.Reset();
     tagToPublicCoin.clear();
     surgeCondition = false;
 }
 
 void CLelantusState::Containers::CheckSurgeCondition() {
-    bool result = false;
+    bool result = surgeTracker.IsSurgeCondition();
 
-    // find a range of groups that sum of serials larger than sum of mints
-    size_t serials = 0;
-    size_t mints = 0;
-    int start = 0;
+    if (result && !surgeCondition) {
+        auto range = surgeTracker.GetSurgeRange();
 
-    for (auto it = mintMetaInfo.begin(); it != mintMetaInfo.end(); it++) {
-        auto id = it->first;
+        std::ostringstream ostr;
+        ostr << "Turning Lelantus surge protection ON: in group range: " << range.first << " - " << range.second << '\n';
+        error(ostr.str().c_str());
+    }
 
-        // include serials and mints to accumulators
-        serials += spendMetaInfo.count(id) ? spendMetaInfo[id] : 0;
-        mints += it->second;
+    surgeCondition = result;
+}
 
-        // serials exceed mints then trigger
-        if (serials > mints) {
-            result = true;
+/******************************************************************************/
+// CLelantusStateSnapshot
+/******************************************************************************/
 
-            std::ostringstream ostr;
-            ostr << "Turning Lelantus surge protection ON: in group range: " << start << " - " << id << '\n';
-            error(ostr.str().c_str());
+bool CLelantusStateSnapshot::GetCoinGroupInfo(int group_id, CoinGroupInfo &result) const {
+    auto group = coinGroups.find(group_id);
+    if (!group)
+        return false;
+
+    result = *group;
+    return true;
+}
 
+bool CLelantusStateSnapshot::IsUsedCoinSerial(const Scalar &coinSerial) const {
+    return spends.count(coinSerial) != 0;
+}
+
+bool CLelantusStateSnapshot::HasCoin(const lelantus::PublicCoin& pubCoin) const {
+    return mints.count(pubCoin) != 0;
+}
+
+std::pair<int, int> CLelantusStateSnapshot::GetMintedCoinHeightAndId(const lelantus::PublicCoin& pubCoin) const {
+    auto coinInfo = mints.find(pubCoin);
+    if (coinInfo)
+        return std::make_pair(coinInfo->nHeight, coinInfo->coinGroupId);
+
+    return std::make_pair(-1, -1);
+}
+
+int CLelantusStateSnapshot::GetCoinSetForSpend(
+    int maxHeight,
+    int coinGroupID,
+    uint256& blockHash_out,
+    std::vector<lelantus::PublicCoin>& coins_out,
+    int startHeight,
+    std::vector<uint256>* tags_out) const {
+
+    coins_out.clear();
+    if (tags_out) {
+        tags_out->clear();
+    }
+
+    auto coinGroup = coinGroups.find(coinGroupID);
+    if (!coinGroup) {
+        return 0;
+    }
+
+    // mint blocks are ordered by height, find the one past the last block of the group
+    size_t lower = 0, upper = mintBlocks.size();
+    while (lower < upper) {
+        size_t middle = lower + (upper - lower) / 2;
+        if (mintBlocks[middle].nHeight <= coinGroup->lastHeight)
+            lower = middle + 1;
+        else
+            upper = middle;
+    }
+
+    int numberOfCoins = 0;
+    for (size_t i = lower; i-- > 0; ) {
+        const BlockMints &block = mintBlocks[i];
+        if (block.nHeight <= startHeight || block.nHeight < coinGroup->firstHeight) {
             break;
         }
 
-        auto extendedMints = extendedMintMetaInfo.count(id + 1) ?
-            extendedMintMetaInfo[id + 1] : 0;
+        // ignore block heigher than max height
+        if (block.nHeight > maxHeight) {
+            continue;
+        }
+
+        // check coins in group coinGroupID - 1 in the case that using coins from prev group.
+        auto coins = block.coins->find(coinGroupID);
+        if (coins == block.coins->end()) {
+            coins = block.coins->find(coinGroupID - 1);
+            if (coins == block.coins->end())
+                continue;
+        }
 
-        if (serials <= mints - extendedMints) {
-            start = id + 1;
-            serials = 0;
-            mints = extendedMints;
+        if (numberOfCoins == 0) {
+            // latest block satisfying given conditions
+            // remember block hash
+            blockHash_out = block.blockHash;
+        }
+        numberOfCoins += coins->second.size();
+        for (const auto &coin : coins->second) {
+            coins_out.push_back(coin.first);
+            if (tags_out)
+                tags_out->push_back(coin.second);
         }
     }
 
-    surgeCondition = result;
+    return numberOfCoins;
 }
 
 /******************************************************************************/
@@ -1016,7 +1350,8 @@ CLelantusState::CLelantusState(
     size_t startGroupSize)
     :containers(surgeCondition),
     maxCoinInGroup(maxCoinInGroup),
-    startGroupSize(startGroupSize)
+    startGroupSize(startGroupSize),
+    publishedSnapshot(std::make_shared<const CLelantusStateSnapshot>())
 {}
 
 void CLelantusState::AddMintsToStateAndBlockIndex(
@@ -1063,7 +1398,7 @@ void CLelantusState::AddMintsToStateAndBlockIndex(
         containers.AddMint(mint.first, CMintedCoinInfo::make(latestCoinId, index->nHeight), mint.second);
 
         LogPrintf("AddMintsToStateAndBlockIndex: Lelantus mint added id=%d\n", latestCoinId);
-        index->lelantusMintedPubCoins[latestCoinId].push_back(mint);
+        index->lelantusMintedPubCoins.Add(latestCoinId, mint);
     }
 }
 
@@ -1102,6 +1437,8 @@ void CLelantusState::AddBlock(CBlockIndex *index) {
     for (auto const &serial : index->lelantusSpentSerials) {
         AddSpend(serial.first, serial.second);
     }
+
+    UpdateSnapshot(index, true);
 }
 
 void CLelantusState::RemoveBlock(CBlockIndex *index) {
@@ -1174,6 +1511,126 @@ void CLelantusState::RemoveBlock(CBlockIndex *index) {
     for (auto const &serial : index->lelantusSpentSerials) {
         containers.RemoveSpend(serial.first);
     }
+
+    UpdateSnapshot(index, false);
+}
+
+void CLelantusState::UpdateSnapshot(CBlockIndex *index, bool fConnect) {
+    if (fConnect) {
+        auto blockCoins = std::make_shared<std::map<int, std::vector<std::pair<lelantus::PublicCoin, uint256>>>>();
+        for (auto const &pubCoins : index->lelantusMintedPubCoins) {
+            if (pubCoins.second.empty())
+                continue;
+
+            (*blockCoins)[pubCoins.first].assign(pubCoins.second.begin(), pubCoins.second.end());
+            for (auto const &coin : pubCoins.second) {
+                snapshot.mints = snapshot.mints.set(coin.first, CMintedCoinInfo::make(pubCoins.first, index->nHeight));
+            }
+        }
+
+        if (!blockCoins->empty()) {
+            snapshot.mintBlocks = snapshot.mintBlocks.push_back(
+                CLelantusStateSnapshot::BlockMints{index->nHeight, index->GetBlockHash(), blockCoins});
+        }
+
+        for (auto const &serial : index->lelantusSpentSerials) {
+            snapshot.spends = snapshot.spends.set(serial.first, serial.second);
+        }
+
+        snapshot.nHeight = index->nHeight;
+        snapshot.blockHash = index->GetBlockHash();
+    } else {
+        for (auto const &pubCoins : index->lelantusMintedPubCoins) {
+            for (auto const &coin : pubCoins.second) {
+                snapshot.mints = snapshot.mints.erase(coin.first);
+            }
+        }
+
+        if (!snapshot.mintBlocks.empty() && snapshot.mintBlocks.back().nHeight == index->nHeight) {
+            snapshot.mintBlocks = snapshot.mintBlocks.take(snapshot.mintBlocks.size() - 1);
+        }
+
+        for (auto const &serial : index->lelantusSpentSerials) {
+            snapshot.spends = snapshot.spends.erase(serial.first);
+        }
+
+        snapshot.nHeight = index->pprev ? index->pprev->nHeight : -1;
+        snapshot.blockHash = index->pprev ? index->pprev->GetBlockHash() : uint256();
+    }
+
+    for (auto const &pubCoins : index->lelantusMintedPubCoins) {
+        SyncSnapshotCoinGroup(pubCoins.first);
+    }
+
+    snapshot.latestCoinId = latestCoinId;
+    snapshot.surgeCondition = surgeCondition;
+    snapshot.nVersion++;
+
+    std::atomic_store(&publishedSnapshot, std::make_shared<const CLelantusStateSnapshot>(snapshot));
+}
+
+std::shared_ptr<const CLelantusStateSnapshot> CLelantusState::GetSnapshot() const {
+    return std::atomic_load(&publishedSnapshot);
+}
+
+bool CLelantusState::LoadSnapshot(const CLelantusStateSnapshot &checkpoint, CChain *chain) {
+    Reset();
+
+    CBlockIndex *tip = (*chain)[checkpoint.nHeight];
+    if (!tip || tip->GetBlockHash() != checkpoint.blockHash)
+        return false;
+
+    // mints in the order they were added while connecting the blocks
+    std::map<int, size_t> groupMints;
+    for (auto const &block : checkpoint.mintBlocks) {
+        for (auto const &pubCoins : *block.coins) {
+            for (auto const &coin : pubCoins.second)
+                containers.AddMint(coin.first, CMintedCoinInfo::make(pubCoins.first, block.nHeight), coin.second);
+            groupMints[pubCoins.first] += pubCoins.second.size();
+        }
+    }
+
+    for (auto const &group : checkpoint.coinGroups) {
+        LelantusCoinGroupInfo &coinGroup = coinGroups[group.first];
+        coinGroup.firstBlock = (*chain)[group.second.firstHeight];
+        coinGroup.lastBlock = (*chain)[group.second.lastHeight];
+        coinGroup.nCoins = group.second.nCoins;
+
+        if (!coinGroup.firstBlock || !coinGroup.lastBlock || group.second.lastHeight > checkpoint.nHeight) {
+            Reset();
+            return false;
+        }
+
+        // coins taken over from the previous group, see AddMintsToStateAndBlockIndex
+        if (group.first > 1)
+            containers.AddExtendedMints(group.first, coinGroup.nCoins - groupMints[group.first]);
+    }
+
+    for (auto const &serial : checkpoint.spends)
+        containers.AddSpend(serial.first, serial.second);
+
+    latestCoinId = checkpoint.latestCoinId;
+
+    uint64_t nVersion = snapshot.nVersion;
+    snapshot = checkpoint;
+    snapshot.surgeCondition = surgeCondition;
+    snapshot.nVersion = nVersion + 1;
+    std::atomic_store(&publishedSnapshot, std::make_shared<const CLelantusStateSnapshot>(snapshot));
+    return true;
+}
+
+void CLelantusState::SyncSnapshotCoinGroup(int id) {
+    auto it = coinGroups.find(id);
+    if (it == coinGroups.end() || !it->second.firstBlock) {
+        snapshot.coinGroups = snapshot.coinGroups.erase(id);
+        return;
+    }
+
+    CLelantusStateSnapshot::CoinGroupInfo group;
+    group.firstHeight = it->second.firstBlock->nHeight;
+    group.lastHeight = it->second.lastBlock->nHeight;
+    group.nCoins = it->second.nCoins;
+    snapshot.coinGroups = snapshot.coinGroups.set(id, group);
 }
 
 bool CLelantusState::GetCoinGroupInfo(
@@ -1229,9 +1686,14 @@ int CLelantusState::GetCoinSetForSpend(
     int maxHeight,
     int coinGroupID,
     uint256& blockHash_out,
-    std::vector<lelantus::PublicCoin>& coins_out) {
+    std::vector<lelantus::PublicCoin>& coins_out,
+    int startHeight,
+    std::vector<uint256>* tags_out) {
 
     coins_out.clear();
+    if (tags_out) {
+        tags_out->clear();
+    }
 
     if (coinGroups.count(coinGroupID) == 0) {
         return 0;
@@ -1240,7 +1702,7 @@ int CLelantusState::GetCoinSetForSpend(
     LelantusCoinGroupInfo &coinGroup = coinGroups[coinGroupID];
 
     int numberOfCoins = 0;
-    for (CBlockIndex *block = coinGroup.lastBlock;; block = block->pprev) {
+    for (CBlockIndex *block = coinGroup.lastBlock; block->nHeight > startHeight; block = block->pprev) {
 
         // ignore block heigher than max height
         if (block->nHeight > maxHeight) {
@@ -1261,10 +1723,12 @@ int CLelantusState::GetCoinSetForSpend(
                 // remember block hash
                 blockHash_out = block->GetBlockHash();
             }
-            numberOfCoins += block->lelantusMintedPubCoins[id].size();
-            if(block->lelantusMintedPubCoins.count(id) > 0) {
-                for (const auto &coin : block->lelantusMintedPubCoins[id])
-                    coins_out.push_back(coin.first);
+            auto blockCoins = block->lelantusMintedPubCoins.Get(id);
+            numberOfCoins += blockCoins.size();
+            for (const auto &coin : blockCoins) {
+                coins_out.push_back(coin.first);
+                if (tags_out)
+                    tags_out->push_back(coin.second);
             }
         }
 
@@ -1334,6 +1798,11 @@ void CLelantusState::Reset() {
     mempoolCoinSerials.clear();
     mempoolMints.clear();
     containers.Reset();
+
+    uint64_t nVersion = snapshot.nVersion;
+    snapshot = CLelantusStateSnapshot();
+    snapshot.nVersion = nVersion + 1;
+    std::atomic_store(&publishedSnapshot, std::make_shared<const CLelantusStateSnapshot>(snapshot));
 }
 
 CLelantusState* CLelantusState::GetState() {
@@ -1377,8 +1846,7 @@ size_t CLelantusState::CountLastNCoins(int groupId, size_t required, CBlockIndex
             ; block = block->pprev) {
 
             size_t inBlock;
-            if (block->lelantusMintedPubCoins.count(groupId)
-                && (inBlock = block->lelantusMintedPubCoins[groupId].size())) {
+            if ((inBlock = block->lelantusMintedPubCoins.Get(groupId).size())) {
 
                 coins += inBlock;
                 first = block;
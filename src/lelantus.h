@@ -12,8 +12,14 @@
 #include <unordered_set>
 #include <unordered_map>
 #include <functional>
+#include <memory>
 #include "coin_containers.h"
 
+#include "immer/map.hpp"
+#include "immer/vector.hpp"
+
+class CTxMemPool;
+
 namespace lelantus {
 
 // Lelantus transaction info, added to the CBlock to ensure zerocoin mint/spend transactions got their info stored into index
@@ -50,6 +56,20 @@ void ParseLelantusJMintScript(const CScript& script, secp_primitives::GroupEleme
 void ParseLelantusMintScript(const CScript& script, secp_primitives::GroupElement& pubcoin);
 std::unique_ptr<JoinSplit> ParseLelantusJoinSplit(const CTxIn& in);
 
+// Fields of a joinsplit which follow its proof
+struct JoinSplitHeader {
+    std::vector<Scalar> serials;
+    std::vector<uint32_t> groupIds;
+    std::vector<std::pair<uint32_t, uint256>> idAndBlockHashes;
+    uint64_t fee;
+    unsigned int version;
+};
+
+// Reads the fields of a joinsplit following its proof without deserializing the proof.
+void ParseLelantusJoinSplitHeader(const CTxIn& in, JoinSplitHeader& header);
+// Reads the serials and the fee of a joinsplit without deserializing its proof.
+void ParseLelantusJoinSplitSerials(const CTxIn& in, std::vector<Scalar>& serials, uint64_t& fee);
+
 size_t GetSpendInputs(const CTransaction &tx, const CTxIn& in);
 size_t GetSpendInputs(const CTransaction &tx);
 CAmount GetSpendTransparentAmount(const CTransaction& tx);
@@ -67,6 +87,15 @@ bool CheckLelantusTransaction(
     sigma::CSigmaTxInfo* sigmaTxInfo,
 	CLelantusTxInfo* lelantusTxInfo);
 
+// Cheap checks of a joinsplit entering the mempool, done before its proof is deserialized
+// and verified: the number of spends, the serials against the chain and the mempool and
+// the coin groups it refers to. Joinsplits which can't be parsed are left to the full check.
+// It rejects nothing the full check of a mempool transaction would accept.
+bool CheckLelantusJoinSplitHeader(const CTransaction &tx, CValidationState &state);
+
+// Removes the joinsplits whose anonymity sets end at the block from the pool
+void RemoveLelantusJoinSplitReferencingBlock(CTxMemPool& pool, CBlockIndex* blockIndex);
+
 void DisconnectTipLelantus(CBlock &block, CBlockIndex *pindexDelete);
 
 bool ConnectBlockLelantus(
@@ -88,8 +117,13 @@ bool GetOutPoint(COutPoint& outPoint, const uint256 &pubCoinValueHash);
 bool GetOutPointFromMintTag(COutPoint& outPoint, const uint256 &pubCoinTag);
 
 
+// Starts from the checkpoint written by DumpLelantusState if its block is in the chain,
+// the blocks after it are replayed
 bool BuildLelantusStateFromIndex(CChain *chain);
 
+// Writes the latest snapshot of the state to lelantusstate.dat
+void DumpLelantusState();
+
 std::vector<Scalar> GetLelantusJoinSplitSerialNumbers(const CTransaction &tx, const CTxIn &txin);
 
 /*
@@ -97,6 +131,214 @@ std::vector<Scalar> GetLelantusJoinSplitSerialNumbers(const CTransaction &tx, co
  */
 size_t CountCoinInBlock(CBlockIndex const *index, int id);
 
+/*
+ * Immutable view of the chain part of CLelantusState at a given tip. The state publishes a new
+ * snapshot whenever a block is added or removed. The containers are shared with the previous
+ * snapshot, so that costs about as much as the change itself. Snapshots don't refer to the
+ * block index and can be queried without holding cs_main.
+ */
+class CLelantusStateSnapshot {
+friend class CLelantusState;
+public:
+    struct CoinGroupInfo {
+        CoinGroupInfo() : firstHeight(-1), lastHeight(-1), nCoins(0) {}
+
+        // heights of the first and last blocks having coins of the group
+        int firstHeight;
+        int lastHeight;
+        int nCoins;
+    };
+
+    // Mints of a block by coin group id
+    struct BlockMints {
+        int nHeight;
+        uint256 blockHash;
+        std::shared_ptr<const std::map<int, std::vector<std::pair<lelantus::PublicCoin, uint256>>>> coins;
+    };
+
+public:
+    CLelantusStateSnapshot() : nVersion(0), nHeight(-1), latestCoinId(0), surgeCondition(false) {}
+
+    // Increases with every published snapshot
+    uint64_t GetVersion() const { return nVersion; }
+    // Tip the snapshot was taken at, -1 and null hash if the state is empty
+    int GetHeight() const { return nHeight; }
+    const uint256& GetBlockHash() const { return blockHash; }
+
+    int GetLatestCoinID() const { return latestCoinId; }
+    bool IsSurgeConditionDetected() const { return surgeCondition; }
+
+    bool GetCoinGroupInfo(int group_id, CoinGroupInfo &result) const;
+    bool IsUsedCoinSerial(const Scalar& coinSerial) const;
+    bool HasCoin(const lelantus::PublicCoin& pubCoin) const;
+    std::pair<int, int> GetMintedCoinHeightAndId(const lelantus::PublicCoin& pubCoin) const;
+
+    // Same as CLelantusState::GetCoinSetForSpend
+    int GetCoinSetForSpend(
+        int maxHeight,
+        int id,
+        uint256& blockHash_out,
+        std::vector<lelantus::PublicCoin>& coins_out,
+        int startHeight = -1,
+        std::vector<uint256>* tags_out = nullptr) const;
+
+    std::size_t GetTotalCoins() const { return mints.size(); }
+
+    // Checkpoint format, see DumpLelantusState. The mints are written in chain order with
+    // the points in affine form, so they are read back without square roots.
+    template <typename Stream>
+    void Serialize(Stream& s) const {
+        s << nHeight << blockHash << latestCoinId;
+
+        WriteCompactSize(s, coinGroups.size());
+        for (auto const &group : coinGroups)
+            s << group.first << group.second.firstHeight << group.second.lastHeight << group.second.nCoins;
+
+        WriteCompactSize(s, mintBlocks.size());
+        for (auto const &block : mintBlocks) {
+            s << block.nHeight << block.blockHash;
+            WriteCompactSize(s, block.coins->size());
+            for (auto const &pubCoins : *block.coins) {
+                s << pubCoins.first;
+                WriteCompactSize(s, pubCoins.second.size());
+                for (auto const &coin : pubCoins.second) {
+                    unsigned char buffer[GroupElement::affine_size];
+                    coin.first.getValue().serializeAffine(buffer);
+                    s.write((const char *)buffer, sizeof(buffer));
+                    s << coin.second;
+                }
+            }
+        }
+
+        WriteCompactSize(s, spends.size());
+        for (auto const &serial : spends)
+            s << serial.first << serial.second;
+    }
+
+    template <typename Stream>
+    void Unserialize(Stream& s) {
+        *this = CLelantusStateSnapshot();
+        s >> nHeight >> blockHash >> latestCoinId;
+
+        size_t nGroups = ReadCompactSize(s);
+        for (size_t i = 0; i < nGroups; i++) {
+            int id;
+            CoinGroupInfo group;
+            s >> id >> group.firstHeight >> group.lastHeight >> group.nCoins;
+            coinGroups = coinGroups.set(id, group);
+        }
+
+        size_t nBlocks = ReadCompactSize(s);
+        for (size_t i = 0; i < nBlocks; i++) {
+            BlockMints block;
+            s >> block.nHeight >> block.blockHash;
+
+            auto blockCoins = std::make_shared<std::map<int, std::vector<std::pair<lelantus::PublicCoin, uint256>>>>();
+            size_t nIds = ReadCompactSize(s);
+            for (size_t j = 0; j < nIds; j++) {
+                int id;
+                s >> id;
+                auto &coins = (*blockCoins)[id];
+                size_t nCoins = ReadCompactSize(s);
+                for (size_t k = 0; k < nCoins; k++) {
+                    unsigned char buffer[GroupElement::affine_size];
+                    s.read((char *)buffer, sizeof(buffer));
+                    GroupElement value;
+                    value.deserializeAffine(buffer);
+                    uint256 tag;
+                    s >> tag;
+
+                    coins.emplace_back(lelantus::PublicCoin(value), tag);
+                    mints = mints.set(coins.back().first, CMintedCoinInfo::make(id, block.nHeight));
+                }
+            }
+            block.coins = blockCoins;
+            mintBlocks = mintBlocks.push_back(block);
+        }
+
+        size_t nSpends = ReadCompactSize(s);
+        for (size_t i = 0; i < nSpends; i++) {
+            Scalar serial;
+            int id;
+            s >> serial >> id;
+            spends = spends.set(serial, id);
+        }
+    }
+
+private:
+    uint64_t nVersion;
+    int nHeight;
+    uint256 blockHash;
+    int latestCoinId;
+    bool surgeCondition;
+
+    immer::map<lelantus::PublicCoin, CMintedCoinInfo, lelantus::CPublicCoinHash> mints;
+    immer::map<Scalar, int> spends;
+    immer::map<int, CoinGroupInfo> coinGroups;
+    // blocks having mints in chain order
+    immer::vector<BlockMints> mintBlocks;
+};
+
+/*
+ * Surge detection: looks for a range of consecutive coin groups with more spends than mints,
+ * counting the coins a group took over from the previous one (extended mints). Groups are
+ * scanned in id order and the range restarts after every group that can't be part of a surge.
+ *
+ * The state the scan enters every group with is cached, so a change rescans from the changed
+ * group only until the scan gets back to the cached states, normally within a group or two.
+ */
+class CSurgeConditionTracker {
+public:
+    void AddMint(int group);
+    void RemoveMint(int group);
+
+    void AddSpend(int group);
+    void RemoveSpend(int group);
+
+    void AddExtendedMints(int group, size_t mints);
+    void RemoveExtendedMints(int group);
+
+    // Whether the group had any mints added
+    bool HasMints(int group) const;
+
+    bool IsSurgeCondition() const { return !surgeGroups.empty(); }
+
+    // First and last group of the first range detected, only valid in surge condition
+    std::pair<int, int> GetSurgeRange() const;
+
+    void Reset();
+
+private:
+    struct ScanState {
+        size_t serials = 0;
+        size_t mints = 0;
+        int start = 0;
+
+        bool operator==(const ScanState &other) const {
+            return serials == other.serials && mints == other.mints && start == other.start;
+        }
+    };
+
+    struct GroupInfo {
+        size_t mints = 0;
+        size_t spends = 0;
+        size_t extendedMints = 0;
+        bool hasMints = false;
+
+        // state of the scan before this group
+        ScanState entry;
+        bool entryValid = false;
+    };
+
+    typedef std::map<int, GroupInfo> groups_container_t;
+
+    void Rescan(groups_container_t::iterator from);
+
+    groups_container_t groups;
+    // groups where the scan finds more spends than mints
+    std::set<int> surgeGroups;
+};
+
 /*
  * State of minted/spent coins as extracted from the index
  */
@@ -149,17 +391,32 @@ public:
 
     // Given id returns latest anonymity set and corresponding block hash
     // Do not take into account coins with height more than maxHeight
+    // or not more than startHeight, the latter lets callers fetch only the coins added since
+    // Tags of the coins are stored into tags_out if it is given
     // Returns number of coins satisfying conditions
     int GetCoinSetForSpend(
         CChain *chain,
         int maxHeight,
         int id,
         uint256& blockHash_out,
-        std::vector<lelantus::PublicCoin>& coins_out);
+        std::vector<lelantus::PublicCoin>& coins_out,
+        int startHeight = -1,
+        std::vector<uint256>* tags_out = nullptr);
 
     // Return height of mint transaction and id of minted coin
     std::pair<int, int> GetMintedCoinHeightAndId(const lelantus::PublicCoin& pubCoin);
 
+    // Publish a snapshot including the block after its spends and mints were added with
+    // AddSpend and AddMintsToStateAndBlockIndex, AddBlock and RemoveBlock publish on their own
+    void UpdateSnapshot(CBlockIndex *index, bool fConnect);
+
+    // Latest published snapshot, doesn't require cs_main
+    std::shared_ptr<const CLelantusStateSnapshot> GetSnapshot() const;
+
+    // Replace the state with a checkpoint taken at a block of the chain and publish it.
+    // Returns false and leaves the state empty if the checkpoint doesn't fit the chain.
+    bool LoadSnapshot(const CLelantusStateSnapshot &checkpoint, CChain *chain);
+
     // Reset to initial values
     void Reset();
 
@@ -245,13 +502,18 @@ private:
 
         std::atomic<bool> & surgeCondition;
 
-        typedef std::map<int, size_t> metainfo_container_t;
-        metainfo_container_t extendedMintMetaInfo, mintMetaInfo, spendMetaInfo;
+        CSurgeConditionTracker surgeTracker;
 
         void CheckSurgeCondition();
     };
 
     Containers containers;
+
+    // working copy of the next snapshot and the published one, only accessed atomically
+    CLelantusStateSnapshot snapshot;
+    std::shared_ptr<const CLelantusStateSnapshot> publishedSnapshot;
+
+    void SyncSnapshotCoinGroup(int id);
 };
 
 } // end of namespace lelantus
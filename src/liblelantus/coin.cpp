@@ -144,8 +144,9 @@ void PrivateCoin::randomize() {
 
 void PrivateCoin::mintCoin(uint64_t v) {
     value = v;
-    GroupElement commit = LelantusPrimitives::double_commit(
-            params->get_g(), serialNumber, params->get_h1(), getVScalar(), params->get_h0(), randomness);
+    GroupElement commit = params->get_g_table().mul(serialNumber)
+            + params->get_h1_table().mul(getVScalar())
+            + params->get_h0_table().mul(randomness);
     publicCoin = PublicCoin(commit);
 }
 
@@ -176,4 +177,19 @@ Scalar PrivateCoin::serialNumberFromSerializedPublicKey(
     return Scalar(hash);
 }
 
+Scalar PrivateCoin::serialNumberFromCompressedPublicKey(const unsigned char *pubkey) {
+    // secp256k1_ecdh() with a multiplier of one hashes the key in compressed form
+    unsigned char pubkey_hash[CSHA256::OUTPUT_SIZE];
+    CSHA256().Write(pubkey, 33).Finalize(pubkey_hash);
+
+    unsigned char hash[CSHA256::OUTPUT_SIZE];
+    CSHA256()
+        .Write(reinterpret_cast<const unsigned char*>(zpts.data()), zpts.size())
+        .Write(pubkey_hash, sizeof(pubkey_hash))
+        .Finalize(hash);
+
+    // Use 32 bytes of hash as coin serial.
+    return Scalar(hash);
+}
+
 } //namespace lelantus
\ No newline at end of file
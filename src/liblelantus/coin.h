@@ -71,6 +71,11 @@ public:
             const secp256k1_context *context,
             secp256k1_pubkey *pubkey);
 
+    // The same as serialNumberFromSerializedPublicKey() for a key given in the 33 bytes compressed
+    // form that secp256k1_ec_pubkey_parse() accepted, hashing the bytes as they are instead of
+    // computing the point again with secp256k1_ecdh(). For public keys of spends only.
+    static Scalar serialNumberFromCompressedPublicKey(const unsigned char *pubkey);
+
 private:
     const Params* params;
     PublicCoin publicCoin;
@@ -0,0 +1,52 @@
+#include "fixed_base_table.h"
+
+namespace lelantus {
+
+FixedBaseTable::FixedBaseTable()
+{
+}
+
+FixedBaseTable::FixedBaseTable(const GroupElement& base_)
+    : base(base_)
+{
+    table.reserve(WINDOWS * WINDOW_SIZE);
+
+    GroupElement windowBase = base;
+    for (int i = 0; i < WINDOWS; ++i) {
+        GroupElement multiple = windowBase;
+        for (int j = 0; j < WINDOW_SIZE; ++j) {
+            table.push_back(multiple);
+            multiple += windowBase;
+        }
+        // multiple is 2^WINDOW_BITS * windowBase now
+        windowBase = multiple;
+    }
+}
+
+const GroupElement& FixedBaseTable::get_base() const
+{
+    return base;
+}
+
+GroupElement FixedBaseTable::mul(const Scalar& multiplier) const
+{
+    if (table.empty())
+        return base * multiplier;
+
+    static_assert(WINDOW_BITS == 4, "windows are read as nibbles");
+
+    unsigned char buffer[32];
+    multiplier.serialize(buffer);
+
+    // buffer is big endian, windows are taken from the least significant byte
+    GroupElement result;
+    for (int i = 0; i < WINDOWS; ++i) {
+        unsigned char byte = buffer[31 - i / 2];
+        int window = (i & 1) ? (byte >> 4) : (byte & 0x0f);
+        if (window)
+            result += table[i * WINDOW_SIZE + window - 1];
+    }
+    return result;
+}
+
+} // namespace lelantus
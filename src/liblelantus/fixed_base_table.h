@@ -0,0 +1,43 @@
+#ifndef FIRO_LIBLELANTUS_FIXED_BASE_TABLE_H
+#define FIRO_LIBLELANTUS_FIXED_BASE_TABLE_H
+
+#include <secp256k1/include/Scalar.h>
+#include <secp256k1/include/GroupElement.h>
+
+#include <vector>
+
+using namespace secp_primitives;
+
+namespace lelantus {
+
+/**
+ * Precomputed multiples of a fixed base point for the generators which are
+ * multiplied on every commitment. The scalar is split into 4-bit windows and
+ * every window is a single table lookup, so a multiplication is at most 64
+ * additions and no doublings. Like GroupElement::operator* it is not constant
+ * time.
+ */
+class FixedBaseTable {
+public:
+    static constexpr int WINDOW_BITS = 4;
+    static constexpr int WINDOW_SIZE = (1 << WINDOW_BITS) - 1;
+    static constexpr int WINDOWS = 256 / WINDOW_BITS;
+
+public:
+    FixedBaseTable();
+    explicit FixedBaseTable(const GroupElement& base);
+
+    const GroupElement& get_base() const;
+
+    GroupElement mul(const Scalar& multiplier) const;
+
+private:
+    GroupElement base;
+
+    // table[i * WINDOW_SIZE + j] = (j + 1) * 2^(WINDOW_BITS * i) * base
+    std::vector<GroupElement> table;
+};
+
+} // namespace lelantus
+
+#endif // FIRO_LIBLELANTUS_FIXED_BASE_TABLE_H
@@ -0,0 +1,2134 @@
+#ifndef FIRO_LIBLELANTUS_GENERATORS_H
+#define FIRO_LIBLELANTUS_GENERATORS_H
+
+// Generated by contrib/generators/generate-generators lelantus, do not edit.
+// Serialized mainnet generators of lelantus::Params.
+
+namespace lelantus {
+
+static const char* const generators_g = "d75bfd6797e108484944bf16246ecbac54cf25d39c537ba91aced24f70fcc2380100";
+
+static const char* const generators_sigma_h[] = {
+    "b0f4cdec32c98273766898efb79b61c1d96e1be153b577d79c3974c9d9e8fa310000",
+    "dabbf2f802c1366b77fc7dab8c650b6d225b95bab99c96f36c40701a6f637aa90100",
+    "9deb376da4f5594163c6b257f5e82241d4a5ad01660d2213fd827307d3e3340a0100",
+    "1fc2af8541f737aa8f582139b78c2b5a6d3f4b7647df811bd408d9cc7bcab99c0100",
+    "3d4751d17d41c8eedf0f5483f48efbda7bc555deca2380d8c65ddb2ce26f3e120000",
+    "6f5b9d10ddb9ba6e17f9fe3349883c9dc01c455a42da69a65f4923aef1322d040000",
+    "72ac547d7a4764b6c1ec446e2d2f8ee8bad5aab3e79b22eba57167850121c7120000",
+    "576efadc82e8baee10d17a17246101ecec8d65364ffa13d3ddad2e8383cb2ff10100",
+    "5f1d7d4becd046c0d0337b810b5e10a044dc97e33443077874294443c83e1abd0100",
+    "9f3a5611f069981ec4154ac8a39d01b8274bdc655190b82aa9943d35b81a267c0100",
+    "a7dd3090d335509518582c1d95a1d9bf08d1269efedc9772806ccf078f9d6bf00100",
+    "7e344ed68a6f6a6eb6fb1d3d5476350da7ffb5db85fecc6b4f3f9437c33419ad0100",
+    "eab7f90e5f10b81e6a130cc195df94b7f8175971f81414fbd22b75cbf68efe7c0000",
+    "c6def5246c210260ebb9c22da78e42fb27bd811cb73776ed44086cdcf6866a260000",
+    "66dc9a04091e893153c5ccd1b001e6882f07fa23673ad3eaca551a816d6be9500100",
+    "a048fe87f9bd15919261524ecdbb9add1252704c9fe2282e11f0c3efc99296150100",
+    "ff36c17680e0f9c247296d31ec7443a770d22d8e77ee2593e13fec80c6dc50c50100",
+    "707e13a595295a327f1a76f7fd4dfd8ef1b8ff70f0ae0ad164426561d9342c800100",
+    "e36d65e551dd726da478906ccb812ec03fc7b8732ad146c0fda911e9bd159e580100",
+    "1f052578d374ff0eeb70540dbd6735220361d59c8b00129296d093365642f9c30000",
+    "ef0258893ca138f429ee7d923404ba80c3b9190b5f9a36413d2e2d1b7605e39a0000",
+    "6d47cd9c6ef8b0e330ac803c2a8f508c97548def2ffd380dd4d2ec3aa3b002770000",
+    "1790ed10a6c572f609a19683953632297dc93646d73f25742f324b5aa5a73b3f0100",
+    "e7c5602ce340be980fd1bd3d1c32221153c4218be633be1698b99f09e9570fbc0000",
+    "420697789a5ade212e261c57933df2262292f94b994ef1d4e94cf9a08a5a0c410000",
+    "3790e2ead7b79dddc12e3dd772b8256609c5b881b7e95bbd9353a69a1bb659e70100",
+    "429a7fd96a523f766111c29168a0014155621f53ea5e3e91fbccd3d4178d334f0100",
+    "bf1c2b8333713cdcad209642183b56868c4ec386a97e2ebdbf4880d1a257f96a0000",
+    "15d13fcf244dc20d46a1b47256c69e5d1fb859981c3f28489071e90055501ebe0100",
+    "0a868da34197127221a614308a5a969262e9721c2ce72d004b661e41e5d5148e0100",
+    "d888e72933a3df9b42cd9049d03674460e03344fa1ac66b7c2a958c7dd99a42c0100",
+    "ef91e56ac95ad42a45c6d64c286f6c156d63a7efd93e190731c2b21918927b560100",
+    "50bb3ade6385c003d26e2e2f38830550abf7b26ae352f80c9442aa69725493df0000",
+    "36e6bb86e8b6b5943780141004f7a923b74b3a976cf531305053c7b4a856da270100",
+    "be34e31fc5d3c4c62ff1ac963d20d82910072031a510f3c836a5c307ffc1399f0100",
+    "1cc06085e8469243f21ea2f12da61b800e2dc4a1f163d37158932ccf203e08bc0100",
+    "43462499771566b24012b7fe1ddb308b0eed46435b7906c16248654c365778730000",
+    "e7619631241bf352fb0e2713e1c77fe60addfb0abf14ef86bece8f512d4de7ab0000",
+    "e8dca390089a8f32a3b3a54d5162715a8af5e241e9038c9b3fca86c256c891c50000",
+    "48b3624b9f86dee5293be1025a7f61c29ee9a39a539a0d355a35bd4c846cfc9e0100",
+    "d8e75b672a270135d32ee2c20bee9ec2c1ae4ae08c44db5423a59c91d95de48f0100",
+    "44ecbbb58e0e44965b246241ae7eaa01f785080798a40ec94d1f83a3d5d13ff90100",
+    "ccb04cedb4f37864f6b2fba961b41ca74f296e87f4911f62b0cd36d36d93d8c10000",
+    "f898e19e99e27636b05c4b8252820ab1417530d392174572f1763cf9972563250000",
+    "76ba6a0667ebdd571feb0acca301cffd1b783d9b1d5d28f9b7d49299b867acbe0100",
+    "cdde40ecfaa9b6b4aa0d0c46c61dd946ec8166b1816836f447308529775e07e50100",
+    "7b1018e264be34f247931f2fc39c12c339f5eabc452de70d15d4bc284148826f0100",
+    "39fd184e88119cca6e6f9523eb6203f4b780e4b0b483ac39cf8250d41f77bbb60100",
+    "166df08b4a2392e62a52737f298638b1225733dbf137ffcb4b6178acc6e155260000",
+    "13989c9579316bedbad9d8411bdf25cd56e24426a1ff6e45822ed8ffac1dd8e40100",
+    "e622d277ad3f105ba774d2e9fcbfc52cdc938599101662918f9fcb8793d1c7fa0100",
+    "94daff4f71259d5bfe64c32559721b34afbf412d8283d1470276f6016230511a0000",
+    "5e2069c7af70074762d9f62166b02a95a65a6a7246ea9b4c86143f58a496ae9f0000",
+    "85c3da0d7938e63269f794dc5675c554a78f1d1845bdded09068693a82bc69d40000",
+    "ef907d07a20cd99f8083486b6ade6ddb1eb92175ce6dda2f3310baff05274e480100",
+    "605f576e3dd311f8ba9725f2a59e6974dce450c1e40705f2728d2644554032a50000",
+    "d3900b843252bfdde4b144db623db523ccbd423d4211c021e147c18a1cfd5fad0000",
+    "f63b21538565ea384bba851037530cdf3d1696a5648fd93d2ddcbb26b570dfe20000",
+    "f23a046970808dd71bd3546d273c082a042dba020fe117b139efa083945ae44a0100",
+    "0cf41c85d3af8708596a510bec4c352285ac96bfb793cf346f2aa47491a57ebb0000",
+    "df516d2d0aa6e3fe623c7101dc0386270c64c860bef44ac3939703497d4389290000",
+    "ea41a2d0e875b40c9054013e2e39b6cbec239a075e0d78dc490c3c3a363eafba0100",
+    "1c265f3899286f831066fe28d2df23089f702852a982c4ceb0a2f747bd6c2c490000",
+    "66f05b9f134e8da207214b678f2a56f9d22f4710c64d7c3a708bd322e5bf14850000",
+};
+
+static const char* const generators_bulletproofs_g[] = {
+    "b0f4cdec32c98273766898efb79b61c1d96e1be153b577d79c3974c9d9e8fa310000",
+    "9deb376da4f5594163c6b257f5e82241d4a5ad01660d2213fd827307d3e3340a0100",
+    "3d4751d17d41c8eedf0f5483f48efbda7bc555deca2380d8c65ddb2ce26f3e120000",
+    "72ac547d7a4764b6c1ec446e2d2f8ee8bad5aab3e79b22eba57167850121c7120000",
+    "5f1d7d4becd046c0d0337b810b5e10a044dc97e33443077874294443c83e1abd0100",
+    "a7dd3090d335509518582c1d95a1d9bf08d1269efedc9772806ccf078f9d6bf00100",
+    "eab7f90e5f10b81e6a130cc195df94b7f8175971f81414fbd22b75cbf68efe7c0000",
+    "66dc9a04091e893153c5ccd1b001e6882f07fa23673ad3eaca551a816d6be9500100",
+    "ff36c17680e0f9c247296d31ec7443a770d22d8e77ee2593e13fec80c6dc50c50100",
+    "e36d65e551dd726da478906ccb812ec03fc7b8732ad146c0fda911e9bd159e580100",
+    "ef0258893ca138f429ee7d923404ba80c3b9190b5f9a36413d2e2d1b7605e39a0000",
+    "1790ed10a6c572f609a19683953632297dc93646d73f25742f324b5aa5a73b3f0100",
+    "420697789a5ade212e261c57933df2262292f94b994ef1d4e94cf9a08a5a0c410000",
+    "429a7fd96a523f766111c29168a0014155621f53ea5e3e91fbccd3d4178d334f0100",
+    "15d13fcf244dc20d46a1b47256c69e5d1fb859981c3f28489071e90055501ebe0100",
+    "d888e72933a3df9b42cd9049d03674460e03344fa1ac66b7c2a958c7dd99a42c0100",
+    "50bb3ade6385c003d26e2e2f38830550abf7b26ae352f80c9442aa69725493df0000",
+    "be34e31fc5d3c4c62ff1ac963d20d82910072031a510f3c836a5c307ffc1399f0100",
+    "43462499771566b24012b7fe1ddb308b0eed46435b7906c16248654c365778730000",
+    "e8dca390089a8f32a3b3a54d5162715a8af5e241e9038c9b3fca86c256c891c50000",
+    "d8e75b672a270135d32ee2c20bee9ec2c1ae4ae08c44db5423a59c91d95de48f0100",
+    "ccb04cedb4f37864f6b2fba961b41ca74f296e87f4911f62b0cd36d36d93d8c10000",
+    "76ba6a0667ebdd571feb0acca301cffd1b783d9b1d5d28f9b7d49299b867acbe0100",
+    "7b1018e264be34f247931f2fc39c12c339f5eabc452de70d15d4bc284148826f0100",
+    "166df08b4a2392e62a52737f298638b1225733dbf137ffcb4b6178acc6e155260000",
+    "e622d277ad3f105ba774d2e9fcbfc52cdc938599101662918f9fcb8793d1c7fa0100",
+    "5e2069c7af70074762d9f62166b02a95a65a6a7246ea9b4c86143f58a496ae9f0000",
+    "ef907d07a20cd99f8083486b6ade6ddb1eb92175ce6dda2f3310baff05274e480100",
+    "d3900b843252bfdde4b144db623db523ccbd423d4211c021e147c18a1cfd5fad0000",
+    "f23a046970808dd71bd3546d273c082a042dba020fe117b139efa083945ae44a0100",
+    "df516d2d0aa6e3fe623c7101dc0386270c64c860bef44ac3939703497d4389290000",
+    "1c265f3899286f831066fe28d2df23089f702852a982c4ceb0a2f747bd6c2c490000",
+    "43d32807ee0abe2f1a4e705cb241335e603916b895c8f02445f91cd84b6c8f0b0100",
+    "9a71a1bf82a929bf43f4c06f3ec9e933419a838794ec2f80396521388672d7fc0000",
+    "50c44df1ff81079b862fd46a54d0e518807835aa37cea699d040daba2a2442d80000",
+    "a5f8c204f51ad632b70b7d3b750c268fdde013faeaaf84337e05d5c8f222e0f90100",
+    "c088727f91c6537fbf4227cfb851dcd9ca8ddc217d0bb3be73d37ea83248c8690000",
+    "dd433b4cb86418f675889bd55cec263748e7d4d74eb3403cae2a92f081745b090000",
+    "83db7590f4156d598a4711c5695f362bcfbed5fe62ba99a135dee99203ab8c860000",
+    "b22923cc01ed9ee1ba2c7803346b908a49c01772ed8574e94f277e4aa5102c370000",
+    "f3ad9c118efa4620dfce27e9abb4784ebf06a70f611284354dececf82fe7e3000000",
+    "acfa010b0fbc48a45b95fe01789c97dd0ca83c01e336122fd8ebf54879830dac0000",
+    "c38f7c91a99faf46639f94856f14910dcaf467d1703290ce1523f45cb3b737480100",
+    "a65f3e481a1c1cc5129e2812b8a68be913379dd3bcf78db5a0d55a110b7064f70000",
+    "082c0a857e90cf2747c4c80eda18dcd6ea27a310fb04cf708d5ee0abe8191f710000",
+    "f53b480f3c23f7d29b54ee679eb28a7e620296c1144fda10a7e07548825beeb90000",
+    "edfc55460edff682baff67403c001029ad420b1bbdc363b0f56727e873a926700000",
+    "02f20382fef6c1ccc0644bb3f8abf94822a20082ce46150302e03a0322afa9530000",
+    "6d29ffa2395a41fbe5018ba6fe68fffc6cacf1a5d480145a1b1c37059adc338e0100",
+    "3442f288e7aa7257668626d16ca720b0394614964e1cfdc7ec81ca130eb3194c0100",
+    "b9bf0fb223009f1a7bfab24f058ba9b7e99f0667050c5a848894ff77beaea4290100",
+    "24f473d054f36a95afc531f9afeee50e8f5e93eb7ed38aa66d5bb229111be5270100",
+    "3bdae73eea71d61a0aa07f454bfcfbbe5b2a3e4f74d89de35e4d5b3a8643cef30100",
+    "9eb998bfde2a82b6e4cbd758aa82a201fc581c577c8165fb0e8589d23d3e0ea40000",
+    "956629e2cd94b2b775341b5cf800d69f66f522a9d85939f17df1a1f22be2279c0000",
+    "d71c35812041497b479410716f8161b19524c2cb7f3e6cfb26239cbbffbb8b740100",
+    "8c7fef182520c4fb1b4cc22bdddaa9ace43935ab914002376168dc4d4f0c9c9f0100",
+    "3b00fa51c26c94c26830c9620093623f5ae542081ac191dd12bbee2d17e173820100",
+    "9eb0aa01efde94191bff431c1d55e20841317219a36c6f0a9112365ee7c1e4a40100",
+    "6cb8165bf257f09883d9d343455304af7a5d34737409c7d78a0e4d241dc95a3e0100",
+    "57f74a350364d36d3cb902cddc56bd9e5a781cd69384e6b1e3938268240605db0100",
+    "e34109ec65eb8653be08377168a794c5e9cb9466665fe82f434ff04a84f3f4440000",
+    "2efc4aebd0d2d580ecc9a04a9e7c484b69160bc517069965f30b21f93f03f3d30100",
+    "7a414dbf5de3c563d4eb43c1dc5bd222db8754ba6b67f0c273e7f3078a783e340000",
+    "3de979bdd25b944c3b5ddc6a3f2c4829e378ff67becfe79e99aad98015d2bc4b0000",
+    "03916587e2cd9e7e67585aa305c708995a5e5a44895972a18f71640e5e1703de0000",
+    "d06203c2a590528392856aa535ffc365b0cad71099305a960c56fc55b8d01b9a0100",
+    "21eb5e608f7f3fd6225d7c767c92238c32ba7a5c0990eae3cdbd2f43286d3c350100",
+    "a51b737bacfb0ca4bdc488aa19a92490286aa156b290dd13f41d614a8444d7ed0000",
+    "9f01541d86b654ec5df82fba3305ed9be9d9859605ccd6f27e62152b3550def10000",
+    "498aa930551d91dddd3082f76084d0d916d1442231196e7a9c23944def3cc0250000",
+    "69b133e007c283844cc50579c8985576e7122bb7524dbcfe3de93061c10199390000",
+    "2213baad63e19a0f79a06f3617dda7302cef103ee2ba48e81a263851124f90eb0100",
+    "8c3c926ae6bc3cab1f01e371933bbebe169f1bbc845de065fa598e2c458a35310000",
+    "9d9141d8e2296d0eb89e074270eaff06e0f2da126d6d14df2853dfe716ca16580000",
+    "ee48401467782684d6b3c55384637c0ac061a284bd006bde7392a4f9a540f8d70000",
+    "278509785a403d8bc1358a2d3559acfea66ba0c0ebb2488b6a15e00128754b280000",
+    "3867aea4cbbe1ac6221240dbc74ebaa99eb9afbdcc1ba9b8afdcbc4dfa168e050000",
+    "6a41d22ece933e5f224b0cf3585efd6e53350937e1480b2b920deabc6d434af80000",
+    "bea72959674b7cde6e799f2613a0f3dc35fdab5591f25feb68623f27f56928b90000",
+    "26b13dd67c6712947ee6c5e90613d25d2037643f472758855c80054656faea6b0100",
+    "ef5f1d21407f7a87e9a87c57402504ccd833a6ccf7737d0cad3211b24b9691d70000",
+    "c0c8284d1af16fdd502a9b5668472844917aa5dcf3324e0de0030a277ca00f2a0000",
+    "bdf6358ad3b71d30c89e538ba3ff5c724a7315bac9dc7f648aa82cec66a13d070000",
+    "b8c836d9214602665a68ecd13b84008cff5e9915590415a6015a129f08fc9f9e0000",
+    "6bbd1c9f20cdf6f3d937b0d2f4d25f91a02aa5c825f4187c12ce59b447c81cb90100",
+    "cb520d43b1360dc9b0df9b4858ef6bbc9098234fbd277e71c74ce90e55c0b9640100",
+    "2c015308debf0d56b0cc891f42eeb35d8bcf675e40d5c18039cc54173277d9f20100",
+    "6f8435a89c991869e5a06204f345a02b4bd3b3507b13f99b0c0dfc581bb13fbf0100",
+    "44515c5e8b993a44065a8bdcb2d9d313396b216f79356ca618eba34eac57422a0100",
+    "a178b97c34260732af354582a87d483f735f84ed50193ece77d0ee86126616aa0100",
+    "3e4cd1b72cab8119f8c1bf92443c8df90caeec9869aaddc5c7ea4218aa23bc760100",
+    "b7bb38765d7875d1afa90c2d4aa9fa6f5ea1be3405e9086303e7b604d4603bcf0100",
+    "66ff272b1825aa21942a5a0985c5844535c2cc4a910d41f550bc8e557eb09b280000",
+    "764125948f595c8b75477580fd29931183bb03c8913bb9b49b0b6366d1cc3e0c0100",
+    "f41b851acaf588a799580244de87a8c4633c19265fa1de00c4847bda658c8ac40100",
+    "4e2031455c9a92edbdf94c38675bb7a2937159a08492549e2f1ff2ba3f5bb2230100",
+    "470bc59b5fc0048f958af520367eaad6333903d32ac99b854f77eb3b0114aaf80100",
+    "c5d9773474a5ddd1f7519702a61b59acc907b102ddd457f953a7b3e5f00191c70100",
+    "e73aab78262e93f0ce9a0b3af2f9a8c7c53d038873e05ec0ef8edbb2803c615c0000",
+    "e71e36e000f8aafc22542527e85f96f49b056756c22cfc74dda9d5a679a1f1eb0000",
+    "dc0bee151ffb510eb1f2f0a96e96a38a2028ef74b2564944cca4c6c80f112e7e0000",
+    "63e063bdd6311ca11f87373ae3a06e9c53c71ad6f54c5aad480f01aac5213e9e0100",
+    "da477319c56b6e5ba5065a2ba49e5d12948ecea5b126140fe3d37eed30a628f10100",
+    "05d95f4ccbe1ae83dded9e41ea5eb79fd4c2fa0f210dedbcd3494b9f6d9c3aee0000",
+    "810a788a92f0789d27f694ed68ade5c282ed2e4b0fc839d86f53d1f60b316dcf0000",
+    "9f9b726432a84f6bae51b24656110bde324917176d93bfb4d61b8c9b608de6610000",
+    "fd8b7f12fe35815182489838bf840782c7136e8e2b39c5e265307ff365bd59540100",
+    "d512deb8fce4d1ac16a86200f31054cbb6723c6063c4636596b3c0e1179c15480100",
+    "e2df1cd8c4cee05aa3a954e6bf8c8c04e20bbdebefeed24c358c2c26d70f0bc00000",
+    "3bff4b4971aaf1485b17e1b74d65944a19c008dfe5c8b261d72c6bf1872019440000",
+    "8588bc642548628899f82b76e1e85cbf649ba906c749172e9e4a7ae071678ddc0100",
+    "2e37fcc4a4c1860e6496dcb32df6c5e4ef992c3332c1ddeedd10e27a6f73341e0100",
+    "9c81fda0a89952acf6b9725668a9044f8cd51cea9f9a4db48de68cb8a51748030000",
+    "87a1cdca75f72daf3b3770b4c922763ea5d69167032d03df627c30430478ca8d0100",
+    "ebc0ca2bd989301fcfc0a86cfec9a9ad10a940df5023bd7a32970b958e1bddbb0000",
+    "4f6d6fce4168f48f7e9a1fc8f29c20dc738c528d8d73260d9ceddbb2b51580390000",
+    "4441f410b92f3783ecf368636f7b7ec93414eaf66a00756868b653b3ff2da5400000",
+    "fd7ffbab0d6969f05c0e4600b42e294c66db1860cb440bf0319fd382ce2eff810000",
+    "5e2d145a721f36b4d2cf577087c4644b15f006aed9b9e5c557e482d16aabc1a20000",
+    "85ef63c56d7662491f2a511b84157a36dfb8460beb2cd6b3c4fcda841ca28faa0000",
+    "800cf3de9283692af4556afcdf08e9e133fd38cd6218428c1fe59f61411c40870000",
+    "3d709c0ad5c2aaeea0f0e03bb8f13be513a46a5d51da7f001e5831f4735a9f6d0000",
+    "ad356ecfaff6b0d31af0046911cdc6354594d08eb8aac6639205ab101e5fae860100",
+    "d3e0ef34895957107d2a25f154636ae535d76107846a92e5ecf09deb27c9f0840100",
+    "5eebed3d6b0695287f766c3f930fc773137e42e9f3c2e5ddce9637deb32491590100",
+    "91b39f2cfe756249b5f7b363f7b5113a7a93d0a3a80de74e0f79c36cf2ed3dcb0000",
+    "04241379007fbcc784ec6eb1e8872ad6bdbbacad9ecbdd7cb2dca0367618c2270100",
+    "651514f5304c18bf041d96a3f00742bbb818818bf8c2720539174c7764f26f670000",
+    "7182096b35d89a0e6cc0c69045e7d76e88c61bd734eba4aeb7d20e28ba261c910000",
+    "c4d805bf4691ca7b3836ae6c53969db98a28c2e69a9bc17f5b5eee0132dcaf570000",
+    "af7473e1983d01c8e220eab9efb837af54df3b13a28e4d19be78eead571a514d0000",
+    "971eb900abe4bc354b3d9430153a806097f37416064281a26e301c9e501beddd0100",
+    "cbcc2e174da4cc9c4721671618f1e8ea2b03948a171c44634f9a383c29e629030000",
+    "03dd578a5a25fb5b1929a9d8cd1d3977b96f7822e8279848b17356662c8a7c5e0000",
+    "59c683dbd84a31e8b2394cfa1c31bed849c1fda8cd85b1791fdffdc2e73d9c750100",
+    "890fb86ceef834a3ae298fa65775c1a8c1ba4bcbefa7afe48114a2ebd10ee26b0000",
+    "a3cae8af75572936dbf7cc0c861c36523fd363c328d2c182a23c582d5308501c0000",
+    "65bd23658c7f1adc2ef3e2be579a4e27c8f6e3304394100f4a35d3814c95d6ca0100",
+    "d0c8f6f33aabbbdd9febb153765b97a15e749680d03b57f8dd83e704324bf9640000",
+    "899cbe57d0bb7e35055c3fceb03e792f82fd9b3fe23756f3a0948db56ec4a93e0000",
+    "dec2b2d10b984640542187ae8c1d925db00716eacdaaa232fcc75aa809edfa330000",
+    "c7a0b0307069263e5b7bbc13b1c2e958144d921d248bd2ea7ab8f60ac5f737700100",
+    "ab269d4473e6b3e2b403ac0b0873c6d138f650ae6eac9508b151b30b65504f640100",
+    "c499b9d5ba38a9c0f57f09d2e29648f7290c1b600c2c01f0b999003af2d45b560000",
+    "fa16a1e32ce9eabf15e3f45fb04aaf78e16d2e3a3ecf7edd5117b42c08c848520000",
+    "f876b5f7f46f29641acbca7b57194a5e3407e35039de3f751670844b71ae12f20000",
+    "f4ee654084268d03a41926074342406dfd70d46f1ea2de211620acc0b7b9dee70100",
+    "f40d265a3a8f06c1e251b44fabd8f8ed5390452e6479f1cfa17c867e923f81d50000",
+    "f6f9cef23c99994d428cbf1bc3029544cb939666687cffd72af7a2f805f52dd40000",
+    "d00d46b6626e3a42a770e76077c947b2ed4575076be43fd2657684af2c8d49cf0000",
+    "61cfb60646902c8ceaf5a1e996063b9f8f0acd94601b456f1306174b3563d2670000",
+    "74d92b81e3775868a49d4ce73d22ab95d1b7b7eed658133623ff52232c643bf80000",
+    "671e362e1fa082171498813546a01121fbf5525ab014766b70d5c6ce9f8c4a300100",
+    "6dc27d3033d74493a47aeb810dbfd173057688d82d925a0126c5cce7c95727c20100",
+    "0cfb36dec478e4ef2f9f80ed1a0ba98df18c64154821f9ec3e97376508a039720100",
+    "cf0e69d5351cd1ca6592b9583c8b0aebb2c8db88309f58cd9c183d4ad366b4db0000",
+    "b54143683f7c30b31c98b7080f8993c6ae8632d391706b02169f573b63a34d650000",
+    "86c5cf7adfc17edfd22826c93e41b08f9204bb43e678edf3ab277e9205df8c7d0100",
+    "fbb16080d3f5e8f24eddf339bc82e910513ebe5d9ff285aa00431a9ef43db2f10000",
+    "d187388817f14222e8915b14fe2a708782393b571f06420758e4f7ead02967f60100",
+    "4e7a2b7d424b559a96c61cc8186bf58816b6bf8c90266e2ac20731dd479282530100",
+    "ce20fe2f8bcbcbf44413c3bc5fdf42de9c9a5407d389360dffb393c1b724e2fb0100",
+    "e40796bb2444c9129d7661adee3c39050f8dca294f798f48741ef55e3af07fd20100",
+    "2381a743395bd2be3627f6b33fafec474dc070ebd5ea05482b2ba1da13381c520100",
+    "343c5fd40b4a864a648d4c579211a8259b7ee66a1625a50ecde7540bf3fa52740000",
+    "38fcc657b546abc00e8e544bc7ab5e2d93e665fabdfa5e032d92c78d77d872e60000",
+    "b11c500312aa534ab7e0bde1682ea109d71751c8181a2d73937d38fe46b533a60100",
+    "c48d8a04235d1830c29131bc8b9140140577b42ec0f3781288aa98187319c1c60000",
+    "ef3484e6c7b3c9223ba55663023c4f3b5c2d8328fb25cd0ab2a6c6cda4899cce0100",
+    "cd918ae464d71253f82aa0a7415d5f4917886589c38973f6a001d3638d04f69d0000",
+    "19b4ab2b55e9cf4991318a4d52fc26cfa3e848a17b1eefccb96571200d988c910000",
+    "0069d3f70c1cbd0ca0d40526cd2f4dc6378d7c6dfc3885a9832fbcf2a914bdc30100",
+    "05ca9c3416bde7a91251c1b819f1cae700a4d2901d5ec7cbd78f9c1c3a19df190100",
+    "33367c6f9e4c1406a37c4e91d2ec094ba61f6245476740cadab88b3db10929390000",
+    "40be191346f39dc250e43fcd1d70c98b8668a96d9737caeb98b4edbffc4bbda10000",
+    "7c838e4b57c496708aae1c4f82f978f50a9c206e6ad31bb75ba422c30bf4dc6a0100",
+    "5ff1907f5bbd09c10ea61aa250a4f64689b10ef6a0ffaeacf0570ee1224ff39e0100",
+    "fd8c7f4c83bfaf216ea450c27337873be845e0eb7039d212033872b57efcb0d60100",
+    "74b4e5a34306f76de058cbc0d845e1f9447fe630ff78ee1a0807e1a8faf924270100",
+    "300cde61dacd5fabd3af74249ab88ee5562348e574c4827db81d30a4a10fc7900000",
+    "ad9f8f1b7a0b5ce8a134066b574c804d95a87b83be50ada8c747b9ee1f4f43750000",
+    "970c1d7ec74ebb834e801a9efacb0d78f78427a034b26264f6963b8923c639b60100",
+    "40aacb25ae5421cf8de646c3d39c6b6c41af52e44ef85a8202c5e3febaae7f2e0000",
+    "2448ee1ab2748230189b9e0581e4858591d3716cf5309603ba1a4f2bbc375ccf0100",
+    "98483c748985a1c3749713f134d2d1aa7234a8699dce774d15f07a5a24e382cc0100",
+    "03759b8f7587c8d9ea9f427e08ef1c4151e4e4351d97d5a9c21509f640be8f690000",
+    "7d1d703e0761100526aaa4dda8fed7cba94ed9f63ed20656e2d5ee8fc7ed22510100",
+    "72add0504ff2eda245eea6f389c75238337043729960e757c082e83f37ad89ab0000",
+    "8a4dd29c10529e05c573fe73bb907938d6fbc9ba287d0a08a985c502705fa9ec0000",
+    "183c85c63978f3a8665d79493a640ea97e3deddbaf9d7cf3ed4db51cb45314bd0100",
+    "357288a103781ed20eebe95cc1cd422a2ca88d7e497f0e7eca6a8d6db7b9477d0100",
+    "7565a1a866e6d4410594fb078d97c159e1836e05f8c3a44b7ccd85ae6dbbcd980100",
+    "0e8d6b55cee01ca5454724ffcfe1398df587f7cd69fc4191fea576c7ee6cc8e50000",
+    "0f35631cdeb7d98a0f9825fc03f3cc85ca622fa9a695f5a3f41e475a3902e4260100",
+    "3c99bcc37d3e72ef4c086e890c314c6308d9c7f5e19315739d28962622d37ebd0100",
+    "2385c5ed33470a2a6f13cb27a51223a0997e437c10c3cd79d1dc3f89c4f886070100",
+    "af7ecaa27a98dbfbf278db990e85871aab5ebf375de23772a2ca9a5ab4ea1bdf0100",
+    "cda7d7fbff7dfdfeac0b99abdcf0e18daabb19efeab583fd16b37180b3322cdd0100",
+    "c70b8f432e22ad01b55e7dd8975bb368453f4be729f1e069f919e785505676210000",
+    "b60fd0f4f20bd7286e5b2e3a79be036b5c10c914be13e323f4522563162348020000",
+    "6a6c8542dea3913a9e832ebd63eebe0137a64a0e075cca881c2ed29a85a835fd0100",
+    "f2ddc43b6a8e4c0d5f4509d8aa5ac299ec32bf4f6c228f9367945e5b77ea1fe30100",
+    "1464d050179438608dbb251df1d9908dae3e9e15ef6e20d155ba05d29cd757c00100",
+    "ac12074537eb2d4aef72b442f32fd9136cbd028a40ca96eb13e7a84dc1d717550100",
+    "95a3588684b26ff6b8227347bfd638e8aec46776d79969ee4d625f29f108d9600100",
+    "a7c11126a506c5528d57630685a4b92070d95f31723852df86dc10193a00c0fe0100",
+    "bc201714d68787cc4e6bf098f9bc683eddfec1401e303335592c7b9fc0f4eb9f0000",
+    "628c6f9e8c48248c4a88780717eb609ecce97733f3e42f85f743887becd31ec20100",
+    "c8dcf27fbb4d9ea298dc9a11260c0d0fb79949f69955dec15c9750628ba774af0000",
+    "4250f95ec51c9c61685ccd2b7b30273500c9f1e992f9e45bb72c9a64700801830000",
+    "82794349bc0bb4e2f28d68f18ceacd4172fb776de1220e6b22bfc01038e24f460000",
+    "f529b92fa2f84e7ad9f52208bbb613636b309740ee2641fdabc607dcfe4d57000000",
+    "42ac5a5dfa1b1e3753dc0824b928bc4635a12e262c49a72ad14fc0c8b6831dbe0000",
+    "a2f816961a2e8060d079960380f9737b15ebdc257c69bff0a9245ef4ea8875fa0000",
+    "c9dac106817bc1f4cc368719bc4181827c66ad582444015f17e601749c388e480100",
+    "7e36d0f1e1366e2a96f1214ad741468d07e057c4290065d8f2cf23446db83e670000",
+    "89f43613612965309e1aa8cb47051faaa65cef702510ca6604f045d81a1c568d0000",
+    "69dec5f9968d5117d0609c21b83eceefe33d2915ba4e5d208c4057d42575cd1c0100",
+    "f7986b13818238402db0f6b0c344543839b9e87a9edf3d1933388badc06efa8d0100",
+    "31505e3fd77a09c843ed9e491773c0f88dbb3a70ba4358af940ffa8c88006d150000",
+    "87f1605abeb16d7d070d086be19bfb1a482cde97dec836d8665fd6b21aeb9a3c0100",
+    "7bea45afaad2dbebc70029eaee0ade64beb8bfca12ea3c4b6bc8f0c0b808eaeb0100",
+    "987f2bfee8c60ea121cb7cad3334ca8ead5207595ff151358ad236b80ad676390000",
+    "f98ccb518e5e55f11fba8deede7e11cd7a3adf3c8a8170c4ffb49d9b27ddb62e0100",
+    "f1c240bd377428b4aa0c591340dd2ab57cfb76582a5ea18561da7a1c2c7e7e820100",
+    "fb044936caa299f149c2a60679ccecca58c02563b806edb39330f6e51c2d437c0000",
+    "974f01f8e0ccea82516d2eb80bce713e7522ae7ee317e76ccc6c02cf66cb09680100",
+    "63d25e121a53376601e5c00d2cf67177349204ff2c241a2a7724d198e1d194070000",
+    "c7684b40ccc449aced11d4161cd6b66f87d10ea16bd5cd418bce48d0e0e7a3d50100",
+    "80b257079727282e64d2e68ec4bd66bca90cf2cd9e34010bbbab77c58e16f22a0100",
+    "3ea5de881e12f6082129c5fdc1cdc41a77e749f03d87bac24b5266cfa84cf3980000",
+    "851fac614a39b87f37c28eb6a312802de64d0fccd67555976423048f2970267d0000",
+    "bb41ccd71be1c10cfd395fcf6af844ba5ed72fecd30914b89f58246e614e9ec60100",
+    "40fe67636c51f5c92d246f4138a05fa4fdea0d4a72cfa8a4a4351883495fe5010100",
+    "be38ebc253757da9a10f554b426731a8ded1263b2db135dbf6cf06d8e272cf5a0000",
+    "10394eecd2804a81fbeef749a943e6da9e4a460b3389667c14a69dab57dafe490000",
+    "863a79a2b247654513c8b5537617d81b9b475254f76bb4233be4b096538efdb00100",
+    "c2349420979930d804f1e9f1c010f35d61ea15ab2cf6b29b5458e88e41db5f580000",
+    "46f7b54f2bab2036bcd75b73b4a97899cfd59991c4a38d050833606e81bbb72b0100",
+    "22d8a4cd92f4fe152699dc409b9ccb9745eebc70a6f9beda3b8d1b73995e8b200100",
+    "d2bba27b824c5e4ea6205cd92ad846e9fd84734f96e60ff400cce56de7a9254d0000",
+    "3f258fba427a289982d08217234be32f5e8f8b9a03c669dde7abd1aeba1220740100",
+    "fbd9f429272fbc4492886a88701a7e8b6710c36a9b9f0af336d24b17a9b00d630100",
+    "33315a837774715070876496dcea714af46e0e9ef393b7f4bc1ff920d6d48c480100",
+    "ecd1e4bd125a378f1945cdc1f96959243310e14d582e09f837f4c8aa4c4645e30000",
+    "50dd147007e58ffbb6a929ad6e0c4f7d635bb15cfd3a4555b8aa6f69aa0d10660000",
+    "5910d19f2575777d4d7c23288c570603d3073a10808bcac5b705de906bcd1c8a0000",
+    "d81a63c8978a3c9737bb47a779fb6fcd1033a136df06063758aaea3b79bb58250000",
+    "28fb013e0f3d3257599d9d7154814da332f0730fae9cf2cc6f9dd87a11293bc50000",
+    "08e78af8f3a3d57f29ab78838b21b0453519bdadf93d977e9eb2e68494b8ede60100",
+    "66772c95aac150f0dafa345342c68af81a0ac35231a75d279b9631e8d48878ab0100",
+    "ba1cb4f5d1e759f602ee35e23c3b5803963bb8afb8333b64c807821b7c93651a0000",
+    "b2cc969410fbc6dea511312e3c2d3963d37f546a4e3223a34b81f642658b18c60100",
+    "21bf40c2007c531a97990ff71927606aa8759980b06da858bb984911d9599f860100",
+    "d18f73c3878892f8ed88fb1391924a4d25c70a85f24736d82f0bb7f874c1895a0000",
+    "45442d9a4b48adce07a86c97b333e1d5801135fd020f3b42bf70ded629c9d9780000",
+    "8098819dd4c914572aa94f77f5275db2403b54879ba9702e16d8736d44bfae0b0000",
+    "7b9747c56e6cd8a421d59295f4119f1121fb3a072def9e4e779908e17003244b0000",
+    "073cea9ced6e83429948ec297b8598188b884e6aac1d383a87b467102f0210210000",
+    "b548a895c9ec41aa6b65eec7b6b342580c5e5ca13e0e25709acfd78cba624e950000",
+    "d8b6dd0386d398090990de9701b6fb434c67f8566241824a56f4259b4ba5d2ed0100",
+    "4a2a03625934fb6e5b9d384ea3d1d8a663291e39cbee1718ffbd88a8c24ec7fb0000",
+    "0b2db7402a163c0be78621a3190309eba56f63cb309f1bc85419b345d270c50d0100",
+    "df23bd95bb5c87802ddae68f34fa0e938db5ddb19c2ae355be1b901def0012b90000",
+    "03d312ef1d6dc83caf58adf5766d59851311a1a3d04bc356e11a8be59980547a0100",
+    "7df90c49c02d5405c8ff3b375d0a39065c49b7fcabb3ae9b46102d1bb900c44d0100",
+    "afa0386858a2a6767ca3557d2823f8cbe3158489bd9541072e65e93ad83072340100",
+    "5a0881dd0e1f7b32657691a93a8cfe43ef64f8d774b42903898d6974d2c747b70100",
+    "862378e889377bb9a489515e4ebd33e700e88221da613902731540d59830037e0000",
+    "17e62503c32c4262b7d43db54826c259f5e538aa4d079d2a31ddcbdc98ab1b2d0100",
+    "7b93afe16abbef2aec643a9b4b29498d67081e0ea5ee9f3a763bece2567975860100",
+    "97e4998cf94be4126a36975ada6564b69313ee475649625773d768e8f6210c320100",
+    "f7ab90c791c53e54448c16c8d8ee93084bdb2c92fc26b9b0784bc7a0d5a799b30100",
+    "c118e45231f45549224c612ccbb017db4b6a200482643fed971b0ab7d6f150080100",
+    "8cbbedb09b6c836054ceb9816516bb1b675cf1b44a935801893ff271ba7dbafc0000",
+    "3958c15489fba0c5d810f94f7dd0104fc1aff29d16381bded987cc8d7ebbe1870000",
+    "3d6ae3792290123ea339bcfe98ace33fe83d6096c07ee6db7e1b6de1e00f73c20100",
+    "f9623980e276eaa891cf4f40bd4883c8ee50b4011c7a2c9cc78118a5d1a569c20100",
+    "ae539490c9a1c8845d417665149328e34cf528235c580bbbb40051ba26f879e40100",
+    "acfe883cb977887b0e9d4751c23d117e646f1f471ed591cce4cca32b026d4c3c0100",
+    "9e697a6c5cc30a8e51b66f7f16b309f9d3b5834fc03b0bbbe2179147106117e80100",
+    "b82b225bab79640e920938d8ce787b9eddb45b72f81c076268c3bd78ab22e1500000",
+    "392cc288ce335e7c9f8819e681f2455841eae5ffc8880e2ca2cfb3fb816f14190100",
+    "c9e3660416ec2b178f7166789f42571461bb119c2d82a0231a2afb2af69141f40100",
+    "7b3ae0c3084ebd72ee9afb71385cbae947d7754601987f1e80817e22c5c4aa740100",
+    "301b2c6fc31e6cd2bd504896b7dd4c993a368fc0b4fe840e83ca316648172a050100",
+    "bad7d48726e88b38c25386c45ef68eb3ae09b4ce8ba3ed29d97249d7b38799b00000",
+    "e993acd37744dbbeb18adfc176e99f8d676caaf27a776cd2061baaa030cb2ab80100",
+    "b9ad00e1ff372c8be41dc0a3c8a5092233c3fbe7bc126c9fc0a7bed61eff74f80100",
+    "9175924b9a7707f95e9ab6be0e87644eb0e51b76425ba98be04c11a09d4ba57d0000",
+    "bf926279eeae7bd8a09af00fd494aa282bc39adefb15eb9c8c43a7988404386d0100",
+    "0d44a0c77a79d780677010d5b890bb0fb3762c8ae491b87471ac7d8b52783aa10000",
+    "dbed46eee748d5161c45e37e14b170018c743bbca533e81d1605b8fcd5afe8d20000",
+    "1cd9b774b91728f6fe11bee78676ba445eddd594ecb027b15c9b04ae778c13d00000",
+    "0e286cadb42e8ad6f41a41066c19c12fd3f1992839871c6f43811dd181f26aac0100",
+    "9fa061ecb924f0100a13f66d7f073148c1b1a83539df0bd9da210598690169650000",
+    "ae61aa8c164753a17ed9db4fe43df97e099eccb75d4cdef54394fb53df7cd3790000",
+    "78fb309fa007d6744b50921de006c967dca5e2c4f97604481d519726c7e51fe80000",
+    "3e3cdd08361bb87a5046f51d1ed152b9a21a7285813c5e7f9b1f6232f974e7790100",
+    "8b9ecdbba20eca2cd09f30a5405358c78c54f93a0c452693144a3e7fa7c160ff0000",
+    "97574f984d0c4b9b2b0f9362660228dbb77b799bc3bcec022f8232e37fe4a9ac0100",
+    "29d16d492cdae2ec79daf61f2c06b2c08ed1d90d48a8d3b8801a8fc565faa7ed0000",
+    "80204f4544c9f8633d842b77c6e8eb884bc4318d0e833a75e913fa26af8faabc0000",
+    "00f2de3162a242fe735b6933a9e0c16218e37c8d8b890b8ddfdc72b43df0ee840000",
+    "ad7205e1179d3ada9bc7009da3f8b7701c5a2c805a5241ad3ad50264a7c617bc0000",
+    "e49ca87f9afabfd1f80a08e832dd310e1b4c607d3307bb677dd47a1faf97147f0100",
+    "a92c125d58535f0a43b603be1d85d2eb14428e6b9ecd1e3fef463fa2d4526cf20100",
+    "42fd98a879d3ccecce9a0487df81a9d19d9aeb93e6825473a7d058ba986e8e190100",
+    "631bcda2fcf96fa671bff576d7ad87a85ca9ecd632f7776b226e07e0f3edbd890000",
+    "8133e7430dbb2769d5636a25b9babd12d8b8d387b48684ea7d1053b80cd220de0000",
+    "b1950553a7f43e0ea4ba7f0ae4b77ce3ee49bfb2c6611c2bed6afb199abe15030100",
+    "b733012a1bcc511e38fdb488f3c4198c3b0c637621295745f578a3f3c4c740430100",
+    "4e5b7223324f7d8072679a11326fcbcca57d71ed73b30032b4740b03a2bcf6560100",
+    "579c0074732429084ddd18f02099582e634e5650b8a9f8f544f0e22e8069fa220000",
+    "a3d1e2fc56883e03097aa03ef6b1eb5e408038d623c751b1703e93066bed8ed60100",
+    "91b7b5d554c024496db13fff85383fcbab449a218cb3d4501d7e84d19e0cac5f0100",
+    "c932767c72343033b4c4f9a5c1de6ecfab3e9ad2d97911924f1775cbcd01725b0100",
+    "aa0d6b2579edee90b7cf410f4bc2b8b9d9cd6e9a93b1cf417106f2d0038fcbce0100",
+    "1b05c6c71ac439650cca0c7340ba2a8b08dee3ccc8b4582881b4c27e84204f000100",
+    "c8dd9f5f4c7bbb5a8a94abc8dc792fbb44f025617c2f2d813c38380a198b31650000",
+    "db038cc8e52297d7db9e2d7139baa5821e257aec48bf369b8d550c1f5c1e29840000",
+    "9db4c840a5cad6ecd47549e6b99f81bcc14c110822e6adb8714f78a0c066fd620100",
+    "d51d43c11d8a410096c22c1d34804fc41f42cdbf2dfc9a55d72a2a8d2b1138fb0000",
+    "c9608c397c37038063c93907ac74924f834aef13f1e81d3f32312b096110bbcd0000",
+    "913c1051a3cd399904bdd5947ead19ceee67a8ad12884991ce5bfa77b850bd6a0100",
+    "8acd889752d481a63de3a9a7792304a38347f41815626ecad1539e6b0c70efa80000",
+    "b0df3dacd2a50208bbcf39135dab1d5361bb6cdb3471a4a4e2c1928674342d270000",
+    "7fb9857528df582c38268c5957f1d777d2088c793144b1ced7b83c419059010b0000",
+    "12a22201ca30363b6cd7600df7c7019dc66195da52ec631053b9121c649b55450100",
+    "e397afa5a2c7a0d91d4ce0f7ecd1b390cb120a9aa44f95d5a70992e67ed28de40100",
+    "ea88de7ee1f75b96415bd4f0e77a96b59d99e8629c2d093c6bde99b7d43867030000",
+    "0f7fcac203e2ed4b24e23931a86d1b7f568c7a92af94b6b0ae5e8609765f1f4e0000",
+    "bda623aad8144b6b7643cb2f8bd0ffa61706e04115ca46aae21aae8385d9d1aa0100",
+    "fb201af68446cc403b95a66f22d59dcbaea6183cb8fb4b80b55c1aa15280d5760000",
+    "8b4edffd3058754aabb8d1214bdc0b893d7cd7347757d849bd8be11136d00e6e0000",
+    "fb5b5626b48f105ef5710616d0669ce1f0f3f5e046d21492576a03d37b144a970100",
+    "a5f150935a2975b611a4a611e6116d9638ec2b64d7d8c9c3991f89df40d1846e0100",
+    "55495b4634523e160d3181211bc83f35a03ae8b9574feb64bb44831121af7e950100",
+    "2954376caf1794a6f3ef45ac82850a8d80cab17e08b2655ab046801f3fa7dbdf0100",
+    "5ff4503dc00a9b0be4a83878f3ff15eb20aa06bbf9f16bac08e06374016630d10100",
+    "37120069481ee791fde1488540fcb6606c3a00ba6ff082ff8dc6c3c96bb01f8e0000",
+    "776404fa13f3d863e148ecbee72c3493a541fd3535e8c4bd8e4d4c377def69730000",
+    "98d5d159e8d16a95d31134f746596d103446636ee19eba7882cdde8837a391630100",
+    "833366297ac3947419c569aa390327a8fc3a99bdef8ca1194efc7d74bf1f0a4a0000",
+    "412d181d6b6bec49fab2deeea72140945166007684662353d23c88a81b4d38b60000",
+    "ffdeb02f692e124c6ae41e283ae3f2c5f6e1a5d0d4237095ab03335f5660c4280100",
+    "ed951831e34dc2a2dcfbbc2fa766ad6071d6fa91e353c33bb13a76832cbb79ad0100",
+    "adf43e7c80818cde2565b386d5a5f07ba2df57fed2c4e267a7d2500b111bd69a0000",
+    "56de17b23c795352a590239161cddd4a4013a3bd024785fcef92c2b66120cd680000",
+    "6014142da440d502ba750aeaf676eeed6b4368c6ac075da9280292e2e7c207350100",
+    "475e2c884a3b92c82bf1d9b70f76be09fd9abd9e11a7e48ff4136ed9adafdeb60000",
+    "ffa12080cac8bc2674acc632fcfdbbd24e2839609aa4a47f2e35d171d9a0391d0100",
+    "3d25e02785f31cd48d3a7e888a3dcd81ba9f709aa4af5ccdb4d54f9add9182930000",
+    "d128c9d8e728db227471676a2fb8472d230ab42bc3b1258bb1187c6747a095c20000",
+    "c836e6ad5a8a432f78bdf8d621e1f94461154d8550767cd6ef0932c88c5049730000",
+    "75736d5b14cbc06d72ad0edd68c1cb62984e6406707501129692d58f1e65cded0100",
+    "94a874819652d73d141e89d8a9d17c0a0218c1c849c32f4ba45795f9f155412a0000",
+    "c7026b3d9dc10c1271d569b9c424aa8df99cd9097b2b2b1825995a8c48e1e7b20100",
+    "973d717b78e815fa80f9f0c6b0ac11b9ca0b435e5177415d55f7c9dab9a1ab9f0100",
+    "408665d5f6c99167db7852fd501596e39e5b6ca3d87c9e5b6e30f6ade376dd370100",
+    "8cdb598d0e00f809da70559d47fb79e7fdaf6873c124791b7a43d5637db966630100",
+    "f2272d168bd79d144bf5853f4724e92eeb79d515e92d8a41075ace7ec6bb7ff30100",
+    "ae7b0b58601614f6ab91405112378f916e2ee5d9b99525521352dff184a502160100",
+    "53b022c4d2baea2cedc2161e43aec29210f074bc6f4d4c0d503e829f3baf6de20100",
+    "e973f19143c8bf93ceb4b321b0e8b450d927260fe4d14720308e0ef2ddb9d8aa0100",
+    "3ba9862e2d6c0b0f27bb97ab4d59c853ac9c87eac6618acea681f2dfbc9fb5800000",
+    "4cf4c136edb03cc6f7d67c20bae974aff4f50c6e5540d73b3de4809c4ca2859c0000",
+    "437116ec40efe4080e55c35e88cc0fcdb46f40b00b5e15c6f256f3d0ed453f080000",
+    "45e9cbb0d550af7473b504019bdc23140c351a63e96df6d4fedd4ea59cad6b3a0100",
+    "f3f503e6eb6ce5981ea8db064bba4f834005da69b8080c8b46457ce9649377be0000",
+    "0b20f342966d4b159ac22bdddf698dc371d71862922b8961c27591a8b8b640c80000",
+    "2286253c3d2f423a706264c936731dad07631c3bd6b68ad492159adfa0be20c60100",
+    "8e696a060a86788ce31aa2f9e58047ddd8560c6d635fff2b83f612019578a0200100",
+    "c19434a45b7dc21473d901c1d44f11d16d4d26a141001d3708bdfc20139cf1070000",
+    "9be98c6fd2f303c13e8e69ca5fe5c7b017804afc98a95dc2c4b964d8227683520000",
+    "d3687c8e6db542c31d4359fdf9de1d40e7b1ea8681500e52383c1eac60b110b40100",
+    "60b8301fbe1cbab2bf3a4f58f00e8b8227b8a0fe8f8b6b71696c6269d77c018b0000",
+    "527e7f398ca2fa153dec6aa797b54a029b3c3da5e01fc16da7011fbd4e9d749b0100",
+    "7963647140e3692048959a8a2df04b16698daf520d0462f17d0867b4dbf9d7340000",
+    "9a46dab07c13e6dd3b60112b10e025cf83030e419d574d5528b6df6c99febedb0100",
+    "74f42cb1dda82c789b55ff06ebea14254474cb261fe8b983c545fa9cc441f2890100",
+    "2e1425fb7b084ef409bfcd09d24048a22c291ee3c26185c4158c94bc37d350140000",
+    "ecdda6c0bb5dc94f13e6c81454bda629687ed376a94499c4765d92e74c32bea50000",
+    "d36d0c1a73dd31e6e449954d532ece83ef94edc793d6a11ef1b3edeaecb691080100",
+    "6de408af888848d19bb787db1b0c689cac3eeebd41e52d7aa4e6a70242fe1abe0000",
+    "c7d94d04cbf90a84fa39119006a4e090f5e59887a56299060661d8f158edf7960100",
+    "14d2853c40a5f4d8df1c8eb26885e3e022dc6c0df18995b8a8e797027f3098610000",
+    "1f3aa4e66b896ca5cdd2a586cfc7d303fdcc82059ed326c729bbc41abfe643840000",
+    "15a9ab6c28dee66832553e512b8c255802d65de050e4cccedd64fb6875419d330100",
+    "7ff2748f926afce7edf5491259ca3be629e0b302df728303c141226c7957658c0000",
+    "0275cfb95aaa48b7a401099f2a4fbcb28a4b73f6662fa7bac8c914b3907c575f0000",
+    "84e465c8c417c57656aeba4e47ece913429eb3be047ad33b64dc722435fa21a00000",
+    "9dbf6131ff93074d14f18ee1379788b668546115d5da3e84dba97b9d03cbb4930000",
+    "c72c99f8d10c25027e10adfc2e3a654708e2f268083f4907c5c6b7fab2617dc30100",
+    "13ecf23d27ca839a35cc9da74b6cc62f23c78b22aec3b2d810b4cf00cfd0ba2b0100",
+    "51ba1c71ea7e2f0ffd0fcdb3274ebc5887a1496b9efc2944eef6aff00071f5a00000",
+    "cb390b68ca303bbf8bbbfaddb5fea519906cd4bfc4dbdb42bfa9b024d30a47fb0100",
+    "e0ff2e8418aad88841a30259dca5af83901a733cb288bf0b61c02746ce2098be0000",
+    "7112f59ef5c665bfdf8d8f0c51ee28a4514e1ad98bb44d50cb81b2133054a5160000",
+    "a693c1932b646fbe24a42b7435a63e3a93f0633be50c38c24ede3aaa2ca860b50000",
+    "bdb60e2053f3325546eaa3bcad591238cf5284277f3115492914e525bd0091380100",
+    "8bc19fee3d9f182a9229d6e06f01ca52662e62914fb544424888f8c4e4b19a760100",
+    "3a35f74f7d3868c9d112997264fca57b84e9e0a50204ea3e340471f2b5285f230100",
+    "941f1fefc400c62fa84a43b5a80a206ad354034c00203842f5c5789f9d814a8b0000",
+    "ee7e55330131055e0e5cf5dd934d5b8be79d6663415e3558b394e4234f107b910100",
+    "b1884ca7848283583971efe3279d6be7a919a8e62e68a48d183cdedcc8642f410000",
+    "c56d3ae2779ba318860dd2bbb9448e7e8c38c4bc11dfeca537143f5759e014e20000",
+    "a01c48dcf68cf2d8c6c29c133097efda4103687f0a2b7878b566b4ef111472a60100",
+    "fee7a7f20afbe27d926de4f0ef34c84482acfe7fa5927ae5ec03d0ab3a8432ea0100",
+    "ff5c4464169b5dab96ef80521c56b58dfeab5656657760aae48c5cce43737d850100",
+    "44b064c891eedf3ec178ef5c8c6ddc312fbcd9f288f72afab92d5cc9c5dfeea60100",
+    "62023e7041df2b246d9812d224b63db114c076605a8c092936f4bad4452047c70100",
+    "1275301dd2ca61ecfb3c9dbe36b4c3d10cb73f61dbfe26be11dcf4f4fb27e2520000",
+    "c5ed4cd0c5304cb8a8ad0067c468835d13c8fa5d2c069b9eb719359c24a442c80100",
+    "b01815da89a83fe526164a2f00b21a73488b8826126a167643fff3cc0595413b0100",
+    "870126cb67d9452079cbc5ee681dd913d6ae9e9330478f3c9fa673bbbaf434d40000",
+    "2b5bc529cb4d900c5111f829f6c96e56399adb13d79a4551f367ccab22d818cd0100",
+    "d82f3e09846e84b71231908d7cdbe6a5743875d4a3bef54c2231ed451629f69b0000",
+    "1057af743cdf001e9e97a586a0cdd7b39abbf625c135b9ecf21f25d303faed590100",
+    "2d9820b5d2fa1140e7b3f2db48ce8b16b566dcbe1f1126556da4a91c2cf992ce0000",
+    "7fe6e86e2464564438a02aabcf56d88468ce42b38f2623af26b445c8f5d8ccbe0100",
+    "9e0d4b2168b63dc32158df68cb87c88e5ff1e03efe298c419f96eb0512d5cccd0000",
+    "375d51782d83e111c0b720db68a6e918859f7900ca3ca894c3969ee74bab6ee40000",
+    "9cf607af5c2a295776ed412e4706d8e9f9b1d581052b6dbda93e26cf47799bb30100",
+    "291cd7626e2f67cfd78c67e91270fd45da082150642b127a58c8b72317a4c2150000",
+    "e3520936b2965ba026b6210b3451f166d158ff32f1e4eebb6aa2775478f4ffd80100",
+    "d3c5bb49c1b001b7e893abfe30484e0e93a35d1eb10c2858af52b54a124b386d0000",
+    "b7e2a4ea792658e690b59df986c1d1fb456451dd55e3951cddc37914a2a2d43a0100",
+    "8a4ca7a75399e842d3a74062494719511faccfbad919871677f822118f20076f0100",
+    "89bc9bedbe335969cca1c691f359991885cd869d7abd51c7b91c724b54c3f2670000",
+    "213b476f3909d81d797ee3053a8d7fc07910230f1b029abb9d3e3a5bd4c80f380000",
+    "b83bb8d1fd48028e31b157e892ed478d3993933aa4d2e717a92bbd82005757250100",
+    "d3fdc7ac2312bd807622decbd84a8c66ca1645a7e55a03a299baf9b5cc84e3110100",
+    "4b467520b1edc0a47067e5b1732ace143d9892b7e181c22a6b2de530c7d8459d0100",
+    "c994c01e94d6084a03eb6c75cf1d7d69df30dec2241c2bf74035b808613935410000",
+    "4ff2a58e121d891e080811986a1e38f49ecf2a83a27863138a85a62dce985bd90000",
+    "0a0fc0505e6839cdf7122263f4adfff87b5b91410d6fad643e19e4f754d1568b0000",
+    "e74894393d21893f9f7f399bdaf552f36ff350d3393af095b2b3421d3efc2ed90000",
+    "02f29cfa9d4b9b32d2706727a7d1d1b7a4466510d20ca7025a5a1172751f27b70000",
+    "e59c767743fe6861c0cacb755abc1a3d08bf92157aa9b781f04fd4a29095b8820100",
+    "f5e276e955c01cfc87fdffe6d6f389fa7af91c6d1bfbbb4c9b2a86259fe9af0e0100",
+    "5dcbf4c928d73d909434d3ae5d493330cb76a0c3804b2310b08e5b83264c55fd0100",
+    "eab73b7c6adaa906f7dea05f63ed1e7121a031e3850a91064edec775a92098a50000",
+    "675ec66ddf8d87afd729fb746f6d5b30637d5f4a169477ec2154c3e28cf2e8430100",
+    "97e7bc42fc8ed2f9f4e44dbe4c3eebbd20a64a6faea4006482ef6a3064db549c0000",
+    "3a7693aee3165e11551cded830ef0583d1fb44a06edc5ab7411adfc4d302296f0100",
+    "0fbe30d6e1248b81455b026f01ce93fa127e7118dde92a9c320f348c7a0c19a60000",
+    "4badc91f6b3c51236c8e468e5d78a1e3d5fd4dbf5ae9f7d6c91db1c64f8dd4a30000",
+    "f4216a56a1ad9063254fb2f19c3fd8c8779027add89758e9922f6a9674a36dbf0000",
+    "c2d2c7c6d812f2e2e04f92c816e5460b627c808fbd02a5c5c41797143b16c7af0100",
+    "fb2e0799a01ee0170dcea77654adc6661487e2dd4cf8e05cb2d62b30572a1c950000",
+    "12568d786f1ec5813af0e4608226c97bea599b543bb44dff2e601ea5dd7d355b0100",
+    "9a3ffad362ddcdd788da94fd44cae82c788c1f62e8a592e16e27e31cc0d2f2ac0000",
+    "432d3a7a5d129000596be8f16275112d0daedd25f27fcb997e8c98a0163a83270100",
+    "975d22eaafcdde46c77e4e6466590ce904bc3efa54fca27e53eb1643f10ff5c70100",
+    "1d29ab565945897c9a69dbd6f60691808e56142813ee0556c18c0c752684fc510100",
+    "916f49a3d485afec8660babfcb9686fb1891f357e8ff524a9c64af0b7e76d5cc0000",
+    "aa6707b7ce06c49fe2ea320bce85a3035d20d06bb3b6dbefc1386e68d6f52fda0100",
+    "52c8348cb9bb04b54320eaee2ef650688865bb49bc449530e9e8adb781aeb3660100",
+    "46b9775283598f60a31aaed662e8e66d1c42e1cd52b3524f82c7c744e4ae92cc0000",
+    "b7c47bcc4e99848839f4f1e446e4cf999573e1ef891d8947f2f5aa72f6bc63ff0000",
+    "00fddf638be2bc1b8b57fd861f534857b61c732808b69136429e9d5f48a326b00000",
+    "86b78986175750b50dbd587d2fceebf273170609d67926a2e91a2ef7ac7be9aa0100",
+    "e48e4d4d95de0dc1ad7362d0ead6e5ec52d3090d5536e3354170560781212f840000",
+    "5a408a483c5c9a477f9ec41b73adca8bd11881febd439f4d6d33113c3609e8df0100",
+    "ef12366fef37d831458657bc133da663ae24fc12aa0ed4d881ccbbdce13d00290100",
+    "9cd5ff6d46249f9be76aa5918ca01953fed368a64e445fd694ee45ae26d2ed980100",
+    "e317477787731db056666a301cbb6d1d9d801e7a4635e2b405b5b9b5523cab480100",
+    "92dd6b08dff049bc303b9725edd83c0a27d0fdfa9286e0e32c89fc4ed5e1ad7d0100",
+    "a9ba1ceb15b1d484b51de5c66574dc6761903eddc6e052b2707ec061405253690100",
+    "fb86dae50921ae670bbe5d340f3460820686c9158bfbb340d3add3ea384fb9800100",
+    "cbf07c1f86d7d402d9efba15150e3a23b92a6428aa3d2bc1e2b016e4ce8551260000",
+    "afdd3a86fcd1792f0cfb1d6b0e5f37e163ba704b30fb266783688474975d79750000",
+    "1a64df1990e9420c104b0da820357a1b5935a09a923784b64cf8b58b17ba291f0100",
+    "723c376f5198fd4f62b89296381224dc36cb06745d45d2fa981958c06d48d43b0100",
+    "7b55321320d872a34f30b36e0657246d9663489dd912a51400f52d67fe03c7ad0100",
+    "7ec6d303935ed8a672da3c4e42d0b598fdc3e5f36bbc96261be0cb246960c5ba0100",
+    "a5fc2356ba396d37494c8be56b50f72e6d72a15084973195e08bb4e9bf1402fb0000",
+    "faec757ea971cef299524a27648c44a227960cb95d3b24592b7dd837937a4a540100",
+    "cc5ac16d1ad6b5ee4a3774300274c1eb6356f75bcb7f8b18b07e10375f177d690100",
+    "8b9c29f8510b5be26f3b8b8599152ebd337593d49ddf12b0c24c894b1879688a0000",
+    "e0b64b567985b925c6229121749ca71471811e4a7447bf9a7284b417cade59ee0000",
+    "bd3d278a3637bda74e4e37b08f439779aa5f75e14ccdfed9d3c255df633870c40100",
+    "7a670fe891dbbbf6ad1fd241f63561e48be39bd5d147abbb4bfee32da7a315220100",
+    "191b30251eb615cdb8c1318ce99c19fcb8ff8923d4e03d88b8bec963fdd0ae2d0100",
+    "1ba4b46d2b9f0a255fa7d56882b95df685c81f16f65d37b92f4aee904965772d0100",
+    "6417052a6e1395b502a51e94fb99d9367e297f67726f728fb40f4e6405995c390100",
+    "cdee97f48f30d44861d9d157f87a16b17fa8ae080cf6846bb9e488c15f74b48f0100",
+    "e9cda9587e7322264a1c7056fe3b17235211fcada2b3ab8efd8422fe472d841f0000",
+    "fc8d99853fe7ffefe618e67b0103cbcaac54546ceed9bedf561d642996bbe9b60100",
+    "797e5b1bbef3f7221d5cab20821204eec2f90a39294ed2f793b5dbd42d2ce71d0000",
+    "4ce9325c95ba2fa99194b9362d71a28ab7327d2ea55907981d4c06c80d34c0ba0000",
+    "c1e4478da08a499f2459c9d95cb93e58f2d97aace3dddfe7b0e4d45dfb1095ba0100",
+    "34f186773ebfd72335fcfa94fd835b464ede52ee10410a6dacff3612a1f8e81d0100",
+    "41b64c9a832066e4e13ba1ddadc072f75e278bc42fc688b54815fb3ed0206c440000",
+    "3796580d496d3388cfda34811dae091f75aaf40a4258c2cc844b10c480b7e8980000",
+    "b807e4dbf064ea448b86595db101b9c11721869b6aaec0079be0fc8694ddb91d0100",
+    "96b7b01cdd7104bb1cf14a4069905d3a53b6073e96aa13645f955d249b1d13120100",
+    "31b4094ba42ac04f335df8ffee29af2fe2de9e0101c7f5ab427136435111e9380000",
+    "1cee8f68752a4a6539aa7beb9d494cbfb7cfb4c982113efac9ab2d784fe56a040000",
+    "c49feacab11f19b8ca45607572f4a881b5486d7dcf6ef22ead22c5624a0fc5280000",
+    "7288038dc188d86c2de9f24b50176cfd943d4a70146ff4f54ccf77b38f5cf5ba0000",
+    "0e409b37c7e2b4d007e6f594d41f086dc82d4f1b24cbdc2c81b58fcf8cca00810000",
+    "5ef0dddcbcfee0271e88e8c42a409d966d12f108657209c338d0644a4fbf7d8b0000",
+    "577c85d2aa697bd8499f0934a67fce4604692c5c7a454e700c7d6e42167fbd750100",
+    "76c615a10c09fb9dac15017d97eb119d47a8888eccaa786d49372d13a67ee8200000",
+    "55b131e6e0af8e31250f53fd280710401cf4c58a674e828383acfec2e63ecc2e0100",
+    "78807e70b1f53ccb61e97ac4406d9a133747a9d56f5b36243384c27b14a886530000",
+    "5bfee36d295f8a05b8fcdd3d7d63dbbd6696bf33927ae2dd29fe9b929fafecdf0000",
+    "3698de7b21e7c8b37f315c532167653eb1dea8d944d1dba3d2f221d4ae8276cb0100",
+    "756f68d126f0adb1d39c1d1f67443c189d88254f3dd38dc9da5430d6ac5bee620000",
+    "60454b5a02eb72de6e3f46e427c223d4530e07a370a9b6c2db7c42f9a6b4a9c40000",
+    "07dfc9a82cfa37ad2bb0b44a157b0222a6710aca8fd024635b1582f8f6a6eb260000",
+    "331584d5ae328321aa895c19b20fb1303f86f433dcaca55effb9dd07d26e6a5e0100",
+    "205143f528745e27f73753344cde32a441f82df4df9b06b2252447213dfb84e90000",
+    "96ccee90691407e04afb101b27debde28b69216cf82e3cd80a22864d5403d5eb0000",
+    "4fb8f97d2006742db529589151009240a98562fc2d40dce7621ae964b06b74930100",
+    "4d9c110b727943a33030b335d5ba898c1d4dc1d4fdf6212176e09d0c8a1f236a0000",
+    "c3d3c7e74ac5cc4042ab2b1211f2f4197f51f80572ba7ad8e197810cc8a6dc560100",
+    "7e60501867e84ff6aa903f1a61de0ad1600d4e16ca89f0c39f38540f654438b20000",
+    "859456641c3a1afcaad90ea668851311b2ae5cd0b7cf9207b0d5db441f3e6eb80000",
+    "b768544c13c951cd3764731fc42c04066bd8d04da89ab015625db3b7aaf3a0fa0100",
+    "e04882daf1be558a2a0121beb5d3b9c08fcb13fc01751bfea112165e686c10050100",
+    "32cc6de2f8aa128b1d2bf8ec176fd95719a4255175ec616e053ca850be1e6d8c0000",
+    "75f3f2379dc67c390d8a64e7a95fc34ac1711dc1acad5fb0b4b5838179dd84030000",
+    "e70176a6858b7abbd73d1780e8a08f12feba488c8e9c00e8c92055c97d628c350000",
+    "de8452c6d07dc9fa0d868ea0335562f39f898879091bd15314aa49976e3282330000",
+    "0ebcfdb0ea7f8a0b7edd5207dc5d3e9a519a8de184b0f3a8c386ec18a4aa5ee60100",
+    "1e58df43f051068ca5b58ae2a8485509db822e6d7058468e985d3c5ce34e3dee0100",
+    "73ebcb1ca5921fd146464e89bd253ad721e3b41cd4a1dcd188aef0e833007c560000",
+    "0933469c072f761724dddb80810a9e2bc49b6d3aa90d5b6fe1b4c5eb463a40eb0100",
+    "6275961b60d98917b95bce8f2349e77272a8f6a85890faa37d573e8a7934c3e70100",
+    "a13dda066a8f8127222be037344b6baf4e013ea3d01e44445397db94206a4f990100",
+    "0bc4f1710aff695a36c90869f3cd404a1ab36a08dd60d1a35843f299d8c556060000",
+    "d90b9a064c9f585101aed20d3a37c34396cf19e4d7e0f6c616412e072a422c220000",
+    "aa279444a74cb3f096e334601d9b320c25885ccc6e0f8dee0de667a4fccc79650100",
+    "394e0a96c9bb7097e2f6c3820887bae03707b5223c5dab22c8c9bdb29153bedc0100",
+    "d43ae6fa29032674d2e19d670b70e88ae8bb15fbc608c4ecd345099a0ff10e6a0000",
+    "dc680f244a1e222ded2903453a564f59fbde18f16ee4ffee6ab098108208b6330100",
+    "91fd13aa9d5a979eddf6f9f69fd1ac7bd318979db56420f4de3bffed25fc157d0100",
+    "cdfe28833c67a02c38fe40557cff61bfd31e685c43e00487f1ac720760e344040100",
+    "3cdb282d3416853c50fdb3b832fbd81594b475a7a5b1caa879ef7ec31cc1c62c0000",
+    "9148cd51606fcf97d4bbdec503e1899e4eeede8ec2c4a6cd219e3436c82e45ec0100",
+    "bed5618fd2158ec43323aea4dbe395a559fff3eced83933b66aad9b6684bdec30100",
+    "690e816a27ecf1693cae16948e318cd5acff09ea9af8c7026ef7ab4d2b2519f90100",
+    "ab55198242154152a072f636adef80fb8c503b6b2cd5922cefc1d5fa9b2e81810100",
+    "769c050e3ea17c74067d8a8db1c3dbae1cae6d131e3b4af92341a38873986d440100",
+    "885a331322033d0969163256fb46875a19f576a632a13e3bab8829a20179a0b60000",
+    "d6ed425692fbdc686e85f8cfdc3c75dc033be5d0fa0cc2e2565d560a52dcbf0e0100",
+    "b40478fdb03420bf418f5aa227ffba634c843141b0ba9cc37d7f6369e022b9880100",
+    "a3bacf007b21d992ba535247da107bd7c0a05e988004c75720bc2abd7c6b6c7c0100",
+    "0726cc8a2fc96bb253814c6a7c57928ee8ae5a6bac33488eacaeb8b78b0db99e0100",
+    "9d97645a8cf262bf5dbca9711eafaf949456541707f9f5b0577f6622c750d04d0000",
+    "fc523fbe734460cc5629145e17c852d3b2dc2c5ee49518a07e7d9a3c3db6e0a00100",
+    "23b2a6f0f63c202e83ff288091368ec1278dd4fd132ce5096e9c34c7eab778ce0000",
+    "85c25615656831a6faef2a8ba1515f8dea5e62089b89a4f18ea3156254e1b2730000",
+    "7b705ccdbf787118dc94b2c12ef908eae19dc78e03e94f426cce7eda9a9e63070100",
+    "a1fb18d1e5aec0d934f03e8b086a3a11bb9d9a91ed8252adde7be46bde27f8cf0000",
+    "74c2cdc2534be3deb781d9d91eab2530f46a973975d3ef5827808dfe165f39410100",
+    "2614e0e5b91731e0bee79cf4ffc939a8ded2565f9384a1d6b664a89570e4f5690100",
+    "e5c3940a2c4f268290cbb0ee962f83886713ffed8b494ec9597268099f42d80f0100",
+    "3db6783b1bed4dffe1414f0eac824a3d49dafcafa1b2713f3a94fd031f30376f0100",
+    "3a4c9e1d5c3fb97cb11fff587acf64f8f10e798505c6cb029a1bc75eccb645060000",
+    "794c86e7384b472833d10d67cb5a7c12cd677c50524ac957c0d2b9cdf638696a0000",
+    "52f9e127e52c43649b02e82e5cd2fd2caa777959bdf3e5d9c160038e6b18a7d00100",
+    "5b5799ebab64f44024fb54b74ad6183b9965470992e0fb6a2357de02c39807040100",
+    "f89483f0d4db19897c2109a14a6d846e5cfc8d3961704aaacab975887f066d570000",
+    "8ed635dbc78b3da12daf4eb4996fce2ef033311e658104e6db23b7e31b1e64c40100",
+    "92e43e7fc06d54e58737769156740360a65eebdb510ae24906f588160cc201aa0100",
+    "a04642346d01d5a7f9442bb4dbde36abd4cdbe2f94f155e9c76fc36a2b92bc970000",
+    "2ab21f1ea63132a7bb055d0bf5b38002495312c49fb3247ddef1b367d87263e10100",
+    "d2cdb05092889117b41ed9de2c9ad0d375181a26db4bd2200b5d60a44296499a0100",
+    "dbfbc90b7342aaab6ed17ccf21796748518c3115950ba90bbf4e61a1efb80a7c0000",
+    "d14c85223367df52fdc67a2ebfb20880beedd98d690fc54f01160a2189b1aa410100",
+    "31763ac564f774f3561559f0dfbe3f16cc98e01d4063d2e642786e6ce3538dad0000",
+    "1cbf2b6ea4c6714ffe6692eb945e6608c5f6372645cf58cd75c5c39bae2fcd480100",
+    "30e2c0cd142a6f237f905a89c21a0edaba34b1dfcd041c15dc4123bf51bf63870100",
+    "f29dd9e1961ab4f7a1d8002bebf7e32571195ca6b3ea2a7c69e511c58e5d2ebd0000",
+    "93a32c13597ca3bc165f7635e6b7b08e9e14311145033a35d6030ada9bf78edd0100",
+    "bf4502736590551f30f8460df206ad24aa5896322af7b73902e7c076f7a01c000100",
+    "355d0a96097f40ca8bcabd135ae0cc9a2635aff3fa7a6b176a0e5fe30e14c41e0000",
+    "ccec864e7a16c79416899a8cefd191f6e8aa4a1b886b9a03e19677b35c4b8c180100",
+    "e735e52ded6b58475a201319d1090b01942d8190ee5560554d528c42a726bc340100",
+    "9a7b303277d72f2a4642afaf79ceeb5aa09f1e7038ca332fb19efcb37ea8a8f80000",
+    "9eccf906f83795d540ab50943a196b7b80b5e4b840297be8fa518791d9e87f0f0000",
+    "b3cd20524438973d16072cf874997d021fed43f643c89b4e1a5178af293c82920000",
+    "692b23d9b5382036036fa582c5458057da7eb7c1a871406f29093c1aa2fde52d0000",
+    "e5b6ba2acd22b09e0b39a49111a49ed204a98826cdf30ebaa20dba33436735ba0000",
+    "eb382398fece7028d9f0f3599a6d00530805392ca4f20bb1f83abb7d16b5cebf0000",
+    "a5768355c5bf34bd41ee629e494f335d9ca19896e7ddb48672fd19dc1a9d99b30000",
+    "792197d4c6c7e5b226283bd75dbacf904abd03c3a3a394a66b574eb69ee61e450100",
+    "437f6849c551d9dab167dd07a7f5b115c39a6480958aa94ffed1e04831bf57ee0000",
+    "6ab5962bdfa78d8a39bfae5486d1db25a848ec421725ac14750e92b5e1ff1aec0000",
+    "1e86b7b9af1cf401208420cb3a7009d4b1148171ab610b4ad8b1c17d39ca3b9d0000",
+    "826f781865eeb8d556ee86082909a3f8c87ac10f5e91f66b0ee80271cbf0d6440100",
+    "77fb6c44844c17a582804b26d52c1aefd7e014b2f6a483b89202227ba60cde130100",
+    "1d02ba211f2640cbf7a42e43cdf44c1ea08e59061d4ac662cdb039061edc38fe0000",
+    "5bdf41e83365687b4667a39f764296099a8422a78677a12cb9ac85996037f0a70000",
+    "6d38e1ab4c91f3a64bdfe2fadfe0cba875ae39a195ded238083b3fedd60ed9a00000",
+    "063a818764f91701be9aa7c47134dc07bd3377aa0b9489ea4371acc2c98281ab0100",
+    "9c8d73560820d2ed16ed727e0a2a595ffa2da92d1bdfca18ca90b0a6b676dd710000",
+    "d675822833ce036e080e7cdf8e1409cf4711f086732295777644c5140b6a43000100",
+    "db8e825be6a6f17de7ca41999011e8c10bcc0a43714ba883e36321f2f35fba6d0100",
+    "9a75bdbcfa8803a6cdf55db4c3e0f429ab6874da5af776014f6668fc38ee76820000",
+    "e94976d70c43b67387ad7fba2f10a35fdcaeda67a247e143b17d0402137d30740100",
+    "24592afdeca79ed5d4ba12b34b9f0707abcab7022bae9d4617746cb42dd20c850100",
+    "7b6eec4b8e66aa9d9da4fd7315f73ffc53587f754fdec6a53f60e045a1fe62060000",
+    "935a8b73f82652050eb5c1c4dc666e600eec7c267511887cd3dd7bf032d4725b0000",
+    "363c133c0c60d427fffec231560d8eda1516cd68c67315ed0f078c6be30867610100",
+    "96a56a73e7cb57f175743f665e671701999d206fbe5812f6e0a2d199cac6c0c00000",
+    "c5c13daa9b0b7e51335ee7ddb15c313100394a25af6aa760a5dabb1b390f02fe0000",
+    "d924e440e8e9f806fa6abf6e0e21419a8eb25021fd70a40b0b73f9073e5ae9310000",
+    "36fad6480a0289fcd356cb04e5f02f63677fadbd226442c0cb30880af778b3c70100",
+    "07c61f1d9e6bcc1459c5b039d8b5bca56d32bfa3416668d5956c6bffd42645720000",
+    "390718c655c633ed769ebaca787f2fd43ded843621d6d3f605e6aed56403e6910100",
+    "249d5ac4a7c29c91c78ff965f54e6cbf7424125c46cad6423ce8ebc8c966a4db0100",
+    "e05d6a0dd7332ace703a9463690e79b0b8bf54e2d5b310fbb48235e8199c13b80100",
+    "488b8c3f3e3fb381cc140ac87499498023bf69bf227ff06601a79f2c0d3d1be20000",
+    "f7ca29db91eccc283311734566446dd8514052c1632d586aef60a5c1a4fdfcb60100",
+    "02871e2942b4182dff47abca548bc10db474a4ae1494c7c99f4e00ce703613e00100",
+    "d78e4c59d0e84838f1794b193e0df2a5812d2cdcec0291f51d8fb7e1dec516560100",
+    "89e17a390936084b3c18c31ae2f0d35b5866e116db8392f4d47464a3d02ad8660000",
+    "9f2b5e01342a0da210df53d0cca4d7969f3c22cbfb9ac23e000fb2a158efe11f0100",
+    "711e3530f6de84159e6f17137727b1b8be12d56765cb35c4f9b4fa411e636ecb0000",
+    "a9bcf39efa7ed067698fc9d766c08da49e9e27bbfff69815910f43251fae804b0000",
+    "573be8b356ae38a1803c013cdc579809d23e94348e5baab54515d4524f198f920100",
+    "b8672987a8a47ef77f29c2266310a28a1235d5d2ad40f8f9b38df3af93836bef0100",
+    "e56942596eccccfd26f2a637e8c366806e3fa1b9c60e449f5f22b25e870cefeb0000",
+    "02dc4444c89a08aafcdba39fb84c7151dbfa29380711069c6abe3bb397f83e9b0100",
+    "b02fc92e90d2c1d8bafdbc5eb90ab8bd56bd355879fc4c472ed1509294662aff0100",
+    "41d5b1f4ea2f9bc7d604dc60fe342bb17f9ba4a242cb79694424f198b3d0dd410000",
+    "049799f338521bbe40bb2cf7f12837904042a6e709cc355ad782dcb220d6ad390100",
+    "ed2358c6bcafa35fed738d29576c918cdf4bd64606a071c5893ab55102b422aa0000",
+    "ef7c943b192e735d427e8379f835959f69d9503595371a19010a4c6fada0278a0000",
+    "76b80a9efc1a6a027b0a49cc5513a6fa24bbf78fd38c4ea7ed072af8a74fad930100",
+    "7b5ecaf092329d2add9f348bb3354ad97bd1f0413e939258520e2cc60545ab7d0100",
+    "beb3206c4b80ba630f2883304861f68e2ec8039a202aea0c6aa721a47775afa40000",
+    "e3ba4cda1f82cf39e0d9fe1802cba85f0db0c5d66b94aa011262bca4321970c60000",
+    "5d17c7cbc38e321b96a3ecf62ec89b7a84164d3836ea2041d5f1f0bff6686cd70000",
+    "9cbf3eef84f8d24a49e2c8ef221f5faa737e47310ecdb509da33c2e1e00b13f90000",
+    "11a98e570e19f0d269113f98066d1eaf07bf04ac9ce17124afc4cbcb276520270100",
+    "748ebb39650b0ddd74edb95e3ebd2694931a9b289591138429314cad176e49e90000",
+    "813668d6012f67bd26d013488e0ed4e2d362d7bfcfd89e3addcb1d5cb486a40f0100",
+    "96fe1bd36bcaac01cf27e83cdbbd84a899e8a947a42b5bf65f7afed835d486530000",
+    "35c333399edbb47d531ff537ff8acb9a59d546af9ed7afd19ee920da697fcec00000",
+    "af0cf60ba10c75c0b96586437845b6c380474b9c3b5699bad66638a4b2f54bf40100",
+    "50fb2e136a1337b75fe0ed5d53201585bb2e7b103b6dac377b6a1946ddaad1430100",
+    "7c089d6be11192489d87b855865ed047b34fa4ffb5ed417b690851854685882e0100",
+    "4d515eb5fc816996be142bde1d4af9834ab29d8a9d2971218ebc920f2ca334420100",
+    "fb3f9ab4f5c0ec718f4ddeee90a79ab357d493dbd3ae00eeffebc299295b347c0000",
+    "f176b1837e7b6866d1aa1d9a3c4fe4c3a42a7116cc40fabd39e5a2817f24ff820100",
+    "0218e66ec9c077ff3711ba2ea0201cc3d696ec3538ccaf0f1bf8a340f9fca95a0100",
+    "fcc53f66ca4890842062c3dcf29ae6a0517a4749935ad8edc9d78517c6f84c5a0100",
+    "b1977b42038fb2ec92b305704609afdb9dce308159b3835bd39a0473348281910000",
+    "55c7c443940b3352df515f0993f18c8627b961f35f4fbdb0c1fe8461f763632f0100",
+    "b604a080b937a8af45491cc64c12a563f876c0ede237c3fd0d86860b8c1c5fb90000",
+    "961e7e0195e682bbd66c313d898e7ee7bddcb77351c1501d738314eaba5f22bf0000",
+    "87ab059f4dc43d8c878ddaa71252b691476c2f2542b4874478f9ed957afc13460100",
+    "35871811cb46a3435ac2b91561f49b0fc02c75fcda1f59e65b9d337187b534180000",
+    "1a7bece9459f6cad243196ffc007b25ab6ac3714b2dd000ebc1f9937940d47740100",
+    "b25c982e8478baa2e2ffe4f831b285916551400d92a56c7098209d793181d5660100",
+    "b9d0ee1309e422b2194ae69613a68bf064763b4ee0f3ae1d5a45096a43642da20000",
+    "81adcef9e4308d47f675c158ea838ca343f8d850a77e1a89104d866df18a981f0100",
+    "936d655e404221b72c470a8efa419251bd272f69185a4c0c0dc2469d4650876d0100",
+    "6a495b128261c3166d78f6971ef7019b0cce7cbbd1adcca77023f0284de143640100",
+    "21256d08643eea2df9a568147170174d747c976bebd44e9d7a0f1442da54e9b60000",
+    "f24a8c9b8b0b4b921c1216fe8ac7e79f6857b85770341d1575f079b118c5ff460000",
+    "af6f8203845047419dab601c17a8a70e2c01e0ec842f0804eea6365c8a007b370000",
+    "859627bc1c9192e79c7d674d26080566d6a612fcde0d0053880f73f7db9621450100",
+    "db05c37e84442fb81c773b6c3eca27f1e994097abd44839c3744ddb38b974e240000",
+    "3996a6d65eaed5c743312881cf584035865d733f1abb84abc424f17b29dbb0cf0000",
+    "06dc0ef3b5534857081c8cfc2da2339679b4887a1821f356c8bdfce6e07750ec0100",
+    "b568a9d52b5d064d6cf003b8af54772f8ecc8b916d2fa5ae43339265d6f366910000",
+    "c353d0d3d84948e4873a833dfac4735fbee923baacd1f06249ac635210a14c490100",
+    "145d535df9c94b33d54e04321aabbdb8b79bbb3f4eacb958b9ca60466bfb5ba40000",
+    "837c3a9951b79dd9757af8e1237006f7be7f1a30d6c0eb36b2dfb1f7dc2cf6520100",
+    "4da56e814b9ee7aa27823534ecc7006d00e96dba2e9ff514ecf9af17c49812c80000",
+    "988d72cb36a983bc2f9ec5902e4581f0f4e5c65a88a5e005fd0b4326280132200100",
+    "d392026368dd54856e08a377989e8c8236e6d65a6f0c9d36ee2a14398492706b0000",
+    "b196b6717b4eda362da476a3afec9eaf68d0b4ca3c3997e5eb452f461e5f82290100",
+    "0f2260eb2666db6ddb655a355fc8f81e40d6e76d7ac6b67d802360da1329d3440000",
+    "92d35997d2ab92f1cd41c1ba5e2dc926890af02d1195cd5c90b72a2a9f9092930000",
+    "44c31984b999e04284f9ce539b269f4792bae44a21e64d040b84ef6c8fdc53cc0100",
+    "6cf4f31d59b511ef196af3ad7d38112f550abf5026883d2338aac6b58c73b7820000",
+    "7142011a6764496c1c8cf594826ed8421e85f25f7f9fb21e40ba9b45749670620000",
+    "01624b3dabed155a46c919f19d7043ce5476d7cebd7426039061af779239eee80100",
+    "e5d6e4aa91ff5f631375f53c0c329b9bbb0f91ec5630cd9fd909590d478d84900100",
+    "4d7ab012954e3fd467352343160e070083afe487a9dd4781c298a4bf4292553b0000",
+    "b84ac83eef6c44a2099fa3ab6c0b2d9485a710ebcfcf6a0a51799a48442ed6e00000",
+    "32904abd0fd7f2549415be6114fdde21866b0ae9ee9c1efb5beb2b80539b362d0000",
+    "c04912dc38ca664cbf1fbf9aa50be83fd7d92dfe17a10d2174b0e8065976670b0100",
+    "0f783c4aa6d7fb745e10b89753d91956e72c692c0644091e6fd5d7928cbef84f0100",
+    "809c5402395c2f20ab61deda72f168525be6fc5c2eaf775ad77ddc98948651e30100",
+    "68554f626f35c18540cdbe58ba81e908e650a4a5c4fe4d29ca7b79ab6880d4c60000",
+    "eb171331840bd1710b5d643fa3a66a8c7f94b1ca52b043c86f5698a0300dd4580100",
+    "3799151ea5f681e5ea64de8d0a799d349da7ec60587d3d5aa60116e02b8d79cf0000",
+    "799275992307844b87a79cfc47a1433dc07abba74d48e81c8a325b6593ccadf20000",
+    "ec08f20c4453ed82efd9a6d0466e5a8182933ddb05775d1b49f2c21a80ab9c180000",
+    "6b84aad22ae70fa0a99c6d2596822c0b40a91f15ea12a77f4ef957d1f46a7f710000",
+    "f725f67eeac2c25b3f0fbfb70b398d4cce22e7fd7524096d614119f0f7eba8200000",
+    "32c55d109bf616756d61219a1739bf65df8988d57f50705f6486f640a09beded0000",
+    "7ee0f0a0e8bc68c7ad2646f827dc877a92764196c441d6309d5636936d3da4160000",
+    "aba34a5a6c960861fa1b600d2b388149ff00621ce2df6d694b03ffd82455c85e0000",
+    "eb7d5d2d8f8519ed92107f8d6bfeca753746aa48db18dcc5d37513ac1f9a2b6f0100",
+    "7dcd183ebf3b455875af7ba7bff4d7c85ccc4d91ee788eb97a145c4d8f4cd8b40000",
+    "c35c0633218889308a520a2e7b7ca5e4fd4fb844bd9fe3cdff3e1bf0e19a6b040000",
+    "62964a9bfe3befefab7c4f7f61629e7703f3fe26954d5365fb1acfe1f5f2857a0100",
+    "d44233faca3913516876e4602ac4b283f9d1de89480099addb0b7e46ea6caec90100",
+    "f3b2fa76747c65e91f26164c29877b6878a8cf0cbaade3b837322b3048247f980100",
+    "7b6688decba7dd1e5dda04af70e0ee13b760dd48b65c8a94ed31d2794fc3acc60000",
+    "58e7d4e3a71ca16e6dc81620ee542ef5c04a668bf430f2b963572c25c3eb53fb0100",
+    "8dd105d99e15dc9fe7a73b374bed21d3c600f36f287e27503d9a204633f2f94b0000",
+    "81bed981a4eace6b9af0b68441eb61526bee9a2fbd6c3ec445543e4079fb98f80000",
+    "66d8f2421c8faf06f2a0cf672347232f41a3374a7dcfe09bf4b5bfff5d975f970100",
+    "800f7f5261e065efc4a778182847fd8d925a4b7ff6e22b9fc064e078e80212f10000",
+    "b9740473a09b6d8a3f29330af0cc1fdbd43782e362f408536671a807d9b636f10000",
+    "525190e17932447c90ff25e51526208c88f9826f008249a8cfff2118ca81f7f60100",
+    "a2eabb2b7eecfb8388a565d2e28f4ef8b26b78ae5c9fe4ded38c08598833bbfa0000",
+    "fea72a4010e72e1b20c52976644811fb4c3a0d97707103ae976e3ca1df79b9c80100",
+    "c6fccdc3e394a03c7a2d3edb493ea07008a918361ca552290d62ca47afa9ecf60100",
+    "dfb8c14056a230511ddfd8ac834fca7f649fcdbbfad99208df0a14033c82cb8a0000",
+    "7db338dbd3996a212506334692531d923d5bc23bcb8b63c50e9ce7c04ebbb2170000",
+    "c65cf450b53be3148a538713af65771f684d478b2730297dfb3d5aeef2dfffaf0000",
+    "7c70f5cf097d5b5051d6727462a3df2c139419dc898fdd487c211de75b9507900000",
+    "4aaec97ce2d10c965a9e1780108242240352a5b59a4b7d201751cfc42222b6030000",
+    "c8a57d544ecdaf92b65cb605f303f82cec26cb2c51eedc1cef989e8024bc3bbb0100",
+    "3fd463cc32da098071f284f7414b3928f7ce6c00bdfbfd3d29bc8008bb6e75d80100",
+    "bef863aa14afe7602526d136b161d5c7f0d418cd44f58d0852cda9df7ddc8b700000",
+    "51fc6bb8388eef4cd28c9519ebfaf07445e656a128f3871a40ec01c19ec9cd720100",
+    "0788067bd2f403a60314799c0898b584e4614b8cdffd53969fe8a51f311ef3cd0000",
+    "4befe66728dc80557d90d246e1751d6e42003d77032a915035364cb0576ae8e10100",
+    "99d724b9c597957825d7e387ecd9b346c22cf0968f1055afd24a978014291bb80000",
+    "ba66ad45154d959e7fcb37974d7fb0534a275fd3197da7b5116575439ead6aa40000",
+    "85dd15dea9332590fbb3b7a8150e4fcf2376be59b8e929526ae3b7be8640cd130000",
+    "a7ccc39f6ac1678fa0c10692a093294857b8764cbf78de356ce6d765b70d43f50100",
+    "094967be9856204fb3a4b0dce23327ad7bd01bb23ab86bf170f0f4b87fd0bb440000",
+    "38303291ef618e023e66e35ffa0719fab6cdc80c98f758ab215b1deaa83d65760000",
+    "f39eca536c7988e89aad73cc0ba945ed907b8dff6177afc1b6e77aec831e016b0100",
+    "b49f85c7ef22751c5ea11607e084feef9303d1dbb54b1606fc46deee81018fe90000",
+    "9ec07608ed2f86b6de1cba9a0ef767ab1bf6d4a42fd60ae1e00bf591653d93540000",
+    "c5684099a775ed7c07411227e03bba6d969ea4968d57d5903c182c094a06bc8f0100",
+    "b20e7c62c4feeac0609061f529e995a98d76c68e7c674b31463a7fd5a434bae70100",
+    "a236a72ebbb3494a3b3563e70623213ae0d4c45f92495419aa5d626f79f4e08d0100",
+    "b6de2d8f9c357f087788131df213b3c819639a3fb3e7787bd2e26d5b4c5a98a90100",
+    "5a20d4c6bd41815217b8b27205a9e13d11636a7d1eca0ee65fc70ec2c95b8f150000",
+    "bd644872fd7d827a09c6bba79f1942690f4cf799252db7ce98734c6b226a21670000",
+    "8784fbdf9ac6d9910759c88a50c02745d62d8bef14f4c190e9b7c3cd9690876b0100",
+    "3e7641314fde138cd6e8e8f5cd2f2681e7d940a3690a32413658aab3528018c70100",
+    "b8554f573984513c46dd506a6ebf22b8662df96dc510d3a9785afa40e72cb7710100",
+    "3bcec7439ead2556f1e5ce14aa2611d830618c02dbd4d789db8236d70ff46ae60000",
+    "ad4d635ee7cef62ee2a972d0a7332adf6ce10ab3b5612e06637fba32c18b5d0a0100",
+    "bb57a53153af63e386889b5e538441708641f7e77d564380ce4e943579b137240000",
+    "7ed7257ca0f39b5553f41f5dd42200aea12b75b002ed474b2b9f17664bdceb640100",
+    "63b88ba4f9ac4b4c9a9c28e430c59ce3c4614ca2bdcf61185168224b6167a1380100",
+    "7dc55ea4db27b811b7e5aa726d7f7313608520ee5ab99d50f01638c72bd5c7d90000",
+    "f727801789bbac9e25c69c4871af6be2791a66d4ddcd323af2433fc9d19858960100",
+    "e17b0fa4fa04559d6f5b60d6e908b488b5c4b08212252c9e9a44bc1f73222a620100",
+    "5936a33fe13c3d53a1a83b06b6d4bdc639bcfbc4df2e84100ff363768a4490020100",
+    "577ea128aa579faacd8125970ee8d2bd0eba823089791fcd62421bd43354bfab0000",
+    "1e05541a1d3ce260ae5cf64a1e14b52f1e242c3258f950da108a892a21053cea0100",
+    "18579e9e6f663aae8f564990d1942438c0930af6ff964525f7a1f9e38f1bc9650000",
+    "afd6aec8f1fe5ffaa186f9e7a81694cd8f5ff4c6dbad9028048478de60d024cc0100",
+    "9a9f8881f152aff0459890df61064140301a3e6fe190af42df431267475868150100",
+    "1fda2df08198acd6f1c8d12a30afe5c4292b5cff8346f97b80efe9732a1058290100",
+    "5478bfc0b6b1d27cdf917179385ec4ec60a6117850ed02e19a066aa4c86a5b850000",
+    "7c3212c7073554d6854522e2ac31a494e1dd87b5ccdace875ad568e3af2468740100",
+    "9e130bfac9f1a28522dfe38b5f7f7295e0dc98da8fe26a3349ca3bdf6b0093950100",
+    "f14ac9d448b4a7eeb2d0cbcaca1f85347f598a57b589c2598c9ef62c5af57a0f0000",
+    "120682a1986b548db6092c1387e1638b5dc6b622fce82a91823d3012c0e949aa0000",
+    "e43f2e460abc293c405ecb0734070a35ec887d705b34192311bfa731be27753d0000",
+    "3965d48720e9cb9f0407d86b149e5f5c4d1b70b67a3e0d0f5937efcfe7dc6c170100",
+    "8f0719b9d687692944ff3734844ce43a6a1c08c4f373a8edf0064f7d87ab185b0000",
+    "17d4d2773e51e9b92bb06e4e038986ea0ef35cd60811d82f5bcdf2f2190fa6850000",
+    "fb376742e3bda324fbe6f9ecd891d2defc9fb6cfbedf79d5e1f322fda3a88e3f0000",
+    "ca0be3118930adf9733673183759a18554a299f470a67765329f3b75cd22ab520000",
+    "ea8a2aae1503a473144ea8e61a3de0be391fa6f9eb2d019ffb949f19fb7467360100",
+    "e99bc9cd58bc9a79566fffaf4aed6dd205854145d6b60edd5a9fcd98f36ebb530100",
+    "029c75a087a32da8db1f2761ebee4a97fde348c8f165eb56e7f65759da31e2290000",
+    "1e8682e6fd330395218c765e728bf89b0a298cb745c439f5a9a531e9bd39eece0000",
+    "340b629aac9467c40c19d03232cd8c72af741a998a2d2d51df53c7faa2855dc10000",
+    "54766af828389faa245ec338957ec816015989b69fcc3ee7f90e97721be7d9e00100",
+    "c45ccebf70d4c4205d8b2eaad98e28d500b12d880954410c697e3ae3cb10ab2b0000",
+    "36ce1ac3276826291998fa5a6ff94e5514301770920a63a5e1db60c32f61313c0100",
+    "e0cab9bcadfff6a8178c1dffc9dd963c1345ab520214c1e55b3272fe8e7841350000",
+    "9c41fa3ba65d7d623ae9f50f267aebf0d3e22739c641e61b67d1a39a8b9accc30000",
+    "28180ec9cf9d288e9ec10340f6af55755f939062164f8e08100970b79497d8c30000",
+    "ed63978fe1e5466af94a28814fe6a2dc3fbbd98a6282c9e813773d2b1aa6df940000",
+    "95bfc7f57220a8bbdcb23776b3a0281077d1c27d3ae4e283d854e3415f6106210000",
+    "dcbbddd92e2f186a0f71b0237fb508ea7bb4f4d0943cdeb2172d0afa557d9f7e0100",
+    "acfccab37b5db23c4d7a119ce528a47c2927e5d09e1f90eeace8f4ebf06651220000",
+    "cdf9c56d99e98907ccdde25a87d3e69262b3a9489255f0632915b1bdf988e40a0000",
+    "f80d17c9013a684541ad2af3d885f638623f8346f2fc2a8d3c1febbfe87eaf310100",
+    "45ca8ab6d3312d3e1639effcb8e92107ea66814d0cceb425a229a16dedda53980000",
+    "cbf7dd0f3e5804da216c32523777ca52764ffbf7e807d5bba86ed4dff9acf12a0000",
+    "96a7d933f6aac11ee72d4475e8fd15dd1d8994fecfb3267af09f0cf4704236bd0000",
+    "777aae97404929bd1e4b6ccb9994787aec6ca12159abe6c3c32a5c030e1cb36f0000",
+    "968ff4c9e4c46db9d35576ab0dcfcfca8f762304dd65699e39b3d434b93b1daf0100",
+    "2b8db238d60a28c96505f89f3c591f7dfa8557a553583c84c650f0991129016f0000",
+    "28660bbc2be7b5e78b81e532edcd7cb2fc8c202536899c8e7759406f4cdc395a0100",
+    "97779d9a57ed224d8230750a1678330a43a21be48dbe8dcc3d3468e3de2a07f50100",
+    "917004edd62d4cac76466510b2374b753aa7408e0f15c9988e3fba366098b8d00000",
+    "0e0743d8c080a11d3480013a8af28de82feba60a71088d0741d06ba8915f516e0000",
+    "dc5ac4bea365d10ce16631e84b4edb7dc2dc6a7b791010c769bc9c6e29c861a50100",
+    "c173f597c35b80d11b920786b414973506b5cbb3848d490166e86edaedd5916b0000",
+    "36a047cca5456faebf2368f541b9ebe422b67c7ce3c9c4bc5326b43c273277cb0100",
+    "4033703d9566533c51f985f0a73da7434829dd663777b0d35936f587d93c11620000",
+    "f679211e78bc4bcebb486fd11ec73e5669121e401e42f9289b467e6ea9d92f390000",
+    "819249ecfd9b0ccbb39c7547a469c9b709dac12684a11102f03a6117ce1f7cda0100",
+    "6f41cfe79de45ec5a9c65d7da303ddc3942e8d8e2ea6229d9e685bfd034696df0000",
+    "e5632b1331085b0bdb72a5b2a7b9624623e9fb4be7a79237c0d3fd3018145c780000",
+    "3c0f513dc4ede83a0ecd59a9b4650d2ae308604582dce8e09ba3754c6569e0730100",
+    "c3a325756213c81974877aa8c813397c964d47e0f82992b503b7a3685a89fbd20000",
+    "2683e7dbc8c15022255dc21aa8197799672577de04efd6901d7bfe6fa48bfedb0000",
+    "75d22866e5e21a65e5f0c8a3b90460fcff13377458f94a76538634da74ec53660000",
+    "62f9728c2644b643acd629fd0818493d989dd647a7ed058a57b54e68294afaef0100",
+    "528491a403b173c715816b327b8634824755b0097351cdce5f2a8fd93be7a1d50000",
+    "7541111479f1a4a154132abd1fa6e5332bc8cbb2d544a8763f4205b59b198d160100",
+    "e19008da7e635e29910628b5938c8765880e738f37d74218945ea74c82aeb79e0000",
+    "6eef2a3e4db5fcbe42b7b2a412a54756acf147c6bd4c7c79e82c26fb223af8b90100",
+    "a5bcb4a84a0125a67f566c6f04425fa9147bb475a51bebc1a6e7a176b73c7c500100",
+    "91f7bc269ca587a7cef982d50b8f3c32013d8d6a633d53ce68217ca56677b29f0000",
+    "9a6adb2b0036342932971cbf28142521d2c7a9c34ecad9bc52d946b17cffab550000",
+    "7e9d439f45705292f0f206d39b74f806bad82f1a89794f7a030ce4164e67b86b0000",
+    "52e96f45676053bccd44453928c5ab86d88549570948c7f274860274d406fb0b0100",
+    "33858ec67331eac31278524d1cf070c78b5e7b1da79d362e923f1b7b7d3af77e0000",
+    "3535647c5a29ad666bcc65661175d8835224e2a2b86499c972b7481976a74e5c0000",
+    "6d74d21d8224c48de13fdbeeed2cf1c64fe1c43bce56f756d495c359b73056770100",
+    "58ad7dbd40ecb648f7d84c87b3e68c3dd83ebc3e0a5a63a2b7a08846354164b60000",
+    "46be12062261e243c39bfc6b9e0b5849cb1930a33f771dcf22a4ad33eaa707bc0100",
+    "2e893904671994cb320d95b33774fea49d03f228eac5411fae69f0e74d0a80180100",
+    "3965ff9ed8c53f1a848dbf502691612564cd5e918614c91edc150d37e76665220000",
+    "fb088900a877631e7da239243f3ced7da1d50278958ee8b5616424d3838173230100",
+    "0738243c65686cf01743937d47321ffed8b4aa56d17b883dceff83faf4ec4ac80000",
+    "869a8c7ad66bdb33a1111fcdabedbac8d437244d88c8dfc21f965511a1e749990000",
+    "bdf609c5ae97b211bd4c1f8323ff8af3a5df825c9a22583a10c62a2474942b750100",
+    "7e31412e683d02f072bf87233a1edfe718fbe8e4bd33efcda5b40b4d164912000000",
+    "47788b92a617a674535c32c6bbb5d68986e6896810e190fccfb56ed9a7c9df080000",
+    "ac5a6c131e8fb5c6f7e2b01aeca124be2f699a59fe9d27e5b267cea332c404650000",
+    "d9c1751bdb62eba80690aba477421fa332a1d224a171cc49a35422c6a49b3cf80000",
+    "5347edc9e51b865be99e03fabe7241fda58637f45ce4df6849a7ba8f54d208540100",
+    "d0f4bf06f91bebb6aa1970eeb8ce1497399197797aad49052dd7fd234e6c95f80000",
+    "215aeabdee7831f3b48162eda68dd892fdbc927aa12ba32434fadada9250cf530100",
+    "3bb6370755abe56be5e15dc48455e33cce3f1089b02bdfa971af22e8f63ecf220100",
+    "2206cf8beb0c97672f29cabb08572854cfd0e055cffaf8ed3a85e990428724850000",
+    "9a17e5ba6cdfc69439ec6756514d7b1049e362716a7586e072db7feee9b1675e0100",
+    "97d976beb193477a573ab85310476fdd5136acf3b9db414fd7b0e65e736eaa500000",
+    "edb8843418502b96b73ef2a3942d5820bcf39f06c1b57c893f167905152e731c0000",
+    "d4e0bb803f821df4169453384593679f2661f79682061d98010f577f1fb019810000",
+    "51e6af4736b112db81b742c6dedda84e62bc8a3c658a69fe4472b642585c31cb0100",
+    "4e5197b5b953ec54fd498ff8035a00bad38cae36d6c6525fdafb453c859c2bbe0000",
+    "a7b2ee1976b0614fc5bb26680263a476628393a25d9e272cc8c1008f8e567b7b0000",
+    "69b74e81ef37399adb5c4966483ee6529957d317966ce611deb3a3fe7c03f14b0100",
+    "af61b781f17fd4dc725620ad0cd5184a3e1afc777aa71dce9fd26be85444ca520000",
+    "d3f13ff4b3341cc2c12c4ad3032a62df38df3a3091506f16b29c049f4ae55ecd0100",
+    "81a0364b98e22c8914dea145e48623be293caee7f8f5dded477e4f6c64da70f40100",
+    "50228f1753bde9f7859ce73a37b28529bb630912912c582779860ce6b2b921b00100",
+    "cefaa4b5414ac2e4177862a256d268a2c95c39860cab48c32cddd904157df0ee0000",
+    "e7baf28c74e50b4f572b4eb51c15ebb87ff1b4589c734909b3dc6f19da410be90100",
+    "4adb7fd9e64855b289870a31ebe04881e2e7f948ef2feb1f6006c2acc999033a0000",
+    "eb9d6c1f8a12b2e4ebaa928c2c07e7382ef617accf142ac5921f80fb43b073b70100",
+    "d7745abe8ff0ec5a1a6dec7cf5bc69ec387b9a62eec772bfe2da0228131257080000",
+    "eca19c50636b0632d579659b72d2b6a704735b00668b0014ba3441a012c278fd0000",
+    "7cd0cd5c7ca61144eff07c81cec2e500239d7ef9533cfd4a84affbc54ccb822b0100",
+    "9d2b6cb6d5745fa8d5a0b641bf22c8a267cb5cae302d6ab9af4d9009fb90ab270000",
+    "7c88c4efcfa8cdc8c644a0a8159d5a8df7163f1edad56874074ef5b4d04f05380100",
+    "12dd0a7fab0bd877925234244edb033723665b079f1128ef1b2bc3cac6e584f20000",
+    "97cb33afd11fd77e2fb4f99b448dfa17f1b75d0cada740f29ecb2c8c4d20f2e50100",
+    "80810449324fae703c08d8d23b7fa1c428e6a0933fa33a436e478a39f3eed0a90000",
+    "3591cc2a798d7821ec07c5a8a5d747f9e2bf43c335d715ce34c6caa0966567e50100",
+    "4a3659dff0a1d883cfa7e2556e5b0d14d3157eda9ac576e21c485f031c8190440000",
+    "a9c9b234359c1341de4442d1dc24e3095c44392a10068b75abe987728812293b0000",
+    "4c7f471ad867042b2fc0cbc66c997d654af016b6cb6d0558d93460781c4ea8220000",
+    "12ddb904864b15eb52a68281a7811cc91f8bfd4d87f0011106366d8089dfbf160000",
+    "24a20e6d5c4f83823e1c1af970f09bbec203792c02cb8c4720c9b143ba46bf490000",
+    "736d39f919b2740b53c692b52feea98ff68cfd141b935c5c21c7794c65a91b5b0000",
+    "eb1b49a02d1ed001944a4f207141aa01723bbb3be72e192b9dfa8f2928981d5a0100",
+    "4009995aa18ce45a396d3bfeb12298fd83073692712bde7ccc9471e85bec042d0100",
+    "6591a7ee8adf9b14794baea7ca28ce86e6939c68c0f3774bce4796d0b68f981a0000",
+    "1d577a6df0db50aee277072240bc1496d6b3945b0f28fc50542be99cb74080260100",
+    "212f2a642b9c9a0ffa9424132c8fecb2dd65810fc2a064d293af9b9caf5105bc0000",
+    "0fdadcddf655598066c705c9b857349061e3be3c7d8756420ea06de3cfc455e70100",
+    "f3e8c4f35b7bda00c02d1dce2ee62b1e89a97b39236eb508d4dbdafb8198b5c60000",
+    "e43a42f88ef19f5d88c287bccfbe17652df9f0298853dafe685c45514a28430d0100",
+    "c8df79e3206b5260b442fe022fdb7d43a9d76eb941c5fc17a81f3feba4d5dfb00100",
+    "fa22fd6fcba1c6a25b37a6f4b4ebec89a40b3cc7bc125203571f8c3ecac1de170000",
+    "f2628afeac011f039bd932ca8285b150148420dfbedd81b203d822e19f83c1ec0100",
+    "f2269bbf710d345d4f4cff8ed0e44f03c4c6c0adae4c1c75bcd94c132723b4090100",
+    "c6c037cf3f471c3b90de2a4f2a62fe90332d288c62d3f3d221552829b7e48b9b0000",
+    "4f89857a63f26caeb46666f6ab939c4b60e7b800a4e63139f06089e62ee6cba70100",
+    "bbe1d06cb5f732e086952f5b65eed85807220044e3b667248421b5ec4e999a660100",
+    "aa49daa90b385f0a0e5e7952853a3dcebe5b5cdb66260be3179ee825d2ba37680000",
+    "2a36115238e626c9d2f09e3160286656aa4dd6802e9583df78b5ae7a37a830b80100",
+    "0e212047e98de08a8b92e37796de28b2c2f72a1b2f9f649436562c6aff42b0330100",
+    "2adfba278947c0384893452370c032b4727aa3d54a1588fd6f84274493ae10f90100",
+    "d205cacf70900fa7e42a9ee892b18a4fc77822c3fc63a2c69461d31cdb5498df0100",
+    "d2126a6b1972ee4d591a45e08b8a708a6c56816520d8bfe5676455a6833c517d0100",
+    "1e9f6bb262511e671b7aef8ceaf985970453882e096b70910f0473a49375b0c20100",
+    "a8ad726b19258cf9fcd9ac8251f526385dcd5a8e50dc45d153a1693ae7fc6d300100",
+    "c89648d1cb52d8ea446f97c1909061f397c6223ea7604905ed6dfcfcde59e5c00100",
+    "e4f6d07cfdd55c2ff512d30834bf412c2cef77761f858b74e86fd2fc8a6e68960000",
+    "ee18492c2aa5dee3156df4bab9ae6c0a88ef6201c65f7aeb8fd62389ce29ab330100",
+    "b9e9df6068160559220df40701bbbe71adc1101a2a628eedd26f6f397561ed350000",
+    "e7c8faed275f250fdf78d8f5e1052559426470c4626c50672db0abf989ca08db0000",
+    "19b1fc88a93a0a4298f4286c3234e8209bc6d67ef90d163f68cab8de2208b8ab0100",
+    "1bf49d6049f13f3f06dbf87725845936a8eeb6acecaa94133e674715e7b49d150000",
+    "2788d52004ba76114924b771e5598a211e9d97f4e44e2ecaf026c810957d6c290100",
+    "5485086d213d8d8dbb67bd0867085d4d65a12ca48bdd6a5958396150541f7a540100",
+    "fb43a5a5d326fc968693ae35401aa228d00a9d0f3df9e20fc0f82fabcaee53640000",
+    "c18bf6194827b389feac39f0e5d08245fddef87254d7066db42d347e3743eeed0100",
+    "3a0e44a3c7090f08af1c70fdada6d16e5f1e18b620cecbb3b233360b299576240000",
+    "7dc5acc867585e60d1adbc44ddace99a2b327b824f21f7f64c5f5f44b41742150100",
+    "97fe24615bd060f534110dc01b812b5b9ffbf417a23a9e52c39af59c6575921f0100",
+    "2aacc38f7ae27a0107a31add6e7b389f53d3b2647902168cbfa934c6fb5347910100",
+    "b599f2bc1a523a592f3e0baed67141a8852ac9b4cf8f25a92a3bfd83a3fe8d9b0100",
+    "cefe85f2aa9d3a8ebf47aac5a403c74322cbe54380bb6b235e9422aada121a6d0100",
+    "193dc79bdde228f19afcb262a8b1424580395ddb1ed979bc1420c7c7b96460510100",
+    "0c29880169f6011016732943a3ed66b191018c66d412e75fdf14c06000cfe08c0100",
+    "b2657a6f6c08fca40f953ac4078beed493e4cb209043ff394752db5c5a6ef2560000",
+    "68f1491fdb38a7bfe34850de0fd11c908312e817c535362937a9ba78bfbd7a3d0000",
+    "0da8d5c78d3f221598fa29a4032c7fe62f67f2a63c5f00781caaa04b4b3a29630100",
+    "5e5d845b3441d682a4f153a381dffc426fb30fd83aaaf5aedb50829020bf0c3c0000",
+    "3a1da036c69a69f83eb58e102b172586c4bc14d89926fe042cd11d6aadd96c580100",
+    "1c95e0f6a745318c86a2ebf2b8427fa1d2e00a8a083e03d5170f8834a396c25a0100",
+    "f617e93d359ec08558a0c656c9ad2a1c9f0917a595bb70a8cfb69a28e5c4bfde0100",
+    "817fdc80682b6c8b32e0bddba782a0ee57bba39b71dedaabe728f77c445002e70000",
+    "caf40973730becd5137e32059a5a42b709e0b27786c5383ee9c41abae57014a20100",
+    "996438c8931d5c2832317128331acd8b47b27be779fdf4890dc35ab74ba856630000",
+    "6ab4987a4692447a06d931047bc20423aad389146693cb3103d7a06a780b75f40100",
+    "191e312315a10a5caf33f130b0df2d59778b7f132be3619da6fc187ba80b1a0d0100",
+    "9ac644336cb57522ec6ff0a4b238cc7d6f61f6815e30c88354a0f93d1c2ba9a20100",
+    "4a9abbfd5e3cb79fab3b4f6b3574f2ad2badae9056b700cc80d9372df7d2b0b60100",
+    "5092a0f3de8e1a2e7f995e8ee88837a6baed8ea72021bb18d60467e7c73cf6240000",
+    "4df4c6a59060ef0946897cb2f4e6d0d131a18cfc818f8a81f712710a9082bbed0100",
+    "08f0cd9d772e8c74a7e9bc3e71a2307454834a996c55f18dd1002e937a2e81b80000",
+    "05159bad53cfc1debb405487608d4b21e93727b8b3e31ac3015dafe690d3255a0100",
+    "cd1696d473513887ce4827553292a6cbf434c5cbf396a849a20b11e6b39f8ed40100",
+    "dd4d5480bcdee646f863e6867248b59e71ca5275ead97825e5e91266014129c50100",
+    "eebdd66d77003a9105a3b58e9df054ff828140cc04d5415deeda913c8fc988f60000",
+    "8938a82ada61efcb3a1e0efc429c27e5a6bdb0989a3b5821480eaffeec558aca0000",
+    "afcadbb1acd4cd03893bc6f4876fc9ff0aafc28a8b1150abd30123ee1d0d51d70100",
+    "55e24d8ee42bf54dbf91d9b4f70107f35d72f6d781fb1f90a09f0071452ea3fe0100",
+    "8fe2a508e2654ca2443b19c14e58f5207780bf08ccc1465538dd83e3bc7cc8b20100",
+    "2691a577d87c87a18c1e4432a26f1efd8422f6322415b2d007edd97451e19ba20100",
+    "b05b702baf259806fbe9f2ebd7f460440714610204c265f421bbc684271c1f010000",
+    "1382e55be996316cc59cc21f6c282fa05d2c031edc7b856b964ea0afecf2578f0100",
+    "779009351cf94732758449ceb6cd781e2847e34ab4d404c9d3e300b030af5c140000",
+    "47fce70387e1d04d4f9a981ca301f8d4fa9224ecd013f0e9390bf31064f0b96f0100",
+    "6fb9562b3af442f23d80d41db399f116d31ed18a6a577ca60090daf27a09e28c0100",
+    "90212d3551716a31c9d644ade4eab38e9ad08a73a2e80905c88e87e92d79e6390100",
+    "40e7f19a220375f8596c3f36c9295b2b7d9ed844e60c6590699b9b643afa2f070000",
+    "f414c61acb5469387f36c20580b0a1e8393e59bda32fbf9bda73c619adfdab120000",
+    "26344c37b84b979021e2d9effad8a9dbca4f01cfbf142147f93752c8a3ae99510000",
+    "d8dcc4fc4bcee72f0495a1c6fa7acc53c5508f55398b9ba906ec650c3dae2e3a0000",
+    "0553f0bab36ec3c189a870e6ca47b1289a2be375d211bc3d294d12e7a0cc82070000",
+    "9112368c2bd89afd84c19cdaf88457d23d9f7c16430e3729e7ce1961693c65140000",
+    "c38d171e043a1f35d9fdd38c49142209e01eebf760d492894fd99c72b55af2040000",
+    "ca6a8c917a997f9416b1831cb741b792c27b1dcc2aef4ec014baf76173c2afb30100",
+    "51702d573c47f7d305a9fd36dd4f3629d5876be0af6555eeba666498106622720100",
+    "d3bede0f3174615c4d3ef5a6792f5cf8321620827deaf62833147f0723c1c53f0100",
+    "0009702fb65ba80772d040f6dd32a7039a8159f76cb39ff68917d7e1006ca96e0000",
+    "b3e387f679a31e743a68401020fa1686e4a87efff4bbc2b0bbf9ce322e2445ca0000",
+    "c89793b4e03c465274e3090fd05aed7c035e0dd78de467f2923b13f0d6e3ed8f0100",
+    "bb02662727419e892428679c5c11dbecee80b109e917bdaa7285adbdb5aab3870000",
+    "fb51575cf292aec64da085f547938ea3548b96755ac3eeb73ca96ccaf86243e10000",
+    "f32839df2689f80efa01ad96227fc1e605d4964ce6bcc78b8e49427e4f68ec830100",
+    "54831c77f0feebb00c5805084aa36d86721844d1d0b2daff5fe8056e9778a5570100",
+    "9dc0496d27c52d88d22598e009a5955d0db480205e6f5961df339da62504635a0100",
+    "6e3d45c366f2607c8dbce70fc6917467638ee3744bc193366e49084fe184169d0000",
+    "ed554a3420bf93bb61e32cdac84fc9ea9c8ece40049f8de82f6b2691cbdf37e00100",
+    "589e9b3cea59ba282fe88f66fca255d2fe33db435d3e21f6b539d21c9126244d0000",
+    "e6782710d5549658866210cd350c2e204e1616fb06aa1ce012dfec2797cdc21f0000",
+    "5e6e85218408d9ec10366b35bf2878bf54f087f7c61e7f765d4f4b87442d35580100",
+    "78ac7322f799c60e45eb2dfa9f73a851935427294a55434112ecca67b6c71a200000",
+    "8b04369e852e949907b372eb7ac50b8a5b34ffdc091277360681481d6fd5a1660100",
+    "2630875a00fd71ef66048b8ab6514cbbfe6cc4a9e5c188af83381f2379aa72970100",
+    "cbf8fca9fca71c7862bd47713de829acf297629e8941d9c49164a08d90f2fa7f0100",
+    "9237d14642cc9e65becdd23afbea16c95b5742107174e5d242b84144dc0ecdc00100",
+    "1b249f979b3343d3c69794074ac820e332ea6fff38e06596e0c07c1b1c599d530000",
+    "e9ee685e3cdb6c5e789b77ef48d922ac573937d9230e491edb9e788b5e6a41070000",
+    "dae45cf775332de8f94f38df815ed96337de6fc07eacd51014e46ee0bcb59cdc0000",
+    "7407882115196ae38ec1e2e0c401fa5462a94c2c02ea2227ec5e8cec1f82811a0000",
+    "e5192f05186933e1fe51055d1ca16ed2ba5e60eac2c093ee5bfc586f6c870eb60100",
+    "bb5b3fc24c30c478290b4248d7570101188395291cb3711b44ef3ac4ac8b168a0100",
+    "973424d0590678737336bfd9399aaf1a40526bb7901458e096107d429afb38760100",
+    "422a13df0a044c185d447cb5236f0ca2980acbf61746ecc12c037db051adbf160000",
+    "ba02244f0b181fd71ff3326e2065006743b6a92287621b56fa7dc1cf7efa3e8c0000",
+    "edc52d6d0b2c8e36c2363c3900945657fe3c44d57efe397cafcabe65d78431860100",
+    "0481f32fe85a8346c6d48b88b6d884e4e9dc3c684dfd666600ecf97a7e9745f10000",
+    "40e80e1e39f15c174ffc407f9891181996cf898d246d7c369cc27c33105eca9b0100",
+    "7232137e73cea8fa0f9914ff81de89824fb6fcf74c0e6dccedcc1906b575bd180100",
+    "5b7f8e9650809aeb8893e3a5984a1813cd6bbf5cd9e13bf5d964e417aeb79cbd0100",
+    "80473d35c0a4edfe3e80bde51b97439e5d67239259501764d74bc9c35fd859cd0100",
+    "fcfaf88b013db81e61deaccbffa70e99ba0d71bb13afee09b53f647483d756b60100",
+    "8a8b2f493a765d2c75473eb7a85a3b98c75c3f8da5dc3df4179a5289984e70c10000",
+    "a9d1aef366f5ec68b1772dcc10efc0c5d43543895d32a4f1f5fa8f37c4d0b0730100",
+    "9ac82089352db6b0dabd5cf63338f6e241a05e9745f9ae2f38218f1fca2e0ac70000",
+    "927c0f1b3d5b838d0c60fc8c980c36db79542c31b399129656f9c0ae45ff37bb0000",
+    "04417ce27aa805524d05cdd2e4c1e2829dd4bf396ea30dbdc1d94ac621caa2970000",
+    "bca0fd1766eeddefb43f546ca7456e12246387124c2e2f5c53c45397110292cc0000",
+    "a7bd6ea733e78721c762181b96e52cd2001847e23d398d0c8cef98088f249e640100",
+    "bdd74ee39090a2cbde27df757736c42dc1901475a9ae4e59e187a22675a8979a0000",
+    "f7c3bd50a8a7f14e856cd46b3efaf5435c30fb4dce26aa6f1394ea21225c99150100",
+    "f970a95545b3f1875c408690e3cf9d87369439c021f98ac10a91a46c64c891a50000",
+    "b9a5b0d081bb6a6f38872a498fe67a9c6d154f367e389f8f9e78664d6be61fe40000",
+    "0b5de5f8b72c2032c904ec2cee51d6925dc897c6e57b589f2d8132fee7a8ae280100",
+    "d785022bb8e6f7573da3f80e4910ca7fb82fc940132e2ebddb07a957825a5e4a0000",
+    "e07b6e760319dd0d103a9c2792cdce9be28f5173c70722475a66f3382b1594a20100",
+    "359e5b3e899a8822213914d07fe5456fe0bc65fa159bd964868718dd858a529b0100",
+    "31b1b17fe931a4da5489cb224ef5a0ec6d1dd336063ef00914f832ee07f852ec0100",
+    "6306d3bce6c0f5fa36e3d4191b6c73f0ab5a74001b9d73f3c1c4192866a7150e0100",
+    "e8a254d05cd791575593939e53c7b6586ab7b7b09cedb8ac1b8bb8ef38d7d50a0000",
+    "8efe45d7077ae5dfe46f290d2cb42f8e5889d8f0964a94160a6812eb3beeb4d30100",
+    "03b0e962f93f7f0fc01a936b4d7aa926e18e00f6377258ee3c20e9d826e3341c0100",
+    "3075f267b45b069b209f5f274ccaf1c4c150672e260ed6cca8afebc13e6bc9770100",
+    "bdc50baeb3388d636dff7d3b506d1e8afe7c0105d78292614f686e71201747f10000",
+    "bc3c3d9c5f6af64d5b958cc3b03b4bb1a2e2ab0b83b13c3a99281471e87a15f20100",
+    "1ea3668a49b181db876ccb52c77c03d443841ec3cf4b308a5411e00f9cd9b8570000",
+    "80dad0b669b9c2c09614affa89543b10e6a88bdb4fd51f467bf3988fe943a7fe0000",
+    "f296658ce0404b5115063b3025d19aa18631419b334942398ddf018d4f78b91c0000",
+    "05dcf693864d4bd9c4b6500ab13628c4424cbadba7e9542fc2e05ef76bd486e20100",
+    "89bd40207ad4d4a64726a0c5c5960ecdfd85d69e2a25c4b5c09c075084766dd30000",
+    "717dafc74ac59494143d464f51ecdfa4215e13e5b86c488521296d1978e1828a0000",
+    "eb4408354622b1d71378913085e7696db4d00034c1a88a31707dc6c4074124960000",
+};
+
+static const char* const generators_bulletproofs_h[] = {
+    "dabbf2f802c1366b77fc7dab8c650b6d225b95bab99c96f36c40701a6f637aa90100",
+    "1fc2af8541f737aa8f582139b78c2b5a6d3f4b7647df811bd408d9cc7bcab99c0100",
+    "6f5b9d10ddb9ba6e17f9fe3349883c9dc01c455a42da69a65f4923aef1322d040000",
+    "576efadc82e8baee10d17a17246101ecec8d65364ffa13d3ddad2e8383cb2ff10100",
+    "9f3a5611f069981ec4154ac8a39d01b8274bdc655190b82aa9943d35b81a267c0100",
+    "7e344ed68a6f6a6eb6fb1d3d5476350da7ffb5db85fecc6b4f3f9437c33419ad0100",
+    "c6def5246c210260ebb9c22da78e42fb27bd811cb73776ed44086cdcf6866a260000",
+    "a048fe87f9bd15919261524ecdbb9add1252704c9fe2282e11f0c3efc99296150100",
+    "707e13a595295a327f1a76f7fd4dfd8ef1b8ff70f0ae0ad164426561d9342c800100",
+    "1f052578d374ff0eeb70540dbd6735220361d59c8b00129296d093365642f9c30000",
+    "6d47cd9c6ef8b0e330ac803c2a8f508c97548def2ffd380dd4d2ec3aa3b002770000",
+    "e7c5602ce340be980fd1bd3d1c32221153c4218be633be1698b99f09e9570fbc0000",
+    "3790e2ead7b79dddc12e3dd772b8256609c5b881b7e95bbd9353a69a1bb659e70100",
+    "bf1c2b8333713cdcad209642183b56868c4ec386a97e2ebdbf4880d1a257f96a0000",
+    "0a868da34197127221a614308a5a969262e9721c2ce72d004b661e41e5d5148e0100",
+    "ef91e56ac95ad42a45c6d64c286f6c156d63a7efd93e190731c2b21918927b560100",
+    "36e6bb86e8b6b5943780141004f7a923b74b3a976cf531305053c7b4a856da270100",
+    "1cc06085e8469243f21ea2f12da61b800e2dc4a1f163d37158932ccf203e08bc0100",
+    "e7619631241bf352fb0e2713e1c77fe60addfb0abf14ef86bece8f512d4de7ab0000",
+    "48b3624b9f86dee5293be1025a7f61c29ee9a39a539a0d355a35bd4c846cfc9e0100",
+    "44ecbbb58e0e44965b246241ae7eaa01f785080798a40ec94d1f83a3d5d13ff90100",
+    "f898e19e99e27636b05c4b8252820ab1417530d392174572f1763cf9972563250000",
+    "cdde40ecfaa9b6b4aa0d0c46c61dd946ec8166b1816836f447308529775e07e50100",
+    "39fd184e88119cca6e6f9523eb6203f4b780e4b0b483ac39cf8250d41f77bbb60100",
+    "13989c9579316bedbad9d8411bdf25cd56e24426a1ff6e45822ed8ffac1dd8e40100",
+    "94daff4f71259d5bfe64c32559721b34afbf412d8283d1470276f6016230511a0000",
+    "85c3da0d7938e63269f794dc5675c554a78f1d1845bdded09068693a82bc69d40000",
+    "605f576e3dd311f8ba9725f2a59e6974dce450c1e40705f2728d2644554032a50000",
+    "f63b21538565ea384bba851037530cdf3d1696a5648fd93d2ddcbb26b570dfe20000",
+    "0cf41c85d3af8708596a510bec4c352285ac96bfb793cf346f2aa47491a57ebb0000",
+    "ea41a2d0e875b40c9054013e2e39b6cbec239a075e0d78dc490c3c3a363eafba0100",
+    "66f05b9f134e8da207214b678f2a56f9d22f4710c64d7c3a708bd322e5bf14850000",
+    "d27e80462147419ff44ee543f27fed62bb963eee9b2dc52078ab8464083f74210100",
+    "12a105402fd837b09e4bdb768bac328a568b3c98dfb7f6a1bbd725786ef3e1780000",
+    "3220b38acff05025758261fe26464ce739c30ca0ef106d8f30afd351323960e80100",
+    "192c54d49df77f0206f5e6c2bcfd4b3fcda94b8c0247b5ee262e4be152d1624a0000",
+    "ec3af270d52e35bb8da680c213f09c79a7c4b34fb744eb41571eee5ccb0e49070100",
+    "ef741dc7de96be4beca68214d4e7229486f06fde74a74887917d3353413d587c0000",
+    "1560003067608a02aaa51104b28627f424d05de7574d65d4994dfb56712e65f10000",
+    "0d3358120454722d812289986a26042a37b0011c2355978933377915b04eff250100",
+    "e04c96e5fb1e0025a29bc4100298ab94ce219344d2bef685b520ac892477807a0000",
+    "a1459c55fa30dc55290bf2885beb6a40405f1fedd1aff297db7cd5253642f8d50000",
+    "18ac52180515f1a96ed9bbabf4cc1da3d999124042b43e5b0afbd5bc2e21d5070100",
+    "70eef90a66827a0bd359bdfdf5f87b3612e23a3687cbe01ba5259183bbaf45b80100",
+    "12edb68d37c300b6a2b1bc6803892dab48689458771b1bc3aa9adbaacc73bfda0100",
+    "804ad5bf0ffe8345bb1f9afa036c14a96d9889ae227b0e68071da27b36e9d4090100",
+    "cd203f7ce8a654d2c0ccbf5eafec63dbbff81c4561f36233c3e657998b0bf8dd0100",
+    "ce3636f1e73648802d1b6e449c120a80dca9a26a02554ce7b17c3262863c52cb0000",
+    "887e4b91cfe3f2da2dd4de63c405f9b07bdfea4af2398e65c464b0f62c6c3e4b0000",
+    "3fa2740412719c43e239b11f0a0e7d326562b5276e81627e72fcfdfab3a3b8330100",
+    "7136f8dff2e4f0ee0609f951896b1267a943e69e19225f9bd068a2427a45b12b0000",
+    "6792aa0ee539ad8938f0dc98bcd0b15ad910c2f70f5acccabc5ed90b38baf22c0100",
+    "e406da092f27383ccf930fc68aafd776b8339bf2afd4834899809926a671fd1d0100",
+    "1d9fb8a50a66caf028c334e96d7bf68237ff54ef3c5bca7dd87c052b604c9bc90100",
+    "73fa02b7df21a074e927531d2f20eaa9974f437be99bbc7bfe4c1703a89ab35c0100",
+    "982aa64d2522a1d7b4896ff40d2490bbe95555863779b3559841db75329a70e80100",
+    "46035454b4b87c0e5dab8c71b0833c0b53fae6d294a3d8a12159487c2fda01d70100",
+    "cca3a706ae7130330ffaece0e2a2f2b054d77c7741c3a33b5439d0d62b6509fd0000",
+    "0c79eb88cdd19b7d5b8b6dda0ee70d052cd07771731b1f2770dcdc9030c43f060000",
+    "6f6e8189ac47098e387cfaedf20907a3d4cd5e227d5e5f3a57fbe2a4ddfc782a0100",
+    "826c14cbc7811af3879aa7c0a9bcfea0a1281dc0790faf1427b2ca3840f10e980000",
+    "0194895d2ecfd9100dfde56726353e2dc56cc97b80ff4d1b33cf81bf5a462c5d0100",
+    "6a373298177dbf96186d814a71fb093b4b0039a501190228095b1aa7bf999ec20000",
+    "adc5c8367d4c57bdf289ffeb20076d713bbfc2ddff077acc9fa40e6729bd6a580100",
+    "feead80dd9a385e4ea33949ae4f3bf1c238da1a455ff81ee9010ef2a035f514a0000",
+    "e03ea0fa4be180280a54efa1343704973f58fb915b4affd448430867f72a654f0100",
+    "340d3d53589ee2c013d3784332b4f0c503a22c5c95d3ab232d2af1e59c9a9f1c0000",
+    "d7da67db1ea0ee7e974049595d7bd00f097044788a259434ede14c034913b17a0100",
+    "81d0b147b4fe15f44e8aeefaa94283add659b51761931b7fd19049e317b3f0020000",
+    "23441a906f4f64cabf5147c457b0af5aae6994dd36fe438f1cc6c170a74100b60100",
+    "4941ffc3809e3a79825dd1e6999749f3872e86ebd59140750de59527b6b24bf20100",
+    "44eefc40b3843c2955851734bd0cb34f09d9eea7b52bb512870532b2af41c9f30100",
+    "6932bb6fa6736c2166d3e1527b5bdad14cea4354da01603d3fd4ea76027161990000",
+    "ecd6726b5fc61a93dbf5e9fe24882f489b2afc97a0c419826805f92d7a6690050000",
+    "18e629eb845665a5df1e22f9fcb4b43b5c94942261139b11dc29e81d65d8e59b0100",
+    "c61a778786337ea383d810aa63bfd9c4f7f20f2bafe81c8e97a9650a1d3f5fc40100",
+    "85d391c91ace1d9a9277ebe4c005358b6ea92f83cab95db45d9f8befb6ec5abf0000",
+    "b08e6c9935c4ca938c81d3af4883859496b93725ad48b615b3ac7fb5335b390d0000",
+    "02e07cca3c6514176f652aef4cbc39d7998347692e01e048e0ec270ca7ce55610000",
+    "dfda570b9ae8a7df6978618b08c0480d34a13be2af7dcdd08a47d3ea7de842290100",
+    "2fff3447c2dee3eb5b00dbab96126668d0367d14cc71e169208cdcbe3e08fed90000",
+    "ff6816389fe4320215dd272cbf6d8107a3e795439a264ec4e76fbf47c2f19eab0100",
+    "d5f20c6c0326be22ccea2749290ddacb25d4763b6018569c9b547a18310e6d5c0000",
+    "a0a974f1503ec479d0e1b0d55b46f8fbf0a34b974cdeb6879f32f9bb737d6e800100",
+    "869bc68c67dbb6446ff144a117499ddc6fc8e18e90ff8b8652a1e9cbb977d9270000",
+    "5a7ce291a3a3b53cc3c68441fdea2f80e263828422215acdb6d7941d8e2c647f0100",
+    "500d77765d119ac5882db2404275a9b3baa61a7a8df5ab019af621de982b823f0000",
+    "a6936d76caf55cfa2b1090fcb0652288c307d04b7ecb12fe304b22371c7cc69e0100",
+    "dce77296ca481618aaaaf2e40208e39b619ed457e09c6de80ccacc637f3cf6bc0000",
+    "c7a3b1ba99f688664268e5409e6cfd1b244de266e0b4e3e250dfc79147be9cec0000",
+    "961517badf2f30c34060442ad81ee57ad7fa60e36836f737cd8c861650157cfe0100",
+    "3c8e56b80c3b4ac27dc3725afd054690c12c0e9b87f52a14d27425b1129e80f20000",
+    "f11b54bb082c63e3d5cddfafac4c6ce12182cd8d0dbefdd9febe846bd4f151590000",
+    "63c7f91c84d6e968e7af5f92628ed01e94c40b0230d68f61c90ad652de906eb30000",
+    "63bc55c66e8afbfeff0fe5c2136622ec42c575327772ee7f599a035317e867410000",
+    "e47e3d83dfd4bc05fae7383572b8b5e21f985114bb05472ba83df3dd4795de220000",
+    "202c25cf635161d0aca518df8b905f50210105ad25bdfdb3bf4b462a417769910000",
+    "b75d42929a22ab5e4ad35a95388fb37e9e19539ad77419198984214b27ff2b0c0000",
+    "4b1c5ed30d7f9077af1dec9c346f5cac6f3f7caeac7c0a6340e2ac5cf383f3300100",
+    "db5729e901eca8bb09d76328daa781d312cc3bc2138e0392093bb52b2276179c0100",
+    "8cd273fdbca115780175c5719e13371a96239aeb7166da00ad502c7f1adfd0bc0000",
+    "07c79e6b3fcae9d5eb1763a2eeace1a4d53318c9d2de358a9da8bdb582e2ae3d0000",
+    "8c8979e248dd7e1beed0e753643090537ea48c291735f67c9d5303c26bbcb1d60100",
+    "9ff705f657157bf51820083cda67369bdc4568af08124110e1e04e46e15896720000",
+    "785a2d8f7fa2357c1eaa4c8c99b6268407b3defc9f50520b8351f12fc5745ad50100",
+    "228a9fc5976ae5daadebe914cf700b588585e9d199e30cf506a3cf8032d86ab30000",
+    "9807013d46c4a348afaac519b4da6afd6b0893148d7337318124ea93bc75deef0000",
+    "b9efff6d6c49d197965fba5f917a6b9002e582c3d7a7aff90d8b82f9fa5484710100",
+    "3803482d096a040ec6b3d6cf748d6a088149df4f1a00adaab45aeeb77c3a22330000",
+    "80677dbe7d161d8321675a2658a42b8971fa589ea2ed6fd5219154fc6d675c280100",
+    "8a0b2b23a6531070e504d5b8ace462eded236841502a8350b3c2135329d16ed00000",
+    "0493c408b9783fb4221dc9d47e87102ec5bba1b70c035221538d864680dda37f0100",
+    "7030d87a65f4a58da6d69732a009e7d10cadc1bec08ea3d25ce080992ce70f510000",
+    "c7a4bec418183e8357acd7c7665e96f565f5d39c84442d6b8c63f639fcd71e130000",
+    "b4898bcfb13c3ac7ce07c79c41ce628568632dc5a92c77c2a3c02dfcb315720e0000",
+    "b6e0256ba573a4941df92a430163108444fe6c3d232c3aae1f3beb6cefc406f00000",
+    "7ddb4950bcd176bf8e3a8a0c7a4df2579616b296fb6c2f117a0e1e162b8b69bf0000",
+    "ec6c4dbe7749ab9416199908b2fdcaa9b098d4f844e0b59836cf2188c00f7a3d0100",
+    "63f21f04fe7d3abd563ab62b54ce11eb9848b21838c2284a6175f7a7afbe81b00000",
+    "efdf37bec08c186fe96e6a378c726d0513933ea12185456569d4e86d914986e80000",
+    "a53c12d591df771405f47033dde6de60642e511ba7ad54607673463601e067fa0100",
+    "9fc4393d7bd5aaf20f60a01fa13da52f1a948a86fbb58087770dd9e36c1dd0430000",
+    "34ac91d91db5fca3d75785d123cef3b478e198500b4b61416095b829776135130000",
+    "6fd894c75922aa1a3d74bb9a4a30e2f543c41b872cc98ad23feec76ccb9e5ff00100",
+    "b5706f112aa6c7551b0fe4256685b73f4c12bedf18316ab8d4b666fe49b0953b0000",
+    "1f83b9a423b7a00154706a2b4c97ca20c0e01c9bd357ed0e19d415991164b6290100",
+    "12d1e5f4620883022bd6070f2254c878f16adb2265a97e6c1416e6b551acedc70100",
+    "394e145631028a96040d75b232d2d754fc160337a6900ad53f70c236e75e034c0100",
+    "805105bcfc8359d6fc4efc0d46ff8cfc61f21bcb85c0f333f28ebd86ea057d690100",
+    "04142a3a93c70f04e2312504548f7c7c101e921cabb19b756b0051f2a4627b6d0000",
+    "153a5b2e4f7774218dd996d02310f1d3f7b787744c1d1f93832e48dd2c89f5220000",
+    "ae731976d814fbd7044f73463c83defc1f51f9b1c9418d629fb7fdc4e593bf020000",
+    "7f7a3d86daf994fcc8ede4f3067a18c1b39030fb75e14327b6b7a271e6cd852d0100",
+    "e58bfa1662d2d33da3f751a5f2456ddd3d60e56686d1931da86b4056c51d69160100",
+    "c1b010a59563e914d16c11f117231d4a8bab09c40aee3e391174efe936db2e490000",
+    "644c7f12ac8872453e970207f59cc0fd59486f766b7e77b511bd5b5e59c3a1d20100",
+    "a8186d341993cf22d3ff819e62f23cbf90fefb00fd8cbc6eca66805e00e3fb510100",
+    "f66acc98a7aef483eb5ea437c2f1d9a02cd46bae2df72519b1e120708e6d97290100",
+    "11516681d62639482d1802195a9fd048ce7416a0433121e9a76a9817282b2ea20000",
+    "ecd071541b3dfbe3246c9a1b58b270413a28ef6b04069024f56932daebf828860100",
+    "659dda7401262a52d25d0f0f115579686b5b71173cb66796decf2c5d1c2273970100",
+    "c84ba12643a1146709b18724a68a7afcca73a0117814472e32e61bbe0b144e560100",
+    "89e4589273ae00a95b5662a7f1cedb34299554cf3c4d5dda3613b1597738d4f10000",
+    "bd4e36432a0f24c7895d0ab8761c3c8a740919d156bf01f678eac24273ff32f50100",
+    "c38f4a25565b555526bddf5025c31d38f8963f882afcd6765f1fceaca1a028ff0100",
+    "320e238e93f79264c9ea938d3cf749b3d96c52c6d5528a76954c142024053cbf0100",
+    "0f3ad3915a57a8c5f01d42417a221b6075b802b03a20164a96d51bddcc8df7880000",
+    "b56d2fafe722ed5c9e969653584047a84d963a38a28293face82f485c7286e210000",
+    "9eb79e3dd6e94599937bed7c3eda4dfc2a8cdc25473c6cb09afe196ff4f4fe2b0100",
+    "b09563fb13ac1999e2b1122170f1aeeab26434fbdcdb3467262cc9e068d94a740000",
+    "e455127dd5350131247a6a76bdb07eab15b4f6bcd04f5130f49efeca0ccd9fae0000",
+    "84965150208b367db2c033e5de61aaeff73447e6535aa919382ce420290dd6df0100",
+    "465a9cb15e0a57b88f20c64f39c9dd4a3287126f77488476d9942b41a9516f350100",
+    "ec608646d684aeac9f55e88a4298b65ab4a7f4b0bc4f3f02dfbdebd6b5a9bc3f0000",
+    "ac128b071694d4b18efa4a193413d6cbb57842ba060ed56b0c2156e05ba033630100",
+    "9be0d23172aec3028f13a60b55b4fbc079bdec015d149b96bbd5eb4ac86105ca0100",
+    "e099dad4f5eee1946e4ffc4fb72cccb58321caf09b8c11f53f47bb35b12f0db90000",
+    "35c0be80afacd1f6430bc27b0af577341ce39fd7d7a22e4de6d3accae000c7970000",
+    "f6fb4795a228b5235c734a527bb493afa3ed0af3c14dbba58e6e15dc18fd586e0000",
+    "f0090b600d3fe12abc6e0cc25034bc80aaa8b8ac38774f0db14efdbf0d4d8cb90100",
+    "308b13f7a51efac51142db0d7835fc7559f5e766c9a5b7ec14d48d4250df06410100",
+    "49688350c19e84caace79fc2d803fb05146158572333f4e330186e6a5245f2200100",
+    "60afc603dc1ad4843dc5054070ed7636ec5b01246d54df980e9d5f921af5faf60100",
+    "30921f13ee36aa642ee3a7147362b0141a53eea7cb0e27525c2ea30325ede75d0000",
+    "071780d9ca03035c8371dffad9171d85d39ad6d1846e8d06f66da1bdb4b3d0e10100",
+    "bc471af56ab73ecac5afe80b6ddecc6f0d779996f1dd44ce8052c75bd6a383fd0100",
+    "fa4e11e423702438af492081a2d694de92745a43b07094c793a13f1cbc97cceb0100",
+    "22404da91276ed406e8745d064e37ff2b5792c07331897b4c8b803f69d5c1b530100",
+    "ec5f2028986e581d9bf6cc15406b05dfeb1c530c64bda462eced856160fec6c00100",
+    "e4597b699392535447baf3c97966eab5c16d3ab02d81b0ebecf5a9d086f050ea0000",
+    "435c61b7520ce5667b414a41394c29aaa45bc17511d253fe72f2e6e1784990080100",
+    "42242a64868783e60692c5df37a835556adc24286bbf0d83b1cb495b335f352a0100",
+    "e475215159a1c3fe55b83f86c1d2d2b157733ffa913d8d1365e6ce7bb12b7a560100",
+    "bbdbd68fff8a024eb4b121df761c8d3a9744f685be91aedc4266f8b77268fb7c0000",
+    "ac8c6d46b9231edd34f0280b7027486417a7d06b4cc1da5e608f34384868d6890100",
+    "e75eb68abaa4ae425085e18872e909d40636fcdb2442486d1119d5c7b69f21770100",
+    "405229abaf006e6b930a60edcc8da573062c4ed41399577badf2ae7337726e3c0000",
+    "931bcdf5393528408091a316630317d3bcec5cc56de28fefad517e870425444e0100",
+    "7dd7ccb15fbad7b5496f5fccdf7d0441a9b6ea26a87c6fba5db13d92e03ed0de0100",
+    "7cace91d245275564f6297412fea80f497db0b7aaa69341639bc54d5d044e7960000",
+    "a9423cb98f9590595c845d9b886b8ff05c5de1b13772fd79bea173c8b52ccd4f0000",
+    "9029a42a9d09c3dbd9236ec33b61b54bcb6a30d2fac8518c008b45ae40c9ef040100",
+    "2807458612f72012a80bdb33bcdb0f5a046e780240df7b678304fd85edf1cf0b0000",
+    "c1e5dd5cf148d3ea7d7462485bd10d7f26cc39147a36106783bf73d36b3cc1760000",
+    "75801f00ee627e2819b98a7eed17983e80c5a34f0018e85dd638c1d989b192c30100",
+    "cba6518ac7eb4b1c30b49d6b40d4d0d5e80e60f032ab0c996e9aa268dd885a650100",
+    "86854586ee404d923c4d8d8ccece1d4ca86bad89d08d1fa8bdcbddb5adc7611a0000",
+    "e9ec37f25e8923b374cacccdcdaab570138620dc977d7fa298bcfec829861bad0100",
+    "8372dd45618069fe7fc161a15830a43069cedd793752dba918f6be0d1c91f4b30000",
+    "c9bfe78be705c1a7cfd324fefe57ca16881154cb9dc3ba6b1a55c631faf7a3e30100",
+    "973f19d90e56f2ffbe8093f23a1001bad46da101d621c7465de968b71e3e9f940100",
+    "8735d228340487187ec7382dcf6119674f2991d2a682895237e27e74cf75a9390000",
+    "eb6b7e58a3598862e14beb580fb4cee93b32ed1f9db4d013e2f5b9e5e8ea3c2c0000",
+    "fc896acdbf2dc309d0685954d31bbf57b89c6d03661781a0a176bb23870fef0c0000",
+    "567694ba446b199ad95ccf77b2b38c89188e3ff218c14bbc8095f2f5e423b9380100",
+    "db0d209599469c3cd9f484689a70c0d3ad7f8093a7c8dd9e97db97b95d0594cc0100",
+    "99a6ce89a5b64c5dc9dc8c39934522b1b605b5ea424a1746524d989d919a66300000",
+    "ad7749713a79c09ef237d136c393d254b6a11a847fbff139b0b9a04151626ee50000",
+    "f503d8eb76bb5294ca29654b5ce285490ccea8855a4d06f069cd10e8819b0db30100",
+    "471656d99d4f35e3fc7dd176705622917b3c1d0267ba882cb33d9aead6311c250000",
+    "f14a4d20ef7e594000e9c6c41b226d3cde452dae0cdf715173c62112600d91a50100",
+    "cd46740674717ac0da4887d8159a7c6fd16f12f14e2e207b1d1d3cbc8b5c132f0100",
+    "988ad6ace04977da6217b7fe0a714eb5270c484022897a6f73b8d49b77e324ef0000",
+    "3c5cc19ebb946771c341576afdfa5d9123034fe7d15fdc558df43ebdf58cdda00000",
+    "3e7f23966478cab111d1a6d599acbd5fd8844f040041ef08c344ed77dc5c520d0000",
+    "d52e9795d02941fc620e9c0ee3c9a35b02d42f6fb842f568398f865d436cc5c10100",
+    "9d3ba2be3c226bcd14c836a2b7c51ce613cf2bb2d5831d06e0e860e6b6f038f40100",
+    "6c116091cbfa149e18cfb37b659b7ac0f3ab2f580c4c514d3f66d13fcab3a7dc0000",
+    "ccec3be5cda3b9f828d9a363690f376b010d640e771f61d537346a4d0403e6110100",
+    "07d110c88a5956f00b713995905b4efb3d042227e37df2552e7ac01ee0deaa910100",
+    "38c80238695cd8b72d15f3d7acba72339f596e276f9051c784bf922959ec019a0000",
+    "024458c1e3b2fc6024404afccd5873ad653c72129100733b0dcc1d768529b6c50100",
+    "7d92b22db272a0d83a95bcbf5009acec9d7aa2d1f25eddb29a0b9a8ed933c0ac0000",
+    "2ad50a11c1265a05f8db2a7875a787441fd72a49d445592319b1aff389e1430a0100",
+    "5e40b0b25c784d2af409998266d6eb973a38aa79ba081979967fcd6341c7d7b00100",
+    "5dea0f7cc140287b2d4b62d72316964f8d444259335910766ac4fa902e897b8d0000",
+    "cca04dc434e61e69606a67b4f938e44852c66e15c36cc22c353116de91ecdb550000",
+    "d848e0f51e7b279b043843b969558bf19ff3a0fb4e3ee3d74fe68f61222ab1c50100",
+    "2e1e6858421a97664aa4e092163890fae87f6ca781b4e0f5ec2841024e6f02220100",
+    "6da76e725a5a51ad624453f61fc6ce7753f0ef2dafcaaa8f7974f84d5f2b11a90100",
+    "5d7acd37689053d4345dd0ac730275f3ae5fea745709149f32104d361d5e126c0000",
+    "0817e62c0e00778e197bc2f633643437b5f559565581b7f0332b4e21550e290f0000",
+    "e0419313898d94d0635ae0368e555b36ce2520a753b3821b165333d2046b7e5e0100",
+    "549f41da3b692d8559b636e3d7e14b2b30243bad1c0568d781cb7af91096ef790000",
+    "4766e6a1f8115ba1856bc38d11b2357e189b0c7314a5f0e700c78be4ad339f950000",
+    "59d3c43e4af62a74573c7d4902521caa28b67bd6e9628c992646ece5fad5e00a0100",
+    "3ea6aa0edff56cde6fdacc2baaf8a3ee935ee63e35d3b68da6e926e5fb8962e30000",
+    "ff686ab13a14a8deec9f10af36841d4879f1a3c08a6589b0a43d6997e68789bb0000",
+    "ee6adb1d40a8947e992bb70ecf3cf41b3dc8bb29598f73b7d93395e1dfd9895f0000",
+    "4b56a3dbb70e2dcb9e7283b002b67d29f7fa959f922cc3d50a8fe5c8787a42040000",
+    "1f98d53973ff6ee7a0bb84c8b2589e725d4768a2d097d09d6656d614e26f99520000",
+    "8230ee3a8ceb4ae546e58c7753cc6d1e3fe63e4bf038726160634ccb37817b7f0100",
+    "fbc2c1399643e9450e1a18839a43d7597a85d837f7d898f16c759bc8139107080000",
+    "93cf457f936cc764e7453c2360a1dfdef3dd19179e3bb863aaea1a548c038fcf0000",
+    "1a4f11b48b27ce635c9c0d5adabbdccb897e75cd86c3a2edbc9b6d9ef974c93e0000",
+    "165a07ba66c0cc852576d852e6b87a6b59a64d18195dbf06a76c71ea8ec8509a0000",
+    "3f5fb52d8c2bac8d5889c86b4b0a118934831fa794922b427946983cc2b704790000",
+    "8d1088a1b0465f657dbe68d21c69d6a2f6e1c39507c42a8dbf43f4642512848f0100",
+    "805944f01f858d0fbcff89138b094b429d8543a5bed783b724c35755a91189560000",
+    "f56049ea70a8e4409f33ce2d230f32793e9d3245a7d422cf2afb078112215cce0000",
+    "1aa5bc2aec7821cc65bbc64fddaad47d875f3518027df1cda3c8167f09fdb3770000",
+    "c8669db404c7bcd7030ff7848e2998f7a46f59e2b537876c3422980edb8955a70000",
+    "f1a63db9755f76b8feb421a9e6fc3a0fb2885396d37a9f27ee9eac58513f39990100",
+    "6e32f06c4c33f16b4d5d9a9d1cb2e8c6d21fdead66060bd933a7c4387d1758720100",
+    "3204fcf6e2f553beda863c181975fc440e85c2d4488fc165dfc020e2a66a11a20000",
+    "f8620d8882069cbcb1ac197c28ff9ae00c32d737be070a971b45077510a191b00100",
+    "b630a4e2bf90eb24e58fe2c51b457c8431bf0f7835fcb8440cdc2caa1a1efae20000",
+    "68102febea9c8832f0038b77bf0acee4a9e4cc82f41e41e6aa165e4b3223a7440100",
+    "4323b422345aafb5b11e1e3c0c0c3c68119354d3b9af2e1aab5ab5e0daec2ec00000",
+    "bed282a7fe00895e01d4494e0330c0ffd6268037447033ea2405a28751831ee90000",
+    "81b3803dbcb04a77ddae15934e05475065818620d376ce64747ba83a268648540100",
+    "a5d12dcbd42ffb268834a7cf7dfbff35b67b07aa6620b9247a014233eb93b06c0000",
+    "7374c0f51e1d0b00bda44b32c5ea1592a201efe4365b239e1383a751d9f43f770100",
+    "f1dcbe5ec6f97950c428ddf33cc14bc81c008168befa35fe93f6332ec178d76b0100",
+    "948443553a40a0ed8677f2b6014af88125751ac3b73332664b4e8667db45ed630100",
+    "cf73da8a0fc13ccde52ba3e9278a1ba4f4aca0b27160c134366066aa03f6a7910000",
+    "b567a1b6c5900d4f403b39e06b25728f39d4fed050c1f42427e8a7b048276cd50000",
+    "3bd5785f03caa4b7948e41aeeeb606558198233130a490e2511a537d772e95380100",
+    "0f82e0db15efaefbd97019862b325e9408b8b1821d7c189c10487264f473bdc10100",
+    "5ec48b2a611a876aa68b3b7b740aeb7989896257fdac70d870e5df822b90fa050000",
+    "b6ab9a465988a701a8f377a9eaa00309399234d8396805f4bfc198b7f3c3d4210100",
+    "ace7fce005fa8ace8e308b11817bef821958b3f8b63f99207687454a327e869f0100",
+    "de9e123498c25da899e697583239fb64b6711232316807b12c753e715a3b325b0000",
+    "64d796b7aa452b52fa2979aab5589dad04aba84a69ddc5db237d0ecac4b0e1bb0100",
+    "f6f5dc71762cd3e15801559db4cf3ef939806858c0bb1c9b0f5fcf5b49e50dd20100",
+    "c727a70fc2ce337c448385267077e0ad99fd40be5f057dd518a89382b4d2fe1e0100",
+    "8b692f56bfa7fd757e4785ee5ea6eb56012288f88007e352b136aadea5ef8cc30000",
+    "17303b19eef78fba0caccf676b7155c3c63a89d7e30e7f373ef0caddd3dd91910000",
+    "40954c31a006be505510e246ccbcd82633d2b7bb8efec649e69f603bdc4ca1490000",
+    "ea29efcdc9d4c8dae36fa7c78f5f48f8c071571639bb3dfb697c899216755e0d0000",
+    "b58593bb99e59a875500a1b485c11e19a468bc2e62d817f76d7270bc4728750c0000",
+    "278b3f5eaa81b20e808b028c06637de582bcef7f9855a9951a7df6455fad01ba0000",
+    "19c4a06e083aaa86079c6cba5a665f52f90f3b67afe3914dcd2259a8c47b383f0000",
+    "09e9c7e0f4e4c2bff4d490053d50207e0ed56ac3c360e0940864fa57e03dcc4e0100",
+    "631091f67e7a385855ed3c2d0a8bb9aede8957fb88861257870079ae05cf51b20000",
+    "122f95f59e4fcf374e724fc68609c1d6196f465e96b1ca11b999b438abde417e0000",
+    "cd521d3b92b5fb9ac9c49cb99a348ff4c2a926d1ef44caaff1c87a9d9f2aafa00000",
+    "0048cdefe26be1cc13f2ce01175a446f31791f82ad9d0fb8a3ce955280a88f1a0100",
+    "63d6c2b052431987d7fdf7c324001b0da7db6b13f025621766548166932138290000",
+    "1a0b7f7ac821e7a2abff48e65c93b6635ac8e329db18b599a5459c540f04e7510100",
+    "7ad36df3513537b0a0bab958983b8a5cd9aa3043458b64f6c652513c2974d77b0000",
+    "b5603523300540270951df526c4938c6bab0732cd0ed86a3fc315866c147eebe0000",
+    "462c548f7e02d51fed543aae47cc68e6fa9a1b8ffb4820ebf32688b3cdb29d350100",
+    "e9c108436bbeb3012e142b4c3417f3175f7540cc624d17ec30ea36e2ea92369e0000",
+    "ae5c2d6363635816c1df8f79457c85514d722cb943e3c5b3fb656890d49174ab0000",
+    "f44f953bc36236cc406dc0445e6495283e7feb37c48df100b712ebb4269dc0a80100",
+    "f2028f5e4b08e9277286f7dba6d1a0df39c15780c2fd613fa0e00dd14af5605b0000",
+    "4c17683c00c5c1f4617d274f22b42ede1e03a8d91c0cb96dccacecf52f423c470000",
+    "a273fb0366592172a6f7e1b90bb80b24b6c8b0e036bce495ce03af493a8378280100",
+    "e2b3f1aa7bb89fdce11b44f8314ed7ab70f696507e5044ce7ceac5cdb41474a90100",
+    "4c66030e46098f72ade4fc4a4400f90276664ec6b8b2ecd8d2ad43f2f656b6650100",
+    "0330234ce0e454cdad8d75d29ad7969844ed64a807e383f8a496b786361d59710100",
+    "3200ecc89d3cb1635c652f85276db65bffc1e30d3d2d8d94ae480dea09683f9b0000",
+    "8591f0e0d886651b1be58458920b5b78afcff10f3d236ba7db7c9cc1a7d726910100",
+    "7186f96d06e879381844ce61837984e3a04c06607a64f0fa75362d4f302bf2c10000",
+    "b2fb14d95d5932428ccd01a10a2c40146b530536b46eb087297e59bb9d9899230000",
+    "ba2dd4a0faaeb8425feebfd5715bfc0266f2e98266258d69d147a5603caa1bd60100",
+    "c1ad7667c71e9e8c41f24c0675178fdae6f8f7e7ea7e9d010dedd788e785e7970100",
+    "6ca884975bc27fc0682b9602fb4cef7208fae6d32372dd47714ae17dc816fdb60000",
+    "c3ab2dc29cff2d792805d0f9a56f8b8966d66772cd99e151c4c8b0259d5685f10000",
+    "36b00256fe26d4cac4bd56598391a5e677ee8ac9678f4a80a42eec9b4b4637330000",
+    "fd8d0d5bfa6781ebef8f87c03e80204fab103eb98e6ec9f579493a9d29c4aac20000",
+    "c18050ad984886daf6810e1ac40bc224f74c1c0a2cb86b6e7e50a1f475cea5910000",
+    "9e400cfb06337168e6389647682dd11022c94b89368dabbd4519a331fd52b3cd0000",
+    "ea17303c27595b4216bc5f9d2072af3d576eb3e4f06641ecb99dee934ece11940100",
+    "3327694c3f52115962a7923284b5324703eed95ec70bd221e836632e52139c050100",
+    "9fdb70772f423a9da9115066eb4e9a1b8092b2d48bf423d80bd3823470a3999e0100",
+    "550366e51c30e7e9cee3b182ab68d0d7e1b63c8483662f1740a884928328828b0000",
+    "2b01ae2e7c6390ead371099cfb7f37085a16a75bc1a223812b07dd16f017f2da0000",
+    "48d62a8b1d2f9c5700c93b39bdfc53f45dd953fa489b79bf1f5efcd6f6fb9a750000",
+    "50d376ca42756e37e5f207fcbbc24dff5cded95029c807d9bec9f098608b71ac0100",
+    "9d8d5a73f9dff8f91ebb5545b79ee5fd174740653daa860242613dbd4e07ef6e0100",
+    "08830d8dfad1c703a30575a4a0249616f2b176ad1a8f1fff4ba54545bc72126b0000",
+    "342a5ce35f7ab424557e0b0e3e3614ddf1b5ecf55e052915de8045e1407ba4140100",
+    "738b2c8337d0be4d6916966482cd0b74d7254b424ac841c508392aebeaef15240000",
+    "0691649b8fe662021b0c4c2bed7d01af20fc23f561ef5f022c2d98d56738b7f60000",
+    "02ce2252b83607971cb747aa0e5fb6481a63b256ed81d626c45523712e01dc360100",
+    "978ba675c5dc57508dc5fd6f75bd9e90e1d7172d492f420bafb79f2db306813c0000",
+    "3dfcf7b80dbf7ea2590910a90ef737b0f6695ec88ab8cc7c7a45212012171cc20100",
+    "6696f8f059cacdd24eb43afc25ec86dcfa1e220597b2e3af97e82f58564d62450100",
+    "dbb81581cb902cefa37936f4d47348b1afbae7bcb7688906014ac4cc7c7bb17b0100",
+    "4c27895ff77ce8c07c500116c47b2e6a08a519ebc6950720cd8e9aee125f03430100",
+    "f7118401fb0238916e01431ac077b7e0c65537728b34b21adfa20475cc32a5d90100",
+    "ab0e302cb9d1df713b023d7bb1fc7e904ba041170bb8ef98b425d6815329f5280000",
+    "09ad4d731c769cd2f6fab02f083b86aa0be63fdd4d289e5f622d010fb73315440000",
+    "55a3f821a268546f6ccd662f8423a261af12edf3746b86a4f428f6eedc5fb07b0000",
+    "3cc5eddc4055ef5912edf43129c1698c5f9b479977179bc038217a607b4807b50000",
+    "5e2cbc8ed76db0d60d7049141ae8b95ae848d34a2b5f08dd2d065fdd47a085b10000",
+    "88f6fc48946e87e386c3ec8995b3253aa157ff3b16f85af76c982329d34358a40100",
+    "d54f51f94324365a09394ad48561a6f99ba7e9e2a49349d45b3070ef61fae41e0100",
+    "ece346feda6392cfedb1b49f91bf560e09b7b0d18f2f96a4f11a898501fe5f020100",
+    "eb9b5df63ed42a9c3a7494b06af5e24004c9f3ee03ecbb077cc07ab5f11e42e40100",
+    "f250bdd3b0cee37de4350c3dcb811a568c6213df24606243f373544422bcd2a10000",
+    "605921c0d688122a8760212a61638c159c4b8a72d800087a9e6314ceadd797230100",
+    "c1d5c266796403ea739579e5518ac417675e5e22eb44c2f9997a5f6633f3cce50000",
+    "678df1e3c41640ea14948824590acd145dce1e9de427b0802177ea0913ad46c30100",
+    "b8d57bc7e9df224c79a7d028a660ec68321e33603841c0ac0fb5c56b70f855ca0100",
+    "0f4c5b68a3809ce2f45c601bf776e093bae132504a52af18dc3fa0540d63c5da0100",
+    "38bcbce43e49d7b4c37a499aaf1a9e69324ff0a62c905cb5ff46b68024c10f6b0000",
+    "3536143c98a92b48170564e51d7fd948a8f6a4bb46464183772e0b6f9bf93c9e0100",
+    "f7720bbcae730a0c16baeaa7d0eeded21d255def3b4bde6158a3cc202539dd790000",
+    "09268a4726aae16b6a57ab2d7761b497b654e98672f00aa626ed6553c8a289eb0000",
+    "042136ee2b32c534a03644a8b203cc86d89f3cef0e93bc8fca46167b1901be5f0000",
+    "673410af70b5841b71e76c0dd90ce6661fc739f366a87e431dcc0c287b3dfac50000",
+    "22dee84cd644208775ecb34263721d7a3ade8bfce2f5b5c890d295a4a7c5f6c10100",
+    "3f562310fafa9313e326d17548234211f72c5f1f9b703395ed764364560ec8490000",
+    "31de834d118c6db0eeceab0a211d00fe872a7d36751e50c5deeb595701e7129b0000",
+    "84979f0566269677be2da42e7a5a2f36e43ad95d16f3a478bc44e629c434ce500100",
+    "b0bd4f8a218c94ad9fc22a85e0f16919e3f2c18293d1e3a099da9a41b7dc1dd30100",
+    "f125cb361ba638e1d7fa667fc26bae994a19769700e3922763a30b7a7465bb920000",
+    "c2ac27c6af04641682d57835cfa787581c95e8afb7e9b8d9afaaec02c8ba8f660100",
+    "24432c2eedb52d4964434319d8bb3c55ac967f5e92a1306341f68619edd096140000",
+    "cdf936da82813c7443d435531829bbeecc4705ec69c0b89670048e7c9193de480100",
+    "8fee2b0bfe6b94a5838d3b262f2bb040690eca461eebffb910581d2fe2a6730f0000",
+    "6e289b30b00ec00ab1a2daf456364e2f3feba7c2699bec4777ca83985008f8ca0000",
+    "263f7cb35b33d89213b5382b6bed2d7e32765c90794c31855650e93bcb949e460100",
+    "55d1aacc58eaa4be485ab076eb402a2c90fbcd3726584b55dfe2e1faa88225ce0000",
+    "f6e432320cf6f1f3b864a3d2b8e64fb64786b85da1e4290dd822bd0aa6697c980100",
+    "8b5801dc42f724254a04d64c8ed2461d8d46457debf25a2927c5de832c5964b40100",
+    "75ad35d828e88518bc1b241e961119771691ce7d045003dbc041e089b855c9440100",
+    "06fc350ccfcba3d37fccfe0e9a63be29dbcfbe805b2208ac9c4b21ac81c8f7d50000",
+    "ef14f2284138729e0c8c97f4bb22fb63eb869f0fb4d21161397608f9242d6cbf0100",
+    "368ce454df757ad66b52301327ae1e76b7c48e96a48d0adea6cf51b50d991c930000",
+    "828a070f3daf0f27f19e115d4f60a21edd9cc458d70190486cbccb90df37d5c90100",
+    "97719a80d0e3515e91bff52969b6ecb9b6501f1e0509cd8f6ffdc72eb58128ca0100",
+    "ac128062fb79a6748d4931333c9625d40f51e824486a4408875bfd86901746c10100",
+    "1cb7dac0f3bcf82485dcf47c390ba6b59a06d3a7f77c349090f239a9da92f3450100",
+    "e63a403d02f4b9b241c2ee8610076d1ecd62c2e9bc5ee8444a38867962ee6e580100",
+    "bd4272af85b358f4e28b5758596bf50a6cab58061916d0e6a19aa49767feeb340000",
+    "9e1b18be40c1390ed8b285f5ae46d8de678ce43586ceae7e4c18dfa0ef819fdb0100",
+    "63f9c7f6e1d0ab041521e27bea398f25bc2e5510ec98ec73cf6d7fe2e037684d0100",
+    "56ae180187a5421ee0450cb81d4864468be09d40881785091ae01fedc41986480000",
+    "2fd71fa6f73eacafdfd88b8984ba7ef77f3c3956d492fe01e7c1355af09ea67e0100",
+    "b2e9933ad5ff88e938847d9048293d95992cfbce99589767612c87fd1158abb00100",
+    "9e543f95438d791dd8e998a9a065b96d4a5ad2312861de273acd20b0df928cd60100",
+    "131e6e97c6f794ca45957de0dbd603017308117ae89e8578b5c2446f1238d75b0000",
+    "985905b7c00c8a66d74d094dc06dc0ffd2186a5744ca23cf5ffe626ca0eb808a0000",
+    "0b1b0dea706e1e9154a9f966a96c3014f691c5f781351e3de9eb5f2b966c4aff0100",
+    "591f6fefe1f9546e0ea42f67d55bccfb7e9bcb29d40713fb53e5d85ea4ead7cf0100",
+    "de2ad82b0a94954c3bc67b71660ea610e14b641cc6b1f3a74d08a2dec37e26ae0000",
+    "ccbcc9e631991b7b2d154170857b17cfd290a92ae6a0e0a389db68f49182bfb70000",
+    "f66538ed8bbe0d2d226e01343649650d89b17850dc52ef9e1dd47b8611d7b7ad0000",
+    "6b89ca2efb5255715da814802fbc43a306108878b4ed322bb18ca8460fdee39f0100",
+    "11fa1ca4ccc2d4ee05ebc98f048d2cc0d361da43c19d6111c9818d2ef9bb32380000",
+    "9b40af6f3e9d036ba3dd3fe1f4cd4a236fa758acf045dbe43c2ce38457b55e3e0000",
+    "e8e562950527b0bbfb109693b6ed8b43acc1635637a2842f21b53c63db9110960000",
+    "eae88e7207ac478f08027c416034e9d8332f55cb0b01cfa3630a2a9550974a400100",
+    "68c8c0df696f758288b1da0f352e863601be6501b3d34b26a71e1ecd894cfbd20100",
+    "4be973bf71822eded3be27cc9f9529eda75f698a3c08a125b73303570e0877f40100",
+    "a9e6aa1b4f9314c149562b10dffda2ccb02377857009ba8c6a5eb25890aff2e90000",
+    "1b34fc673f7b8124b6662b8c768f2536b34c3406b00c04620edbfb130ad613e80100",
+    "ed8bdd62ec6b0dba3454d62a6c4e7692b2cddeda62992fdddbd6d55e9e0d88bf0000",
+    "ae1835c742dd6df09f3eced956bdc7c3626afbfcc3d462553237824c88e7dcf50000",
+    "8539b5ae509520caee3b3251d0de06de988c68734cbac9cfc051142a9c28ded00100",
+    "816c7a20a4b610859d28bd29951ce943dc697e61e1e5b58cbdd39a8e4a19291f0000",
+    "f45b43c6778d8be4b5f2232f806b2735adcab5afa87ad5839947f107991385f50000",
+    "422982ca043725a0355924cc8c162cdc54442997821e47fe8d43ff3e7848bb230000",
+    "8cdeb1aa5c5cea7958e42025892a6a74bcce6794316a781ca6edb43363d231360000",
+    "c8c690446e5f334c847c13f1196992d7e6e751bb59af3868e1e90c7fec4e92910100",
+    "e0a613b14740ffa2819895bc704242f648864096ecf2e1a1122da0ae4566b87f0000",
+    "160fae2cec68ef019e89ad3e6384421a26a8d90e63b6e02ba6840ecf5a31f40b0000",
+    "a50ec90da07b74926ef9f0663e9c5ee42e434a71ac8ed860a5490e038775c7950100",
+    "fb11142ee7d91384997acf83c33ac4dcf9a4c475e6dd5fd074d665a1ad3102bc0100",
+    "32252089b6a4f57f146ef3545cd4847a47cce3469b1aa64b21fad3e8810494e30000",
+    "0bdf0f7fbc47a36203e804ef2056723e7421e08443d05c205144bfaa729ea9080100",
+    "f965a041e9a805aef2e9986d18879db869d2a3d619e2fb95b8b189aa5c2332a40100",
+    "844381175cbc67329e3660eb553a7f0f2e4bda75f127dd8209fba2066a3d286c0000",
+    "f1683f5b97bd2d9fab283e7bffa99978dd0ee7cdcccda3aa20c97e2e88ea736e0100",
+    "4a523c82e62b9fa77644ba729fd2a8e6d365721e732429a509d10168128ce2d40100",
+    "9d9ef97ecd166d17f7b2c6c2c23a5ea2a4f630aa01805a82346e8d21b1244a2a0100",
+    "c3ba900457b24456a2ec76e0dde44ef0bdf5a57584b37587f69e43f4070c2ead0100",
+    "832358402b12d2dfd13b860e15dbdc6cc113ea910993be1a48134e815a2303f70100",
+    "89724476257d827404b6f6a604c4dfde7736eb0d0f5020ec08fcbc1b24e861a40100",
+    "4c68aad122d6e452f3b29c221674335f0ab00308102c06d2eab080ab7d4017cc0100",
+    "4b93a0feed55bd7878330217a5cb3356bba98d41631445b049045f3d873d2afa0100",
+    "545f9e01a96b17af1f2f7feafec98de4c1980e2ceec863fd8ccdd92b6fa7f44c0100",
+    "f5580cf6281f61e126fe4a4447c4cfd6ef8aafbaf887c4198d0e54cc64ac83b50000",
+    "f249ceb4f640c1b91540c20d89fec451334dbcf501e220ae50dd9366edd95f510000",
+    "6083a3b5af82878407e41abcffda790d9b077bdf2403778d33bfdccab5810a800000",
+    "3f39ad4252e601db2ea736d52597ade15841c1347829331e1a827199ae270c6f0100",
+    "b349d0320e6a81e3d0670d9503eaf69be3e8096139873e723efd2cd29da759ac0100",
+    "a8cc653a4d9fb7a1d424451cce1c8c12b7790ca75b85514a81c829deec2414cf0000",
+    "af0f28aea557b3b37a6968c8f676f25cb8bcdaaa744e70b84d0f564b07283b420000",
+    "11bc1b9e72d9ad755a657baad0769bea09617f4d8e862f632b4d16ef9bb2a2200000",
+    "f8e4379a27352bc310bc568038dab21af6622e1b70cab112f3c668ae4a1120160000",
+    "d2f2f50d5ab476eb1617bafa2c705d9da552fdddb056061ca3216888e9b8905d0100",
+    "8a44e16659d51ce88650cbfc015e0718bc245880fea284fc47b057dbd4d843320000",
+    "326e1c3c950724ee235f836b84e161331121931a3f2e37efa6d61a61d96421b80100",
+    "c5951cc60d0444aec2164eb6109c1c647a463e69936da61a76be0d82865237230000",
+    "1e1b3f6d2fc4f4fd1b8f2c2949480beeca52af62ebe5b0cfc509768f9b28078e0100",
+    "d9b20ee35cc4f8ad345a2da2df20081778691b0adbeee837c6f5fb1ea1359f710100",
+    "543661fee86d0f63b43a63aca51baf17a44039181605b2efb6988428f29de4460000",
+    "4245cd268746187e9ec84be6cd2c79840ea3c051b234579c6456418514ce08b60100",
+    "c1efc4d00e5f7068ebb188cd7c9271ae58ffe98489dfe916e1b3cca1afe230940100",
+    "8d93d18d386be74322aa419b7f62939b31a454d7f5a1e2290fa86bd4b82a13910100",
+    "8ac637b6c00d7e24365de2b0b0b23881934390220c7a07fa925937a8337202960100",
+    "051bec07c4c3f8a9cd0e6db207e5d5ec98750c27049481faea5dae465579b7a90100",
+    "d1bc2076605281934075de5453c41a752de9bcaf5fbe54c86d2b60e32ca6722e0100",
+    "1365fff2a213a086fbccf7aeaaa2e97cc478fa7bddb0c79a4bc2d8ff161772ae0000",
+    "6c52608e5a39816ee1addfbaffc96563389500ffe4141ed14f4704bbf676ffae0000",
+    "26e7b525e58bbb289db5cff42b4edfbc85a67f5bfc201568565e5526fdcd244d0100",
+    "51d2dc1e78b721e25453bcc264a44ba04039d33812712386272e355bceda93470100",
+    "ea7221daad269a77100dab33103a573100c7db7a939c47cf079dbb89f66b3eff0100",
+    "be4f1aab98baa4ad9bd1f9c19fd7dcd517a4760057cb4ab2a5a8fda9192c856a0000",
+    "ed710f20a45129f60f9cf7570f304a63afcf7c650e66f356154ddf9d6eedc6c40000",
+    "b343d7bbbd1fc80a225f1c4cca71720c90035425f9786b286bfaf60859e8ae390000",
+    "84e53a182fb7af6fbc790cca2d0d2edb6c6edba624c92fb09ca06f4fbed2e5850000",
+    "bf8a73ba9aba9ae568e84936ae294beb20bafd15daab85e9028803e582d7eeee0000",
+    "7370b7f664ae25f81a7ee9017060da67e6b372a775ec10e20f66d0f2997f39320100",
+    "db0db8ec466133733e0f4d30f325dc71bd65cb1c4a21685fbee846e8359cbf310000",
+    "1f1cfb8986a24e75a4939115930f8e543a5bd7be56af9c855fd84c9ad41d670d0000",
+    "89f7007b3f6d81b866b1faf90427b501fc53f09e84d4d85eca443dc9d7599ed00000",
+    "bb4c12ed7c307ba3185aace01de0b40608a82ee901740c204b630c3e44c2c7e20100",
+    "909c47edcc32202945e09ca80f58c2700d418854113b0c073b0ca1487b14118c0000",
+    "6374f60838c4ade75f03b825e1a10ea8fccabf3abf287633f49c90554465abbd0000",
+    "62c887f2d4b56f899e97321263dc4d1ab128cd83636c7dc02a8a34d4735545000000",
+    "1b7bf7b5277b5eb61dd5ce8e2e8c83ab922db6bf8f4244efb4cf3bb8d3f043080100",
+    "ec43381429e5520e441eb7dd9b4c6fe557f063601bd8d289c9812690b0711a0b0000",
+    "d9224db778a7b869fc36029364f7d6b9374ceebd52365b5e82285893addd09350100",
+    "c36d92c9d220bd997a2e0f6890342eb74dbb2419daba6fd07ac0b1de1bd5f6ce0000",
+    "c981c503d6b0a329a7012a8634d733b57def77fcf1be80e7e0073bf0bcb37d710000",
+    "d01e428c2db761e5fd4f25ebd6e84f99c5546399ca8829d85ac0fbef45fa32ef0100",
+    "04712cb8701099b64105c1e3520c8e7c615af8d037b1246c08885ae7b66aa7840100",
+    "10ab0003ae3c974cb208fb8b036524f8a8507bf98293af3d62ad884017a986800100",
+    "28d4e92b9d5213b8d15d34fdf59a7b8ca9ec8dbba3364fdabad6832fd767ca6e0100",
+    "861df3e868cbdede7772032667666aefcbdb74ab6a814b66ee9ea9ba1e9ee5430000",
+    "b085a6cca8b82f78ed29c350ae67b01e9edaeb30889d075f647fe3c75dc70eb90100",
+    "6f5d007dd5a738fa992218d057710bc9564914a999984602f973ee98ae7b5df50100",
+    "b2a9d937f67bf35101dc11a2ea00a08fa19133558b81be5b587f67f1f177962f0100",
+    "2f05d30ad2130ed9a6fec1b66db95e4d7bbb3c23ebb98d502f23c6a505154d3f0100",
+    "7a985d5b2672933a764833071f80328b3a9da451f62d79ffcb8ee742e29f61f10100",
+    "2db668863724f98a4c6f3db0b367dfa1914d241f458d095e7b38fd549abe3dcd0100",
+    "25f038c6a6f2476977be2fe119adce5f70580ec78f08770d6b4ceb54001c009a0000",
+    "3333a481c33d53b3b16573608aa87b97e05459250b351cfe6938d567d6a4f1770100",
+    "79b996abc28b9d62fb723ca98eb7cdafd1772b430d157568819832fedb6e22d40100",
+    "ab9e39754006940ba6d1d3d80d9d70970ac7bb8e146f547bcf4c4087e29198680100",
+    "12b7fa0af5723ebedbcb239045c68939c73f96850a5d271be24c70fc673c41610100",
+    "eda1912b87f061236ebd73f8c03916912bacd54a7302afad46bb536c5e72cffc0000",
+    "969b36be2924512a8b8d97e4787973eb4681349fb79b613ab14c08f959c23bf60000",
+    "ac547291417c47a031d2605fe8224e4fde6be64bbb7d71ee1245033e81fa82960000",
+    "a40675858a554760cd7df372fbbb5fdacc871af0e58e6f4154239d78c9dc41dc0100",
+    "71c7582c54a5e0e7400381918552a22e55d853e04d117003dc1601020531487a0100",
+    "f58fd99763939c8216f7517f22a53eefa8a184d8744c28ba60377300ab3fdf550000",
+    "3dc44fd1287dc210f6087641b65dfaccc0748f09f03e7cd880d9775e98fa5f460100",
+    "a148b1fecb1f2ea3ac6373f9940c0a08eb74a2322c5e0032c42b56353cf8356c0000",
+    "3b92e117b77b763246bb28828ab959d0d48c2069ba17c1b6444fb862b9c09c2b0000",
+    "aa9ee029bee39578c0d2f88e62c94bbf89f8ba15bce6ffe1ff76918c2d199ca40100",
+    "41455aa73dc343214f0c1f2bf2173cc2908a18942134694639e4aa35d87b43c10100",
+    "6223379b523c9b135bad426202e2bae6e5d738e7942a83428efc3dc64aa874f30100",
+    "dd37b8318ae243dfae20b854f26288caf2a13a324a8040c9bf2d6ff93a85dff10000",
+    "39f8168c85a2016b49ba53aa2eb9079f0d4019d3785cc52487b04eee9f7bc3a00100",
+    "a49a3919e22c02a5475d82887878f5585b92460252a8efd44c42e061ed14db7e0000",
+    "3850beb19c6bca181a5f418197709afe0ecd50790b5685cae42bf7c608b4e8b60100",
+    "41b435c2c5eb3758a0047db3679120e799b7303a8290ff3f7e45e0c8892200820000",
+    "9a5abec634153a215670201a5f6b1e7c24d85a7ba6917897d872a627c28fd7900100",
+    "6643adf7b2861d3bc69ed345bed4fd2747ffb309e998aac58842f757547be1d30100",
+    "23a1ce78cdedc4893cd1ac1a05cb2a543dcb9ed04c5a7a4966ca915507f574ce0000",
+    "a4f68dec2dc21e8a925683a0b1c0737d18fd2fdf894a88430c4096e46f8469a70000",
+    "7a05430b7ef949c63fffcf7772419719a8ef73782fb92e494412af2c4859ec760100",
+    "d95455f3eb4c4521e5f078438c86d27329d34bd3c11a875c9f9df3f6ec0092070000",
+    "c7ca179164871de1b38acf4dfaf916a52f7979002e60518139dc00795a62cc3a0000",
+    "f36808ff1b7a40b3e7be9b51a80a5e40807b5f41c1ab097adff9537ff9b1aedb0000",
+    "0e078caf72fccf14b93f030a62b5c53117f921e643e9ade2fb4b7c7553bcf3b70000",
+    "3650fd05a85c40270a3d0d0ac6c4f9df10fadb7a91aa1ef5ec2ce02f464471630100",
+    "559497cc1c3f48f4d6a3dff26de9bcdb196f3a8626bd187947414f5f3bf55a2a0100",
+    "0d996277f4e0790d2987060da4e5e1ccc05d3ff6b1aab42a226b09baad60a30c0000",
+    "560b7b31610c429485b9c0aff359475bf1bbf82cb6c03cfefdf636f1c83eb12f0000",
+    "0ed75be7c796a9e9e8de4e25beb4f35b37e929c3320b0fb1fef06785e935700b0100",
+    "1e6a23273ffd67e1c784f05c5ee39a3da1332f8348d8936cc14e8d09b09834cc0100",
+    "bbd48f490654ae3e5d00fdb3ce5e6de1279a1f66f25a1a61fa9c7e882a3e64510000",
+    "2a9bfb2594be42652d9d1a0183d5063a33852fe27db17d21d9cf137d1f14d5ba0100",
+    "98229316a756795718f9bbe1d422bbdd6ab76e1153e3257ead1d5e94a595c9490100",
+    "09c916a5b6bb7f1a3f64611a6f553d74afcca95a7187a09952df474373c4a8900100",
+    "9d48d02330955ada3a00a1ac728f4c3016a547bd9e4bfdc570909b740a4d34de0000",
+    "90091ad534d28aaa37280071e5bdc3629c4cb294a0fc62bd3dc6596eeed52ed90100",
+    "cc07938479de3ac99dced74c2b8924634f06f54ddf3e7b3f87ff11ef602812e60100",
+    "e6c35e475c8b848bfbe2c1d4360f909f76a37f5394efeaa83af9fd68b4f0fa340100",
+    "f10a54ef055fdaae905f53724082f960a0c316036fd3a1ddf7d8ff2534cce3310000",
+    "57bd387d77b5be843cf388ec4fcacb6f902566365ecbdd504054919cd133b71d0100",
+    "a42e4b25307940fcd7a2e93e91451d198bcacc7f9a9e0c5659c5f212632f2d2f0100",
+    "4b1672c1c7141a15871afe47afd15d219339215821746385600be643ddacbe530000",
+    "f2488bebc42d350bfec3644c54783da303b9d02b7cd3ab26b0d623ce9d80692e0100",
+    "122ce5b29c913032d3442ca0870b8b684cc4f4168ec5235214339e93a924e6910100",
+    "fd6fbddbfdeebcf114e7825c3986f03095100f85395f97fe35d7683b9af109450000",
+    "a5facf9b0a8d7522f9dcf908112d3861817a8c2ad929ade5da6c73bd6fb69d620100",
+    "e34af5afa00fcaea209991eb83947539eb563f4947028f6e2e2259bdd246f4750000",
+    "084a4a15ec20cd23bed8ca24c09bee00ed9788d9666767b5b5e1cf8da1d035ce0000",
+    "473a0039a7c810192bc65eb9dea07c6edf97a0290db936e1aec314163702e7a70000",
+    "e749ac711e066d0dec3f1cad2df12fa5af55a153b73837c98e58227120cdd5170000",
+    "34b4dd2d405a1a9ca2479a1b1913fcc4a3f962c9830cd275fc497e12cd3c593d0100",
+    "90f5306dfaa9f58d93393191947395eeed8566ce91e0fd05c767a2551466aece0000",
+    "44604b8feb81a3e6a9cdcc2c5725ff48980cae73e37d85e96ce07368f1f7dc030000",
+    "bcd9ffacb61dee42cc5135a5f5e8114ea235984de6d2001532e96a514113988d0100",
+    "cc67e8d4f01fe5d6c740ee4fa0646c194d9c567650f03395c3205606268012f50100",
+    "ac5781a37e9d7e44e0628efaf7ea2e4d6f970844b9030483e69086b5cf61546d0000",
+    "0edf0abc864b63a2c78ea37bd21f70909743b3d2c241191d68aae80174976deb0100",
+    "89291bfdfe6de83ddf8792c9da5af34afb352ae4113b59f6ed1e134d39938cb80100",
+    "fee002805db310ef4efbc7b11a6caaf929fdd72ca9a507299f1fce0e86d8dfad0000",
+    "b852eb2057ca2ee81822e95a3fd002fae33cf369bf113d42209c8f0417c889240100",
+    "8cb558d31a3e45139e55ca781e037801fca13436eb9dfb8020b023294b6553390000",
+    "40c0609c9996d103b1aad5282c74599abe3c5364c1bc9121f21c4b8a0ba6c6700100",
+    "636c9802e0cd7b4a72d19e27a634d30ea8274cd55b46b7b9768411c83bf84bbd0000",
+    "90dfaefcdcc3d2c347c82045c81e94db7abef23d724de6f807064cd38471bf6b0100",
+    "66b2d480e83281941e6d497b3c35d273d384fbee1558d59ada86b3ca28f53d9d0100",
+    "770c68e67b38ed52d01c99ecbac20a0af288a407595ccbc0ddcbffa3d0a6b55a0100",
+    "539d51f01b3463566b3b3cf66ea992e915dea828593cd30c53d44cdf4f284e760100",
+    "54a73f08919c6249047121a54ef7c067640423a51bccda95e5c6b18397e1df550100",
+    "bee1bcd346931ab72cd89f27ccd941519f8b81543c9e829707d5d4dff91e3f080100",
+    "792a1fac4cea1850b78916649d2feb4f2242a74aeab903b2ca3ab6deca00f3080000",
+    "8bdce95c5111afdcb85b050fc5677cc8f2682d4e2dc317b1255d22d963ad748c0100",
+    "429c3942e94786f717e8f4e7c1bc4a56d73e75e27fcb9209be34c48e633777460100",
+    "beb7c0edc7458aff7fda0c22d559d08418f4139c7dd6199c8ec8f5a3237103280100",
+    "845fe8f7f342b1f947bc2fa5cf0850a42095fcdd47bfde60c4eb7d2fd9ccbb860000",
+    "710c5f0b192657d6a6ddd3489ac5a6259f3214bed5dbb36362c99575daccf2950100",
+    "8cd8aa52c61a670de559eb8d0a011a20e09adc50640234fbd14ef52c55c761390100",
+    "6b674faea5a9387eaac2ad099924e4e11912f5aef290e8dece88f48a5a900a080100",
+    "bb6b6841ecc97cc67f3f4a67486d971363fceb4426319e0dcb8b84c6d3aca3340100",
+    "9e2dc54544d75f4e95426a6ae2c336ce95eb256feb006a7a88c593a6048397e40000",
+    "0708d9a033707f197448906581bbbb37e0fdb7bde11a64144d479f0341299af50000",
+    "73bee9af27507f3122b490e6649d03039fe5832651a8c9731f4c5adcd4c998fd0100",
+    "042490934375f81ad204d577608b6a49216b759923eb99e6072dcd6b59f4d4850100",
+    "1cbf87e1f9ee4c34a4495c4af46c42b3185afd3faffcb5773e5522b6f9e57ead0000",
+    "7dc926f44f10ff1e7f925b99e414ac963ddf1c08d2f2a2d564d1dfd9adc4bcb40000",
+    "7d21a7bf538485cb73d5435a05a249ca177670a8d0e82fe7b9f39cf0be8b2e740100",
+    "e67bae1a3cc6aa2b7bc12c6d565d5a7493cf381aeaf812f480ff615900d9e0220100",
+    "e0c043a5aa311eec263a3f20e0cad5be84a6a4e56ce46527e3a2f4edd1ea32440100",
+    "8ee502b85e11c5bd8bce042bfb106a156c489c2116e48ded80e635f4e60679fb0000",
+    "4ca211020336a38371ab16cb3da7dbdc3f9f355c57ae5143a4d1253288c319b80000",
+    "c7bb16d636447590716f6df2c2d1d05335c6cfc91a6c1fe505df264f80bc66410100",
+    "957af6cace423a7404ee3cbbf7b63f7f6631519cad74e2a45936192a08bf03c50100",
+    "4cd74c6866544652364663d991b64bf6adc8283ac44291050aacf42d254858f90100",
+    "e2b3600665a8b34f7746296aa757d1fefa44529d2541c8c472256c27be8b62790000",
+    "f44ba30789ad11504c8b0f57ff1f4b6847ccb7a257ce241f1f39db27391f6aa40100",
+    "4845a95c5b037619b085936fb74bb6880c107b40d06de6bd2c43c6f7a47250bf0100",
+    "a9588c85ac71e95020ae1940b0aa849a28e9059834e7a81990ccf91d3ba0cc8a0000",
+    "f71dacf73efdc150ac44a728267e6aa36eb23dc93e224bc745d5f0bc816329480000",
+    "a22ea66df51ca85872f5981438bcdcf22c1624f60979b3fafe298476478f1b1c0100",
+    "f5638aa6f33fb8a81025b5e7966ba9c11e425720a184f5e1b2a10cecdbfc8e130000",
+    "f510ddc35a445bcdd96228b47bd55e99ed24078f05356ccb6ae05a56e9cb63110000",
+    "e12d016cffe947887bc18f963d7e1b421e0b74a010de6655620f40136b0379ac0000",
+    "32759f184228e1fd56cbe2198b5e7870076a3dfde437881fcfa354adb5a3f9fa0000",
+    "bae9f4e6fd2800aa0ddea5ef15638f7f586616dffed3043d272f9c23a3beb6160000",
+    "2d0f35307d53ac6b0942f8cf6f032bd4f5bb56252dbcf383cdc1b67209a7763f0100",
+    "7211148bb8dfd3e174ca05512b1a72599cc6ba195664f5fc51df88517f44c1b60000",
+    "51dff0953f7b5e79ff1f38305218d663d6a06b67bdedf47601f43ce4b31d20870100",
+    "c8859f72528fc1780dd372fb544b8926cdb421377d722854360aa772ff15cccf0100",
+    "2eaceb59f2108f8098c2661ed5bc3f70d853973123e7df5ac2032610d7f6d5860100",
+    "93991c246fdce8b1738c8665df7cff2866fac5bdfa25bcb2f5022f0d9dadcb170100",
+    "c66372499f8f1f8fe23e5ede0416bb48fabea076f4f984ee8ab2a3d0e44b1bd70000",
+    "2c4b81b732b0b2dae726cc503c4b2b94f99442ca0f8dc80a784ae10c73df7ddc0000",
+    "f23f8a3c86a104313c1b48db0c64f7e6841596e68881c824eba581f489a3a8290000",
+    "e7d7d8d5ac8bbe48838e06139c3753f91913ad34868a36ab233b97e8da64d76e0000",
+    "06fca270150d3088d486d6cf7ce83d02b5d8fd8786896d26ab114514d91ffa000000",
+    "1b39bcea93da86b2bc7e45c11f065535625ec00879aa19b7e424962fd1133cd00000",
+    "4885c7c650c859b310abcfbdb65784086ea83b4185297f2af9c388c7819e5c6f0000",
+    "4dfaf5a4d2612e41435db9abc490c56e72457c8c804e8f3096d60471d0b7f4f90100",
+    "367efbaa3797af7c46b5b7a01f5f7a78e0696fbf4b121f3b8df35748cb9087150000",
+    "03512f69f641dadba8dff2a68383d090e41e484dbfb12810e636dd71aa9dcc960100",
+    "d28e0baad227df5b2119781ced6f1eb78cdc82de3359ccbba7d80591aabdcee30100",
+    "9936377cf3f1f0fc3ca7dc68455d5e9a25e8ab92b3b5050e7caa11bf7c60f7f60100",
+    "0f4c78b5f086af8e291356f81a8af8078d173f157d3ca208a96bc24d2925c1f20000",
+    "80d608a29b227c7b556282b6ab8c5695891b26b98933f5bcdece466013b99a300000",
+    "cd53125a3aa55dec5ec164b75733bdd9564d14f6c705918b273ee8049a3f06270000",
+    "6b0026810c9d783b36ee65bafcb1b12fde0b96dceb4510bcde1133d157ff64fc0000",
+    "6eecc87af77c432d402e030e5bb22f1fe9be44574c5f0a9513656729bd4e4be60000",
+    "0727bf99d45ce98ae05ae83a552ee998a16e09d1d15d13eaff5481d35563fe7e0000",
+    "9ca62079223341e474709d985ecd01bc75513f58275c8fcf81f5e39104be964c0000",
+    "fb4d6aa54cfbf24b30b1b53c0ab64c9972b1993cba60f057e8003025582eb6a40100",
+    "a4186080e54705215efb654d29ab385e0a06f12ffe7487b5739e62a45b6938880100",
+    "2a358a8668d1963ef6b362dae549836b80924869de0b3a88b70ee04d662dae5b0100",
+    "7ed70c50c5063fbf6f5d835a849f2367e3809f5cf2c715ef97a4bcd190f7148f0100",
+    "7f320b25d970cf502c90c58c944eebb1e5fdeafb7ec89913f43f453f9b5bb3f80100",
+    "493ae0097ac86a8d2c1674de64df9fc47b0b643dac7752ff5759ff72922a6f3c0000",
+    "b422e23c0cf20e10d353dbba5b4fa1c618d86d5453fc2fc2afddad8a98d3a8ff0000",
+    "5bd1156bb58ca17cdd11b6ffb8707fa1565f603de876127f46918c562aed97640100",
+    "f513d7b79c5b9b7a12432dc7a004daf75a0a3502f90816580fefbb5be14c55480000",
+    "f9496cf1fe5c656b6ee68af2a35538f8b34be4f0e8ae4377eec8ad6f373715e00000",
+    "df0ea4c55edb3ffcde5c043c27164286b7ad2f9537b9bddad3367223e11bd90d0000",
+    "11d32bc22db748fe8a506891ce79b9772563615bc78675d6741f2b4a8c37b0600100",
+    "8056e122ebd3eebb952c33467645ec59ece2114fc1ea5d64c5964596a331060f0000",
+    "6884deb62be87f4150d92d558c7739bd2127fd29c4d3ac17d00091874ff775660100",
+    "1aeac63fe6cb160d55a8149a2bc15e19412beab962b109b74e7713c34236c9460100",
+    "0d81017dd6430d3351d12a8bb85721583dadce5b66beb16e2049d3bdafea7b470100",
+    "800c81eb34e6a34ebecbf016424e91517ce0f41112041b336bea5fc0507a87980100",
+    "2f0c07e45504eedd74ffe8552c4225cb0d75670aa55c6f92943d3f9ce93377630000",
+    "e6dc911567b2936acdd03de15f710484ed57648b03db34e43031d3d5f3b4352c0100",
+    "076c091bfdde5627a4687c4ada8eeb71309affe5adf560de2592017b2a93c39b0000",
+    "f14442ac4fa0c3a1518ebd3768a2a4e3dd63d30017110972b800635d284804e50000",
+    "3172adf603fa22f788fad01be06b0f90e72be0445130a45825501c8da51af8240000",
+    "c90403344d2827f0e47c50a8bc039e53de1f601f43f0b1f10f82a219e25609b20100",
+    "0e5853f426f78f3ffca6c8f9c7fa3e95571e0e54847571e5a55b1aad65f53b5d0100",
+    "442021af793be961e1f0c9173f8265098e4eae1100487b489f72c194e59999850100",
+    "90b320895212f92da3b1607409fc96222c732494e6348b0568df8d84c0a5b7d80000",
+    "d480aa02d99310267d36c8b0b1ad78e6db7aefe2a8d1257b47550bccdb1df2820000",
+    "d59c099a7ffa93f9675241f458c196cdb8b6e3526c9bf9e70313be030396fd1a0000",
+    "6047f2c981a1aa1f5b58b1a1ed6d61a168fa6e3217a35bbc86b51afccc38752f0100",
+    "430f8fa9e5d08c49a4ba68eeebe0c3754c3df3e21712d2e01cc438f734b040920000",
+    "abb63f80ace2c2909212d72f829e8f3b1ed3e5119211a0347778a25f08fae88c0100",
+    "ac742c1f152554040db5d0f97a9462badbb6cb54960cd220a278cce49ed17bb00100",
+    "cef08bcc55dda34329f3e7091c5d2cd0471d9d537f43dc3879c9ad778b1a9a3a0100",
+    "0e929a1cb336e23da274ace1f4b95c9c4ccfa218ae1d5ee49baf8890f52550f30100",
+    "aa9f7b4452277d3d7e9ee4a95ce23d605bf1ca809d1c92a63ec58774385538b40100",
+    "b37dee3d2068545e795781967250674628f46cbb5769fba762c32674c55b019d0000",
+    "fefc4264fd93caabd32a4e7e169e1449dc672914f45fe599b147b1f90329e0da0100",
+    "17a798335549151b63e3f0ab84884de223cd340dcfb1e2d2473f638775e22dd80100",
+    "bf4f3bcf7e4a3db11e976da458a33b545564aa6e1fe78d56d494a2ecb1d2b6940100",
+    "6ce9d09d36edcd77a131e6fba43cb89cc3f417ed9e7eb1d155add6106db286280100",
+    "5eb83d46929dca0999939def5195937eb0bdd0da8e98766e52e3ef46e0fa16c00000",
+    "4e6399bf93d7e55eec46baad401dddabb7b948ab1cb337cf9b0b651649357ec60000",
+    "47d1354e2e793854c15a80cddc454df8a17f981228da86415eb303e8d83a598b0100",
+    "12371d7081599c340f863901c70601637b0e21fbb9ca415d3868bf7732aa67d80100",
+    "4d8672d79c7baa66d91c59c1237ca81aec4d66c0422c00ecd3947c05c03ef2fa0000",
+    "598441095777a131490f9852ba31fcc18b4670f23d1f17c782d1d5eb54b42ec00000",
+    "1bd72b60aa84a0e36dca5cd2b603c5b80fb9a44ac6903227d1f5a23e72b6b78d0000",
+    "629b38c43842c4282a7c4e263f7a55a2832a367d59d9151e2e762f45fba93ecd0100",
+    "d8eb586f6e48bd0251da950daec7efe668b5e3387d5cbb0c3af8fd0b6a2b75090000",
+    "578fed12678a76a2f7b3738b7728a2aa2341ed4eeee45b1126682f396d0b7f100000",
+    "6bc2486d76e17c6af22363146af2a9c397fc91b367b1f36782071d1ab8dfe5d10100",
+    "5843752113fcec5ba60030b43e46f6660bfd6f9d1f865f650a43e659c8c207580000",
+    "8743e8327d9abc50638ae162602b9f1f8b4a026b991b408a00186b3dd6229fb20100",
+    "93a7b86c7b7ed5f055fc83d43e5877894d0bdaf7c8eb25778b50b9d80fa4b4be0000",
+    "37020375d127116cb2868fbb1bce93b1b40e3bfac6ca4fe4f1c2adb9d3fd7f6f0000",
+    "a3962d7d5181455f4ccb9920f3a41dc2923a84fa7ec5cb6137d73b05be49031e0000",
+    "45feeb2d865461a49fbfc727d34660efaaeb687ed2c1d1d0ed5e592658a1b3cd0100",
+    "4080e65923c430fdd473f6f6d998a53620caeca717024a121ce90f2c2fad73720100",
+    "4a0b85637f7cd44b121cd2bdc420ad1f233e02d103ba2fb20de886dbda6b88360000",
+    "60c648d01c704cbe4e91ef016c49cfb7090778a613f2ac3bb790dc70524cb5830100",
+    "8b793464c3db06d2c9f6b5193eca679b189066b6c5e6784c31a81c963e94564b0100",
+    "ee84b4a0d255d9260fc98938a7f71627d50a87cb11af85e75407409e362bedf70100",
+    "76e1233da45cda3580bb0ed6096b352ff5fd7fc92026d0a48b4227d6a2a599fe0000",
+    "a6dbf4ecb840aa0304d4e29fb79e586d62f2435d83cfbe7c634688df9c11626b0000",
+    "3aed4054502ddd76366869d088f43b5d613d44e12432b8b19e4fcc46f3718fc00100",
+    "8be36e794989d9c1eaa872277db19726ad9bdb44d4ee5758b85d44655afe3f450000",
+    "625b232033a8d89eedc03796bfcd487994a8b83c03b0cb0942e56555fc6ecbea0000",
+    "e64727ee5ac279986192f05214aa5f88e592a379b1dc45f5cb658637af50f7470100",
+    "4b9d946b1dad48ad764063d6a7b94f152283d653ecc85464076c8c4cf29593860000",
+    "a8d9e685d84012e900c815435290f0853225b642b52a1bb898198348281baa5a0100",
+    "6bcf6606872be3334ab289c34e0055efe63cc671ce07a6e5e8ef0bab203731a30100",
+    "c395e760653049510df2d0470084c77cd533fb398807f2bb595e7dfc7a569fa90100",
+    "7e7c4b12b00f22f92a9ae16e8e286a90ce2d84e5af3d2d4fae4e7fb823ed6e8e0000",
+    "19115d20edbc81adb0bd6f277407df1f308069fb18ed08152f583654230d29eb0000",
+    "8cf019301eea818e7cc0659644c53383e0e5783342051e6f96d7e6d4dc49daf10100",
+    "8f27cab4366ead6e3c8be0b2f0ecbb59679a476b9b5511a36a2c9311b057fcf20100",
+    "5bae5c079a5588ad96c9624486077955c580cdadc5a647cfcbec9caa1d45be080100",
+    "2a12b490c1583eed323a3ceedb7fb41455ce46556988c015f775e080efda114a0000",
+    "3e03738d720e2a37f7d354efa3c2ae1f5dd8574dad21a1677fe5ee03c51863ec0100",
+    "92295acccd3d9e4d4518aa543f556124245f27ef86f747771c386e92fddb3ffd0100",
+    "3b1dd84c19ca70844d8759c4f1fde5ba8a0fa9e0676725beaf14271fe711553e0100",
+    "6d3192a103692450d0c61d4070296bd25438bf6de8982a4b3787bb2f635bf5040100",
+    "90dd8d2e3c35d5ffc89427eae9c115fe2c6e63c1555d9762f6097e8bf834f43d0100",
+    "ee2da728aae05dfdffd50e8bd2969231fc14bb3b17bff41d7bb4ce493a224fae0000",
+    "01acdaf39f034fe9c68b90ac482880fd39406926a2fecd1e507358e24bd469100000",
+    "a6a3fcafdc7f03d9d489188676e288d7a850adac711da9a5ed5aa1d531f781170000",
+    "2f74d89f8b7e4667cc728422e031f17c173edc24c8dc6cc124bdf95ad0739cb50000",
+    "70f3f7976dc810cb537175382029875c32d021bfeb5321ab528c87a37eeb94430000",
+    "9a3c9de8781e0bd2a44e942b2965c80b95cbeea34a91f017d7279e8e1fe25e5a0100",
+    "f67440a01ecd2ca298073f67ef5508aba532d548e09b1c46736419078ab72a290000",
+    "1c0a7c64725a4c625d0281655bb92d27cfeb352b15df3e1a1d0982140068a39f0100",
+    "59ca5605c1c5746ca706857f61b085159532d398addffc71ddc977fd9e6cd09b0000",
+    "c1b71ba4d4dcbb46643a5957a9036dba9b7c979fc5e8c9349c31679190f789480000",
+    "2fd4956c4c4ec25056ccb6c3d106e643ce67b4f3eeef03d6f7bbe5232f13d9b90000",
+    "801cd1a8695df7313159a19f116b5d188837b467712213c38f420923f00556960100",
+    "aae1ece8f7d97c693e2f8826b85d56b3564300b3c4d362771fa201aa6168c43c0000",
+    "28a5a8d9a0d14e8cf76972e010f79a8c530237876c96bdf1bad22958b9303c9f0100",
+    "b531c792589d5bea04bfa782c4ae7e6d275450c50dd9d4fe23231e84367f06060000",
+    "82d7434f288595e5e996736b95827e4adf54411400911f1108f0723a588ab9450000",
+    "0adb37cf0ba490e5edb3357f9647701008e44bf7b6afcae7b69030fe1761a14f0000",
+    "132ef5d9c014f250b5ce5b1c2d12555ddb183d9a64a7311060c689ab299154e30000",
+    "1ee5aa5d5b855fd477d070b1ee7b60d636cb14ed5acb5cf175037926df8a579f0100",
+    "7376abcec5efb7a73fca3b31284c5e643463ee54b6760431ec8616c23445db7e0100",
+    "8225c88346ab1ef9f9e4d4ab158e3c4844d022c493315ded62cbba8b1953e00c0000",
+    "27bed63e7fc8e16411ee3eaed8cc0fc1e1886d3b90c6fe47c01e8f959723fb690000",
+    "a07003eb468cf364483cbdac3a92019ce49137f26c185778578df032ad46c1a60100",
+    "57b6a0a4c3986457d650eb6dfc84c3a39e81facf11021b480e62f6e6c074852b0100",
+    "f6a5c5f503c91ddaa42137d361fafae6d3bea852462fd9006b6460d7acee78d40100",
+    "88d19cebd8943c09b0633dab2d00eb844b5f94b77bd0d38a09968a891ce9fc9b0100",
+    "bdfefed8274a7d3c47ac185184caef33102cec7e1e038f4835e7b2ab7817fc180100",
+    "3c816c690f756d6cf89076de0f6d4e837ef5bf079a98d21a17d1bd0a7b0f990a0000",
+    "c411825dfd5f33bf3eeb3712c7ffac0623982fdb78299a3a126b1cb4e6e08fa40000",
+    "02e3fca6ce5e8cab1cc6b862911d0f14a673aee4f48e7bca307739a77e11d8320000",
+    "790d2b6bf96cc42aaefad01e7169e0bd19e84ed9739799e3aaf67908abdfac760100",
+    "ad8cbdaaa1d1db56718b56e8b125f3d2569701abbb5d4aa20b05011cc6fc1e490000",
+    "449a6c9cdaf4ea8301a76a2a5255bd8a6495b8d594391baae33b69b67e5ca58c0100",
+    "486968f340f800b1b1ca3945a6632547106c3bec1b5588edff061536d9f1bdc00100",
+    "584705f8d0bde199dbfa32cea621cb20ccb2d2f646b63d9e93a8803f2b920ba60100",
+    "1d901f9e8e22a4911081fc989f9fe9aa00b00b3ec0f978c38b9ee5be43b0dac10000",
+    "3813657aebed986c5a0502d40816771dfa994f8c4bcd8ceec915447ab0cdd0630100",
+    "b748a617b1d79cbd3e993c1feffe63b785444e2dffa3e32fdd48458ab99875570000",
+    "88d6643297dc6859fb30b6c6299d5fbfa3f59999dd48b5259ba911a96fd402310100",
+    "14425a6b14d7eb523096f0f8d559bba9127b90054a31e61d57a31d4587d00e1c0000",
+    "a20826bf4cf52da357bbf787fb10cb7145fa128eda92531f5030a913b7a9075f0100",
+    "ad180a22bfdabec995290ca2aa5b81afd944c111affbb8d08a3ec90ee993deba0000",
+    "9de4f03b08dcb67c0fccc1513d2ca00fd104feb175f4df52320c30feb5c6f8b80000",
+    "d3627d8d6cf4884012dc7dbc20fea1ed1989a22a972a4751ab8a42a007fac32e0000",
+    "ecd1de8cf7684eb0057bca83c9a854e0887c628e34e0c289cbd53c49f3e2acde0000",
+    "60f67920fcf8a1fdfe2a79e3291dff19ca20b5ce64083955a53057f886f103fe0000",
+    "54824959b26e14532c0a0d47abcff6a0bc63788e7aa6b3b1faceb93806e202f80000",
+    "9eb2636a5f3b12b1fdaf1eec51e773be5af048359714600e900e8f6f71027c2b0100",
+    "1185cded8ea120196bc9d11ce07df0d0efc133bf68b22b7fee65aa370aa545980000",
+    "38a38ca63bb35435605b9b351b4d07b53095ce554767907f0663b99c1660aa970100",
+    "7c9850e22b127fed635580a8465fd8700e1ecefd85686c348903bf21a30a02a00000",
+    "b301935ea476654b61d846a10dda2a8edbaedbd2206615405eda63498c2912df0100",
+    "e852f66740dbcbcaedbdfbe8fa815f5949e98c5ff35d8b6d4072dca454161b540100",
+    "1bdf1952d9691d6c3b3f4a27587902f70be214bffbf3ad05912d3423174502c20000",
+    "2005da013f2a0d0b93baf5bca7cfe16efeb440fe183b70b66c64637014e900b20100",
+    "8e0ae9b0efede619d1260af828a195899487fb719483da0400c39e556189dc620000",
+    "c48dc7fd6c38e3c5d71cdce249014fd9b7229d44e0f2d4832018b14d9bdad8290100",
+    "45c1b08b021aa28bf793c7f597278fb71de791106f512cfe8152aeada064c94b0100",
+    "42d5e56b67653e4b4c209b6f094497afeeac2cc5f63a37b85dd0ce00a6055ec90000",
+    "5bab0d076fa49a5e3e0f1fa9f2ef71800ba954738a3a99ec771913a7d9ab0af40100",
+    "9c15393d6cec70e11cfa8985bb8223d76caa87a21c593a192341540909df09bc0100",
+    "8e2d592ae21378a8f883c14e1962a3f0fe05504b972ee28ab1952f01c02845870100",
+    "fa85748b4afd79161b1d3fe2c8a340d942f76293728a69e2831b641a2c2635570100",
+    "912aaa1b20e741c9288ae003961371dafb621194f4aed374751afa75d7e5cd430100",
+    "6a22cb99142ac1fc6d2647f633abe7eb89517e7da4de4f06324a2920710d271e0100",
+    "aab2c708864b0e226bc201494d6d7e6a5f782ee53354c1222af4e15a58074a470100",
+    "ffbe4273aafce91ee0346e329425e79853ecf29a9aa2efd0fd295f0944c31f310000",
+    "b120a22b7265bf767835ba27d7ec13a0a8a03dc66919723bbd0abbce14e600760100",
+    "2ead26f5f8dac596cbb4c46b8d3fa667af471aa7f55f47164342ace1ffc319840100",
+    "1443439d69a316ad0758e912a9f159eba34b43e75959b33ea99d4019991b27040000",
+    "80e023ad783d48c5a3aa8fe84d52a10d7ed2ae97a689f626bf04558da2a154700000",
+    "562869d3ec8bbccff4e89bca654d31045a2e346f2fd5915a7463db2df5044db20100",
+    "e31aeb4d76706421a5155427be88e441a29dac057e5dc4b967f1809fef4fe9770000",
+    "6a31f916224ae023536e214ed5a041e3dde07f788c8b7ef95356ca7e1f2195340100",
+    "484a185471c287cde0763378cef776acc08e455ff60ed3353c5260132911e0940100",
+    "0faa3f4c1720ded3a4262a9b15318f1d4723626a8aa0dc79d3836ebf31c4e5050100",
+    "21e94db7ee3442d6d281b5eacf4ba41f6ddf45ebfb04af21a0751e7c61cfc2b70100",
+    "8743dfd6896332ecd7ebee2837b725eae0a24a846791b0d7aa8abf91c342b76a0000",
+    "11e5bc77f3c0c9aec5a871ade21c33b574bf6d399bdc97c10ee7705258bf15eb0100",
+    "5821235c2549f5621dbc1cf7116b80172e232990676aab7c43300a3781852dd10000",
+    "c6e85f2bcf1fb023fc5c61f45c4695e620273691e1d0611ee7340ae6708e5f2e0000",
+    "eb5a3892abc9f8acd36b4d4c88e77136d22cf3a71b61e25f037e6a30a79076640100",
+    "d7111868d53d0f8aac2461c265ab61ab5dd53ece4f858c9c8f41e7edf0d2c4940100",
+    "b394aacc68c55a691097edf23c0bfff3ac6ee28f73e1181c7df146ae64e1194f0100",
+    "714f34e83bf5d4c58e9ed909e7394361ff5272b7cc039148aa2403e19f36c7920000",
+    "e95dd43f1535ea58f1f5d91a72bf1f727e6e64b126428a0f7ed293bc294d7ebb0000",
+    "868058e62e5f4dbbf9da5cc437a6ad0fa0d3b664e2d816ebc8c6394a1980a5120000",
+    "25e963859f656f03d8e1193e1718b49fbfca0b03e83e6ee6fd17d3ee9543b5440100",
+    "bc58ae2b1f4b2ddfbbbe85514bed3829a8c86b59a78861a9e6f5a6db9ff78fdd0000",
+    "19603f354085760d0a1083a7eb5dc3c77593e49b819014d5765fe02bd64cc2230000",
+    "46c2e0c303883a5f18cf6893deb323bf30b418395fbefb2560f109e70824619a0000",
+    "0246363eaee2b65ae0a63f767050860f46b2347f7e8de1c413d8e530bd25271b0100",
+    "6927d553ecfc3f985cd44f9fb0a624a9fded81d19699c9fbd09ff31c4fa5647b0100",
+    "9017b688740562487a1f4737005d2dc76d049a213a0197086e5611305e8405370100",
+    "02038e31907aca40be144a8ecd852df0f5468df94539f3ba80e97a2f3b9396e90100",
+    "2c2e8398af26431b209215e682c5d4e6509db24136cc7fe6d4b7a37b88b4464c0100",
+    "3ac60ed633a6f3d90429282897af1f28e198d85a72339f72c94c2afcbe55eb140100",
+    "3d05e347ab86f1b1818ba82a186983a1d90068ebd0c130b199f34fba2f011c850000",
+    "b0a80872ea2c641b9e6ad986f42f9a4f7a13e965311f4ce9b0fded85fc16e7460000",
+    "8cdb8d0eb3328c9f75f6be05966f02555b7652da2fcc2ac268ee10d7d3bc33720000",
+    "4cfb218653662afb86afb7360f9a26873e02285ee0b774c28c99b8a7732bf6330100",
+    "63c4e17a609075f56888408d9c163540a603b768c0c0f04359a8c0a7ed7ab4530100",
+    "8254976b187c490544808b35538654c0cfd6c44417094926b678e928703f7a430100",
+    "2d2fe88e2928ffa08482069a8b868169538ee3b31c2b1994f9547bf7bcd72f7e0100",
+    "1cea80f6c50bf1337b9fa2e71fc645281306bffe1ca3ffc3be07fda6fcb120a60100",
+    "7b52d6ad860d829a1ed43229fab1430df06e52e1a64a78e86765a58c8ab4ad3e0000",
+    "4b4f97c90a203575d7e1b3405d837a8f107b4ba1f9dde4618be6a7e9670734860100",
+    "4e9cde6c7b82e71d651734142408dcd97a47c4d144fed74e3782d6ab7730e1930100",
+    "d56803444fb9e1b779b15df10f7c91ddb276bb925a2d1b32367a90ebffb021e90100",
+    "bae9be49e835b6f6a204d5dffe0ece26036dcbd2264b0454be26d8476b066bb30000",
+    "9df85a5dff23bdfd8a00d2330745447991aa9800417bdf952fb4937da90497c80000",
+    "9f1c05a0af9a70b398d2ddb44bef793f7b53fe1f38b9babeab270a95fa0478b70000",
+    "38707de9b30037384f32958056160152aeafccee5633c21db18cc5a906849d520000",
+    "3bc5309d8a783e9990c336d803179a0b938616e3b31798efafdf95800f6d887d0000",
+    "95a581847f1d3cc4ff66ee7e17756669a0d9d7396a3319f98a4e21c8a3b97ef40100",
+    "d6da27c305edbbae5b1d8f562409092e7eb1a5269f6cc51234aadc065a48a50c0000",
+    "909dc2589c54218b9b986a4e2bfa036423d20ef11d132c60738c5b95e1b3e7990000",
+    "dbf2ccfd7596a8e00536ce29c83528e07b84b300e70705630d928884f96317c80000",
+    "4632091e4b7dca572e96c017e70f13172848507407a1e72f5b30515a6ba508e00000",
+    "35c9661265efd23917b8f8a174ee277c0d56f76e9a3ddfb0187fcad60baa04800100",
+    "0485db60acacc1dc3b7f40f6330cd1cc1c2a37a0e0a2412768ae729aa492dc8f0100",
+    "9502c6e65f4d1661bb33b36d3becca0f3ecf17a1b20110e42b10e2214eb4ce470100",
+    "5f618f7da9e72aad81ad8f11942b524b7435ddf8847bc9734c36ac34aae574ee0000",
+    "6b63e68e557dcdadd4898bc4a6c0b8269ef945a34e146a4a557958621f9db77e0000",
+    "0627ada4fea9cf1e0bfc72c34f969b97293c55c4a758697b3498dc33eeab158b0000",
+    "1a615e6c4a1225f4acd51f4bcc366423d9efddf0cf350f2060ac7188005a09a60000",
+    "2d2c04b8fb60a55b4b052a62814d0ed862926232376215165f33229f025981320000",
+    "98952f6a6fc1191bad9e0046d2e20b7e5e8cf91744fbea80bce4395fbfd1c5710100",
+    "0e97dc2ec3c1e87850ad913699709d20c55d972bcbaa85a31fb6f149a0dad56a0100",
+    "8873c84b48f7ea869267a7c4d89d0d1748653fde5f0bbb42032e365c3fb5f55d0100",
+    "4d5e5a97be32af39d5d82abdb9477d66e9499b5221b8f680506cfca14da116060100",
+    "127591f12d0ed3460515d68861dcb8e105dcc43ca75b33c3897ae66a0607f9d20000",
+    "ce9a2e32b9ab53c34061006bb8c60683cc00b270c20dea73549bc40e34364ae10000",
+    "aa4f7b20a9b539a1f788cb10f1ee8150d5d62cd900ddfba7e864f5454eb551420000",
+    "f286a07f557ebb640a6bf1d90f624ed6b2fc3330b340b59149050bfd9b3b72f10100",
+    "3d96ddba0ac6bbbcc72218dd7adedec1a4e3b6ee7b9a4294b1949b307df0a6e70000",
+    "35dfc71f0437cbc1b22e1f8547a1937b2a56da6dc96057da8f49ae1961d0318e0100",
+    "31a70ddd57896e74e3bd39f3677f0a73e2dbcbb5a3ec3718b8235c5db31de5460000",
+    "f827bec30d4e23a225693a0e76a4e57ea38dd951a87c5f026f4bc79a74548c170000",
+    "384937cf2cbd57c9969bba221229633983dfe6f5a68caf58db3e92e9c7997b790100",
+    "ee0fb90f7cc7329075e3048c79a8b21afa047c3cbe9705d2ee49aceb515d6d8d0000",
+    "09a291793e8474f9e2e8657645c70a431100ae80b137ec3cec05119a76620a910000",
+    "3c127521df32f14d53720213605c83a6b5e1c456f15050df36ff23bba1b4cdb20100",
+    "41cc7ea2db5d49f6a879a4e0602b3f42149ae0c90e93d4b72da32a016aba177c0000",
+    "62884cba4491da26c57ff8c0f48e4dd04b7ef6428dda943ae7ca1bbefa39626b0000",
+    "b30943a2ead525ff13e5bfe82c71589fc5bfe663a954b9be8e4dccd702a7c1890100",
+    "aef1ce1099260e362311cb956cf81577d6fbea9b02bf5004964347acf4ae9ad10100",
+    "38573ca208a5fb2473f3d8207acb0ce95eed456cd10b29b5e7b32999ffa9e0100100",
+    "63e4963638634b8ef55d9fa15329db325ee7ecbd68156ffc5f05ef4762fac0520000",
+    "df1555cf4bb41bc7f56c144893d01f88c7498aa1818bee26f888636e925e77990000",
+    "ff93d9c707e23773bc32e7088f9bd4639069d078c62bbe4f671589c461417a9e0100",
+    "b79814388b5a322aa011c841b757a94e4377ba926b2f261717a4cc72bac29b9a0100",
+    "a28381e9ef1595937cd00bca7cfa4f642674c96efa5ae63c512761bc506780500100",
+    "9167c908e838acdb38f5fc3cebf83126b6537da8a643770c908d44a9a15be14d0100",
+    "a01cc51cb8d4f32d98c6bd3a4fa2115955ece87939bdf77698eaa162ed7a39220100",
+    "6cc467d88b4009afb35779567fc9206c3f7f39c7103136a166041623ea9063800000",
+    "fffca3dcdccc3b0ab7f9b8edfd316785e99b0fe61eab6d46dce2e892a554c7150000",
+    "be890fd3afc48f085319c17c4694f3435671e24e24899216bbdda8c47b6e0ebd0000",
+    "b3f415ad436903f46031049329ef51a19309223bfea0c3e3ab00a77ddb906fa50000",
+    "694fc467e5ccf0c3cf075f2ce1940a6b6128e940fa3dd4d44a90ad6a51d41b8d0100",
+    "2bef1a93d84a04a2d47223fa585c2f4dbf3926a12e0a24b89311d7db3573a1210100",
+    "4c9430d42f271c691ff345f3c04baff15d691c93f63f172209205973ca869d4e0100",
+    "f0919617f0fb8d5d99680e5bfc9dd9670ba82565c6ac9ef6b513bd659aa03bde0100",
+    "459581475a15eab849fd8c0345359aee9ab7b0fb0b8c9f149db62f21dad0dad30100",
+    "3ce88d62ed0bb15d01f6084a9d7a9d1627e9d4a6797d87f167b73ccd422214ba0100",
+    "845c9b4e1a21e05f8b977ca693b4beb5f33bc63e8ffbf3cbf672ed72fce456690000",
+    "532b3b12e5903c67b419013c30867fdf2f0ea6496a06b0494b0a30acc2c078c20100",
+    "7297d7cc219f219600aff21538819fafe55ea9b501bc0ed46757eff029e0e5a30000",
+    "0066c95b5352c95fd99029bbae34495f2ef5bd2ea13676cfadaa7fa7a3ebee1a0000",
+    "dd66517c4c6725e472a5cd911f77698a52778c5f8b0e2efd711d1e2583ae9c260000",
+    "08dc9c151c5e61641eb36042950643bea7f593e1786b5c591c48712263f1cf560000",
+    "83e59303663c2c4a2263e262c3c1403514df4bbaf3ea7be6a319a58d7cba793a0100",
+    "069a99b5018dd4ef072f4aebd87cf32f05ced0d720ca935c4bf7f4dcaa6fbb180100",
+    "4a85653d788d8df1b2d7546bead7123a4044e53a72d0adf89881a94185fd51e30100",
+    "0525d61e4103fdabdbeaf6699acafb6d0ca8355a7334e91313e1e07e7b9140680100",
+    "391c15026a3e598238df8d77b8ca1bdf992b58457d20769adcac727c730776410000",
+    "9e9825ba7269749a1e2686fde457ddba3178970deff529fa7e2051a44fd833f10100",
+    "feef33b3daf2fd33d89870b3e66d9b1ce2dc2da4fddf18cf988668d6d9c7bd6a0100",
+    "31458a5e9ec839580d78ee76be0aab7145f11027ee4d2a04602778216940159e0100",
+    "dd944d39735e4d2cd98a61fa681d181e16b5be520f809a7a42548a0679c750010100",
+    "8a7dc3592c1cb43806233649a4ee2420162ecb946e7e511e4c348081b35afe630000",
+    "df50e61304007f79cc78beaf649865221e4f7a6243dc6c8cb630cfe427c858f50000",
+    "eb5fcd9852ac19f0b79b9d96a8e6c134425cbe8af3f1e21814c48823976187440000",
+    "6e981ef1c3e7fc0f38f1af7b0ded18bd4c99d2f8b5e8f12f10aa0f16e07eaf050100",
+    "c304bcf7ff66e98ffff1ddab3a23e62d375737ec6c14d1dbf071340db5598f850100",
+    "e296a34b917ac0b58dd72841267155b9ebc88e95c08ae262a16872559c4a42110100",
+    "99744e3d128c5c1725586695fc86ea25c39021c0c45624e3394d46731e715b260100",
+    "c8f692c4654480f5d278a087de40abf848d17bde451ea14a6304a19f02bb14ae0000",
+    "e3ce9cec518f5249b362c6293409a60ecc323a7a679fe9799401e6574aaf75040100",
+    "d762dfd8805cbdb4ee544b8340dff88dc57458a9387cc4b88b236b9aef8bc7db0000",
+    "9b28f5cb0d4bc1b37115d42f2fe85d89f45cd35d47a6bf6162e3fe6180c0cd270100",
+    "53d31684e6533e0ca0f9c8a76b4c981a268cc892badb4242636cd9e15ae9d0a10000",
+    "3bec5789e2ddccc900dec96ffb1cbf4c41abd6b223581874ee58b271f317bc9f0000",
+    "2ffe38e3b2410c8b2d2c7bff22ba8ad586a3e7ec690b7664f3c7ae53cf48ef740100",
+    "b8e61f6ba4ea0b16479964eb0f36f6c43adf3763da7e68b0ecad4e52d21d2a6d0100",
+    "2ffdfa8314c9ff11404f0e639312e4cd595f1c0f7cb8254016c2ae83d4bf421a0000",
+    "85d8353325c3b67745ad576daa20c69d982e284d4d2d0da39e389de7c74789240100",
+    "29485dfc0a73526472b75bb59b211154c727c09d21d2fda1fc2d711b6ea3cf000100",
+    "bd0c53561f7095832674f1a966a1e558777189349f0266d56154940fb3c36a710000",
+    "0f21b490fa8727237e5fee9a5e867f6ccbb3fbae41c9214fb464b9690b7c51a10100",
+    "53216cbb436f5273dd445bdc64fa61a984364e4c30fa6b05b9af5228c6e55f940100",
+    "bc2e1aabca476d7de365d3be5aabc66f7401c849d4ce42150a36f21bb2bc5ef60100",
+    "3506939bf89f6b39785401be588df68bbcdeb23149885dee2b0fa222447dda780100",
+    "5294a3c223cb9ed9357515506ed04bb171449900b0d595a67d9d8b1dc764a73f0100",
+    "0c8bcbc69e7e5be9a5032a08a63dd3844abe7974e6dce7f24e974fb85e0a76590000",
+    "a5b9b95dbbcec600e80da634bb34bf9e3638e3192e43bad3c96023a5cc9799e90000",
+    "fd1ee0c90f663a777b8bbad15911e73031abf2d9b9edbf08578c8aa0ba1a33910100",
+    "6eb8f494879e84028979163145241f83f419c771f5dcdced8c216a9cdbad9aa20000",
+    "a16c61c47708cff27d4ce63ba64db96767e6e5c9fe6b139eac2beb5c8b87df2d0100",
+    "9ff30fae2b0ea9e949bc50f6c7b3bdb1adad6ee1b97b9118e10a05bf6f2219160000",
+    "782012db4dd671eee5022be22452648f76e214173eac1814868012df795bd84e0100",
+    "9f75a6f38d58fdf51a49b8b4ec01ca57aa7de80c733f3928a40251f4fe1b28030100",
+    "2b867683fbc311c735d31633d7d403cb39cdd66a5cefe129e26630be340ffef90100",
+    "d09a0dee199d18d5b809c04062d76e879c25342ac8971e84760ecb0aae64e04f0100",
+    "c85a5d9c7c5030a59d5e527717d7f04db73ba07071212eaf6666ee056fad2a260000",
+    "082ab474c3ccc82b6434093b39ec57a13b4a543cabe982b444d2aabfb1ad3ecc0100",
+    "d3bf2b9db963239ce870353705b946599558a9555c08141a3ced1999008575140000",
+    "1ec5c6a2ed872654fa168be7c8a493a177102a0f52bc5732394b7d4b152978a20100",
+    "5447e81d59ea62d5d389be359baa37fc284171e7dfa70ade69cbe14cf349e2980000",
+    "b7f72e75c8ac75bd7a82a2e9a91059cc1b2a6e0aa188f4ebdc057d9a473a0fba0000",
+    "81e87699f78f3b45bd70c0494dc83caf9d5ff1ffe866ce5089c3710421968ab30100",
+    "c92b1cda57251911fc34ee28718c7862d7c9b90b57af28dc71bbac9b5bedaa140100",
+    "39120d04d59cf109f28d3be85b4dd0f6309fe45d64eb5ad0c1dc8e8d757e83ba0000",
+    "768cdb2076494f47924915312ee4178ace264db2c03b962b488313a73edcf74d0000",
+    "5eb0d9959fa60a0383cd8bdc5ab47d26dd53c988e14028aa50f10023413a7f6f0100",
+    "8f677342cb6e597fe7274cd8257d6fde4e95f00cb7603e8d52e20920a045c8c60000",
+    "cf02b6167e5056af0dc7f5fff094faceb47f4f7dba01c0fdc01f832d8c166f870000",
+    "4a254e05b8e244e69f18a3613f2a8c8b2cc70595af23b3b745c5d54d03e653ec0000",
+    "fc02e23e486a0a5b75f4360afa07912dfb2707546545ff4fb5e07fd1e6ad7ce40000",
+    "119b4cae1e8a5ea5898287557b6636b6df1c5db2be610ad64b9e601c320fb2a10100",
+    "f623b4d9525d8dd50ec66c177772b6eb070ed1d70cba8549a08708666c65d60f0100",
+    "a317c32cc5f882fa35baffacf018dff10eb502b01ab296b4ddf8043355f231410100",
+    "a02cba3ca38760323aa7bef3df0763dcaf71b96fc3b733dd0ae7a3a57d65fba20000",
+    "911bb29d35c650e760a05802b70b3b58293d67c073df3eec7b0afe75e4b1b5570000",
+    "e1d47b44aa2067448c68caa689c0ea446178b58dfc594cf2f7589c4dd158b3f60000",
+    "b295ddc02172a70329871d304e9747cfd033c8c2b48758822f599b7787cc047f0000",
+    "d2a7702de90ef1a031d9cf1c4b27a8f55f20f9d1e21b4ba5e13393215904b5120100",
+    "9108bed1fb69beba4f5e43891783ae6156a207a3fd8de2deabee9b4d4016fb400000",
+    "baa74c4b982bf116d8184726c8aa2b286e4be2a88872ac1a26fff5c4932cbdf30000",
+    "84832fea677664969c174fc33c6dd20b7e32850cf818b11ff4f877cb7e4b819d0000",
+    "d26c1245bf6ebf2c1a649cbfc7f9fe970abbac9331c8da2c5f4fe6acd1522ee00100",
+    "a355e4a30f071b6aa47dd013ebf0e82f9541effdb6e0594be415db8ef4ec8d3c0000",
+    "429fe04b4bf7758f64429e4cb0dfe2aa2764580a8ded9d53d835120406445f6e0100",
+    "d2d394ef9e21b4f2a7c5e96f7b05d8447f138c94b089f51ab7e58ecb719e71b40100",
+    "b621ebebc28b20f223b3874eaf78a90ba33dea16bd259b160a6ab64206e4fa410100",
+    "22fbcac5fcc9c6884881c87d1460bc143c0faaee50e4e8a20b8361e95e7536e80100",
+    "3de4660c297b282eaeb129c9cf5045863f2c93d6a471bc3c50a23c0748045e500000",
+    "5373800051084eaeb1a115dbb1fdd31ca0c7286e27c594c149567cfb49ed39bd0000",
+    "80f4e15e1ff96df13cf2ac1f7457762b85f87740e13f05a01dc725bf6d09b7120100",
+    "035262465c91348183a2185bd8e471ffa30f40c79214b447a5fc9ce70648e5030000",
+    "03c12d372a5572302b6e47f303ed80030269a2f325f56c6145268a9926a5ddb50000",
+    "6ddf63bb0b0b6698b57832a951d09211eb8000607b8e7f75d72717da8291b7600100",
+    "f36dd48abf07889ae8c404f77a0bcbbc09b9ce74eb70836a1fe2fc876ce47e030100",
+    "56cc7c4c0c465e6974b0d3fe5e78521c8f0821d0384ab194fbca35b505106b1c0100",
+    "44387409d9dac416ed1f084bf963bcb63d9c157b75be4a003331105838c027ac0100",
+    "dd2f8d2ab12d36c570b4e8e1504cecbfd2e444611c24501c9a2b29b21ce9bf6e0000",
+    "258f0b2456699fcd58e48377d2d8779a8463f564b2bf032abdbba4b068b92f110000",
+    "cb67955b761a6f8be33b1335d0e0c2f385bcbf24bbad55ab41cfd7af111114810000",
+    "56602328d2f0732f8631da81cf32808a4062eb03ec56ce5f18d39d9e8d979e650000",
+    "a68b4f1c72b12a5d37eb4a67c00031220260223cd8426dd527813f6099c111f70100",
+    "7fe52ccaa6fe12f36cd9563c04049157ec835d8521ecf9b35cd67d7e126251690000",
+    "d5f1747b021ec9779d1c0653169c1fd7caf9b82f491b973196da427f209b671b0100",
+    "20678c4082aa26045cd14272425619755fde8605c6ce72216da872fea59d6f590000",
+    "4d3e88d8567a04ff9bf33570126a9fcf47927f5e1a2624149e3ec42c9a235c3c0000",
+    "2bb170187816961c69aee442b5da53ebc36c26c20d800a350d737448c2d4e2f50100",
+    "7a6f8892b3b50a34b2bc1ca69c501e6f922477c752dc1a6bc7e14d039b53a64a0100",
+    "813dee1304fcfbcfc16ad12256804378debaaf299d15cd2095623ec9b631a2da0000",
+    "5dbd9a25ed97622b9cd382b3d91b709bd6e071865f2f21b9bbeb0d0d5dd538390100",
+    "ac29a974a774fad713b0fdcbfbb02b91ce1b1118fab7df6d28685d4423ee72a20000",
+    "09b4a91660ad8d4395b9aebf3b1052a4ad9496ce5b88330f097bd6a5eb8ebd560000",
+    "1e95a93842257543648b04a0ee8b2c18f857b910caf24ead751cd516258d2c690000",
+    "e5fa6a469db334c397d142048775dc72055b7dce6730b6d8894777a174f7c5e30100",
+    "68c2389c6ad705d6d1af766b2a00fde70eb42318a4457cf10d2124da2e2b1a460000",
+    "849a946a41c19a076023072336b726ae8eb93627734697a697a88ab3750ac90d0100",
+    "13ae95270d66174bbf3dc00d688541a53f2ac885b42626d2436fd4f0383d2cf10100",
+    "f19d6d0a420fb7a56310b678bdd79a63f901a15dc4a3f9f4024ab7bda5f568c40100",
+    "580784d4d60a5270d0d6353c3fa85bae61c686dccd36f1b7892ef2c4dbbf11710100",
+    "22c7327789fea1871360acd94a6f15175111a73d81a2c1197d526a54d6eb26fa0000",
+    "a596ee3c0ea0c90fcd22f5a851401b21dfec7325cb952d5e4dacc1cda361734c0100",
+    "adb594b63e54b01a6d17f96589b60f6eb2942ea777b297a65df89d8a3f28efa00000",
+    "30a98efa23f39b5b241dee7cfa7fe484faa43233a7bdbc7fd703d42d6d125b3e0100",
+    "47dd0d70c6b48316c2bced1a16ded2b9c4a60ff6031a75acda9cff146104dbf40100",
+    "23b2b1143e8ec8515008e8a045866f723d6ba5a18796de23bc676e2aed5b977c0100",
+    "38433d8a00248f69fa2e4203dc1b6824ed85c4e60c072f36d64c290cd2d232760100",
+    "1625092f5cb190212cfb94477327ffc165aba7311f3d83c7c0dbd4f0550747c00000",
+    "d3c4e8d0c59c3625554a7e9f66ff5aaf3f5900bd6bc5a2b21c4b1ac62000a3b10000",
+    "a2699437557172bed1da4f6e9e3583039c191be88a3d5a3a4fbf61bce140e2a90000",
+    "6468434ef202b89ea902b7fe91c1e771ac46fe7d35a1e798d623b81e686110630100",
+    "2841078513a74c65752d097b85065206b8bd1eaa5d218072e34d04e2bd77c23a0000",
+    "685f683c9a7dac8a8bca7d341ab84f62308a3c9dd37443b89994a65af7609a040000",
+    "16aff439074e2d720ba6560b998ae5762f1551e85c524aed917bdcee741211460000",
+    "7450a03fd44f18095aa2287458756c1852d2cb16440b2f5204a0148dd93526c30100",
+    "e99bad8db9f50ced4e0c4c7c1f7ac91dfa240c3aad64b8d5d46c7066c935e35b0000",
+    "29ee59348d1f5eeac822b078b42281f9c2e2410d10d678cc563fcd3700aeccaf0100",
+    "fa5cf53757e24055d23f1b6638b6b7da43a10b5f8cade29a49965cc0801f45d40000",
+    "8c5f3f3b0e7a00167ce25f688729deed4419479284e21ba5e11944dec955e9dd0000",
+    "893aab79f05f4cfa0b1b13748e5eedb8a4a5a3017e4fd941a994ced41f037a510100",
+    "2442730649621ee305d848e9976460e988f3cac44dd9f640c7dcff8eec5e36b30000",
+    "e2d48f5d2afc36a345a9b14c00d98d4f2f4e96fc92ac2e9a7e12c0c22423c7980100",
+    "b2637174bd8bea47af432b377eed70f3d8677180ffc9699ca6c0d4cdc1b215890100",
+    "5254d790f6ea85db703b00c4d5c6318b68f8be0c76b19595236cb9fe5fa7aa850100",
+    "90dda8dc68a948565cab94d56af19368376923362eb9b958d3b8ea6d07f3694c0100",
+    "b701accf4e61a67f28f0451252e5cd7a75e898ac3d2f3987d03b5ae5b354ae570000",
+    "7116e64cfbd1280d9f08ccca6d9e0b4987b00cbffdb197c64a6371eab36aaca50000",
+    "55f3c8bfa76e323e08fdcaa77f7a161e7df73627c4124aaa6fc8d36aa34782b90000",
+    "b2d0115cb30253ba8a3543b4bd18f3965174e9697309ccd5e3a2eb176852122c0100",
+    "10ff24cae8338854d43dc46373998531a8e936cbcd2095b462b1566430d7dc980000",
+    "d09d163ce5737e4ece1898476db254985c86c29d9293dff9d317602000f8c5110100",
+    "b17224d96b1cc5f1a1947b145c84a839b38d40117e0dde755c765c7ed7cef3700100",
+    "5eb14e8400bee82bb56e9e16930e0730b57089e3228b25157dea5278fedd355a0100",
+    "364963328121074ef6a9244cf3e44223dad6be344d9afcaeac21d3d1853781200000",
+    "ba660b58deaf62c6571821489a91153b09c68ef377fee623c9e00ae6cbb092eb0100",
+    "0527f536ae170537db60ef5208363ad0ef9a242a094433d2d5de72441f761e060100",
+    "8b9e100056113a7cf0f95b59f786a6e6f3b21e4fc9c9a6f4bc9e2c3279c5b91a0000",
+    "9123dd9ae99d367ca6a6ec6dc1d451b74b13f5d9a9f4435af18249eacb227d3b0000",
+    "c10bd5dfc9e1a68d3c45c0b29e97286e841bbc8c29386a2d506d80e8af7fff350000",
+    "2d7a31edc920256dedbe072b79aa1fc8c7174976dc84e438c0ecdcc01fd913290100",
+    "84f4502a5dcd7791a752ff1e0f26770fc70428e1dd8b825adc5b9f2aa46a98f30100",
+    "7fbe909a0e9e00068a7945f2e98b3c12a8d6319b5fc955f4abea5bb52c4a759b0100",
+    "5d7302818a83d422582c70573fabb817f0abbebbc8294294e4da6554a5216abb0100",
+    "dd5b381a99cae198f1079c3054030f5f27ac3c1c055dea2c44ee171e097b1c1e0000",
+    "2210240392715f87b7087f0b394df20b186b7a4a8335722c4a4a3603a7118ccc0100",
+    "99d5d24517d455044d520a4256e4e92627e8c6dbf8dae8c26644caaf4d2970180000",
+    "7b2b8072f65c9c4f2cf85d7e18a17f558601215f38029a0902ab772cc91317ef0000",
+    "88337feb9ded3707108c864df26b8bf40107bee399bb21e2486ba0fa1cb264cc0100",
+    "3ddbe16bcdc9d40536afb3e100387f73db7b4d9f3ab4f71248d8321b0ccb01cb0000",
+    "686146b61e074f14505a56dc94d13fea0b9e8fab1c2b82859a0ab31d98f2e7710100",
+    "56c919f0c83e32f330faad297cd6210858f5fbc16a7bbfdf15cd9e8c8bc8bd8f0100",
+    "f9b871a658777235b77b48dbe8d1cd91c970056595c18a53673e2fdf82830b660100",
+    "28ed45cd7701d2a51f08384d1eaf0d5f6bea59cfe6362e118347a94b1119fbfb0100",
+    "4e0bf3f57d03a034e0d2621e82f486d68e20784c4fa5188ec7411ce671eca0750100",
+    "46b374e87604859e53064d387e2036b501f5f87277c9df91e271ae4294249d960100",
+    "81971e7ec22bd3ce71e1c08873513bf711a58d1e601f5dcfd5d6816691fd622d0000",
+    "b876c9791952d4f8231a3f91d1ffd5ddff0c1f4f6be5fc523b4b8bc40ec94f9b0000",
+};
+
+} // namespace lelantus
+
+#endif // FIRO_LIBLELANTUS_GENERATORS_H
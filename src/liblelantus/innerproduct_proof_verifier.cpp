@@ -67,9 +67,11 @@ bool InnerProductProofVerifier::verify_fast_util(
         std::vector<GroupElement> group_elements = {proof.L_[i], proof.R_[i]};
         LelantusPrimitives::generate_challenge(group_elements, x_j[i]);
     }
+    std::vector<Scalar> x_j_inv(x_j);
+    Scalar::batchInverse(x_j_inv);
+
     std::vector<Scalar> s, s_inv;
     s.resize(n);
-    s_inv.resize(n);
     for (std::size_t i = 0; i < n; ++i)
     {
         Scalar x_i(uint64_t(1));
@@ -78,13 +80,14 @@ bool InnerProductProofVerifier::verify_fast_util(
             if((i >> j) & 1) {
                 x_i *= x_j[log_n - j - 1];
             } else{
-                x_i *= x_j[log_n - j - 1].inverse();
+                x_i *= x_j_inv[log_n - j - 1];
             }
 
         }
         s[i] =  x_i;
-        s_inv[i] = x_i.inverse();
     }
+    s_inv = s;
+    Scalar::batchInverse(s_inv);
 
     secp_primitives::MultiExponent g_mult(g_, s);
     secp_primitives::MultiExponent h_mult(h_, s_inv);
@@ -96,7 +99,7 @@ bool InnerProductProofVerifier::verify_fast_util(
     GroupElement right = P_;
     GroupElement multi;
     for (std::size_t j = 0; j < log_n; ++j)
-        multi += (proof.L_[j] * (x_j[j].square()) + proof.R_[j] * (x_j[j].square().inverse()));
+        multi += (proof.L_[j] * (x_j[j].square()) + proof.R_[j] * (x_j_inv[j].square()));
     right += multi;
     if(left != right)
         return false;
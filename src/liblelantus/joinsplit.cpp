@@ -152,7 +152,7 @@ bool JoinSplit::Verify(
         }
 
         // Recompute and compare hash of public key
-        Scalar coinSerialNumberExpected = PrivateCoin::serialNumberFromSerializedPublicKey(OpenSSLContext::get_context(), &pubkey);
+        Scalar coinSerialNumberExpected = PrivateCoin::serialNumberFromCompressedPublicKey(ecdsaPubkeys[i].data());
         if (serialNumbers[i] != coinSerialNumberExpected) {
             LogPrintf("Lelantus joinsplit failed due to serial number does not match public key hash.");
             return false;
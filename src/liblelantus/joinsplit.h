@@ -105,7 +105,7 @@ public:
                     throw std::invalid_argument("Lelantus joinsplit unserialize failed due to unable to parse ecdsaPubkey.");
                 }
 
-                serialNumbers[i] = PrivateCoin::serialNumberFromSerializedPublicKey(OpenSSLContext::get_context(), &pubkey);
+                serialNumbers[i] = PrivateCoin::serialNumberFromCompressedPublicKey(ecdsaPubkeys[i].data());
             }
         }
     }
@@ -161,10 +161,10 @@ bool LelantusVerifier::verify_schnorrproof(
         A += Cout[i].getValue();
     if(Cout.size() > 0)
         A *= x.exponent(params->get_sigma_m());
-    A += params->get_h1() * ((Vout + fee) * x.exponent(params->get_sigma_m()));
+    A += params->get_h1_table().mul((Vout + fee) * x.exponent(params->get_sigma_m()));
 
-    GroupElement B = (params->get_h1() * (Vin * x.exponent(params->get_sigma_m())))
-                     + LelantusPrimitives::double_commit(params->get_g(), uint64_t(0), params->get_h1(), zV, params->get_h0(), zR);
+    GroupElement B = params->get_h1_table().mul(Vin * x.exponent(params->get_sigma_m()) + zV)
+                     + params->get_h0_table().mul(zR);
 
     NthPower x_k(x);
     std::vector<Scalar> x_ks;
@@ -1,6 +1,10 @@
 #include "params.h"
+#include "generators.h"
 #include "chainparams.h"
-#include <iostream>
+#include "utilstrencodings.h"
+
+#include <cassert>
+#include <type_traits>
 namespace lelantus {
 
     CCriticalSection Params::cs_instance;
@@ -49,13 +53,27 @@ Params::Params(const GroupElement& g_, int n_sigma_, int m_sigma_, int n_rangePr
     n_rangeProof(n_rangeProof_),
     max_m_rangeProof(max_m_rangeProof_)
 {
+    // deriving the generators takes long, mainnet and regtest ones are embedded
+    if (!load_generators(g, n_sigma * m_sigma, n_rangeProof * max_m_rangeProof, h_sigma, g_rangeProof, h_rangeProof))
+        generate_generators(g, n_sigma * m_sigma, n_rangeProof * max_m_rangeProof, h_sigma, g_rangeProof, h_rangeProof);
+
+    g_table = FixedBaseTable(g);
+    h0_table = FixedBaseTable(h_sigma[0]);
+    h1_table = FixedBaseTable(h_sigma[1]);
+
+    limit_range = Scalar(uint64_t(2)).exponent(get_bulletproofs_n()) - ::Params().GetConsensus().nMaxValueLelantusMint;
+    h1_limit_range = h1_table.mul(limit_range);
+}
 
+void Params::generate_generators(const GroupElement& g, int n_sigma, int n_rangeProof,
+        std::vector<GroupElement>& h_sigma, std::vector<GroupElement>& g_rangeProof, std::vector<GroupElement>& h_rangeProof)
+{
     //creating generators for sigma
-    this->h_sigma.resize(n_sigma * m_sigma);
+    h_sigma.resize(n_sigma);
     unsigned char buff0[32] = {0};
     g.normalSha256(buff0);
     h_sigma[0].generate(buff0);
-    for (int i = 1; i < n_sigma * m_sigma; ++i)
+    for (int i = 1; i < n_sigma; ++i)
     {
         unsigned char buff[32] = {0};
         h_sigma[i - 1].normalSha256(buff);
@@ -63,13 +81,13 @@ Params::Params(const GroupElement& g_, int n_sigma_, int m_sigma_, int n_rangePr
     }
 
     //creating generators for bulletproofs
-    g_rangeProof.resize(n_rangeProof * max_m_rangeProof);
-    h_rangeProof.resize(n_rangeProof * max_m_rangeProof);
+    g_rangeProof.resize(n_rangeProof);
+    h_rangeProof.resize(n_rangeProof);
     g_rangeProof[0].generate(buff0);
     unsigned char buff1[32] = {0};
     g_rangeProof[0].normalSha256(buff1);
     h_rangeProof[0].generate(buff1);
-    for (int i = 1; i < n_rangeProof * max_m_rangeProof; ++i)
+    for (int i = 1; i < n_rangeProof; ++i)
     {
         unsigned char buff[32] = {0};
         h_rangeProof[i-1].normalSha256(buff);
@@ -78,9 +96,39 @@ Params::Params(const GroupElement& g_, int n_sigma_, int m_sigma_, int n_rangePr
         g_rangeProof[i].normalSha256(buff2);
         h_rangeProof[i].generate(buff2);
     }
+}
 
-    limit_range = Scalar(uint64_t(2)).exponent(get_bulletproofs_n()) - ::Params().GetConsensus().nMaxValueLelantusMint;
-    h1_limit_range = get_h1() * limit_range;
+static GroupElement DecodeGenerator(const char* hex)
+{
+    std::vector<unsigned char> buffer = ParseHex(hex);
+    assert(buffer.size() == GroupElement::serialize_size);
+
+    GroupElement generator;
+    generator.deserialize(buffer.data());
+    return generator;
+}
+
+template<std::size_t N>
+static void DecodeGenerators(const char* const (&table)[N], std::vector<GroupElement>& generators)
+{
+    generators.clear();
+    generators.reserve(N);
+    for (auto hex : table)
+        generators.push_back(DecodeGenerator(hex));
+}
+
+bool Params::load_generators(const GroupElement& g, int n_sigma, int n_rangeProof,
+        std::vector<GroupElement>& h_sigma, std::vector<GroupElement>& g_rangeProof, std::vector<GroupElement>& h_rangeProof)
+{
+    if (std::size_t(n_sigma) != std::extent<decltype(generators_sigma_h)>::value
+        || std::size_t(n_rangeProof) != std::extent<decltype(generators_bulletproofs_g)>::value
+        || g != DecodeGenerator(generators_g))
+        return false;
+
+    DecodeGenerators(generators_sigma_h, h_sigma);
+    DecodeGenerators(generators_bulletproofs_g, g_rangeProof);
+    DecodeGenerators(generators_bulletproofs_h, h_rangeProof);
+    return true;
 }
 
 const GroupElement& Params::get_g() const{
@@ -126,4 +174,16 @@ const GroupElement& Params::get_h1_limit_range() const{
     return h1_limit_range;
 }
 
+const FixedBaseTable& Params::get_g_table() const{
+    return g_table;
+}
+
+const FixedBaseTable& Params::get_h0_table() const{
+    return h0_table;
+}
+
+const FixedBaseTable& Params::get_h1_table() const{
+    return h1_table;
+}
+
 } //namespace lelantus
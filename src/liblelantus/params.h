@@ -3,6 +3,7 @@
 
 #include <secp256k1/include/Scalar.h>
 #include <secp256k1/include/GroupElement.h>
+#include "fixed_base_table.h"
 #include <serialize.h>
 #include <sync.h>
 
@@ -25,6 +26,19 @@ public:
     const Scalar& get_limit_range() const;
     const GroupElement& get_h1_limit_range() const;
 
+    // Precomputed tables for multiplying the fixed generators g, h0 and h1.
+    const FixedBaseTable& get_g_table() const;
+    const FixedBaseTable& get_h0_table() const;
+    const FixedBaseTable& get_h1_table() const;
+
+    // Derives the sigma and bulletproof generators from g with GroupElement::generate().
+    static void generate_generators(const GroupElement& g, int n_sigma, int n_rangeProof,
+            std::vector<GroupElement>& h_sigma, std::vector<GroupElement>& g_rangeProof, std::vector<GroupElement>& h_rangeProof);
+
+    // Loads the embedded mainnet generators of generators.h, returns false if g or the sizes do not match them.
+    static bool load_generators(const GroupElement& g, int n_sigma, int n_rangeProof,
+            std::vector<GroupElement>& h_sigma, std::vector<GroupElement>& g_rangeProof, std::vector<GroupElement>& h_rangeProof);
+
 private:
     Params(const GroupElement& g_sigma_, int n, int m, int n_rangeProof_, int max_m_rangeProof_);
 
@@ -45,6 +59,10 @@ private:
     std::vector<GroupElement> h_rangeProof;
     Scalar limit_range;
     GroupElement h1_limit_range;
+
+    FixedBaseTable g_table;
+    FixedBaseTable h0_table;
+    FixedBaseTable h1_table;
 };
 
 } // namespace lelantus
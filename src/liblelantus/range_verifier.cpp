@@ -42,14 +42,19 @@ bool RangeVerifier::verify_batch(const std::vector<GroupElement>& V, const Range
     const InnerProductProof& innerProductProof = proof.innerProductProof;
     std::vector<Scalar> x_j, x_j_inv;
     x_j.resize(log_n);
-    x_j_inv.reserve(log_n);
     for (int i = 0; i < log_n; ++i)
     {
         std::vector<GroupElement> group_elements_i = {innerProductProof.L_[i], innerProductProof.R_[i]};
         LelantusPrimitives::generate_challenge(group_elements_i, x_j[i]);
-        x_j_inv.emplace_back((x_j[i].inverse()));
     }
 
+    // y is inverted together with the challenges, it goes last
+    x_j_inv = x_j;
+    x_j_inv.push_back(y);
+    Scalar::batchInverse(x_j_inv);
+    Scalar y_inv = x_j_inv.back();
+    x_j_inv.pop_back();
+
     Scalar z_square_neg = (z.square()).negate();
     Scalar delta = LelantusPrimitives::delta(y, z, n, m);
 
@@ -64,7 +69,7 @@ bool RangeVerifier::verify_batch(const std::vector<GroupElement>& V, const Range
 
     std::vector<Scalar> l_r;
     l_r.resize(n * m * 2);
-    NthPower y_n_(y.inverse());
+    NthPower y_n_(y_inv);
     NthPower z_j(z, z.square());
 
     NthPower two_n_(uint64_t(2));
@@ -76,26 +81,34 @@ bool RangeVerifier::verify_batch(const std::vector<GroupElement>& V, const Range
         two_n_.go_next();
     }
 
+    // x_il is the product of the challenges for the set bits of i and of their inverses for the
+    // others, one multiplication each when built from the index without its highest bit.
+    // x_ir is its inverse, which is x_il of the index with all the bits flipped.
+    std::vector<Scalar> x_j_sq;
+    x_j_sq.reserve(log_n);
+    Scalar x_il_0(uint64_t(1));
+    for (int j = 0; j < log_n; ++j)
+    {
+        x_j_sq.emplace_back(x_j[j].square());
+        x_il_0 *= x_j_inv[j];
+    }
+
+    std::vector<Scalar> x_il;
+    x_il.reserve(n * m);
+    x_il.emplace_back(x_il_0);
+    for (uint64_t i = 1; i < n * m; ++i)
+    {
+        int k = RangeProof::int_log2(i);
+        x_il.emplace_back(x_il[i - (uint64_t(1) << k)] * x_j_sq[log_n - k - 1]);
+    }
+
     for (uint64_t t = 0; t < m ; ++t)
     {
         for (uint64_t k = 0; k < n; ++k)
         {
             uint64_t i = t * n + k;
-            Scalar x_il(uint64_t(1));
-            Scalar x_ir(uint64_t(1));
-            for (int j = 0; j < log_n; ++j)
-            {
-                if ((i >> j) & 1) {
-                    x_il *= x_j[log_n - j - 1];
-                    x_ir *= x_j_inv[log_n - j - 1];
-                } else {
-                    x_il *= x_j_inv[log_n - j - 1];
-                    x_ir *= x_j[log_n - j - 1];
-                }
-
-            }
-            l_r[i] = x_il * innerProductProof.a_ + z;
-            l_r[n * m + i] = y_n_.pow * (x_ir * innerProductProof.b_ - (z_j.pow * two_n[k])) - z;
+            l_r[i] = x_il[i] * innerProductProof.a_ + z;
+            l_r[n * m + i] = y_n_.pow * (x_il[n * m - 1 - i] * innerProductProof.b_ - (z_j.pow * two_n[k])) - z;
             y_n_.go_next();
         }
         z_j.go_next();
@@ -131,7 +144,7 @@ bool RangeVerifier::verify_batch(const std::vector<GroupElement>& V, const Range
     x_j_sq_neg.resize(2 * log_n);
     for (int j = 0; j < log_n; ++j)
     {
-        x_j_sq_neg[j] = x_j[j].square().negate();
+        x_j_sq_neg[j] = x_j_sq[j].negate();
         x_j_sq_neg[log_n + j] = x_j_inv[j].square().negate();
     }
 
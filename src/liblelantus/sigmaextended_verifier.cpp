@@ -112,120 +112,16 @@ bool SigmaExtendedVerifier::batchverify(
         const Scalar& x,
         const std::vector<Scalar>& serials,
         const vector<SigmaExtendedProof>& proofs) const {
-    int M = proofs.size();
-    int N = commits.size();
-
     if (commits.empty()) {
         LogPrintf("Sigma verification failed due to commits are empty.");
         return false;
     }
 
-    for(int t = 0; t < M; ++t) {
-        if(!membership_checks(proofs[t])) {
-            LogPrintf("Sigma verification failed due to membership checks failed.");
-            return false;
-        }
-    }
-
-    std::vector<std::vector<Scalar>> f_;
-    f_.resize(M);
-    for (int t = 0; t < M; ++t)
-    {
-        if(!compute_fs(proofs[t], x, f_[t]) || !abcd_checks(proofs[t], x, f_[t])) {
-            LogPrintf("Sigma verification failed due to f computations or abcd checks failed.");
-            return false;
-        }
-    }
-
-    std::vector<Scalar> y;
-    y.resize(M);
-    for (int t = 0; t < M; ++t)
-        y[t].randomize();
-
-    std::vector<Scalar> f_i_t;
-    f_i_t.resize(N);
-    GroupElement right;
-    Scalar exp;
-
-    std::vector <std::vector<uint64_t>> I_;
-    I_.resize(N);
-    for (int i = 0; i < N ; ++i)
-        I_[i] = LelantusPrimitives::convert_to_nal(i, n, m);
-
-    for (int t = 0; t < M; ++t)
-    {
-        right += (LelantusPrimitives::double_commit(g_, Scalar(uint64_t(0)), h_[1], proofs[t].zV_, h_[0], proofs[t].zR_)) * y[t];
-        Scalar e;
-
-        Scalar f_i(uint64_t(1));
-        vector<Scalar>::iterator ptr = f_i_t.begin();
-        compute_batch_fis(f_i, m, f_[t], y[t], e, ptr, ptr, ptr + N - 1);
-        /*
-        * Optimization for getting power for last 'commits' array element is done similarly to the one used in creating
-        * a proof. The fact that sum of any row in 'f' array is 'x' (challenge value) is used.
-        *
-        * Math (in TeX notation):
-        *
-        * \sum_{i=s+1}^{N-1} \prod_{j=0}^{m-1}f_{j,i_j} =
-        *   \sum_{j=0}^{m-1}
-        *     \left[
-        *       \left( \sum_{i=s_j+1}^{n-1}f_{j,i} \right)
-        *       \left( \prod_{k=j}^{m-1}f_{k,s_k} \right)
-        *       x^j
-        *     \right]
-        */
-
-        Scalar pow(uint64_t(1));
-        vector<Scalar> f_part_product;    // partial product of f array elements for lastIndex
-        for (int j = m - 1; j >= 0; j--) {
-            f_part_product.push_back(pow);
-            pow *= f_[t][j * n + I_[N - 1][j]];
-        }
-
-        NthPower xj(x);
-        for (std::size_t j = 0; j < m; j++) {
-            Scalar fi_sum(uint64_t(0));
-            for (std::size_t i = I_[N - 1][j] + 1; i < n; i++)
-                fi_sum += f_[t][j*n + i];
-            pow += fi_sum * xj.pow * f_part_product[m - j - 1];
-            xj.go_next();
-        }
-
-        f_i_t[N - 1] += pow * y[t];
-        e += pow;
-
-        e *= serials[t] * y[t];
-        exp += e;
-    }
-
-    secp_primitives::MultiExponent mult(commits, f_i_t);
-    GroupElement t1 = mult.get_multiple();
-
-    std::vector<Scalar> x_k_neg;
-    x_k_neg.reserve(m);
-    NthPower x_k(x);
-    for (uint64_t k = 0; k < m; ++k) {
-        x_k_neg.emplace_back(x_k.pow.negate());
-        x_k.go_next();
-    }
-
-    GroupElement t2;
-    for (int t = 0; t < M; ++t) {
-        const std::vector <GroupElement>& Gk = proofs[t].Gk_;
-        const std::vector <GroupElement>& Qk = proofs[t].Qk;
-        GroupElement term;
-        for (std::size_t k = 0; k < m; ++k)
-        {
-            term += ((Gk[k] + Qk[k]) * x_k_neg[k]);
-        }
-        term *= y[t];
-        t2 += term;
-    }
-    GroupElement left(t1 + t2);
-
-    right += g_ * exp;
-    if(left != right) {
-        LogPrintf("Sigma verification failed due to last check failed.");
+    // every proof is over the whole set with the same challenge
+    std::vector<Scalar> challenges(proofs.size(), x);
+    std::vector<size_t> setSizes(proofs.size(), commits.size());
+    if (!batchverify(commits, challenges, serials, setSizes, proofs)) {
+        LogPrintf("Sigma verification failed due to batch verification failure.");
         return false;
     }
 
@@ -251,10 +147,11 @@ bool SigmaExtendedVerifier::batchverify(
     f_.resize(M);
     for (int t = 0; t < M; ++t)
     {
-        if(!compute_fs(proofs[t], challenges[t], f_[t]) || !abcd_checks(proofs[t], challenges[t], f_[t]))
+        if(!compute_fs(proofs[t], challenges[t], f_[t]))
             return false;
     }
 
+    // random weight of the final check of every proof, g^serial of the check goes into exp
     std::vector<Scalar> y;
     y.resize(M);
     for (int t = 0; t < M; ++t)
@@ -262,8 +159,16 @@ bool SigmaExtendedVerifier::batchverify(
 
     std::vector<Scalar> f_i_t;
     f_i_t.resize(N);
-    GroupElement right;
+
+    // exponents of g and h_ on the right side
     Scalar exp;
+    std::vector<Scalar> h_exp;
+    h_exp.resize(h_.size());
+
+    std::vector<GroupElement> points;
+    std::vector<Scalar> exponents;
+    points.reserve(N + 1 + h_.size() + M * (4 + 2 * m));
+    exponents.reserve(N + 1 + h_.size() + M * (4 + 2 * m));
 
     std::vector <std::vector<uint64_t>> I_;
     I_.resize(N);
@@ -272,7 +177,8 @@ bool SigmaExtendedVerifier::batchverify(
 
     for (int t = 0; t < M; ++t)
     {
-        right += (LelantusPrimitives::double_commit(g_, Scalar(uint64_t(0)), h_[1], proofs[t].zV_, h_[0], proofs[t].zR_)) * y[t];
+        h_exp[0] += proofs[t].zR_ * y[t];
+        h_exp[1] += proofs[t].zV_ * y[t];
         Scalar e;
         size_t size = setSizes[t];
         size_t start = N - size;
@@ -319,37 +225,52 @@ bool SigmaExtendedVerifier::batchverify(
         exp += e;
     }
 
-    secp_primitives::MultiExponent mult(commits, f_i_t);
-    GroupElement t1 = mult.get_multiple();
-
-    std::vector<std::vector<Scalar>> x_t_k_neg;
-    x_t_k_neg.resize(M);
     for (int t = 0; t < M; ++t) {
-        x_t_k_neg[t].reserve(m);
-        NthPower x_k(challenges[t]);
-        for (uint64_t k = 0; k < m; ++k) {
-            x_t_k_neg[t].emplace_back(x_k.pow.negate());
+        const Scalar& x = challenges[t];
+        const std::vector<Scalar>& f = f_[t];
+
+        Scalar u, v;
+        u.randomize();
+        v.randomize();
+
+        // B^x * A = g^ZA * h^f and C^x * D = g^ZC * h^(f(x-f))
+        points.emplace_back(proofs[t].A_);
+        exponents.emplace_back(u);
+        points.emplace_back(proofs[t].B_);
+        exponents.emplace_back(u * x);
+        points.emplace_back(proofs[t].C_);
+        exponents.emplace_back(v * x);
+        points.emplace_back(proofs[t].D_);
+        exponents.emplace_back(v);
+
+        exp += proofs[t].ZA_ * u + proofs[t].ZC_ * v;
+        for (std::size_t i = 0; i < f.size(); ++i)
+            h_exp[i] += f[i] * (u + v * (x - f[i]));
+
+        // the final check has (Gk * Qk)^(-x^k) on the left side
+        NthPower x_k(x);
+        for (std::size_t k = 0; k < m; ++k) {
+            Scalar x_k_neg = x_k.pow.negate() * y[t];
+            points.emplace_back(proofs[t].Gk_[k]);
+            exponents.emplace_back(x_k_neg);
+            points.emplace_back(proofs[t].Qk[k]);
+            exponents.emplace_back(x_k_neg);
             x_k.go_next();
         }
     }
-    GroupElement t2;
-    for (int t = 0; t < M; ++t) {
-        const std::vector <GroupElement>& Gk = proofs[t].Gk_;
-        const std::vector <GroupElement>& Qk = proofs[t].Qk;
-        GroupElement term;
-        for (std::size_t k = 0; k < m; ++k)
-        {
-            term += ((Gk[k] + Qk[k]) * x_t_k_neg[t][k]);
-        }
-        term *= y[t];
-        t2 += term;
+
+    points.insert(points.end(), commits.begin(), commits.end());
+    exponents.insert(exponents.end(), f_i_t.begin(), f_i_t.end());
+
+    points.emplace_back(g_);
+    exponents.emplace_back(exp.negate());
+    for (std::size_t i = 0; i < h_.size(); ++i) {
+        points.emplace_back(h_[i]);
+        exponents.emplace_back(h_exp[i].negate());
     }
-    GroupElement left(t1 + t2);
 
-    right += g_ * exp;
-    if(left != right)
-        return false;
-    return true;
+    secp_primitives::MultiExponent mult(points, exponents);
+    return mult.get_multiple().isInfinity();
 }
 
 bool SigmaExtendedVerifier::membership_checks(const SigmaExtendedProof& proof) const {
@@ -1,6 +1,7 @@
 #include "../coin.h"
 #include "../params.h"
 
+#include "random.h"
 #include "streams.h"
 
 #include <boost/test/unit_test.hpp>
@@ -159,6 +160,31 @@ BOOST_AUTO_TEST_CASE(publiccoin_serialization)
     BOOST_CHECK(pub == deserializedCoin);
 }
 
+BOOST_AUTO_TEST_CASE(serial_from_compressed_pubkey)
+{
+    auto context = OpenSSLContext::get_context();
+
+    for (int i = 0; i < 10; i++) {
+        std::vector<unsigned char> seckey(32);
+        secp256k1_pubkey pubkey;
+        do {
+            GetRandBytes(seckey.data(), seckey.size());
+        } while (!secp256k1_ec_pubkey_create(context, &pubkey, seckey.data()));
+
+        unsigned char compressed[33];
+        size_t size = sizeof(compressed);
+        BOOST_CHECK(secp256k1_ec_pubkey_serialize(context, compressed, &size, &pubkey, SECP256K1_EC_COMPRESSED));
+
+        // the key of a spend is parsed from the transaction
+        secp256k1_pubkey parsed;
+        BOOST_CHECK(secp256k1_ec_pubkey_parse(context, &parsed, compressed, size));
+
+        BOOST_CHECK_EQUAL(
+            PrivateCoin::serialNumberFromSerializedPublicKey(context, &parsed),
+            PrivateCoin::serialNumberFromCompressedPublicKey(compressed));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace lelantus
\ No newline at end of file
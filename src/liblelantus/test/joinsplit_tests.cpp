@@ -3,6 +3,9 @@
 #include "../../sigma/openssl_context.h"
 #include "../joinsplit.h"
 
+#include "../../lelantus.h"
+#include "../../txmempool.h"
+
 #include <boost/test/unit_test.hpp>
 #include <openssl/rand.h>
 
@@ -98,6 +101,43 @@ BOOST_AUTO_TEST_CASE(verify)
     std::vector<uint32_t> expectedGroupIds = {1, 1, 2};
     BOOST_CHECK(expectedGroupIds == joinSplit.getCoinGroupIds());
     BOOST_CHECK(joinSplit.Verify(anons, {privs[3].getPublicCoin()}, vout, ArithToUint256(3)));
+
+    // serials can be read without deserializing the proof
+    CDataStream serialized(SER_NETWORK, PROTOCOL_VERSION);
+    serialized << joinSplit;
+
+    CTxIn in;
+    in.scriptSig << OP_LELANTUSJOINSPLIT;
+    in.scriptSig.insert(in.scriptSig.end(), serialized.begin(), serialized.end());
+
+    std::vector<Scalar> serials;
+    uint64_t fee;
+    ParseLelantusJoinSplitSerials(in, serials, fee);
+    BOOST_CHECK(joinSplit.getCoinSerialNumbers() == serials);
+    BOOST_CHECK_EQUAL(CENT, fee);
+
+    // and so can the rest of the fields following the proof
+    JoinSplitHeader header;
+    ParseLelantusJoinSplitHeader(in, header);
+    BOOST_CHECK(joinSplit.getCoinSerialNumbers() == header.serials);
+    BOOST_CHECK(expectedGroupIds == header.groupIds);
+    BOOST_CHECK(joinSplit.getIdAndBlockHashes() == header.idAndBlockHashes);
+    BOOST_CHECK_EQUAL(CENT, header.fee);
+    BOOST_CHECK_EQUAL(joinSplit.getVersion(), int(header.version));
+
+    // the mempool entry keeps what block assembly needs of the spends
+    CMutableTransaction tx;
+    tx.vin.push_back(in);
+    tx.vout.push_back(CTxOut(vout, CScript() << OP_TRUE));
+    CTxMemPoolEntry entry = TestMemPoolEntryHelper().FromTx(tx);
+    BOOST_CHECK_EQUAL(3, entry.GetPrivacySpend().nInputs);
+    BOOST_CHECK_EQUAL(vout, entry.GetPrivacySpend().nAmount);
+    BOOST_CHECK(joinSplit.getCoinSerialNumbers() == entry.GetPrivacySpend().serials);
+    BOOST_CHECK(joinSplit.getIdAndBlockHashes() == entry.GetPrivacySpend().groupBlockHashes);
+
+    // a truncated joinsplit can't be parsed
+    in.scriptSig.resize(in.scriptSig.size() - 1);
+    BOOST_CHECK_THROW(ParseLelantusJoinSplitHeader(in, header), std::ios_base::failure);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
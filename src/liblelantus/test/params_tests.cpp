@@ -0,0 +1,68 @@
+#include "lelantus_test_fixture.h"
+
+#include "../fixed_base_table.h"
+#include "../params.h"
+
+#include "../../sigma/params.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace lelantus {
+
+BOOST_FIXTURE_TEST_SUITE(lelantus_params_tests, LelantusTestingSetup)
+
+BOOST_AUTO_TEST_CASE(embedded_generators)
+{
+    std::vector<GroupElement> h_sigma, g_rangeProof, h_rangeProof;
+    Params::generate_generators(params->get_g(), params->get_sigma_h().size(), params->get_bulletproofs_g().size(),
+        h_sigma, g_rangeProof, h_rangeProof);
+
+    // mainnet params are loaded from generators.h
+    BOOST_CHECK(h_sigma == params->get_sigma_h());
+    BOOST_CHECK(g_rangeProof == params->get_bulletproofs_g());
+    BOOST_CHECK(h_rangeProof == params->get_bulletproofs_h());
+
+    // other g are derived
+    GroupElement g;
+    g.randomize();
+    std::vector<GroupElement> loaded;
+    BOOST_CHECK(!Params::load_generators(g, h_sigma.size(), g_rangeProof.size(), loaded, loaded, loaded));
+    BOOST_CHECK(!Params::load_generators(params->get_g(), 16, g_rangeProof.size(), loaded, loaded, loaded));
+}
+
+BOOST_AUTO_TEST_CASE(embedded_sigma_generators)
+{
+    auto sigmaParams = sigma::Params::get_default();
+
+    std::vector<GroupElement> h;
+    sigma::Params::generate_generators(sigmaParams->get_g(), sigmaParams->get_h().size(), h);
+
+    BOOST_CHECK(h == sigmaParams->get_h());
+}
+
+BOOST_AUTO_TEST_CASE(fixed_base_tables)
+{
+    std::vector<Scalar> scalars = RandomizeScalars(10);
+    scalars.push_back(Scalar(uint64_t(0)));
+    scalars.push_back(Scalar(uint64_t(1)));
+    scalars.push_back(Scalar(uint64_t(1)).negate());
+
+    for (auto& s : scalars) {
+        BOOST_CHECK(params->get_g() * s == params->get_g_table().mul(s));
+        BOOST_CHECK(params->get_h0() * s == params->get_h0_table().mul(s));
+        BOOST_CHECK(params->get_h1() * s == params->get_h1_table().mul(s));
+    }
+
+    GroupElement base;
+    base.randomize();
+    FixedBaseTable table(base);
+    BOOST_CHECK(base == table.get_base());
+    BOOST_CHECK(base * scalars[0] == table.mul(scalars[0]));
+
+    // without a table it falls back to a plain multiplication
+    BOOST_CHECK(FixedBaseTable().mul(scalars[0]).isInfinity());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace lelantus
@@ -256,6 +256,58 @@ BOOST_AUTO_TEST_CASE(one_out_of_N_batch_with_some_invalid_proof)
     BOOST_CHECK(!verifier.batchverify(commits, x, serials, proofs));
 }
 
+BOOST_AUTO_TEST_CASE(one_out_of_N_batch_with_tampered_proof)
+{
+    GenerateParams(16, 4);
+
+    auto commits = RandomizeGroupElements(N);
+
+    std::vector<Secret> secrets;
+    for (auto index : {2, 11}) {
+        secrets.emplace_back(index);
+
+        auto &s = secrets.back();
+
+        commits[index] = Primitives::double_commit(
+            g, s.s, h_gens[1], s.v, h_gens[0], s.r);
+    }
+
+    Prover prover(g, h_gens, n, m);
+    std::vector<Proof> proofs;
+    std::vector<Scalar> serials;
+
+    Scalar x;
+    x.randomize();
+
+    for (auto const &s : secrets) {
+        proofs.emplace_back();
+        serials.push_back(s.s);
+        GenerateBatchProof(
+            prover, commits, s.l, s.s, s.v, s.r, x, proofs.back());
+    }
+
+    Verifier verifier(g, h_gens, n, m);
+    BOOST_CHECK(verifier.batchverify(commits, x, serials, proofs));
+
+    // every term of the proof is part of the combined check
+    for (int i = 0; i < 9; i++) {
+        auto invalidProofs = proofs;
+        auto &proof = invalidProofs[1];
+        switch (i) {
+            case 0: proof.A_.randomize(); break;
+            case 1: proof.B_.randomize(); break;
+            case 2: proof.C_.randomize(); break;
+            case 3: proof.D_.randomize(); break;
+            case 4: proof.ZA_.randomize(); break;
+            case 5: proof.ZC_.randomize(); break;
+            case 6: proof.Gk_[0].randomize(); break;
+            case 7: proof.Qk[1].randomize(); break;
+            case 8: proof.zV_.randomize(); break;
+        }
+        BOOST_CHECK(!verifier.batchverify(commits, x, serials, invalidProofs));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace lelantus
\ No newline at end of file
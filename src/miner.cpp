@@ -354,9 +354,13 @@ bool BlockAssembler::TestPackage(uint64_t packageSize, int64_t packageSigOpsCost
 bool BlockAssembler::TestPackageTransactions(const CTxMemPool::setEntries& package)
 {
     uint64_t nPotentialBlockSize = nBlockSize; // only used with fNeedSizeAccounting
+    CAmount nPotentialSigmaAmount = nSigmaSpendAmount, nPotentialLelantusAmount = nLelantusSpendAmount;
+    size_t nPotentialSigmaInputs = nSigmaSpendInputs, nPotentialLelantusInputs = nLelantusSpendInputs;
     BOOST_FOREACH (const CTxMemPool::txiter it, package) {
         if (!IsFinalTx(it->GetTx(), nHeight, nLockTimeCutoff))
             return false;
+        if (!TestPrivacySpends(it, nPotentialSigmaAmount, nPotentialSigmaInputs, nPotentialLelantusAmount, nPotentialLelantusInputs))
+            return false;
         if (!fIncludeWitness && it->GetTx().HasWitness())
             return false;
         if (fNeedSizeAccounting) {
@@ -425,35 +429,40 @@ bool BlockAssembler::TestForBlock(CTxMemPool::txiter iter)
     if (!chainparams.GetConsensus().IsRegtest() && (tx.IsZerocoinSpend() || tx.IsZerocoinMint()))
         return false;
 
-    // Check transaction against sigma limits
+    // Check transaction against sigma and lelantus limits, without touching the running totals
+    CAmount nSigmaAmount = nSigmaSpendAmount, nLelantusAmount = nLelantusSpendAmount;
+    size_t nSigmaInputs = nSigmaSpendInputs, nLelantusInputs = nLelantusSpendInputs;
+    return TestPrivacySpends(iter, nSigmaAmount, nSigmaInputs, nLelantusAmount, nLelantusInputs);
+}
+
+bool BlockAssembler::TestPrivacySpends(CTxMemPool::txiter iter, CAmount& nSigmaAmount, size_t& nSigmaInputs,
+                                       CAmount& nLelantusAmount, size_t& nLelantusInputs) const
+{
+    const CTransaction &tx = iter->GetTx();
+    // the spends were parsed when the transaction entered the mempool
+    const CPrivacySpendInfo &spend = iter->GetPrivacySpend();
+    auto &params = chainparams.GetConsensus();
+
     if (tx.IsSigmaSpend() || tx.IsZerocoinRemint()) {
         // Sigma spend and zerocoin->sigma remint are subject to the same limits
-        CAmount spendAmount = tx.IsSigmaSpend() ? sigma::GetSpendAmount(tx) : sigma::CoinRemintToV3::GetAmount(tx);
-        auto &params = chainparams.GetConsensus();
-
-        if (tx.vin.size() > params.nMaxSigmaInputPerTransaction || spendAmount > params.nMaxValueSigmaSpendPerTransaction)
+        if (spend.nInputs > params.nMaxSigmaInputPerTransaction || spend.nAmount > params.nMaxValueSigmaSpendPerTransaction)
             return false;
 
-        if (tx.vin.size() + nSigmaSpendInputs > params.nMaxSigmaInputPerBlock)
+        if ((nSigmaInputs += spend.nInputs) > params.nMaxSigmaInputPerBlock)
             return false;
 
-        if (spendAmount + nSigmaSpendAmount > params.nMaxValueSigmaSpendPerBlock)
+        if ((nSigmaAmount += spend.nAmount) > params.nMaxValueSigmaSpendPerBlock)
             return false;
     }
 
-    // Check transaction against lelantus limits
-    if(tx.IsLelantusJoinSplit()) {
-        CAmount spendAmount = lelantus::GetSpendTransparentAmount(tx);
-        size_t spendNumber = lelantus::GetSpendInputs(tx);
-        auto &params = chainparams.GetConsensus();
-
-        if (spendNumber > params.nMaxLelantusInputPerTransaction || spendAmount > params.nMaxValueLelantusSpendPerTransaction)
+    if (tx.IsLelantusJoinSplit()) {
+        if (spend.nInputs > params.nMaxLelantusInputPerTransaction || spend.nAmount > params.nMaxValueLelantusSpendPerTransaction)
             return false;
 
-        if (spendNumber + nLelantusSpendInputs > params.nMaxLelantusInputPerBlock)
+        if ((nLelantusInputs += spend.nInputs) > params.nMaxLelantusInputPerBlock)
             return false;
 
-        if (spendAmount + nLelantusSpendAmount > params.nMaxValueLelantusSpendPerBlock)
+        if ((nLelantusAmount += spend.nAmount) > params.nMaxValueLelantusSpendPerBlock)
             return false;
     }
 
@@ -462,32 +471,9 @@ bool BlockAssembler::TestForBlock(CTxMemPool::txiter iter)
 
 void BlockAssembler::AddToBlock(CTxMemPool::txiter iter)
 {
-    const CTransaction &tx = iter->GetTx();
-    if (tx.IsSigmaSpend() || tx.IsZerocoinRemint()) {
-        // Update sigma stats
-        CAmount spendAmount = tx.IsSigmaSpend() ? sigma::GetSpendAmount(tx) : sigma::CoinRemintToV3::GetAmount(tx);
-
-        if ((nSigmaSpendAmount += spendAmount) > chainparams.GetConsensus().nMaxValueSigmaSpendPerBlock)
-            return;
-
-        if ((nSigmaSpendInputs += tx.vin.size()) > chainparams.GetConsensus().nMaxSigmaInputPerBlock)
-            return;
-    }
-
-    if(tx.IsLelantusJoinSplit()) {
-        CAmount spendAmount = lelantus::GetSpendTransparentAmount(tx);
-        size_t spendNumber = lelantus::GetSpendInputs(tx);
-        auto &params = chainparams.GetConsensus();
-
-        if (spendAmount > params.nMaxValueLelantusSpendPerTransaction)
-            return;
-
-        if ((nLelantusSpendAmount += spendAmount) > params.nMaxValueLelantusSpendPerBlock)
-            return;
-
-        if ((nLelantusSpendInputs += spendNumber) > params.nMaxLelantusInputPerBlock)
-            return;
-    }
+    // Update sigma and lelantus stats
+    if (!TestPrivacySpends(iter, nSigmaSpendAmount, nSigmaSpendInputs, nLelantusSpendAmount, nLelantusSpendInputs))
+        return;
 
     pblock->vtx.emplace_back(iter->GetSharedTx());
     pblocktemplate->vTxFees.push_back(iter->GetFee());
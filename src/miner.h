@@ -188,6 +188,10 @@ private:
     void resetBlock();
     /** Add a tx to the block */
     void AddToBlock(CTxMemPool::txiter iter);
+    /** Test the sigma and lelantus spends of a tx against the per transaction limits and,
+      * adding them to the given totals, against the per block limits */
+    bool TestPrivacySpends(CTxMemPool::txiter iter, CAmount& nSigmaAmount, size_t& nSigmaInputs,
+                           CAmount& nLelantusAmount, size_t& nLelantusInputs) const;
 
     // Methods for how to add transactions to a block.
     /** Add transactions based on tx "priority" */
@@ -211,7 +215,8 @@ private:
     /** Perform checks on each transaction in a package:
       * locktime, premature-witness, serialized size (if necessary)
       * These checks should always succeed, and they're here
-      * only as an extra check in case of suboptimal node configuration */
+      * only as an extra check in case of suboptimal node configuration.
+      * The sigma and lelantus limits are checked for the whole package too. */
     bool TestPackageTransactions(const CTxMemPool::setEntries& package);
     /** Return true if given transaction from mapTx has already been evaluated,
       * or if the transaction's cached data in mapTx is incorrect. */
@@ -24,6 +24,7 @@
 #include "utilstrencodings.h"
 #include "consensus/validation.h"
 #include "txmempool.h"
+#include "dandelion.h"
 #include "./consensus/validation.h"
 
 #include "masternode-sync.h"
@@ -89,9 +90,6 @@ static const uint64_t RANDOMIZER_ID_LOCALHOSTNONCE = 0xd93e69e2bbfa5735ULL; // S
 
 // Public Dandelion fields.
 
-// All transactions embargoed by dandelion.
-std::map<uint256, int64_t> CNode::mDandelionEmbargo;
-
 // Inbound connections. Transactions from each connection
 // are broadcast to one of 2 dandelion destinations.
 std::vector<CNode*> CNode::vDandelionInbound;
@@ -2948,10 +2946,10 @@ bool CConnman::AddNode(const std::string& strNode)
 }
 
 CNode* CNode::getDandelionDestination(CNode* pfrom) {
-    for (auto const& e : mDandelionRoutes) {
-        if (pfrom==e.first) {
-            return e.second;
-        }
+    // routes are drawn for all inbound peers on every shuffle, only new peers miss
+    auto it = mDandelionRoutes.find(pfrom);
+    if (it != mDandelionRoutes.end()) {
+        return it->second;
     }
     CNode* newPto = CNode::SelectFromDandelionDestinations();
     if (newPto != nullptr) {
@@ -3012,44 +3010,45 @@ void CNode::RelayDandelionTransaction(const CTransaction& tx, CNode* pfrom)
 
 void CNode::CheckDandelionEmbargoes()
 {
-    int64_t nCurrTime = GetTimeMicros();
-    for (auto iter=mDandelionEmbargo.begin(); iter != mDandelionEmbargo.end();) {
-        // If we got the embargoed transaction back, erase it.
-        if (mempool.exists(iter->first)) {
-           iter = mDandelionEmbargo.erase(iter);
-        } else if (iter->second < nCurrTime) {
-            // Embargo time is over, we did not "see" the transaction back in fluff phase,
-            // so start fluffing/relaying it.
-            CValidationState state;
-            shared_ptr<const CTransaction> ptx = txpools.getStemTxPool().get(iter->first);
-            // If txn was not found in Stempool, then something went wrong,
-            // Keep it embargoed for now.
-            if (!ptx) {
-               iter = mDandelionEmbargo.erase(iter);
-                continue;
-            }
-            bool fMissingInputs = false;
-            std::list<CTransactionRef> lRemovedTxn;
-            AcceptToMemoryPool(
-                mempool,
-                state,
-                ptx,
-                true, // fLimitFree
-                &fMissingInputs,
-                &lRemovedTxn,
-                false, /* fOverrideMempoolLimit */
-                0, /* nAbsurdFee */
-                false /*isCheckWalletTransaction*/
-                );
-            LogPrintf("AcceptToMemoryPool: accepted %s (poolsz %u txn, %u kB)\n",
-                      iter->first.ToString(),
-                      mempool.size(),
-                      mempool.DynamicMemoryUsage() / 1000);
-            g_connman->RelayTransaction(*ptx);
-            iter = mDandelionEmbargo.erase(iter);
-        } else {
-            iter++;
+    // Only the embargoes which ended are visited, those of transactions which we
+    // got back in fluff phase were removed when they entered the mempool.
+    // cs_main is only needed to fluff the transactions, not on every message.
+    std::vector<uint256> vExpired = dandelionEmbargoes.PopExpired(GetTimeMicros());
+    if (vExpired.empty())
+        return;
+
+    LOCK(cs_main);
+    for (const uint256& hash : vExpired) {
+        // If we got the embargoed transaction back, there is nothing to do.
+        if (mempool.exists(hash)) {
+            continue;
         }
+        // Embargo time is over, we did not "see" the transaction back in fluff phase,
+        // so start fluffing/relaying it.
+        CValidationState state;
+        shared_ptr<const CTransaction> ptx = txpools.getStemTxPool().get(hash);
+        // If txn was not found in Stempool, then something went wrong.
+        if (!ptx) {
+            continue;
+        }
+        bool fMissingInputs = false;
+        std::list<CTransactionRef> lRemovedTxn;
+        AcceptToMemoryPool(
+            mempool,
+            state,
+            ptx,
+            true, // fLimitFree
+            &fMissingInputs,
+            &lRemovedTxn,
+            false, /* fOverrideMempoolLimit */
+            0, /* nAbsurdFee */
+            false /*isCheckWalletTransaction*/
+            );
+        LogPrintf("AcceptToMemoryPool: accepted %s (poolsz %u txn, %u kB)\n",
+                  hash.ToString(),
+                  mempool.size(),
+                  mempool.DynamicMemoryUsage() / 1000);
+        g_connman->RelayTransaction(*ptx);
     }
 }
 
@@ -3692,19 +3691,13 @@ bool CNode::localDandelionDestinationPushInventory(const CInv& inv) {
 }
 
 bool CNode::insertDandelionEmbargo(const uint256& hash, const int64_t& embargo) {
-    auto pair = mDandelionEmbargo.insert(std::make_pair(hash, embargo));
-    return pair.second;
+    return dandelionEmbargoes.Insert(hash, embargo);
 }
 
 bool CNode::isTxDandelionEmbargoed(const uint256& hash) {
-    return mDandelionEmbargo.find(hash) != mDandelionEmbargo.end();
+    return dandelionEmbargoes.Contains(hash);
 }
 
 bool CNode::removeDandelionEmbargo(const uint256& hash) {
-    auto iter = mDandelionEmbargo.find(hash);
-    if (iter != mDandelionEmbargo.end()) {
-        mDandelionEmbargo.erase(iter);
-        return true;
-    }
-    return false;
+    return dandelionEmbargoes.Remove(hash);
 }
@@ -1011,9 +1011,6 @@ public:
     // in case of no limit, it will always response 0
     static uint64_t GetMaxOutboundTimeLeftInCycle();
 
-    // Public Dandelion field.
-    static std::map<uint256, int64_t> mDandelionEmbargo;
-
     // Dandelion methods, they all must be static, as they do not belong to any CNode, they belong
 		// to the currently running node.
     static bool isDandelionInbound(const CNode* const pnode);
@@ -45,6 +45,7 @@
 #include "llmq/quorums_signing.h"
 #include "llmq/quorums_signing_shares.h"
 
+#include <boost/bind.hpp>
 #include <boost/thread.hpp>
 
 #if defined(NDEBUG)
@@ -774,6 +775,17 @@ bool IsBanned(NodeId pnode)
 PeerLogicValidation::PeerLogicValidation(CConnman* connmanIn) : connman(connmanIn) {
     // Initialize global variables that cannot be constructed at startup.
     recentRejects.reset(new CRollingBloomFilter(120000, 0.000001));
+
+    mempool.NotifyEntryAdded.connect(boost::bind(&PeerLogicValidation::TransactionAddedToMempool, this, boost::placeholders::_1));
+}
+
+PeerLogicValidation::~PeerLogicValidation() {
+    mempool.NotifyEntryAdded.disconnect(boost::bind(&PeerLogicValidation::TransactionAddedToMempool, this, boost::placeholders::_1));
+}
+
+void PeerLogicValidation::TransactionAddedToMempool(CTransactionRef ptx) {
+    // We got the transaction back in fluff phase, or fluffed it ourselves
+    CNode::removeDandelionEmbargo(ptx->GetHash());
 }
 
 void PeerLogicValidation::SyncTransaction(const CTransaction& tx, const CBlockIndex* pindex, int nPosInBlock) {
@@ -1329,10 +1341,7 @@ bool static ProcessMessage(CNode* pfrom, const std::string& strCommand, CDataStr
         }
     }
 
-    {
-        LOCK(cs_main);
-        CNode::CheckDandelionEmbargoes();
-    }
+    CNode::CheckDandelionEmbargoes();
 
     if (strCommand == NetMsgType::REJECT)
     {
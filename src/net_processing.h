@@ -7,6 +7,7 @@
 #define BITCOIN_NET_PROCESSING_H
 
 #include "net.h"
+#include "primitives/transaction.h"
 #include "validationinterface.h"
 
 /** Default for -maxorphantx, maximum number of orphan transactions kept in memory */
@@ -29,7 +30,10 @@ private:
 
 public:
     PeerLogicValidation(CConnman* connmanIn);
+    ~PeerLogicValidation();
 
+    //! Ends the Dandelion embargo of a transaction which got to the mempool
+    void TransactionAddedToMempool(CTransactionRef ptx);
     virtual void SyncTransaction(const CTransaction& tx, const CBlockIndex* pindex, int nPosInBlock);
     virtual void UpdatedBlockTip(const CBlockIndex *pindexNew, const CBlockIndex *pindexFork, bool fInitialDownload);
     virtual void BlockChecked(const CBlock& block, const CValidationState& state);
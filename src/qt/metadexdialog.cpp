@@ -33,6 +33,7 @@
 
 #include <stdint.h>
 #include <map>
+#include <set>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -163,8 +164,13 @@ void MetaDExDialog::UpdateProperties()
     ui->comboPairTokenA->clear();
     ui->comboPairTokenB->clear();
 
+    std::set<uint32_t> propertyIds;
     for (md_PropertiesMap::iterator my_it = metadex.begin(); my_it != metadex.end(); ++my_it) {
-        uint32_t propertyId = my_it->first;
+        propertyIds.insert(my_it->first.first);
+    }
+
+    for (std::set<uint32_t>::iterator my_it = propertyIds.begin(); my_it != propertyIds.end(); ++my_it) {
+        uint32_t propertyId = *my_it;
         if ((testEco && !isTestEcosystemProperty(propertyId)) || (!testEco && isTestEcosystemProperty(propertyId))) continue;
         string spName;
         spName = getPropertyName(propertyId).c_str();
@@ -347,16 +353,15 @@ void MetaDExDialog::UpdateOffers()
     bool divisSale = isPropertyDivisible(GetPropForSale());
     bool divisDes = isPropertyDivisible(GetPropDesired());
 
-    for (md_PropertiesMap::iterator my_it = metadex.begin(); my_it != metadex.end(); ++my_it) {
-        if ((my_it->first != GetPropForSale())) continue; // not the property we're looking for, don't waste any more work
+    md_PropertiesMap::iterator my_it = metadex.find(std::make_pair(GetPropForSale(), GetPropDesired()));
+    if (my_it != metadex.end()) { // only the book of the selected pair is of interest
         md_PricesMap & prices = my_it->second;
-        for (md_PricesMap::iterator it = prices.begin(); it != prices.end(); ++it) { // loop through the sell prices for the property
+        for (md_PricesMap::iterator it = prices.begin(); it != prices.end(); ++it) { // loop through the sell prices for the pair
             std::string unitPriceStr;
             bool includesMe = false;
             md_Set & indexes = (it->second);
             for (md_Set::iterator it = indexes.begin(); it != indexes.end(); ++it) { // multiple sell offers can exist at the same price, sum them for the UI
                 const CMPMetaDEx& obj = *it;
-                if ((obj.getDesProperty() != GetPropDesired())) continue; // not the property we're interested in
                 if (IsMyAddress(obj.getAddr())) includesMe = true;
                 std::string strAvail;
                 if (divisSale) {
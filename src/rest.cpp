@@ -9,6 +9,7 @@
 #include "primitives/transaction.h"
 #include "validation.h"
 #include "httpserver.h"
+#include "rpc/jsonwriter.h"
 #include "rpc/server.h"
 #include "streams.h"
 #include "sync.h"
@@ -58,8 +59,8 @@ struct CCoin {
     }
 };
 
-extern void TxToJSON(const CTransaction& tx, const uint256 hashBlock, UniValue& entry);
-extern UniValue blockToJSON(const CBlock& block, const CBlockIndex* blockindex, bool txDetails = false);
+extern void TxToJSON(const CTransaction& tx, const uint256 hashBlock, CJSONWriter& entry);
+extern void blockToJSON(const CBlock& block, const CBlockIndex* blockindex, CJSONWriter& result, bool txDetails);
 extern UniValue mempoolInfoToJSON();
 extern UniValue mempoolToJSON(bool fVerbose = false);
 extern void ScriptPubKeyToJSON(const CScript& scriptPubKey, UniValue& out, bool fIncludeHex);
@@ -247,8 +248,12 @@ static bool rest_block(HTTPRequest* req,
     }
 
     case RF_JSON: {
-        UniValue objBlock = blockToJSON(block, pblockindex, showTxDetails);
-        std::string strJSON = objBlock.write() + "\n";
+        std::string strJSON;
+        CJSONWriter writer(strJSON);
+        writer.BeginObject();
+        blockToJSON(block, pblockindex, writer, showTxDetails);
+        writer.EndObject();
+        strJSON += "\n";
         req->WriteHeader("Content-Type", "application/json");
         req->WriteReply(HTTP_OK, strJSON);
         return true;
@@ -387,9 +392,12 @@ static bool rest_tx(HTTPRequest* req, const std::string& strURIPart)
     }
 
     case RF_JSON: {
-        UniValue objTx(UniValue::VOBJ);
-        TxToJSON(*tx, hashBlock, objTx);
-        std::string strJSON = objTx.write() + "\n";
+        std::string strJSON;
+        CJSONWriter writer(strJSON);
+        writer.BeginObject();
+        TxToJSON(*tx, hashBlock, writer);
+        writer.EndObject();
+        strJSON += "\n";
         req->WriteHeader("Content-Type", "application/json");
         req->WriteReply(HTTP_OK, strJSON);
         return true;
@@ -9,10 +9,13 @@
 #include "checkpoints.h"
 #include "coins.h"
 #include "core_io.h"
+#include "dandelion.h"
+#include "dbwrapper.h"
 #include "consensus/validation.h"
 #include "validation.h"
 #include "policy/policy.h"
 #include "primitives/transaction.h"
+#include "rpc/jsonwriter.h"
 #include "rpc/server.h"
 #include "streams.h"
 #include "sync.h"
@@ -47,6 +50,7 @@ static std::condition_variable cond_blockchange;
 static CUpdatedBlock latestblock;
 
 extern void TxToJSON(const CTransaction& tx, const uint256 hashBlock, UniValue& entry);
+extern void TxToJSON(const CTransaction& tx, const uint256 hashBlock, CJSONWriter& entry);
 void ScriptPubKeyToJSON(const CScript& scriptPubKey, UniValue& out, bool fIncludeHex);
 
 double GetDifficulty(const CBlockIndex* blockindex)
@@ -108,50 +112,64 @@ UniValue blockheaderToJSON(const CBlockIndex* blockindex)
     return result;
 }
 
-UniValue blockToJSON(const CBlock& block, const CBlockIndex* blockindex, bool txDetails = false)
+void blockToJSON(const CBlock& block, const CBlockIndex* blockindex, CJSONWriter& result, bool txDetails)
 {
-    UniValue result(UniValue::VOBJ);
-    result.push_back(Pair("hash", blockindex->GetBlockHash().GetHex()));
+    result.KeyValue("hash", blockindex->GetBlockHash().GetHex());
     int confirmations = -1;
     // Only report confirmations if the block is on the main chain
     if (chainActive.Contains(blockindex))
         confirmations = chainActive.Height() - blockindex->nHeight + 1;
-    result.push_back(Pair("confirmations", confirmations));
-    result.push_back(Pair("strippedsize", (int)::GetSerializeSize(block, SER_NETWORK, PROTOCOL_VERSION | SERIALIZE_TRANSACTION_NO_WITNESS)));
-    result.push_back(Pair("size", (int)::GetSerializeSize(block, SER_NETWORK, PROTOCOL_VERSION)));
-    result.push_back(Pair("weight", (int)::GetBlockWeight(block)));
-    result.push_back(Pair("height", blockindex->nHeight));
-    result.push_back(Pair("version", block.nVersion));
-    result.push_back(Pair("versionHex", strprintf("%08x", block.nVersion)));
-    result.push_back(Pair("merkleroot", block.hashMerkleRoot.GetHex()));
-    UniValue txs(UniValue::VARR);
+    result.KeyValue("confirmations", confirmations);
+    result.KeyValue("strippedsize", (int)::GetSerializeSize(block, SER_NETWORK, PROTOCOL_VERSION | SERIALIZE_TRANSACTION_NO_WITNESS));
+    result.KeyValue("size", (int)::GetSerializeSize(block, SER_NETWORK, PROTOCOL_VERSION));
+    result.KeyValue("weight", (int)::GetBlockWeight(block));
+    result.KeyValue("height", blockindex->nHeight);
+    result.KeyValue("version", block.nVersion);
+    result.KeyValue("versionHex", strprintf("%08x", block.nVersion));
+    result.KeyValue("merkleroot", block.hashMerkleRoot.GetHex());
+    result.Key("tx").BeginArray();
     for(const auto& tx : block.vtx)
     {
         if(txDetails)
         {
-            UniValue objTx(UniValue::VOBJ);
-            TxToJSON(*tx, uint256(), objTx);
-            txs.push_back(objTx);
+            result.BeginObject();
+            TxToJSON(*tx, uint256(), result);
+            result.EndObject();
         }
         else
-            txs.push_back(tx->GetHash().GetHex());
+            result.Value(tx->GetHash().GetHex());
     }
-    result.push_back(Pair("tx", txs));
+    result.EndArray();
     if (!block.vtx[0]->vExtraPayload.empty()) {
-        CbtxToJson(*block.vtx[0], result);
+        UniValue cbTx(UniValue::VOBJ);
+        CbtxToJson(*block.vtx[0], cbTx);
+        result.Members(cbTx);
     }
-    result.push_back(Pair("time", block.GetBlockTime()));
-    result.push_back(Pair("mediantime", (int64_t)blockindex->GetMedianTimePast()));
-    result.push_back(Pair("nonce", (uint64_t)block.nNonce));
-    result.push_back(Pair("bits", strprintf("%08x", block.nBits)));
-    result.push_back(Pair("difficulty", GetDifficulty(blockindex)));
-    result.push_back(Pair("chainwork", blockindex->nChainWork.GetHex()));
+    result.KeyValue("time", block.GetBlockTime());
+    result.KeyValue("mediantime", (int64_t)blockindex->GetMedianTimePast());
+    result.KeyValue("nonce", (uint64_t)block.nNonce);
+    result.KeyValue("bits", strprintf("%08x", block.nBits));
+    result.KeyValue("difficulty", UniValue(GetDifficulty(blockindex)));
+    result.KeyValue("chainwork", blockindex->nChainWork.GetHex());
 
     if (blockindex->pprev)
-        result.push_back(Pair("previousblockhash", blockindex->pprev->GetBlockHash().GetHex()));
+        result.KeyValue("previousblockhash", blockindex->pprev->GetBlockHash().GetHex());
     CBlockIndex *pnext = chainActive.Next(blockindex);
     if (pnext)
-        result.push_back(Pair("nextblockhash", pnext->GetBlockHash().GetHex()));
+        result.KeyValue("nextblockhash", pnext->GetBlockHash().GetHex());
+}
+
+UniValue blockToJSON(const CBlock& block, const CBlockIndex* blockindex, bool txDetails = false)
+{
+    std::string json;
+    CJSONWriter writer(json);
+    writer.BeginObject();
+    blockToJSON(block, blockindex, writer, txDetails);
+    writer.EndObject();
+
+    UniValue result;
+    if (!result.read(json))
+        throw JSONRPCError(RPC_INTERNAL_ERROR, "Unable to encode the block");
     return result;
 }
 
@@ -765,11 +783,12 @@ UniValue getblock(const JSONRPCRequest& request)
     if (request.fHelp || request.params.size() < 1 || request.params.size() > 2)
         throw runtime_error(
             "getblock \"blockhash\" ( verbose )\n"
-            "\nIf verbose is false, returns a string that is serialized, hex-encoded data for block 'hash'.\n"
-            "If verbose is true, returns an Object with information about block <hash>.\n"
+            "\nIf verbose is false or 0, returns a string that is serialized, hex-encoded data for block 'hash'.\n"
+            "If verbose is true or 1, returns an Object with information about block <hash>.\n"
+            "If verbose is 2, returns an Object with information about block <hash> and information about each transaction.\n"
             "\nArguments:\n"
             "1. \"blockhash\"          (string, required) The block hash\n"
-            "2. verbose                (boolean, optional, default=true) true for a json object, false for the hex encoded data\n"
+            "2. verbose                (boolean or numeric, optional, default=true) true or 1 for a json object, 2 for a json object with decoded transactions, false or 0 for the hex encoded data\n"
             "\nResult (for verbose = true):\n"
             "{\n"
             "  \"hash\" : \"hash\",     (string) the block hash (same as provided)\n"
@@ -799,6 +818,14 @@ UniValue getblock(const JSONRPCRequest& request)
             "  \"previousblockhash\" : \"hash\",  (string) The hash of the previous block\n"
             "  \"nextblockhash\" : \"hash\"       (string) The hash of the next block\n"
             "}\n"
+            "\nResult (for verbose = 2):\n"
+            "{\n"
+            "  ...,                     Same output as verbose = 1.\n"
+            "  \"tx\" : [               (array of Objects) The transactions in the format of the getrawtransaction RPC. Different from verbose = 1 \"tx\" result.\n"
+            "         ,...\n"
+            "  ],\n"
+            "  ,...                     Same output as verbose = 1.\n"
+            "}\n"
             "\nResult (for verbose=false):\n"
             "\"data\"             (string) A string that is serialized, hex-encoded data for block 'hash'.\n"
             "\nExamples:\n"
@@ -811,9 +838,13 @@ UniValue getblock(const JSONRPCRequest& request)
     std::string strHash = request.params[0].get_str();
     uint256 hash(uint256S(strHash));
 
-    bool fVerbose = true;
-    if (request.params.size() > 1)
-        fVerbose = request.params[1].get_bool();
+    int verbosity = 1;
+    if (request.params.size() > 1) {
+        if (request.params[1].isNum())
+            verbosity = request.params[1].get_int();
+        else
+            verbosity = request.params[1].get_bool() ? 1 : 0;
+    }
 
     if (mapBlockIndex.count(hash) == 0)
         throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Block not found");
@@ -832,7 +863,7 @@ UniValue getblock(const JSONRPCRequest& request)
         // block).
         throw JSONRPCError(RPC_MISC_ERROR, "Block not found on disk");
 
-    if (!fVerbose)
+    if (verbosity <= 0)
     {
         CDataStream ssBlock(SER_NETWORK, PROTOCOL_VERSION | RPCSerializationFlags());
         ssBlock << block;
@@ -840,7 +871,16 @@ UniValue getblock(const JSONRPCRequest& request)
         return strHex;
     }
 
-    return blockToJSON(block, pblockindex);
+    if (request.jsonResult) {
+        // big blocks are written straight into the reply
+        CJSONWriter writer(*request.jsonResult);
+        writer.BeginObject();
+        blockToJSON(block, pblockindex, writer, verbosity >= 2);
+        writer.EndObject();
+        return NullUniValue;
+    }
+
+    return blockToJSON(block, pblockindex, verbosity >= 2);
 }
 
 struct CCoinsStats
@@ -999,6 +1039,61 @@ UniValue gettxoutsetinfo(const JSONRPCRequest& request)
     return ret;
 }
 
+UniValue getdbstats(const JSONRPCRequest& request)
+{
+    if (request.fHelp || request.params.size() != 0)
+        throw runtime_error(
+            "getdbstats\n"
+            "\nReturns the tuning and statistics of the LevelDB databases.\n"
+            "\nResult:\n"
+            "[\n"
+            "  {\n"
+            "    \"name\": \"name\",           (string) The database, chainstate, blockindex, evodb or llmq\n"
+            "    \"blockcachesize\": n,        (numeric) The size of the block cache in bytes\n"
+            "    \"writebuffersize\": n,       (numeric) The size of a write buffer in bytes\n"
+            "    \"maxfilesize\": n,           (numeric) The size of the table files in bytes\n"
+            "    \"blockcacheusage\": n,       (numeric) The bytes used by the block cache\n"
+            "    \"memoryusage\": n,           (numeric) The bytes used by the block cache and the write buffers\n"
+            "    \"cachehits\": n,             (numeric) The block cache lookups which found the block\n"
+            "    \"cachemisses\": n,           (numeric) The block cache lookups which read the block from disk\n"
+            "    \"cachehitrate\": x.xxx,      (numeric) The share of the lookups which found the block\n"
+            "    \"levelfiles\": [n,...],      (array) The number of table files at each level\n"
+            "    \"compactiontime\": n,        (numeric) The seconds spent compacting, summed over the levels\n"
+            "    \"compactionread\": n,        (numeric) The megabytes read by compactions\n"
+            "    \"compactionwritten\": n      (numeric) The megabytes written by compactions\n"
+            "  },\n"
+            "  ...\n"
+            "]\n"
+            "\nExamples:\n"
+            + HelpExampleCli("getdbstats", "")
+            + HelpExampleRpc("getdbstats", "")
+        );
+
+    UniValue ret(UniValue::VARR);
+    for (const CDBStats& stats : GetDBStats()) {
+        UniValue obj(UniValue::VOBJ);
+        obj.push_back(Pair("name", stats.strName));
+        obj.push_back(Pair("blockcachesize", (uint64_t)stats.tuning.nBlockCacheSize));
+        obj.push_back(Pair("writebuffersize", (uint64_t)stats.tuning.nWriteBufferSize));
+        obj.push_back(Pair("maxfilesize", (uint64_t)stats.tuning.nMaxFileSize));
+        obj.push_back(Pair("blockcacheusage", (uint64_t)stats.nBlockCacheUsage));
+        obj.push_back(Pair("memoryusage", stats.nMemoryUsage));
+        obj.push_back(Pair("cachehits", stats.nCacheHits));
+        obj.push_back(Pair("cachemisses", stats.nCacheMisses));
+        uint64_t nLookups = stats.nCacheHits + stats.nCacheMisses;
+        obj.push_back(Pair("cachehitrate", nLookups ? (double)stats.nCacheHits / nLookups : 0.0));
+        UniValue levelFiles(UniValue::VARR);
+        for (int nFiles : stats.vLevelFiles)
+            levelFiles.push_back(nFiles);
+        obj.push_back(Pair("levelfiles", levelFiles));
+        obj.push_back(Pair("compactiontime", stats.dCompactionSeconds));
+        obj.push_back(Pair("compactionread", stats.dCompactionReadMB));
+        obj.push_back(Pair("compactionwritten", stats.dCompactionWriteMB));
+        ret.push_back(obj);
+    }
+    return ret;
+}
+
 UniValue gettxout(const JSONRPCRequest& request)
 {
     if (request.fHelp || request.params.size() < 2 || request.params.size() > 3)
@@ -1372,6 +1467,8 @@ UniValue mempoolInfoToJSON()
     size_t maxmempool = GetArg("-maxmempool", DEFAULT_MAX_MEMPOOL_SIZE) * 1000000;
     ret.push_back(Pair("maxmempool", (int64_t) maxmempool));
     ret.push_back(Pair("mempoolminfee", ValueFromAmount(mempool.GetMinFee(maxmempool).GetFeePerK())));
+    ret.push_back(Pair("dandelionembargoes", (int64_t) dandelionEmbargoes.Size()));
+    ret.push_back(Pair("dandelionembargousage", (int64_t) dandelionEmbargoes.DynamicMemoryUsage()));
 
     return ret;
 }
@@ -1388,7 +1485,9 @@ UniValue getmempoolinfo(const JSONRPCRequest& request)
             "  \"bytes\": xxxxx,              (numeric) Sum of all virtual transaction sizes as defined in BIP 141. Differs from actual serialized size because witness data is discounted\n"
             "  \"usage\": xxxxx,              (numeric) Total memory usage for the mempool\n"
             "  \"maxmempool\": xxxxx,         (numeric) Maximum memory usage for the mempool\n"
-            "  \"mempoolminfee\": xxxxx       (numeric) Minimum fee for tx to be accepted\n"
+            "  \"mempoolminfee\": xxxxx,      (numeric) Minimum fee for tx to be accepted\n"
+            "  \"dandelionembargoes\": xxxxx, (numeric) Dandelion transactions relayed in stem phase and waiting for their embargo to end\n"
+            "  \"dandelionembargousage\": xxxxx (numeric) Memory usage of the Dandelion embargoes\n"
             "}\n"
             "\nExamples:\n"
             + HelpExampleCli("getmempoolinfo", "")
@@ -1629,6 +1728,7 @@ static const CRPCCommand commands[] =
     { "blockchain",         "getblockhashes",         &getblockhashes,         true,  {"high", "low"} },
     { "blockchain",         "getblockheader",         &getblockheader,         true,  {"blockhash","verbose"} },
     { "blockchain",         "getchaintips",           &getchaintips,           true,  {} },
+    { "blockchain",         "getdbstats",             &getdbstats,             true,  {} },
     { "blockchain",         "getdifficulty",          &getdifficulty,          true,  {} },
     { "blockchain",         "getmempoolancestors",    &getmempoolancestors,    true,  {"txid","verbose"} },
     { "blockchain",         "getmempooldescendants",  &getmempooldescendants,  true,  {"txid","verbose"} },
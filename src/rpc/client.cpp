@@ -181,8 +181,12 @@ static const CRPCConvertParam vRPCConvertParams[] =
     { "spendallzerocoin", 0 },
     { "remintzerocointosigma", 0 },
     { "getanonymityset", 0},
+    { "getanonymityset", 3},
     { "getmintmetadata", 0 },
-    { "getusedcoinserials", 0 },
+    { "getusedcoinserials", 1 },
+    { "getlelantusanonymityset", 0 },
+    { "getlelantusanonymityset", 2 },
+    { "getlelantususedcoinserials", 1 },
     { "getlatestcoinids", 0 },
 
     /* Elysium - data retrieval calls */
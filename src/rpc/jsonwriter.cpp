@@ -0,0 +1,160 @@
+// Copyright (c) 2020 The Firo Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "rpc/jsonwriter.h"
+
+#include <univalue.h>
+
+#include <assert.h>
+
+CJSONWriter::CJSONWriter(std::string& out) : out(out), fAfterKey(false)
+{
+}
+
+void CJSONWriter::Separator()
+{
+    if (fAfterKey) {
+        fAfterKey = false;
+        return;
+    }
+    if (vFirst.empty())
+        return;
+    if (!vFirst.back())
+        out += ',';
+    vFirst.back() = false;
+}
+
+void CJSONWriter::WriteString(const std::string& value)
+{
+    static const char hex[] = "0123456789abcdef";
+
+    out += '"';
+    for (unsigned char c : value) {
+        switch (c) {
+        case '"':  out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\b': out += "\\b"; break;
+        case '\t': out += "\\t"; break;
+        case '\n': out += "\\n"; break;
+        case '\f': out += "\\f"; break;
+        case '\r': out += "\\r"; break;
+        default:
+            if (c < 0x20 || c == 0x7f) {
+                out += "\\u00";
+                out += hex[c >> 4];
+                out += hex[c & 0x0f];
+            } else {
+                out += c;
+            }
+        }
+    }
+    out += '"';
+}
+
+CJSONWriter& CJSONWriter::BeginObject()
+{
+    Separator();
+    out += '{';
+    vFirst.push_back(true);
+    return *this;
+}
+
+CJSONWriter& CJSONWriter::EndObject()
+{
+    assert(!vFirst.empty() && !fAfterKey);
+    vFirst.pop_back();
+    out += '}';
+    return *this;
+}
+
+CJSONWriter& CJSONWriter::BeginArray()
+{
+    Separator();
+    out += '[';
+    vFirst.push_back(true);
+    return *this;
+}
+
+CJSONWriter& CJSONWriter::EndArray()
+{
+    assert(!vFirst.empty() && !fAfterKey);
+    vFirst.pop_back();
+    out += ']';
+    return *this;
+}
+
+CJSONWriter& CJSONWriter::Key(const char* key)
+{
+    assert(!fAfterKey);
+    Separator();
+    WriteString(key);
+    out += ':';
+    fAfterKey = true;
+    return *this;
+}
+
+CJSONWriter& CJSONWriter::Value(const std::string& value)
+{
+    Separator();
+    WriteString(value);
+    return *this;
+}
+
+CJSONWriter& CJSONWriter::Value(const char* value)
+{
+    Separator();
+    WriteString(value);
+    return *this;
+}
+
+CJSONWriter& CJSONWriter::Value(int value)
+{
+    return Value(int64_t(value));
+}
+
+CJSONWriter& CJSONWriter::Value(int64_t value)
+{
+    Separator();
+    out += std::to_string(value);
+    return *this;
+}
+
+CJSONWriter& CJSONWriter::Value(uint64_t value)
+{
+    Separator();
+    out += std::to_string(value);
+    return *this;
+}
+
+CJSONWriter& CJSONWriter::Value(bool value)
+{
+    Separator();
+    out += value ? "true" : "false";
+    return *this;
+}
+
+CJSONWriter& CJSONWriter::Null()
+{
+    Separator();
+    out += "null";
+    return *this;
+}
+
+CJSONWriter& CJSONWriter::Value(const UniValue& value)
+{
+    Separator();
+    out += value.write();
+    return *this;
+}
+
+CJSONWriter& CJSONWriter::Members(const UniValue& obj)
+{
+    const std::vector<std::string>& keys = obj.getKeys();
+    const std::vector<UniValue>& values = obj.getValues();
+    for (size_t i = 0; i < keys.size(); i++) {
+        Key(keys[i].c_str());
+        Value(values[i]);
+    }
+    return *this;
+}
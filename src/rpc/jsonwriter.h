@@ -0,0 +1,63 @@
+// Copyright (c) 2020 The Firo Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef FIRO_RPC_JSONWRITER_H
+#define FIRO_RPC_JSONWRITER_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+class UniValue;
+
+/**
+ * Writes JSON text straight into a string, for RPC results which are too big
+ * to build as a UniValue tree first. Keys and values have to be written in
+ * document order, separators are inserted automatically. The output is the
+ * same as UniValue::write() without indentation.
+ */
+class CJSONWriter
+{
+public:
+    explicit CJSONWriter(std::string& out);
+
+    CJSONWriter& BeginObject();
+    CJSONWriter& EndObject();
+    CJSONWriter& BeginArray();
+    CJSONWriter& EndArray();
+
+    CJSONWriter& Key(const char* key);
+
+    CJSONWriter& Value(const std::string& value);
+    CJSONWriter& Value(const char* value);
+    CJSONWriter& Value(int value);
+    CJSONWriter& Value(int64_t value);
+    CJSONWriter& Value(uint64_t value);
+    CJSONWriter& Value(bool value);
+    CJSONWriter& Null();
+
+    /** Writes a (small) UniValue as is, e.g. amounts or nested payloads. */
+    CJSONWriter& Value(const UniValue& value);
+
+    /** Writes the members of a UniValue object into the current object. */
+    CJSONWriter& Members(const UniValue& obj);
+
+    template<typename T>
+    CJSONWriter& KeyValue(const char* key, const T& value)
+    {
+        Key(key);
+        return Value(value);
+    }
+
+private:
+    void Separator();
+    void WriteString(const std::string& value);
+
+    std::string& out;
+    // one entry per open object or array, true until its first element
+    std::vector<bool> vFirst;
+    bool fAfterKey;
+};
+
+#endif // FIRO_RPC_JSONWRITER_H
@@ -21,6 +21,8 @@
 #endif
 #include "txdb.h"
 #include "zerocoin.h"
+#include "sigma.h"
+#include "lelantus.h"
 
 #include "masternode-sync.h"
 
@@ -898,17 +900,28 @@ UniValue getaddressbalance(const JSONRPCRequest& request)
         throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Invalid address");
     }
 
-    std::vector<std::pair<CAddressIndexKey, CAmount> > addressIndex;
+    CAmount balance = 0;
+    CAmount received = 0;
 
+    std::vector<std::pair<uint160, AddressType> > unaggregated;
     for (std::vector<std::pair<uint160, AddressType> >::iterator it = addresses.begin(); it != addresses.end(); it++) {
+        CAmount addressBalance, addressReceived;
+        if (GetAddressBalance((*it).first, (*it).second, addressBalance, addressReceived)) {
+            balance += addressBalance;
+            received += addressReceived;
+        } else {
+            unaggregated.push_back(*it);
+        }
+    }
+
+    std::vector<std::pair<CAddressIndexKey, CAmount> > addressIndex;
+
+    for (std::vector<std::pair<uint160, AddressType> >::iterator it = unaggregated.begin(); it != unaggregated.end(); it++) {
         if (!GetAddressIndex((*it).first, (*it).second, addressIndex)) {
             throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "No information available for address");
         }
     }
 
-    CAmount balance = 0;
-    CAmount received = 0;
-
     for (std::vector<std::pair<CAddressIndexKey, CAmount> >::const_iterator it=addressIndex.begin(); it!=addressIndex.end(); it++) {
         if (it->second > 0) {
             received += it->second;
@@ -924,21 +937,109 @@ UniValue getaddressbalance(const JSONRPCRequest& request)
 
 }
 
+namespace {
+
+// Returns the block a mobile client has already synced up to, null when it asks for the whole set.
+// After a reorg the block is off the active chain and the client has to start over.
+CBlockIndex* GetStartBlock(UniValue const & param)
+{
+    AssertLockHeld(cs_main);
+
+    if (param.isNull() || param.get_str().empty())
+        return nullptr;
+
+    uint256 hash = ParseHashV(param, "startBlockHash");
+    BlockMap::iterator it = mapBlockIndex.find(hash);
+    if (it == mapBlockIndex.end())
+        throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Block not found");
+    if (!chainActive.Contains(it->second))
+        throw JSONRPCError(RPC_INVALID_PARAMETER, "Block is not in the active chain, request the whole set");
+
+    return it->second;
+}
+
+// Start block for the queries answered from a state snapshot, the snapshot can lag behind or be
+// ahead of chainActive but both have to be on the same branch
+CBlockIndex* GetSnapshotStartBlock(UniValue const & param, uint256 const & snapshotTip)
+{
+    LOCK(cs_main);
+
+    CBlockIndex *startBlock = GetStartBlock(param);
+    if (!startBlock || snapshotTip.IsNull())
+        return startBlock;
+
+    CBlockIndex *tip = mapBlockIndex.at(snapshotTip);
+    if (tip->GetAncestor(startBlock->nHeight) != startBlock && startBlock->GetAncestor(tip->nHeight) != tip)
+        throw JSONRPCError(RPC_INVALID_PARAMETER, "Block is not in the active chain, request the whole set");
+
+    return startBlock;
+}
+
+bool GetCompactFlag(JSONRPCRequest const & request, size_t index)
+{
+    return request.params.size() > index && !request.params[index].isNull() && request.params[index].get_bool();
+}
+
+// Elements are written either as an array of hex strings or, in compact form,
+// back to back into a single base64 string.
+template<class T>
+void AppendElement(T const & element, std::vector<unsigned char>& compact, UniValue& array, bool fCompact)
+{
+    size_t offset = compact.size();
+    compact.resize(offset + T::memoryRequired());
+    element.serialize(compact.data() + offset);
+    if (!fCompact) {
+        array.push_back(HexStr(compact.begin() + offset, compact.end()));
+        compact.resize(offset);
+    }
+}
+
+UniValue FinishElements(std::vector<unsigned char> const & compact, UniValue& array, bool fCompact)
+{
+    if (fCompact)
+        return EncodeBase64(compact.data(), compact.size());
+    return array;
+}
+
+// Copies only the serials while cs_main is held, either the ones spent in the blocks above
+// startBlock or all of them, the encoding is left to the caller.
+template<class BlockSerials, class Serials>
+void GetSerialsSince(CBlockIndex const * startBlock, BlockSerials CBlockIndex::* blockSerials, Serials const & allSerials, std::vector<Scalar>& serials_out)
+{
+    AssertLockHeld(cs_main);
+
+    if (!startBlock) {
+        serials_out.reserve(allSerials.size());
+        for (auto const & serial : allSerials)
+            serials_out.push_back(serial.first);
+        return;
+    }
+
+    for (CBlockIndex *block = chainActive.Next(startBlock); block; block = chainActive.Next(block)) {
+        for (auto const & serial : block->*blockSerials)
+            serials_out.push_back(serial.first);
+    }
+}
+
+} // anonymous namespace
+
 UniValue getanonymityset(const JSONRPCRequest& request)
 {
-    if (request.fHelp || request.params.size() != 2)
+    if (request.fHelp || request.params.size() < 2 || request.params.size() > 4)
         throw runtime_error(
-                "getanonymityset\n"
+                "getanonymityset \"denomination\" \"coinGroupId\" ( \"startBlockHash\" compact )\n"
                         "\nReturns the anonymity set and latest block hash.\n"
                         "\nArguments:\n"
-                        "{\n"
-                        "      \"denomination\"  (int64_t) int denomination\n"
-                        "      \"coinGroupId\"  (int)\n"
-                        "}\n"
+                        "1. \"denomination\"    (int64_t) int denomination\n"
+                        "2. \"coinGroupId\"     (int)\n"
+                        "3. \"startBlockHash\"  (string, optional) Only return the coins minted after this block,\n"
+                        "                       usually the blockHash returned by the previous call\n"
+                        "4. compact            (bool, optional, default=false) Return the coins as a single base64 string\n"
                         "\nResult:\n"
                         "{\n"
                         "  \"blockHash\"   (string) Latest block hash for anonymity set\n"
-                        "  \"anonymityset\"(std::string[]) array of Serialized GroupElements\n"
+                        "  \"serializedCoins\"(std::string[]) array of Serialized GroupElements, or base64 of the concatenated\n"
+                        "                  GroupElements when compact is set\n"
                         "}\n"
                 + HelpExampleCli("getanonymityset", "100000000 1")
                 + HelpExampleRpc("getanonymityset", "\"100000000\", \"1\"")
@@ -957,30 +1058,101 @@ UniValue getanonymityset(const JSONRPCRequest& request)
     sigma::CoinDenomination denomination;
     sigma::IntegerToDenomination(intDenom, denomination);
 
+    bool fCompact = GetCompactFlag(request, 3);
+
     uint256 blockHash;
     std::vector<sigma::PublicCoin> coins;
 
     {
-        LOCK(cs_main);
-        sigma::CSigmaState* sigmaState = sigma::CSigmaState::GetState();
-        sigmaState->GetCoinSetForSpend(
-                &chainActive,
-                chainActive.Height() - (ZC_MINT_CONFIRMATIONS - 1),
+        auto snapshot = sigma::CSigmaState::GetState()->GetSnapshot();
+        CBlockIndex *startBlock = GetSnapshotStartBlock(request.params.size() > 2 ? request.params[2] : NullUniValue, snapshot->GetBlockHash());
+        snapshot->GetCoinSetForSpend(
+                snapshot->GetHeight() - (ZC_MINT_CONFIRMATIONS - 1),
                 denomination,
                 coinGroupId,
                 blockHash,
-                coins);
+                coins,
+                startBlock ? startBlock->nHeight : -1);
+
+        // nothing new, keep the caller where it is
+        if (coins.empty() && startBlock)
+            blockHash = startBlock->GetBlockHash();
     }
 
+    std::vector<unsigned char> compact;
     UniValue serializedCoins(UniValue::VARR);
     for(sigma::PublicCoin const & coin : coins) {
-        std::vector<unsigned char> vch = coin.getValue().getvch();
-        serializedCoins.push_back(HexStr(vch.begin(), vch.end()));
+        AppendElement(coin.getValue(), compact, serializedCoins, fCompact);
     }
 
     UniValue ret(UniValue::VOBJ);
     ret.push_back(Pair("blockHash", blockHash.GetHex()));
-    ret.push_back(Pair("serializedCoins", serializedCoins));
+    ret.push_back(Pair("serializedCoins", FinishElements(compact, serializedCoins, fCompact)));
+
+    return ret;
+}
+
+UniValue getlelantusanonymityset(const JSONRPCRequest& request)
+{
+    if (request.fHelp || request.params.size() < 1 || request.params.size() > 3)
+        throw runtime_error(
+                "getlelantusanonymityset coinGroupId ( \"startBlockHash\" compact )\n"
+                        "\nReturns the lelantus anonymity set and latest block hash.\n"
+                        "\nArguments:\n"
+                        "1. coinGroupId       (int)\n"
+                        "2. \"startBlockHash\"  (string, optional) Only return the coins minted after this block,\n"
+                        "                       usually the blockHash returned by the previous call\n"
+                        "3. compact            (bool, optional, default=false) Return the coins as a single base64 string\n"
+                        "\nResult:\n"
+                        "{\n"
+                        "  \"blockHash\"   (string) Latest block hash for anonymity set\n"
+                        "  \"coins\"       (array) [serialized GroupElement, tag] pairs as hex, or base64 of the concatenated\n"
+                        "                  GroupElements and tags when compact is set\n"
+                        "}\n"
+                + HelpExampleCli("getlelantusanonymityset", "1")
+                + HelpExampleRpc("getlelantusanonymityset", "1")
+        );
+
+    int coinGroupId = request.params[0].get_int();
+    bool fCompact = GetCompactFlag(request, 2);
+
+    uint256 blockHash;
+    std::vector<lelantus::PublicCoin> coins;
+    std::vector<uint256> tags;
+
+    {
+        auto snapshot = lelantus::CLelantusState::GetState()->GetSnapshot();
+        CBlockIndex *startBlock = GetSnapshotStartBlock(request.params.size() > 1 ? request.params[1] : NullUniValue, snapshot->GetBlockHash());
+        snapshot->GetCoinSetForSpend(
+                snapshot->GetHeight() - (ZC_MINT_CONFIRMATIONS - 1),
+                coinGroupId,
+                blockHash,
+                coins,
+                startBlock ? startBlock->nHeight : -1,
+                &tags);
+
+        // nothing new, keep the caller where it is
+        if (coins.empty() && startBlock)
+            blockHash = startBlock->GetBlockHash();
+    }
+
+    std::vector<unsigned char> compact;
+    UniValue serializedCoins(UniValue::VARR);
+    for (size_t i = 0; i < coins.size(); i++) {
+        if (fCompact) {
+            AppendElement(coins[i].getValue(), compact, serializedCoins, true);
+            compact.insert(compact.end(), tags[i].begin(), tags[i].end());
+        } else {
+            UniValue coin(UniValue::VARR);
+            AppendElement(coins[i].getValue(), compact, coin, false);
+            coin.push_back(tags[i].GetHex());
+            serializedCoins.push_back(coin);
+        }
+    }
+
+    UniValue ret(UniValue::VOBJ);
+    ret.push_back(Pair("blockHash", blockHash.GetHex()));
+    ret.push_back(Pair("coins", FinishElements(compact, serializedCoins, fCompact)));
 
     return ret;
 }
@@ -1012,7 +1184,7 @@ UniValue getmintmetadata(const JSONRPCRequest& request)
     if (!mintValues.isArray()) {
             throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "mints is expected to be an array");
     }
-    sigma::CSigmaState* sigmaState = sigma::CSigmaState::GetState();
+    auto snapshot = sigma::CSigmaState::GetState()->GetSnapshot();
     UniValue ret(UniValue::VARR);
     for(UniValue const & mintData : mintValues.getValues()){
         vector<unsigned char> serializedCoin = ParseHex(find_value(mintData, "pubcoin").get_str().c_str());
@@ -1024,11 +1196,7 @@ UniValue getmintmetadata(const JSONRPCRequest& request)
         sigma::CoinDenomination denomination;
         sigma::IntegerToDenomination(intDenom, denomination);
 
-        std::pair<int, int> coinHeightAndId;
-        {
-            LOCK(cs_main);
-            coinHeightAndId = sigmaState->GetMintedCoinHeightAndId(sigma::PublicCoin(pubCoin, denomination));
-        }
+        std::pair<int, int> coinHeightAndId = snapshot->GetMintedCoinHeightAndId(sigma::PublicCoin(pubCoin, denomination));
         UniValue metaData(UniValue::VOBJ);
         metaData.pushKV(to_string(coinHeightAndId.first), coinHeightAndId.second);
         ret.push_back(metaData);
@@ -1038,29 +1206,80 @@ UniValue getmintmetadata(const JSONRPCRequest& request)
 
 UniValue getusedcoinserials(const JSONRPCRequest& request)
 {
-    if (request.fHelp || request.params.size() != 0)
+    if (request.fHelp || request.params.size() > 2)
         throw runtime_error(
-                "getusedcoinserials\n"
+                "getusedcoinserials ( \"startBlockHash\" compact )\n"
                 "\nReturns the set of used coin serial.\n"
+                "\nArguments:\n"
+                "1. \"startBlockHash\"  (string, optional) Only return the serials spent after this block,\n"
+                "                       usually the blockHash returned by the previous call\n"
+                "2. compact            (bool, optional, default=false) Return the serials as a single base64 string\n"
                 "\nResult:\n"
                 "{\n"
-                "  \"serials\" (std::string[]) array of Serialized Scalars\n"
+                "  \"blockHash\" (string) Block up to which the serials are returned\n"
+                "  \"serials\" (std::string[]) array of Serialized Scalars, or base64 of the concatenated Scalars\n"
                 "}\n"
         );
 
-    sigma::CSigmaState* sigmaState = sigma::CSigmaState::GetState();
-    sigma::spend_info_container serials;
+    bool fCompact = GetCompactFlag(request, 1);
+
+    uint256 blockHash;
+    std::vector<Scalar> serials;
     {
         LOCK(cs_main);
-        serials = sigmaState->GetSpends();
+        CBlockIndex *startBlock = GetStartBlock(request.params.size() > 0 ? request.params[0] : NullUniValue);
+        GetSerialsSince(startBlock, &CBlockIndex::sigmaSpentSerials, sigma::CSigmaState::GetState()->GetSpends(), serials);
+        blockHash = chainActive.Tip()->GetBlockHash();
     }
 
+    std::vector<unsigned char> compact;
     UniValue serializedSerials(UniValue::VARR);
-    for ( auto it = serials.begin(); it != serials.end(); ++it )
-        serializedSerials.push_back(it->first.GetHex());
+    for (Scalar const & serial : serials)
+        AppendElement(serial, compact, serializedSerials, fCompact);
 
     UniValue ret(UniValue::VOBJ);
-    ret.push_back(Pair("serials", serializedSerials));
+    ret.push_back(Pair("blockHash", blockHash.GetHex()));
+    ret.push_back(Pair("serials", FinishElements(compact, serializedSerials, fCompact)));
+
+    return ret;
+}
+
+UniValue getlelantususedcoinserials(const JSONRPCRequest& request)
+{
+    if (request.fHelp || request.params.size() > 2)
+        throw runtime_error(
+                "getlelantususedcoinserials ( \"startBlockHash\" compact )\n"
+                "\nReturns the set of used lelantus coin serial.\n"
+                "\nArguments:\n"
+                "1. \"startBlockHash\"  (string, optional) Only return the serials spent after this block,\n"
+                "                       usually the blockHash returned by the previous call\n"
+                "2. compact            (bool, optional, default=false) Return the serials as a single base64 string\n"
+                "\nResult:\n"
+                "{\n"
+                "  \"blockHash\" (string) Block up to which the serials are returned\n"
+                "  \"serials\" (std::string[]) array of Serialized Scalars, or base64 of the concatenated Scalars\n"
+                "}\n"
+        );
+
+    bool fCompact = GetCompactFlag(request, 1);
+
+    uint256 blockHash;
+    std::vector<Scalar> serials;
+    {
+        LOCK(cs_main);
+        CBlockIndex *startBlock = GetStartBlock(request.params.size() > 0 ? request.params[0] : NullUniValue);
+        GetSerialsSince(startBlock, &CBlockIndex::lelantusSpentSerials, lelantus::CLelantusState::GetState()->GetSpends(), serials);
+        blockHash = chainActive.Tip()->GetBlockHash();
+    }
+
+    std::vector<unsigned char> compact;
+    UniValue serializedSerials(UniValue::VARR);
+    for (Scalar const & serial : serials)
+        AppendElement(serial, compact, serializedSerials, fCompact);
+
+    UniValue ret(UniValue::VOBJ);
+    ret.push_back(Pair("blockHash", blockHash.GetHex()));
+    ret.push_back(Pair("serials", FinishElements(compact, serializedSerials, fCompact)));
 
     return ret;
 }
@@ -1083,21 +1302,22 @@ UniValue getlatestcoinids(const JSONRPCRequest& request)
                 "}\n"
         );
 
-    sigma::CSigmaState* sigmaState = sigma::CSigmaState::GetState();
-    std::unordered_map<sigma::CoinDenomination, int> latestCoinIds;
-    {
-        LOCK(cs_main);
-        latestCoinIds = sigmaState->GetLatestCoinIds();
-    }
+    auto snapshot = sigma::CSigmaState::GetState()->GetSnapshot();
+    std::vector<sigma::CoinDenomination> denominations;
+    sigma::GetAllDenoms(denominations);
 
     UniValue ret(UniValue::VARR);
-    for (const auto& it : latestCoinIds ) {
+    for (sigma::CoinDenomination denomination : denominations) {
+        int id = snapshot->GetLatestCoinID(denomination);
+        if (id == 0)
+            continue;
+
         int64_t denom;
-        sigma::DenominationToInteger(it.first, denom);
+        sigma::DenominationToInteger(denomination, denom);
 
         UniValue denomandid(UniValue::VOBJ);
         denomandid.push_back(Pair("denom", denom));
-        denomandid.push_back(Pair("id", it.second));
+        denomandid.push_back(Pair("id", id));
 
         ret.push_back(denomandid);
     }
@@ -1486,6 +1706,8 @@ static const CRPCCommand commands[] =
     { "mobile",             "getanonymityset",        &getanonymityset,        true  },
     { "mobile",             "getmintmetadata",        &getmintmetadata,        true  },
     { "mobile",             "getusedcoinserials",     &getusedcoinserials,     true  },
+    { "mobile",             "getlelantusanonymityset", &getlelantusanonymityset, true  },
+    { "mobile",             "getlelantususedcoinserials", &getlelantususedcoinserials, true  },
     { "mobile",             "getlatestcoinids",       &getlatestcoinids,       true  },
 
     { "hidden",             "setmocktime",            &setmocktime,            true,  {"timestamp"}},
@@ -53,6 +53,11 @@ string JSONRPCReply(const UniValue& result, const UniValue& error, const UniValu
     return reply.write() + "\n";
 }
 
+string JSONRPCRawReply(const string& result, const UniValue& id)
+{
+    return "{\"result\":" + result + ",\"error\":null,\"id\":" + id.write() + "}\n";
+}
+
 UniValue JSONRPCError(int code, const string& message)
 {
     UniValue error(UniValue::VOBJ);
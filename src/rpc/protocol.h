@@ -80,6 +80,8 @@ enum RPCErrorCode
 UniValue JSONRPCRequestObj(const std::string& strMethod, const UniValue& params, const UniValue& id);
 UniValue JSONRPCReplyObj(const UniValue& result, const UniValue& error, const UniValue& id);
 std::string JSONRPCReply(const UniValue& result, const UniValue& error, const UniValue& id);
+/** Same as JSONRPCReply for a result which is already JSON encoded */
+std::string JSONRPCRawReply(const std::string& result, const UniValue& id);
 UniValue JSONRPCError(int code, const std::string& message);
 
 /** Get name of RPC authentication cookie file */
@@ -15,6 +15,7 @@
 #include "net.h"
 #include "policy/policy.h"
 #include "primitives/transaction.h"
+#include "rpc/jsonwriter.h"
 #include "rpc/server.h"
 #include "script/script.h"
 #include "script/script_error.h"
@@ -44,13 +45,13 @@ using namespace std;
 
 namespace {
     template<class Tx>
-    void ExtraPayloadToJson(const CTransaction& tx, const char * jsonId, UniValue & entry) {
+    void ExtraPayloadToJson(const CTransaction& tx, const char * jsonId, CJSONWriter & entry) {
         Tx extraPayloadTx;
         if (!GetTxPayload(tx, extraPayloadTx))
             throw JSONRPCError(RPC_DATABASE_ERROR, "An error occurred during processing the extra payload information");
         UniValue epJsonObj;
         extraPayloadTx.ToJson(epJsonObj);
-        entry.push_back(Pair(jsonId, epJsonObj));
+        entry.KeyValue(jsonId, epJsonObj);
     }
 }
 
@@ -78,142 +79,171 @@ void ScriptPubKeyToJSON(const CScript& scriptPubKey, UniValue& out, bool fInclud
     out.push_back(Pair("addresses", a));
 }
 
+void ScriptPubKeyToJSON(const CScript& scriptPubKey, CJSONWriter& out, bool fIncludeHex)
+{
+    txnouttype type;
+    vector<CTxDestination> addresses;
+    int nRequired;
+
+    out.KeyValue("asm", ScriptToAsmStr(scriptPubKey));
+    if (fIncludeHex)
+        out.KeyValue("hex", HexStr(scriptPubKey.begin(), scriptPubKey.end()));
+
+    if (!ExtractDestinations(scriptPubKey, type, addresses, nRequired)) {
+        out.KeyValue("type", GetTxnOutputType(type));
+        return;
+    }
+
+    out.KeyValue("reqSigs", nRequired);
+    out.KeyValue("type", GetTxnOutputType(type));
+
+    out.Key("addresses").BeginArray();
+    for (const CTxDestination& addr : addresses)
+        out.Value(CBitcoinAddress(addr).ToString());
+    out.EndArray();
+}
+
 namespace {
-    void fillStdFields(UniValue & out, CTxIn const & txin)
+    void fillStdFields(CJSONWriter & out, CTxIn const & txin)
     {
-        UniValue o(UniValue::VOBJ);
-        o.push_back(Pair("asm", ScriptToAsmStr(txin.scriptSig, true)));
-        o.push_back(Pair("hex", HexStr(txin.scriptSig.begin(), txin.scriptSig.end())));
-        out.push_back(Pair("scriptSig", o));
+        out.Key("scriptSig").BeginObject();
+        out.KeyValue("asm", ScriptToAsmStr(txin.scriptSig, true));
+        out.KeyValue("hex", HexStr(txin.scriptSig.begin(), txin.scriptSig.end()));
+        out.EndObject();
     }
 }
 
-void TxToJSON(const CTransaction& tx, const uint256 hashBlock, UniValue& entry)
+void TxToJSON(const CTransaction& tx, const uint256 hashBlock, CJSONWriter& entry)
 {
     uint256 txid = tx.GetHash();
-    entry.push_back(Pair("txid", txid.GetHex()));
-    entry.push_back(Pair("hash", tx.GetWitnessHash().GetHex()));
-    entry.push_back(Pair("size", (int)::GetSerializeSize(tx, SER_NETWORK, PROTOCOL_VERSION)));
-    entry.push_back(Pair("vsize", (int)::GetVirtualTransactionSize(tx)));
-    entry.push_back(Pair("version", tx.nVersion));
-    entry.push_back(Pair("locktime", (int64_t)tx.nLockTime));
-    entry.push_back(Pair("type", int(tx.nType)));
-
-    UniValue vin(UniValue::VARR);
+    entry.KeyValue("txid", txid.GetHex());
+    entry.KeyValue("hash", tx.GetWitnessHash().GetHex());
+    entry.KeyValue("size", (int)::GetSerializeSize(tx, SER_NETWORK, PROTOCOL_VERSION));
+    entry.KeyValue("vsize", (int)::GetVirtualTransactionSize(tx));
+    entry.KeyValue("version", tx.nVersion);
+    entry.KeyValue("locktime", (int64_t)tx.nLockTime);
+    entry.KeyValue("type", int(tx.nType));
+
+    entry.Key("vin").BeginArray();
     for (unsigned int i = 0; i < tx.vin.size(); i++) {
         const CTxIn& txin = tx.vin[i];
-        UniValue in(UniValue::VOBJ);
+        entry.BeginObject();
         if (tx.IsCoinBase()) {
-            in.push_back(Pair("coinbase", HexStr(txin.scriptSig.begin(), txin.scriptSig.end())));
+            entry.KeyValue("coinbase", HexStr(txin.scriptSig.begin(), txin.scriptSig.end()));
         } else if (txin.IsSigmaSpend()) {
-            std::unique_ptr<sigma::CoinSpend> spend;
+            // only the serial part of the spend is read, the proof is skipped
+            Scalar serial;
+            sigma::CoinDenomination denomination;
             uint32_t pubcoinId;
             try {
-                std::tie(spend, pubcoinId) = sigma::ParseSigmaSpend(txin);
+                pubcoinId = sigma::ParseSigmaSpendSerial(txin, serial, denomination);
             } catch (CBadTxIn&) {
                 throw JSONRPCError(RPC_DATABASE_ERROR, "An error occurred during processing the Sigma spend information");
             } catch (std::ios_base::failure &) {
                 throw JSONRPCError(RPC_DATABASE_ERROR, "An error occurred during processing the Sigma spend information");
             }
-            in.push_back(Pair("anonymityGroup", int64_t(pubcoinId)));
-            fillStdFields(in, txin);
+            entry.KeyValue("anonymityGroup", int64_t(pubcoinId));
+            fillStdFields(entry, txin);
 
-            in.push_back(Pair("value", ValueFromAmount(spend->getIntDenomination())));
-            in.push_back(Pair("valueSat", spend->getIntDenomination()));
+            int64_t denominationValue;
+            sigma::DenominationToInteger(denomination, denominationValue);
+            entry.KeyValue("value", ValueFromAmount(denominationValue));
+            entry.KeyValue("valueSat", denominationValue);
         } else if (txin.IsLelantusJoinSplit()) {
-            in.push_back("joinsplit");
-            fillStdFields(in, txin);
-            std::unique_ptr<lelantus::JoinSplit> jsplit = lelantus::ParseLelantusJoinSplit(txin);
-            in.push_back(Pair("nFees", ValueFromAmount(jsplit->getFee())));
-            UniValue serials(UniValue::VARR);
-            for (Scalar const & serial : jsplit->getCoinSerialNumbers()) {
-                serials.push_back(serial.GetHex());
+            fillStdFields(entry, txin);
+            std::vector<Scalar> serials;
+            uint64_t fee;
+            lelantus::ParseLelantusJoinSplitSerials(txin, serials, fee);
+            entry.KeyValue("nFees", ValueFromAmount(fee));
+            entry.Key("serials").BeginArray();
+            for (Scalar const & serial : serials) {
+                entry.Value(serial.GetHex());
             }
-            in.push_back(Pair("serials", serials));
+            entry.EndArray();
         } else if (txin.IsZerocoinRemint()) {
             std::shared_ptr<sigma::CoinRemintToV3>  remint;
             try {
                 CDataStream serData(std::vector<unsigned char>(txin.scriptSig.begin()+1, txin.scriptSig.end()), SER_NETWORK, PROTOCOL_VERSION);
                 remint = std::make_shared<sigma::CoinRemintToV3>(serData);
-                in.push_back(Pair("publicCoinValue", remint->getPublicCoinValue().ToString(16)));
+                entry.KeyValue("publicCoinValue", remint->getPublicCoinValue().ToString(16));
             } catch (std::ios_base::failure &) {
                 throw JSONRPCError(RPC_DATABASE_ERROR, "An error occurred during processing the Zerocoin to Sigma remint information");
             }
-            fillStdFields(in, txin);
+            fillStdFields(entry, txin);
 
             CAmount const valueSat = remint->getDenomination() * COIN;
 
-            in.push_back(Pair("value", ValueFromAmount(valueSat)));
-            in.push_back(Pair("valueSat", valueSat));
+            entry.KeyValue("value", ValueFromAmount(valueSat));
+            entry.KeyValue("valueSat", valueSat);
         } else {
-            in.push_back(Pair("txid", txin.prevout.hash.GetHex()));
-            in.push_back(Pair("vout", (int64_t)txin.prevout.n));
-            fillStdFields(in, txin);
+            entry.KeyValue("txid", txin.prevout.hash.GetHex());
+            entry.KeyValue("vout", (int64_t)txin.prevout.n);
+            fillStdFields(entry, txin);
 
             CTransactionRef prevTx;
             uint256 hashBlock;
             if (GetTransaction(txin.prevout.hash, prevTx, Params().GetConsensus(), hashBlock, true)) {
                 CTxOut const & txOut = prevTx->vout.at(txin.prevout.n);
 
-                in.push_back(Pair("value", ValueFromAmount(txOut.nValue)));
-                in.push_back(Pair("valueSat", txOut.nValue));
+                entry.KeyValue("value", ValueFromAmount(txOut.nValue));
+                entry.KeyValue("valueSat", txOut.nValue);
 
                 CTxDestination dstAddr;
                 if(ExtractDestination(txOut.scriptPubKey, dstAddr))
-                    in.push_back(Pair("address", CBitcoinAddress(dstAddr).ToString()));
+                    entry.KeyValue("address", CBitcoinAddress(dstAddr).ToString());
             }
         }
         if (tx.HasWitness()) {
-                UniValue txinwitness(UniValue::VARR);
+                entry.Key("txinwitness").BeginArray();
                 for (unsigned int j = 0; j < tx.vin[i].scriptWitness.stack.size(); j++) {
                     std::vector<unsigned char> item = tx.vin[i].scriptWitness.stack[j];
-                    txinwitness.push_back(HexStr(item.begin(), item.end()));
+                    entry.Value(HexStr(item.begin(), item.end()));
                 }
-                in.push_back(Pair("txinwitness", txinwitness));
+                entry.EndArray();
         }
-        in.push_back(Pair("sequence", (int64_t)txin.nSequence));
-        vin.push_back(in);
+        entry.KeyValue("sequence", (int64_t)txin.nSequence);
+        entry.EndObject();
     }
-    entry.push_back(Pair("vin", vin));
-    UniValue vout(UniValue::VARR);
+    entry.EndArray();
+    entry.Key("vout").BeginArray();
     for (unsigned int i = 0; i < tx.vout.size(); i++) {
         const CTxOut& txout = tx.vout[i];
-        UniValue out(UniValue::VOBJ);
+        entry.BeginObject();
         if (txout.scriptPubKey.IsLelantusJMint()) {
-            out.push_back(Pair("value", 0));
+            entry.KeyValue("value", 0);
         } else {
-            out.push_back(Pair("value", ValueFromAmount(txout.nValue)));
+            entry.KeyValue("value", ValueFromAmount(txout.nValue));
         }
-        out.push_back(Pair("n", (int64_t)i));
-        UniValue o(UniValue::VOBJ);
-        ScriptPubKeyToJSON(txout.scriptPubKey, o, true);
-        out.push_back(Pair("scriptPubKey", o));
+        entry.KeyValue("n", (int64_t)i);
+        entry.Key("scriptPubKey").BeginObject();
+        ScriptPubKeyToJSON(txout.scriptPubKey, entry, true);
+        entry.EndObject();
         // Add spent information if spentindex is enabled
         CSpentIndexValue spentInfo;
         CSpentIndexKey spentKey(txid, i);
         if (GetSpentIndex(spentKey, spentInfo)) {
-            out.push_back(Pair("spentTxId", spentInfo.txid.GetHex()));
-            out.push_back(Pair("spentIndex", (int)spentInfo.inputIndex));
-            out.push_back(Pair("spentHeight", spentInfo.blockHeight));
+            entry.KeyValue("spentTxId", spentInfo.txid.GetHex());
+            entry.KeyValue("spentIndex", (int)spentInfo.inputIndex);
+            entry.KeyValue("spentHeight", spentInfo.blockHeight);
         }
-        vout.push_back(out);
+        entry.EndObject();
     }
-    entry.push_back(Pair("vout", vout));
+    entry.EndArray();
 
     if (!hashBlock.IsNull()) {
-        entry.push_back(Pair("blockhash", hashBlock.GetHex()));
+        entry.KeyValue("blockhash", hashBlock.GetHex());
         BlockMap::iterator mi = mapBlockIndex.find(hashBlock);
         if (mi != mapBlockIndex.end() && (*mi).second) {
             CBlockIndex* pindex = (*mi).second;
             if (chainActive.Contains(pindex)) {
-                entry.push_back(Pair("height", pindex->nHeight));
-                entry.push_back(Pair("confirmations", 1 + chainActive.Height() - pindex->nHeight));
-                entry.push_back(Pair("time", pindex->GetBlockTime()));
-                entry.push_back(Pair("blocktime", pindex->GetBlockTime()));
+                entry.KeyValue("height", pindex->nHeight);
+                entry.KeyValue("confirmations", 1 + chainActive.Height() - pindex->nHeight);
+                entry.KeyValue("time", pindex->GetBlockTime());
+                entry.KeyValue("blocktime", pindex->GetBlockTime());
             }
             else {
-                entry.push_back(Pair("height", -1));
-                entry.push_back(Pair("confirmations", 0));
+                entry.KeyValue("height", -1);
+                entry.KeyValue("confirmations", 0);
             }
         }
     }
@@ -243,6 +273,20 @@ void TxToJSON(const CTransaction& tx, const uint256 hashBlock, UniValue& entry)
     }
 }
 
+void TxToJSON(const CTransaction& tx, const uint256 hashBlock, UniValue& entry)
+{
+    std::string json;
+    CJSONWriter writer(json);
+    writer.BeginObject();
+    TxToJSON(tx, hashBlock, writer);
+    writer.EndObject();
+
+    UniValue fields;
+    if (!fields.read(json))
+        throw JSONRPCError(RPC_INTERNAL_ERROR, "Unable to encode the transaction");
+    entry.pushKVs(fields);
+}
+
 UniValue getrawtransaction(const JSONRPCRequest& request)
 {
     if (request.fHelp || request.params.size() < 1 || request.params.size() > 2)
@@ -349,6 +393,15 @@ UniValue getrawtransaction(const JSONRPCRequest& request)
     if (!fVerbose)
         return strHex;
 
+    if (request.jsonResult) {
+        CJSONWriter writer(*request.jsonResult);
+        writer.BeginObject();
+        writer.KeyValue("hex", strHex);
+        TxToJSON(*tx, hashBlock, writer);
+        writer.EndObject();
+        return NullUniValue;
+    }
+
     UniValue result(UniValue::VOBJ);
     result.push_back(Pair("hex", strHex));
     TxToJSON(*tx, hashBlock, result);
@@ -336,6 +336,8 @@ static const CRPCCommand vRPCCommands[] =
     { "mobile",             "getanonymityset",        &getanonymityset,        true  },
     { "mobile",             "getmintmetadata",        &getmintmetadata,        true  },
     { "mobile",             "getusedcoinserials",     &getusedcoinserials,     true  },
+    { "mobile",             "getlelantusanonymityset", &getlelantusanonymityset, true  },
+    { "mobile",             "getlelantususedcoinserials", &getlelantususedcoinserials, true  },
     { "mobile",             "getlatestcoinids",       &getlatestcoinids,       true  },
 };
 
@@ -52,8 +52,14 @@ public:
     bool fHelp;
     std::string URI;
     std::string authUser;
+    /**
+     * Set by the HTTP server for single requests. Handlers of big results may
+     * write the JSON encoded result into it with CJSONWriter and return
+     * NullUniValue instead of building a UniValue tree.
+     */
+    std::string* jsonResult;
 
-    JSONRPCRequest() { id = NullUniValue; params = NullUniValue; fHelp = false; }
+    JSONRPCRequest() { id = NullUniValue; params = NullUniValue; fHelp = false; jsonResult = nullptr; }
     void parse(const UniValue& valRequest);
 };
 
@@ -210,6 +216,8 @@ extern UniValue getaddressbalance(const JSONRPCRequest &request);
 extern UniValue getanonymityset(const JSONRPCRequest& params);
 extern UniValue getmintmetadata(const JSONRPCRequest& params);
 extern UniValue getusedcoinserials(const JSONRPCRequest& params);
+extern UniValue getlelantusanonymityset(const JSONRPCRequest& params);
+extern UniValue getlelantususedcoinserials(const JSONRPCRequest& params);
 extern UniValue getlatestcoinids(const JSONRPCRequest& params);
 
 extern UniValue znode(const JSONRPCRequest &request);
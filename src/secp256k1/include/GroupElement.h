@@ -16,6 +16,8 @@ namespace secp_primitives {
 class GroupElement final {
 public:
     static constexpr std::size_t serialize_size = 34;
+    // x and y coordinates followed by the infinity flag.
+    static constexpr std::size_t affine_size = 65;
 
 public:
 
@@ -79,6 +81,10 @@ public:
   unsigned char* serialize(unsigned char* buffer) const;
   unsigned const char* deserialize(unsigned const char* buffer);
 
+  // Uncompressed form for in-memory stores, reading it back needs no square root.
+  unsigned char* serializeAffine(unsigned char* buffer) const;
+  unsigned const char* deserializeAffine(unsigned const char* buffer);
+
   // These functions are for READWRITE() in serialize.h
   template<typename Stream>
   inline void Serialize(Stream& s) const {
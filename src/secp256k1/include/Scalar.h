@@ -52,6 +52,10 @@ public:
 
     Scalar inverse() const;
 
+    // Inverts all the values in place with a single inversion (Montgomery's trick).
+    // Zeros are left as they are, like inverse() does with them.
+    static void batchInverse(std::vector<Scalar>& values);
+
     Scalar negate() const;
 
     Scalar square() const;
@@ -324,11 +324,16 @@ bool GroupElement::operator!=(const  GroupElement& other) const
 
 bool GroupElement::isMember() const
 {
-    secp256k1_ge v1 = gej_to_ge(*reinterpret_cast<secp256k1_gej *>(g_));
-    if (secp256k1_ge_is_infinity(&v1)) {
+    secp256k1_gej g = *reinterpret_cast<const secp256k1_gej *>(g_);
+    if (secp256k1_gej_is_infinity(&g)) {
         return true;
     }
-    return secp256k1_ge_is_valid_var(&v1);
+    // Checked in jacobian coordinates so z doesn't need to be inverted. A zero z isn't
+    // a point, the check in affine coordinates rejected it as well.
+    if (secp256k1_fe_normalizes_to_zero_var(&g.z)) {
+        return false;
+    }
+    return secp256k1_gej_is_valid_var(&g);
 }
 
 bool GroupElement::isInfinity() const
@@ -532,6 +537,31 @@ const unsigned char* GroupElement::deserialize(const unsigned char* buffer) {
     return buffer + memoryRequired();
 }
 
+unsigned char* GroupElement::serializeAffine(unsigned char* buffer) const {
+    secp256k1_ge value = gej_to_ge(*reinterpret_cast<secp256k1_gej *>(g_));
+    if (value.infinity) {
+        memset(buffer, 0, affine_size);
+        buffer[64] = 1;
+        return buffer + affine_size;
+    }
+    secp256k1_fe_normalize(&value.x);
+    secp256k1_fe_normalize(&value.y);
+    secp256k1_fe_get_b32(buffer, &value.x);
+    secp256k1_fe_get_b32(buffer + 32, &value.y);
+    buffer[64] = 0;
+    return buffer + affine_size;
+}
+
+const unsigned char* GroupElement::deserializeAffine(const unsigned char* buffer) {
+    secp256k1_ge result;
+    secp256k1_fe_set_b32(&result.x, buffer);
+    secp256k1_fe_set_b32(&result.y, buffer + 32);
+    result.infinity = (int)buffer[64];
+
+    secp256k1_gej_set_ge(reinterpret_cast<secp256k1_gej *>(g_), &result);
+    return buffer + affine_size;
+}
+
 std::vector<unsigned char> GroupElement::getvch() const {
     unsigned char buffer[memoryRequired()];
     serialize(buffer);
@@ -144,6 +144,32 @@ Scalar Scalar::inverse() const {
  return &result;
 }
 
+void Scalar::batchInverse(std::vector<Scalar>& values) {
+    // products of the non zero values before each one
+    std::vector<secp256k1_scalar> prefix(values.size());
+    secp256k1_scalar product;
+    secp256k1_scalar_set_int(&product, 1);
+    for (std::size_t i = 0; i < values.size(); i++) {
+        auto value = reinterpret_cast<const secp256k1_scalar *>(values[i].value_);
+        prefix[i] = product;
+        if (!secp256k1_scalar_is_zero(value))
+            secp256k1_scalar_mul(&product, &product, value);
+    }
+
+    secp256k1_scalar inverse;
+    secp256k1_scalar_inverse(&inverse, &product);
+
+    for (std::size_t i = values.size(); i-- > 0;) {
+        auto value = reinterpret_cast<secp256k1_scalar *>(values[i].value_);
+        if (secp256k1_scalar_is_zero(value))
+            continue;
+        secp256k1_scalar result;
+        secp256k1_scalar_mul(&result, &inverse, &prefix[i]);
+        secp256k1_scalar_mul(&inverse, &inverse, value);
+        *value = result;
+    }
+}
+
 Scalar Scalar::negate() const {
     secp256k1_scalar result;
     secp256k1_scalar_negate(&result, reinterpret_cast<const secp256k1_scalar *>(value_));
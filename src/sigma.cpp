@@ -105,6 +105,38 @@ std::pair<std::unique_ptr<sigma::CoinSpend>, uint32_t> ParseSigmaSpend(const CTx
     return std::make_pair(std::move(spend), groupId);
 }
 
+uint32_t ParseSigmaSpendSerial(const CTxIn& in, Scalar& serial, CoinDenomination& denomination)
+{
+    uint32_t groupId = in.prevout.n;
+
+    if (groupId < 1 || groupId >= INT_MAX || in.scriptSig.size() < 1) {
+        throw CBadTxIn();
+    }
+
+    CDataStream serialized(
+        std::vector<unsigned char>(in.scriptSig.begin() + 1, in.scriptSig.end()),
+        SER_NETWORK,
+        PROTOCOL_VERSION
+    );
+
+    // skip the proof, see SigmaPlusProof and R1Proof serialization
+    serialized.ignore(GroupElement::memoryRequired() * 4); // B_, A_, C_, D_
+    serialized.ignore(ReadCompactSize(serialized) * Scalar::memoryRequired()); // f_
+    serialized.ignore(Scalar::memoryRequired() * 2); // ZA_, ZC_
+    serialized.ignore(ReadCompactSize(serialized) * GroupElement::memoryRequired()); // Gk_
+    serialized.ignore(Scalar::memoryRequired()); // z_
+
+    unsigned int version;
+    int64_t denominationValue;
+    serialized >> serial >> version >> denominationValue;
+
+    // same as CoinSpend does
+    denomination = CoinDenomination::SIGMA_DENOM_1;
+    IntegerToDenomination(denominationValue, denomination);
+
+    return groupId;
+}
+
 // This function will not report an error only if the transaction is sigma spend.
 CAmount GetSpendAmount(const CTxIn& in) {
     if (in.IsSigmaSpend()) {
@@ -275,17 +307,14 @@ bool CheckSigmaSpendTransaction(
         // This list of public coins is required by function "Verify" of CoinSpend.
         std::vector<sigma::PublicCoin> anonymity_set;
         while(true) {
-            if (index->sigmaMintedPubCoins.count(denominationAndId) > 0) {
-                BOOST_FOREACH(const sigma::PublicCoin& pubCoinValue,
-                        index->sigmaMintedPubCoins[denominationAndId]) {
-                    if (nHeight >= params.nStartSigmaBlacklist) {
-                        std::vector<unsigned char> vch = pubCoinValue.getValue().getvch();
-                        if(sigma_blacklist.count(HexStr(vch.begin(), vch.end())) > 0) {
-                            continue;
-                        }
+            for (const sigma::PublicCoin& pubCoinValue : index->sigmaMintedPubCoins.Get(denominationAndId)) {
+                if (nHeight >= params.nStartSigmaBlacklist) {
+                    std::vector<unsigned char> vch = pubCoinValue.getValue().getvch();
+                    if(sigma_blacklist.count(HexStr(vch.begin(), vch.end())) > 0) {
+                        continue;
                     }
-                    anonymity_set.push_back(pubCoinValue);
                 }
+                anonymity_set.push_back(pubCoinValue);
             }
             if (index == coinGroup.firstBlock)
                 break;
@@ -647,6 +676,7 @@ bool ConnectBlockSigma(
             return true;
 
         sigmaState.AddMintsToStateAndBlockIndex(pindexNew, pblock);
+        sigmaState.UpdateSnapshot(pindexNew, true);
     }
     else if (!fJustCheck) { // TODO(martun): not sure if this else is necessary here. Check again later.
         sigmaState.AddBlock(pindexNew);
@@ -736,8 +766,76 @@ bool GetOutPoint(COutPoint& outPoint, const uint256 &pubCoinValueHash) {
     return GetOutPoint(outPoint, pubCoinValue);
 }
 
+static const uint64_t SIGMA_STATE_DUMP_VERSION = 1;
+
+// Reads the checkpoint written by DumpSigmaState, the caller checks it against the chain
+static bool ReadSigmaState(CSigmaStateSnapshot &checkpoint) {
+    FILE* filestr = fopen((GetDataDir() / "sigmastate.dat").string().c_str(), "rb");
+    CAutoFile file(filestr, SER_DISK, CLIENT_VERSION);
+    if (file.IsNull())
+        return false;
+
+    try {
+        CHashVerifier<CAutoFile> verifier(&file);
+        uint64_t version;
+        verifier >> version;
+        if (version != SIGMA_STATE_DUMP_VERSION)
+            return false;
+        verifier >> checkpoint;
+
+        uint256 hash;
+        file >> hash;
+        if (hash != verifier.GetHash()) {
+            LogPrintf("Sigma state checkpoint is corrupted, rebuilding the state from the index\n");
+            return false;
+        }
+    } catch (const std::exception& e) {
+        LogPrintf("Failed to read sigma state checkpoint: %s, rebuilding the state from the index\n", e.what());
+        return false;
+    }
+    return true;
+}
+
+void DumpSigmaState() {
+    auto snapshot = sigmaState.GetSnapshot();
+    if (snapshot->GetHeight() < 0)
+        return;
+
+    int64_t start = GetTimeMicros();
+    try {
+        FILE* filestr = fopen((GetDataDir() / "sigmastate.dat.new").string().c_str(), "wb");
+        if (!filestr)
+            return;
+
+        CAutoFile file(filestr, SER_DISK, CLIENT_VERSION);
+        CHashedSourceWriter<CAutoFile> writer(&file);
+        writer << SIGMA_STATE_DUMP_VERSION << *snapshot;
+        file << writer.GetHash();
+
+        FileCommit(file.Get());
+        file.fclose();
+        RenameOver(GetDataDir() / "sigmastate.dat.new", GetDataDir() / "sigmastate.dat");
+        LogPrintf("Dumped sigma state at height %d: %gs\n", snapshot->GetHeight(), (GetTimeMicros() - start) * 0.000001);
+    } catch (const std::exception& e) {
+        LogPrintf("Failed to dump sigma state: %s. Continuing anyway.\n", e.what());
+    }
+}
+
 bool BuildSigmaStateFromIndex(CChain *chain) {
-    for (CBlockIndex *blockIndex = chain->Genesis(); blockIndex; blockIndex=chain->Next(blockIndex))
+    CBlockIndex *start = chain->Genesis();
+
+    CSigmaStateSnapshot checkpoint;
+    if (start && ReadSigmaState(checkpoint)) {
+        if (sigmaState.LoadSnapshot(checkpoint, chain)) {
+            start = chain->Next((*chain)[checkpoint.GetHeight()]);
+            LogPrintf("Loaded sigma state checkpoint at height %d\n", checkpoint.GetHeight());
+        } else {
+            LogPrintf("Sigma state checkpoint at height %d is not in the active chain, rebuilding the state from the index\n",
+                checkpoint.GetHeight());
+        }
+    }
+
+    for (CBlockIndex *blockIndex = start; blockIndex; blockIndex=chain->Next(blockIndex))
     {
         sigmaState.AddBlock(blockIndex);
     }
@@ -769,6 +867,135 @@ void CSigmaTxInfo::Complete() {
     fInfoIsComplete = true;
 }
 
+/******************************************************************************/
+// CSigmaStateSnapshot
+/******************************************************************************/
+
+int CSigmaStateSnapshot::GetLatestCoinID(sigma::CoinDenomination denomination) const {
+    auto id = latestCoinIds.find(denomination);
+    return id ? *id : 0;
+}
+
+bool CSigmaStateSnapshot::GetCoinGroupInfo(
+        sigma::CoinDenomination denomination,
+        int group_id,
+        CoinGroupInfo& result) const {
+    auto group = coinGroups.find(std::make_pair(denomination, group_id));
+    if (!group)
+        return false;
+
+    result = *group;
+    return true;
+}
+
+bool CSigmaStateSnapshot::IsUsedCoinSerial(const Scalar &coinSerial) const {
+    return spends.count(coinSerial) != 0;
+}
+
+bool CSigmaStateSnapshot::HasCoin(const sigma::PublicCoin& pubCoin) const {
+    return mints.count(pubCoin) != 0;
+}
+
+std::pair<int, int> CSigmaStateSnapshot::GetMintedCoinHeightAndId(const sigma::PublicCoin& pubCoin) const {
+    auto coinInfo = mints.find(pubCoin);
+    if (coinInfo)
+        return std::make_pair(coinInfo->nHeight, coinInfo->coinGroupId);
+
+    return std::make_pair(-1, -1);
+}
+
+template <typename Visitor>
+void CSigmaStateSnapshot::ForEachGroupBlock(
+        std::pair<CoinDenomination, int> const &denomAndId,
+        int maxHeight,
+        int startHeight,
+        Visitor visitor) const {
+    auto coinGroup = coinGroups.find(denomAndId);
+    if (!coinGroup)
+        return;
+
+    // mint blocks are ordered by height, find the one past the last block of the group
+    size_t lower = 0, upper = mintBlocks.size();
+    while (lower < upper) {
+        size_t middle = lower + (upper - lower) / 2;
+        if (mintBlocks[middle].nHeight <= coinGroup->lastHeight)
+            lower = middle + 1;
+        else
+            upper = middle;
+    }
+
+    for (size_t i = lower; i-- > 0; ) {
+        const BlockMints &block = mintBlocks[i];
+        if (block.nHeight <= startHeight || block.nHeight < coinGroup->firstHeight)
+            break;
+        if (block.nHeight > maxHeight)
+            continue;
+
+        auto coins = block.coins->find(denomAndId);
+        if (coins != block.coins->end())
+            visitor(block, coins->second);
+    }
+}
+
+int CSigmaStateSnapshot::GetCoinSetForSpend(
+        int maxHeight,
+        sigma::CoinDenomination denomination,
+        int coinGroupID,
+        uint256& blockHash_out,
+        std::vector<sigma::PublicCoin>& coins_out,
+        int startHeight) const {
+
+    coins_out.clear();
+
+    bool fBlacklist = nHeight >= ::Params().GetConsensus().nStartSigmaBlacklist;
+    int numberOfCoins = 0;
+    ForEachGroupBlock(std::make_pair(denomination, coinGroupID), maxHeight, startHeight,
+        [&](const BlockMints &block, const std::vector<sigma::PublicCoin> &coins) {
+            if (numberOfCoins == 0) {
+                // latest block satisfying given conditions
+                // remember block hash
+                blockHash_out = block.blockHash;
+            }
+            for (const sigma::PublicCoin& pubCoinValue : coins) {
+                if (fBlacklist) {
+                    std::vector<unsigned char> vch = pubCoinValue.getValue().getvch();
+                    if(sigma_blacklist.count(HexStr(vch.begin(), vch.end())) > 0) {
+                        continue;
+                    }
+                }
+                coins_out.push_back(pubCoinValue);
+                numberOfCoins++;
+            }
+        });
+    return numberOfCoins;
+}
+
+void CSigmaStateSnapshot::GetAnonymitySet(
+        sigma::CoinDenomination denomination,
+        int coinGroupID,
+        bool fStartSigmaBlacklist,
+        std::vector<GroupElement>& coins_out) const {
+
+    coins_out.clear();
+
+    auto params = ::Params().GetConsensus();
+    int maxHeight = fStartSigmaBlacklist ? (nHeight - (ZC_MINT_CONFIRMATIONS - 1)) : (params.nStartSigmaBlacklist - 1);
+    bool fBlacklist = fStartSigmaBlacklist && nHeight >= params.nStartSigmaBlacklist;
+
+    ForEachGroupBlock(std::make_pair(denomination, coinGroupID), maxHeight, -1,
+        [&](const BlockMints &block, const std::vector<sigma::PublicCoin> &coins) {
+            for (const sigma::PublicCoin& pubCoinValue : coins) {
+                if (fBlacklist) {
+                    std::vector<unsigned char> vch = pubCoinValue.getValue().getvch();
+                    if(sigma_blacklist.count(HexStr(vch.begin(), vch.end())) > 0) {
+                        continue;
+                    }
+                }
+                coins_out.push_back(pubCoinValue.getValue());
+            }
+        });
+}
+
 /******************************************************************************/
 // CSigmaState::Containers
 /******************************************************************************/
@@ -852,7 +1079,8 @@ void CSigmaState::Containers::CheckSurgeCondition(int groupId, CoinDenomination
 /******************************************************************************/
 
 CSigmaState::CSigmaState()
-:containers(surgeCondition)
+:containers(surgeCondition),
+publishedSnapshot(std::make_shared<const CSigmaStateSnapshot>())
 {}
 
 void CSigmaState::AddMintsToStateAndBlockIndex(
@@ -905,7 +1133,7 @@ void CSigmaState::AddMintsToStateAndBlockIndex(
             containers.AddMint(mint, CMintedCoinInfo::make(denomination, mintCoinGroupId, index->nHeight));
 
             LogPrintf("AddMintsToStateAndBlockIndex: mint added denomination=%d, id=%d\n", denomination, mintCoinGroupId);
-            index->sigmaMintedPubCoins[{denomination, mintCoinGroupId}].push_back(mint);
+            index->sigmaMintedPubCoins.Add({denomination, mintCoinGroupId}, mint);
         }
     }
 }
@@ -915,9 +1143,7 @@ void CSigmaState::AddSpend(const Scalar &serial, CoinDenomination denom, int coi
 }
 
 void CSigmaState::AddBlock(CBlockIndex *index) {
-    BOOST_FOREACH(
-        const PAIRTYPE(PAIRTYPE(sigma::CoinDenomination, int), vector<sigma::PublicCoin>) &pubCoins,
-            index->sigmaMintedPubCoins) {
+    for (auto const &pubCoins : index->sigmaMintedPubCoins) {
 
         if (pubCoins.second.empty())
             continue;
@@ -935,16 +1161,16 @@ void CSigmaState::AddBlock(CBlockIndex *index) {
         }
     }
 
-    BOOST_FOREACH(const spend_info_container::value_type &serial, index->sigmaSpentSerials) {
+    for (auto const &serial : index->sigmaSpentSerials) {
         AddSpend(serial.first, serial.second.denomination, serial.second.coinGroupId);
     }
+
+    UpdateSnapshot(index, true);
 }
 
 void CSigmaState::RemoveBlock(CBlockIndex *index) {
     // roll back accumulator updates
-    BOOST_FOREACH(
-        const PAIRTYPE(PAIRTYPE(sigma::CoinDenomination, int),vector<sigma::PublicCoin>) &coin,
-        index->sigmaMintedPubCoins)
+    for (auto const &coin : index->sigmaMintedPubCoins)
     {
         SigmaCoinGroupInfo   &coinGroup = coinGroups[coin.first];
         int  nMintsToForget = coin.second.size();
@@ -970,15 +1196,13 @@ void CSigmaState::RemoveBlock(CBlockIndex *index) {
             do {
                 assert(coinGroup.lastBlock != coinGroup.firstBlock);
                 coinGroup.lastBlock = coinGroup.lastBlock->pprev;
-            } while (coinGroup.lastBlock->sigmaMintedPubCoins.count(coin.first) == 0 ||
-                        coinGroup.lastBlock->sigmaMintedPubCoins[coin.first].size() == 0);
+            } while (coinGroup.lastBlock->sigmaMintedPubCoins.Get(coin.first).empty());
         }
     }
 
     // roll back mints
-    BOOST_FOREACH(const PAIRTYPE(PAIRTYPE(sigma::CoinDenomination, int),vector<sigma::PublicCoin>) &pubCoins,
-                  index->sigmaMintedPubCoins) {
-        BOOST_FOREACH(const sigma::PublicCoin &coin, pubCoins.second) {
+    for (auto const &pubCoins : index->sigmaMintedPubCoins) {
+        for (auto const &coin : pubCoins.second) {
             auto coins = containers.GetMints().equal_range(coin);
             auto coinIt = find_if(
                 coins.first, coins.second,
@@ -992,9 +1216,128 @@ void CSigmaState::RemoveBlock(CBlockIndex *index) {
     }
 
     // roll back spends
-    BOOST_FOREACH(const spend_info_container::value_type &serial, index->sigmaSpentSerials) {
+    for (auto const &serial : index->sigmaSpentSerials) {
         containers.RemoveSpend(serial.first);
     }
+
+    UpdateSnapshot(index, false);
+}
+
+void CSigmaState::UpdateSnapshot(CBlockIndex *index, bool fConnect) {
+    if (fConnect) {
+        auto blockCoins = std::make_shared<std::map<std::pair<CoinDenomination, int>, std::vector<sigma::PublicCoin>>>();
+        for (auto const &pubCoins : index->sigmaMintedPubCoins) {
+            if (pubCoins.second.empty())
+                continue;
+
+            (*blockCoins)[pubCoins.first].assign(pubCoins.second.begin(), pubCoins.second.end());
+            for (auto const &coin : pubCoins.second) {
+                snapshot.mints = snapshot.mints.set(coin, CMintedCoinInfo::make(pubCoins.first.first, pubCoins.first.second, index->nHeight));
+            }
+        }
+
+        if (!blockCoins->empty()) {
+            snapshot.mintBlocks = snapshot.mintBlocks.push_back(
+                CSigmaStateSnapshot::BlockMints{index->nHeight, index->GetBlockHash(), blockCoins});
+        }
+
+        for (auto const &serial : index->sigmaSpentSerials) {
+            snapshot.spends = snapshot.spends.set(serial.first, serial.second);
+        }
+
+        snapshot.nHeight = index->nHeight;
+        snapshot.blockHash = index->GetBlockHash();
+    } else {
+        for (auto const &pubCoins : index->sigmaMintedPubCoins) {
+            for (auto const &coin : pubCoins.second) {
+                snapshot.mints = snapshot.mints.erase(coin);
+            }
+        }
+
+        if (!snapshot.mintBlocks.empty() && snapshot.mintBlocks.back().nHeight == index->nHeight) {
+            snapshot.mintBlocks = snapshot.mintBlocks.take(snapshot.mintBlocks.size() - 1);
+        }
+
+        for (auto const &serial : index->sigmaSpentSerials) {
+            snapshot.spends = snapshot.spends.erase(serial.first);
+        }
+
+        snapshot.nHeight = index->pprev ? index->pprev->nHeight : -1;
+        snapshot.blockHash = index->pprev ? index->pprev->GetBlockHash() : uint256();
+    }
+
+    for (auto const &pubCoins : index->sigmaMintedPubCoins) {
+        SyncSnapshotCoinGroup(pubCoins.first);
+    }
+
+    snapshot.surgeCondition = surgeCondition;
+    snapshot.nVersion++;
+
+    std::atomic_store(&publishedSnapshot, std::make_shared<const CSigmaStateSnapshot>(snapshot));
+}
+
+std::shared_ptr<const CSigmaStateSnapshot> CSigmaState::GetSnapshot() const {
+    return std::atomic_load(&publishedSnapshot);
+}
+
+bool CSigmaState::LoadSnapshot(const CSigmaStateSnapshot &checkpoint, CChain *chain) {
+    Reset();
+
+    CBlockIndex *tip = (*chain)[checkpoint.nHeight];
+    if (!tip || tip->GetBlockHash() != checkpoint.blockHash)
+        return false;
+
+    // mints in the order they were added while connecting the blocks
+    for (auto const &block : checkpoint.mintBlocks) {
+        for (auto const &pubCoins : *block.coins) {
+            for (auto const &coin : pubCoins.second)
+                containers.AddMint(coin, CMintedCoinInfo::make(pubCoins.first.first, pubCoins.first.second, block.nHeight));
+        }
+    }
+
+    for (auto const &group : checkpoint.coinGroups) {
+        SigmaCoinGroupInfo &coinGroup = coinGroups[group.first];
+        coinGroup.firstBlock = (*chain)[group.second.firstHeight];
+        coinGroup.lastBlock = (*chain)[group.second.lastHeight];
+        coinGroup.nCoins = group.second.nCoins;
+
+        if (!coinGroup.firstBlock || !coinGroup.lastBlock || group.second.lastHeight > checkpoint.nHeight) {
+            Reset();
+            return false;
+        }
+    }
+
+    for (auto const &latestId : checkpoint.latestCoinIds)
+        latestCoinIds[latestId.first] = latestId.second;
+
+    for (auto const &serial : checkpoint.spends)
+        containers.AddSpend(serial.first, serial.second);
+
+    uint64_t nVersion = snapshot.nVersion;
+    snapshot = checkpoint;
+    snapshot.surgeCondition = surgeCondition;
+    snapshot.nVersion = nVersion + 1;
+    std::atomic_store(&publishedSnapshot, std::make_shared<const CSigmaStateSnapshot>(snapshot));
+    return true;
+}
+
+void CSigmaState::SyncSnapshotCoinGroup(std::pair<CoinDenomination, int> const &denomAndId) {
+    auto it = coinGroups.find(denomAndId);
+    if (it == coinGroups.end() || !it->second.firstBlock) {
+        snapshot.coinGroups = snapshot.coinGroups.erase(denomAndId);
+    } else {
+        CSigmaStateSnapshot::CoinGroupInfo group;
+        group.firstHeight = it->second.firstBlock->nHeight;
+        group.lastHeight = it->second.lastBlock->nHeight;
+        group.nCoins = it->second.nCoins;
+        snapshot.coinGroups = snapshot.coinGroups.set(denomAndId, group);
+    }
+
+    auto latest = latestCoinIds.find(denomAndId.first);
+    if (latest == latestCoinIds.end())
+        snapshot.latestCoinIds = snapshot.latestCoinIds.erase(denomAndId.first);
+    else
+        snapshot.latestCoinIds = snapshot.latestCoinIds.set(denomAndId.first, latest->second);
 }
 
 bool CSigmaState::GetCoinGroupInfo(
@@ -1045,7 +1388,8 @@ int CSigmaState::GetCoinSetForSpend(
         sigma::CoinDenomination denomination,
         int coinGroupID,
         uint256& blockHash_out,
-        std::vector<sigma::PublicCoin>& coins_out) {
+        std::vector<sigma::PublicCoin>& coins_out,
+        int startHeight) {
 
     coins_out.clear();
 
@@ -1058,18 +1402,17 @@ int CSigmaState::GetCoinSetForSpend(
 
     int numberOfCoins = 0;
     for (CBlockIndex *block = coinGroup.lastBlock;
-            ;
+            block->nHeight > startHeight;
             block = block->pprev) {
-        if (block->sigmaMintedPubCoins.count(denomAndId) > 0 &&
-                block->sigmaMintedPubCoins[denomAndId].size() > 0) {
+        auto blockCoins = block->sigmaMintedPubCoins.Get(denomAndId);
+        if (!blockCoins.empty()) {
             if (block->nHeight <= maxHeight) {
                 if (numberOfCoins == 0) {
                     // latest block satisfying given conditions
                     // remember block hash
                     blockHash_out = block->GetBlockHash();
                 }
-                BOOST_FOREACH(const sigma::PublicCoin& pubCoinValue,
-                        block->sigmaMintedPubCoins[denomAndId]) {
+                for (const sigma::PublicCoin& pubCoinValue : blockCoins) {
                     if (chainActive.Height() >= ::Params().GetConsensus().nStartSigmaBlacklist) {
                         std::vector<unsigned char> vch = pubCoinValue.getValue().getvch();
                         if(sigma_blacklist.count(HexStr(vch.begin(), vch.end())) > 0) {
@@ -1108,11 +1451,10 @@ void CSigmaState::GetAnonymitySet(
     for (CBlockIndex *block = coinGroup.lastBlock;
             ;
             block = block->pprev) {
-        if (block->sigmaMintedPubCoins.count(denomAndId) > 0 &&
-                block->sigmaMintedPubCoins[denomAndId].size() > 0) {
+        auto blockCoins = block->sigmaMintedPubCoins.Get(denomAndId);
+        if (!blockCoins.empty()) {
             if (block->nHeight <= maxHeight) {
-                BOOST_FOREACH(const sigma::PublicCoin& pubCoinValue,
-                        block->sigmaMintedPubCoins[denomAndId]) {
+                for (const sigma::PublicCoin& pubCoinValue : blockCoins) {
                     if (fStartSigmaBlacklist && chainActive.Height() >= params.nStartSigmaBlacklist) {
                         std::vector<unsigned char> vch = pubCoinValue.getValue().getvch();
                         if(sigma_blacklist.count(HexStr(vch.begin(), vch.end())) > 0) {
@@ -1193,6 +1535,11 @@ void CSigmaState::Reset() {
     mempoolCoinSerials.clear();
     mempoolMints.clear();
     containers.Reset();
+
+    uint64_t nVersion = snapshot.nVersion;
+    snapshot = CSigmaStateSnapshot();
+    snapshot.nVersion = nVersion + 1;
+    std::atomic_store(&publishedSnapshot, std::make_shared<const CSigmaStateSnapshot>(snapshot));
 }
 
 CSigmaState* CSigmaState::GetState() {
@@ -12,8 +12,12 @@
 #include <unordered_set>
 #include <unordered_map>
 #include <functional>
+#include <memory>
 #include "coin_containers.h"
 
+#include "immer/map.hpp"
+#include "immer/vector.hpp"
+
 //tests
 namespace sigma_mintspend_many { class sigma_mintspend_many; }
 namespace sigma_mintspend { class sigma_mintspend_test; }
@@ -58,6 +62,8 @@ bool CheckSigmaSpendSerial(
 
 secp_primitives::GroupElement ParseSigmaMintScript(const CScript& script);
 std::pair<std::unique_ptr<sigma::CoinSpend>, uint32_t> ParseSigmaSpend(const CTxIn& in);
+// Reads the serial and the denomination of a spend without deserializing its proof, returns the group id.
+uint32_t ParseSigmaSpendSerial(const CTxIn& in, Scalar& serial, CoinDenomination& denomination);
 CAmount GetSpendAmount(const CTxIn& in);
 CAmount GetSpendAmount(const CTransaction& tx);
 bool CheckSigmaBlock(CValidationState &state, const CBlock& block);
@@ -89,11 +95,193 @@ bool GetOutPoint(COutPoint& outPoint, const sigma::PublicCoin &pubCoin);
 bool GetOutPoint(COutPoint& outPoint, const GroupElement &pubCoinValue);
 bool GetOutPoint(COutPoint& outPoint, const uint256 &pubCoinValueHash);
 
+// Starts from the checkpoint written by DumpSigmaState if its block is in the chain,
+// the blocks after it are replayed
 bool BuildSigmaStateFromIndex(CChain *chain);
 
+// Writes the latest snapshot of the state to sigmastate.dat
+void DumpSigmaState();
+
 Scalar GetSigmaSpendSerialNumber(const CTransaction &tx, const CTxIn &txin);
 CAmount GetSigmaSpendInput(const CTransaction &tx);
 
+struct CPairHash {
+  public:
+    template <typename T, typename U>
+      std::size_t operator()(const std::pair<T, U> &x) const
+      {
+        return std::hash<T>()(x.first) ^ std::hash<U>()(x.second);
+      }
+};
+
+/*
+ * Immutable view of the chain part of CSigmaState at a given tip, see CLelantusStateSnapshot.
+ */
+class CSigmaStateSnapshot {
+friend class CSigmaState;
+public:
+    struct CoinGroupInfo {
+        CoinGroupInfo() : firstHeight(-1), lastHeight(-1), nCoins(0) {}
+
+        // heights of the first and last blocks having coins with given denomination and id
+        int firstHeight;
+        int lastHeight;
+        int nCoins;
+    };
+
+    // Mints of a block by denomination and coin group id
+    struct BlockMints {
+        int nHeight;
+        uint256 blockHash;
+        std::shared_ptr<const std::map<std::pair<CoinDenomination, int>, std::vector<sigma::PublicCoin>>> coins;
+    };
+
+public:
+    CSigmaStateSnapshot() : nVersion(0), nHeight(-1), surgeCondition(false) {}
+
+    // Increases with every published snapshot
+    uint64_t GetVersion() const { return nVersion; }
+    // Tip the snapshot was taken at, -1 and null hash if the state is empty
+    int GetHeight() const { return nHeight; }
+    const uint256& GetBlockHash() const { return blockHash; }
+
+    int GetLatestCoinID(sigma::CoinDenomination denomination) const;
+    bool IsSurgeConditionDetected() const { return surgeCondition; }
+
+    bool GetCoinGroupInfo(sigma::CoinDenomination denomination, int group_id, CoinGroupInfo &result) const;
+    bool IsUsedCoinSerial(const Scalar& coinSerial) const;
+    bool HasCoin(const sigma::PublicCoin& pubCoin) const;
+    std::pair<int, int> GetMintedCoinHeightAndId(const sigma::PublicCoin& pubCoin) const;
+
+    // Same as CSigmaState::GetCoinSetForSpend
+    int GetCoinSetForSpend(
+        int maxHeight,
+        sigma::CoinDenomination denomination,
+        int id,
+        uint256& blockHash_out,
+        std::vector<sigma::PublicCoin>& coins_out,
+        int startHeight = -1) const;
+
+    // Same as CSigmaState::GetAnonymitySet
+    void GetAnonymitySet(
+        sigma::CoinDenomination denomination,
+        int coinGroupID,
+        bool fStartSigmaBlacklist,
+        std::vector<GroupElement>& coins_out) const;
+
+    std::size_t GetTotalCoins() const { return mints.size(); }
+
+    // Checkpoint format, see DumpSigmaState. Coins are written in affine form like the
+    // lelantus checkpoint, the denomination comes from the group they are stored under.
+    template <typename Stream>
+    void Serialize(Stream& s) const {
+        s << nHeight << blockHash;
+
+        WriteCompactSize(s, latestCoinIds.size());
+        for (auto const &latestId : latestCoinIds)
+            s << int64_t(latestId.first) << latestId.second;
+
+        WriteCompactSize(s, coinGroups.size());
+        for (auto const &group : coinGroups)
+            s << int64_t(group.first.first) << group.first.second << group.second.firstHeight << group.second.lastHeight << group.second.nCoins;
+
+        WriteCompactSize(s, mintBlocks.size());
+        for (auto const &block : mintBlocks) {
+            s << block.nHeight << block.blockHash;
+            WriteCompactSize(s, block.coins->size());
+            for (auto const &pubCoins : *block.coins) {
+                s << int64_t(pubCoins.first.first) << pubCoins.first.second;
+                WriteCompactSize(s, pubCoins.second.size());
+                for (auto const &coin : pubCoins.second) {
+                    unsigned char buffer[GroupElement::affine_size];
+                    coin.getValue().serializeAffine(buffer);
+                    s.write((const char *)buffer, sizeof(buffer));
+                }
+            }
+        }
+
+        WriteCompactSize(s, spends.size());
+        for (auto const &serial : spends)
+            s << serial.first << serial.second;
+    }
+
+    template <typename Stream>
+    void Unserialize(Stream& s) {
+        *this = CSigmaStateSnapshot();
+        s >> nHeight >> blockHash;
+
+        size_t nDenominations = ReadCompactSize(s);
+        for (size_t i = 0; i < nDenominations; i++) {
+            int64_t denomination;
+            int id;
+            s >> denomination >> id;
+            latestCoinIds = latestCoinIds.set(CoinDenomination(denomination), id);
+        }
+
+        size_t nGroups = ReadCompactSize(s);
+        for (size_t i = 0; i < nGroups; i++) {
+            int64_t denomination;
+            int id;
+            CoinGroupInfo group;
+            s >> denomination >> id >> group.firstHeight >> group.lastHeight >> group.nCoins;
+            coinGroups = coinGroups.set(std::make_pair(CoinDenomination(denomination), id), group);
+        }
+
+        size_t nBlocks = ReadCompactSize(s);
+        for (size_t i = 0; i < nBlocks; i++) {
+            BlockMints block;
+            s >> block.nHeight >> block.blockHash;
+
+            auto blockCoins = std::make_shared<std::map<std::pair<CoinDenomination, int>, std::vector<sigma::PublicCoin>>>();
+            size_t nGroupsInBlock = ReadCompactSize(s);
+            for (size_t j = 0; j < nGroupsInBlock; j++) {
+                int64_t denomination;
+                int id;
+                s >> denomination >> id;
+                auto denomAndId = std::make_pair(CoinDenomination(denomination), id);
+                auto &coins = (*blockCoins)[denomAndId];
+                size_t nCoins = ReadCompactSize(s);
+                for (size_t k = 0; k < nCoins; k++) {
+                    unsigned char buffer[GroupElement::affine_size];
+                    s.read((char *)buffer, sizeof(buffer));
+                    GroupElement value;
+                    value.deserializeAffine(buffer);
+
+                    coins.emplace_back(value, denomAndId.first);
+                    mints = mints.set(coins.back(), CMintedCoinInfo::make(denomAndId.first, denomAndId.second, block.nHeight));
+                }
+            }
+            block.coins = blockCoins;
+            mintBlocks = mintBlocks.push_back(block);
+        }
+
+        size_t nSpends = ReadCompactSize(s);
+        for (size_t i = 0; i < nSpends; i++) {
+            Scalar serial;
+            CSpendCoinInfo info;
+            s >> serial >> info;
+            spends = spends.set(serial, info);
+        }
+    }
+
+private:
+    uint64_t nVersion;
+    int nHeight;
+    uint256 blockHash;
+    bool surgeCondition;
+
+    immer::map<sigma::PublicCoin, CMintedCoinInfo, CPublicCoinHash> mints;
+    immer::map<Scalar, CSpendCoinInfo, CScalarHash> spends;
+    immer::map<std::pair<CoinDenomination, int>, CoinGroupInfo, CPairHash> coinGroups;
+    immer::map<CoinDenomination, int> latestCoinIds;
+    // blocks having mints in chain order
+    immer::vector<BlockMints> mintBlocks;
+
+    // Visits the blocks of the group from the last one down to the first one, both not above maxHeight
+    template <typename Visitor>
+    void ForEachGroupBlock(std::pair<CoinDenomination, int> const &denomAndId, int maxHeight, int startHeight, Visitor visitor) const;
+};
+
 /*
  * State of minted/spent coins as extracted from the index
  */
@@ -111,14 +299,7 @@ public:
         int nCoins;
     };
 
-    struct pairhash {
-      public:
-        template <typename T, typename U>
-          std::size_t operator()(const std::pair<T, U> &x) const
-          {
-            return std::hash<T>()(x.first) ^ std::hash<U>()(x.second);
-          }
-    };
+    typedef CPairHash pairhash;
 public:
     CSigmaState();
 
@@ -150,6 +331,7 @@ public:
 
     // Given denomination and id returns latest accumulator value and corresponding block hash
     // Do not take into account coins with height more than maxHeight
+    // or not more than startHeight, the latter lets callers fetch only the coins added since
     // Returns number of coins satisfying conditions
     int GetCoinSetForSpend(
         CChain *chain,
@@ -157,7 +339,8 @@ public:
         sigma::CoinDenomination denomination,
         int id,
         uint256& blockHash_out,
-        std::vector<sigma::PublicCoin>& coins_out);
+        std::vector<sigma::PublicCoin>& coins_out,
+        int startHeight = -1);
 
     void GetAnonymitySet(
             sigma::CoinDenomination denomination,
@@ -168,6 +351,17 @@ public:
     // Return height of mint transaction and id of minted coin
     std::pair<int, int> GetMintedCoinHeightAndId(const sigma::PublicCoin& pubCoin);
 
+    // Publish a snapshot including the block after its spends and mints were added with
+    // AddSpend and AddMintsToStateAndBlockIndex, AddBlock and RemoveBlock publish on their own
+    void UpdateSnapshot(CBlockIndex *index, bool fConnect);
+
+    // Latest published snapshot, doesn't require cs_main
+    std::shared_ptr<const CSigmaStateSnapshot> GetSnapshot() const;
+
+    // Replace the state with a checkpoint taken at a block of the chain and publish it.
+    // Returns false and leaves the state empty if the checkpoint doesn't fit the chain.
+    bool LoadSnapshot(const CSigmaStateSnapshot &checkpoint, CChain *chain);
+
     // Reset to initial values
     void Reset();
 
@@ -260,6 +454,12 @@ private:
 
     Containers containers;
 
+    // working copy of the next snapshot and the published one, only accessed atomically
+    CSigmaStateSnapshot snapshot;
+    std::shared_ptr<const CSigmaStateSnapshot> publishedSnapshot;
+
+    void SyncSnapshotCoinGroup(std::pair<CoinDenomination, int> const &denomAndId);
+
     friend class sigma_mintspend_many::sigma_mintspend_many;
     friend class zerocoin_tests3_v3::zerocoin_mintspend_v3;
     friend class sigma_mintspend::sigma_mintspend_test;
@@ -307,6 +307,22 @@ Scalar PrivateCoin::serialNumberFromSerializedPublicKey(
     return Scalar(hash);
 }
 
+Scalar PrivateCoin::serialNumberFromCompressedPublicKey(const unsigned char *pubkey) {
+    // secp256k1_ecdh() with a multiplier of one hashes the key in compressed form
+    unsigned char pubkey_hash[CSHA256::OUTPUT_SIZE];
+    CSHA256().Write(pubkey, 33).Finalize(pubkey_hash);
+
+    std::string zpts(ZEROCOIN_PUBLICKEY_TO_SERIALNUMBER);
+    unsigned char hash[CSHA256::OUTPUT_SIZE];
+    CSHA256()
+        .Write(reinterpret_cast<const unsigned char*>(zpts.data()), zpts.size())
+        .Write(pubkey_hash, sizeof(pubkey_hash))
+        .Finalize(hash);
+
+    // Use 32 bytes of hash as coin serial.
+    return Scalar(hash);
+}
+
 } // namespace sigma
 
 namespace std {
@@ -122,7 +122,7 @@ bool CoinSpend::Verify(
     }
 
     // Recompute and compare hash of public key
-    Scalar coinSerialNumberExpected = PrivateCoin::serialNumberFromSerializedPublicKey(OpenSSLContext::get_context(), &pubkey);
+    Scalar coinSerialNumberExpected = PrivateCoin::serialNumberFromCompressedPublicKey(ecdsaPubkey.data());
     if (coinSerialNumber != coinSerialNumberExpected) {
         LogPrintf("Sigma spend failed due to serial number does not match public key hash.");
         return false;
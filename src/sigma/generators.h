@@ -0,0 +1,44 @@
+#ifndef FIRO_SIGMA_GENERATORS_H
+#define FIRO_SIGMA_GENERATORS_H
+
+// Generated by contrib/generators/generate-generators sigma, do not edit.
+// Serialized mainnet generators of sigma::Params.
+
+namespace sigma {
+
+static const char* const generators_g = "d75bfd6797e108484944bf16246ecbac54cf25d39c537ba91aced24f70fcc2380100";
+
+static const char* const generators_h[] = {
+    "b0f4cdec32c98273766898efb79b61c1d96e1be153b577d79c3974c9d9e8fa310000",
+    "dabbf2f802c1366b77fc7dab8c650b6d225b95bab99c96f36c40701a6f637aa90100",
+    "9deb376da4f5594163c6b257f5e82241d4a5ad01660d2213fd827307d3e3340a0100",
+    "b8a3e2300fcb0f42128866f04df405fc3a02f353f234c59159ba87e4a392c4220100",
+    "8a1e73c3e584671098f78deaf981cff01919268218638e1900b4163364a518380100",
+    "e0ff810a46b421407cf1205f0b46fc385f5c843290cde6e87cb59de2005d9a7d0000",
+    "0d0cbd82fd2f1ca9fad4010719a0947f8b790734e1e475b1d220bfc9840e313b0100",
+    "3362b74c6b87709450bc440b353ff7a054e3de72ced9064c32614482b4b051240100",
+    "2943977fd432df3922dc47058ad58313a04f7748fd3e369b9b99c794dd37943f0000",
+    "8dabd7469a9e4c2343ae1c3fc71e6e01e212ed098d0dcde9d1baad8ead975d410000",
+    "7b87b2b8834943be5787d40f232c204b13baf81bb56cc258f500d472f89254d80000",
+    "f38083e25da58cb19b5f198f9165ced558c0d3f37cb94370414bd888684d28e30100",
+    "9c72ae09eb98ef5e319ac47cf3e4b83c2457654f7a65a5c99824c1310d53ca060000",
+    "b6a63665adae57e8b572839518ffd495a00751e558e59b61c1617fdcd7f2d9e50000",
+    "bfc75faebd84f610d282e663f2128960ce803f214654b2179c7fe0eecd74bce40000",
+    "8cac3a148ffd664adb0e9ec3fe3ec439480a216c5dcaa5a9004c734ce266f3a80000",
+    "3f8093de1df8a1d912f64f296cfc17be02abf332faba54a9388da8c16261ae560000",
+    "a1815cd355e5c88df0c13779e8dafc603d2109ac9f88a46cf8fc6203398253ec0000",
+    "4f9e4e3bcf4f2796449621fd517d679036c1f268b6dcd0b6e51a2857c9a306cb0000",
+    "109fa7dd1b92044c6689e3e5ad3de78d2d3f9f70e1c79ca2800d872b6e9c613d0100",
+    "c569f7661124a42772517b8a57aec6bd7a2a48ad1f8d7e9c7ed871b5db6a16ba0100",
+    "ac9befdb8c03f21abc7f6d31f71b2e0865fc3f7d6204e1bcd47beb88ea778c080000",
+    "18c19cb53ba6b0310f89e5bc80e77bb072c2eef7035ca1c75c22bedff9a509550100",
+    "47b1cf0269d55d056dec54cce754232a0968e2045e8d4b074f6f43a0bfac3b6e0100",
+    "ecaedd5b60e87c7f8734cdfeac422ac9e6a0eb395ef9756b43c26a7b5301f93d0100",
+    "b751b376061e13cdc0ca52877a7a6a5b17a426bde0c67cf0a496855d96602ec00000",
+    "6625b9ddde26e77f214deb0e0223bc67931db144d11e49b737dd0df97bf721390100",
+    "8b6b1c4a07dcf5c2c126f2c3c356bc1ab593b879e8776bc64c1e70cc75b5534f0000",
+};
+
+} // namespace sigma
+
+#endif // FIRO_SIGMA_GENERATORS_H
@@ -1,5 +1,10 @@
 #include "chainparams.h"
 #include "params.h"
+#include "generators.h"
+#include "utilstrencodings.h"
+
+#include <cassert>
+#include <type_traits>
 
 namespace sigma {
 
@@ -35,20 +40,48 @@ Params::Params(const GroupElement& g, int n, int m) :
     m_(m),
     n_(n)
 {
+    // deriving the generators takes long, mainnet and regtest ones are embedded
+    if (!load_generators(g, n * m, h_))
+        generate_generators(g, n * m, h_);
+}
+
+void Params::generate_generators(const GroupElement& g, int count, std::vector<GroupElement>& h) {
     unsigned char buff0[32] = {0};
     g.sha256(buff0);
     GroupElement h0;
     h0.generate(buff0);
-    h_.reserve(28);
-    h_.emplace_back(h0);
-    for(int i = 1; i < n*m; ++i) {
-        h_.push_back(GroupElement());
+    h.clear();
+    h.reserve(count);
+    h.emplace_back(h0);
+    for(int i = 1; i < count; ++i) {
+        h.push_back(GroupElement());
         unsigned char buff[32] = {0};
-        h_[i - 1].sha256(buff);
-        h_[i].generate(buff);
+        h[i - 1].sha256(buff);
+        h[i].generate(buff);
     }
 }
 
+static GroupElement DecodeGenerator(const char* hex) {
+    std::vector<unsigned char> buffer = ParseHex(hex);
+    assert(buffer.size() == GroupElement::serialize_size);
+
+    GroupElement generator;
+    generator.deserialize(buffer.data());
+    return generator;
+}
+
+bool Params::load_generators(const GroupElement& g, int count, std::vector<GroupElement>& h) {
+    if (std::size_t(count) != std::extent<decltype(generators_h)>::value
+        || g != DecodeGenerator(generators_g))
+        return false;
+
+    h.clear();
+    h.reserve(count);
+    for (auto hex : generators_h)
+        h.push_back(DecodeGenerator(hex));
+    return true;
+}
+
 Params::~Params(){
     delete instance;
 }
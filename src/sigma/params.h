@@ -17,6 +17,12 @@ public:
     uint64_t get_n() const;
     uint64_t get_m() const;
 
+    // Derives the generators h from g with GroupElement::generate().
+    static void generate_generators(const GroupElement& g, int count, std::vector<GroupElement>& h);
+
+    // Loads the embedded mainnet generators of generators.h, returns false if g or the count do not match them.
+    static bool load_generators(const GroupElement& g, int count, std::vector<GroupElement>& h);
+
 private:
    Params(const GroupElement& g, int n, int m);
     ~Params();
@@ -158,12 +158,18 @@ bool SigmaPlusVerifier<Exponent, GroupElement>::batch_verify(
         group_elements.insert(group_elements.end(), proofs[t].Gk_.begin(), proofs[t].Gk_.end());
         SigmaPrimitives<Exponent, GroupElement>::generate_challenge(group_elements, challenges[t]);
 
-        if(!compute_fs(proofs[t], challenges[t], f_[t]) || !abcd_checks(proofs[t], challenges[t], f_[t])) {
-            LogPrintf("Sigma spend failed due to compute_fs or abcd_checks failed.");
+        if(!compute_fs(proofs[t], challenges[t], f_[t])) {
+            LogPrintf("Sigma spend failed due to compute_fs failed.");
             return false;
         }
     }
 
+    /*
+     * All the checks of all the proofs are combined into a single multiexponentiation, each of
+     * them weighted by a random scalar: y_t for the final check of proof t and u_t, v_t for its
+     * B^x * A = Comm(..) and C^x * D = Comm(..) checks. The terms are moved to the left side, so
+     * the proofs are valid if the sum is the point at infinity.
+     */
     std::vector<Scalar> y;
     y.resize(M);
     for (int t = 0; t < M; ++t)
@@ -171,8 +177,15 @@ bool SigmaPlusVerifier<Exponent, GroupElement>::batch_verify(
 
     std::vector<Scalar> f_i_t;
     f_i_t.resize(N);
-    GroupElement right;
+    // exponents of g and h_ on the right side
     Scalar exp;
+    std::vector<Scalar> h_exp;
+    h_exp.resize(h_.size());
+
+    std::vector<GroupElement> points;
+    std::vector<Scalar> exponents;
+    points.reserve(N + 1 + h_.size() + M * (4 + m));
+    exponents.reserve(N + 1 + h_.size() + M * (4 + m));
 
     std::vector <std::vector<uint64_t>> I_;
     I_.resize(N);
@@ -181,7 +194,7 @@ bool SigmaPlusVerifier<Exponent, GroupElement>::batch_verify(
 
     for (int t = 0; t < M; ++t)
     {
-        right += (SigmaPrimitives<Exponent, GroupElement>::commit(g_, Scalar(uint64_t(0)), h_[0], proofs[t].z_)) * y[t];
+        h_exp[0] += proofs[t].z_ * y[t];
         Scalar e;
         size_t size = setSizes[t];
         size_t start = N - size;
@@ -239,36 +252,52 @@ bool SigmaPlusVerifier<Exponent, GroupElement>::batch_verify(
         exp += e;
     }
 
-    secp_primitives::MultiExponent mult(commits, f_i_t);
-    GroupElement t1 = mult.get_multiple();
-
-    std::vector<std::vector<Scalar>> x_t_k_neg;
-    x_t_k_neg.resize(M);
     for (int t = 0; t < M; ++t) {
-        x_t_k_neg[t].reserve(m);
-        NthPower<Exponent> x_k(challenges[t]);
-        for (uint64_t k = 0; k < m; ++k) {
-            x_t_k_neg[t].emplace_back(x_k.pow.negate());
+        const Scalar& x = challenges[t];
+        const std::vector<Scalar>& f = f_[t];
+
+        Scalar u, v;
+        u.randomize();
+        v.randomize();
+
+        // B^x * A = g^ZA * h^f and C^x * D = g^ZC * h^(f(x-f))
+        points.emplace_back(proofs[t].r1Proof_.A_);
+        exponents.emplace_back(u);
+        points.emplace_back(proofs[t].B_);
+        exponents.emplace_back(u * x);
+        points.emplace_back(proofs[t].r1Proof_.C_);
+        exponents.emplace_back(v * x);
+        points.emplace_back(proofs[t].r1Proof_.D_);
+        exponents.emplace_back(v);
+
+        exp += proofs[t].r1Proof_.ZA_ * u + proofs[t].r1Proof_.ZC_ * v;
+        for (std::size_t i = 0; i < f.size(); ++i)
+            h_exp[i] += f[i] * (u + v * (x - f[i]));
+
+        // the final check has Gk^(-x^k) on the left side
+        NthPower<Exponent> x_k(x);
+        for (int k = 0; k < m; ++k) {
+            points.emplace_back(proofs[t].Gk_[k]);
+            exponents.emplace_back(x_k.pow.negate() * y[t]);
             x_k.go_next();
         }
     }
 
-    GroupElement t2;
-    for (int t = 0; t < M; ++t) {
-        const std::vector <GroupElement>& Gk = proofs[t].Gk_;
-        GroupElement term;
-        for (std::size_t k = 0; k < m; ++k)
-        {
-            term += ((Gk[k]) * x_t_k_neg[t][k]);
-        }
-        term *= y[t];
-        t2 += term;
+    points.insert(points.end(), commits.begin(), commits.end());
+    exponents.insert(exponents.end(), f_i_t.begin(), f_i_t.end());
+
+    points.emplace_back(g_);
+    exponents.emplace_back(exp.negate());
+    for (std::size_t i = 0; i < h_.size(); ++i) {
+        points.emplace_back(h_[i]);
+        exponents.emplace_back(h_exp[i].negate());
     }
-    GroupElement left(t1 + t2);
 
-    right += g_ * exp;
-    if(left != right)
+    secp_primitives::MultiExponent mult(points, exponents);
+    if (!mult.get_multiple().isInfinity()) {
+        LogPrintf("Sigma spend failed due to batch verification failure.");
         return false;
+    }
 
     return true;
 }
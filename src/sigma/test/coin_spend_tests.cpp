@@ -2,6 +2,7 @@
 #include "../coinspend.h"
 #include "../spend_metadata.h"
 
+#include "../../sigma.h"
 #include "../../streams.h"
 #include "../../uint256.h"
 
@@ -40,6 +41,35 @@ BOOST_AUTO_TEST_CASE(serialize_deserialize_test)
     BOOST_CHECK(coin.getVersion() == new_coin.getVersion());
 }
 
+BOOST_AUTO_TEST_CASE(parse_serial_test)
+{
+    auto params = sigma::Params::get_default();
+
+    const sigma::PrivateCoin privcoin(params, sigma::CoinDenomination::SIGMA_DENOM_10);
+
+    sigma::SpendMetaData metaData(0, uint256S("120"), uint256S("120"));
+    std::vector<sigma::PublicCoin> anonymity_set = {privcoin.getPublicCoin()};
+    sigma::CoinSpend coin(params, privcoin, anonymity_set, metaData, true);
+
+    CDataStream serialized(SER_NETWORK, PROTOCOL_VERSION);
+    serialized << coin;
+
+    CTxIn in;
+    in.prevout.n = 3;
+    in.scriptSig << OP_SIGMASPEND;
+    in.scriptSig.insert(in.scriptSig.end(), serialized.begin(), serialized.end());
+
+    // the proof is skipped, the fields after it have to be read correctly
+    Scalar serial;
+    sigma::CoinDenomination denomination;
+    BOOST_CHECK_EQUAL(3u, sigma::ParseSigmaSpendSerial(in, serial, denomination));
+    BOOST_CHECK(coin.getCoinSerialNumber() == serial);
+    BOOST_CHECK(sigma::CoinDenomination::SIGMA_DENOM_10 == denomination);
+
+    in.scriptSig.resize(100);
+    BOOST_CHECK_THROW(sigma::ParseSigmaSpendSerial(in, serial, denomination), std::ios_base::failure);
+}
+
 BOOST_AUTO_TEST_CASE(different_anonymity_set)
 {
     auto params = sigma::Params::get_default();
@@ -209,4 +209,72 @@ BOOST_AUTO_TEST_CASE(prove_coin_not_in_set)
     BOOST_CHECK(!verifier.verify(commits, proof, true));
 }
 
+BOOST_AUTO_TEST_CASE(batch_verify)
+{
+    int N = 256;
+    int n = 4;
+    int m = 4;
+
+    secp_primitives::GroupElement g;
+    g.randomize();
+    std::vector<secp_primitives::GroupElement> h_gens;
+    h_gens.resize(n * m);
+    for(int i = 0; i < n * m; ++i ){
+        h_gens[i].randomize();
+    }
+
+    std::vector<secp_primitives::GroupElement> commits(N);
+    for (auto &commit : commits)
+        commit.randomize();
+
+    // proofs over the whole set and over the last 200 coins, with and without padding
+    std::vector<int> indexes = {0, 100, 255, 250};
+    std::vector<size_t> setSizes = {256, 256, 256, 200};
+    std::vector<bool> fPadding = {true, false, true, false};
+
+    std::vector<secp_primitives::Scalar> serials(indexes.size()), randomness(indexes.size());
+    for (size_t i = 0; i < indexes.size(); i++) {
+        serials[i].randomize();
+        randomness[i].randomize();
+        commits[indexes[i]] = sigma::SigmaPrimitives<secp_primitives::Scalar,secp_primitives::GroupElement>::commit(
+            g, serials[i], h_gens[0], randomness[i]);
+    }
+
+    sigma::SigmaPlusProver<secp_primitives::Scalar,secp_primitives::GroupElement> prover(g, h_gens, n, m);
+    std::vector<sigma::SigmaPlusProof<secp_primitives::Scalar,secp_primitives::GroupElement>> proofs;
+    for (size_t i = 0; i < indexes.size(); i++) {
+        size_t start = N - setSizes[i];
+        std::vector<secp_primitives::GroupElement> set(commits.begin() + start, commits.end());
+        secp_primitives::GroupElement gs = g * serials[i].negate();
+        for (auto &commit : set)
+            commit += gs;
+
+        proofs.emplace_back(n, m);
+        prover.proof(set, indexes[i] - start, randomness[i], fPadding[i], proofs.back());
+    }
+
+    sigma::SigmaPlusVerifier<secp_primitives::Scalar,secp_primitives::GroupElement> verifier(g, h_gens, n, m);
+    BOOST_CHECK(verifier.batch_verify(commits, serials, fPadding, setSizes, proofs));
+
+    // every term of the proof is part of the combined check
+    for (int i = 0; i < 7; i++) {
+        auto invalidProofs = proofs;
+        auto &proof = invalidProofs[2];
+        switch (i) {
+            case 0: proof.r1Proof_.A_.randomize(); break;
+            case 1: proof.B_.randomize(); break;
+            case 2: proof.r1Proof_.C_.randomize(); break;
+            case 3: proof.r1Proof_.D_.randomize(); break;
+            case 4: proof.r1Proof_.ZA_.randomize(); break;
+            case 5: proof.Gk_[1].randomize(); break;
+            case 6: proof.z_.randomize(); break;
+        }
+        BOOST_CHECK(!verifier.batch_verify(commits, serials, fPadding, setSizes, invalidProofs));
+    }
+
+    auto invalidSerials = serials;
+    invalidSerials[1].randomize();
+    BOOST_CHECK(!verifier.batch_verify(commits, invalidSerials, fPadding, setSizes, proofs));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -20,4 +20,54 @@ BOOST_AUTO_TEST_CASE(scalar_test)
     BOOST_CHECK(s == s2);
 }
 
+BOOST_AUTO_TEST_CASE(batch_inverse)
+{
+    std::vector<secp_primitives::Scalar> values(10);
+    for (auto &value : values)
+        value.randomize();
+    // zeros are kept as they are and don't spoil the others
+    values[0] = secp_primitives::Scalar(uint64_t(0));
+    values[6] = secp_primitives::Scalar(uint64_t(0));
+
+    std::vector<secp_primitives::Scalar> inverses(values);
+    secp_primitives::Scalar::batchInverse(inverses);
+
+    for (size_t i = 0; i < values.size(); i++)
+        BOOST_CHECK(inverses[i] == values[i].inverse());
+
+    std::vector<secp_primitives::Scalar> empty;
+    secp_primitives::Scalar::batchInverse(empty);
+    BOOST_CHECK(empty.empty());
+}
+
+BOOST_AUTO_TEST_CASE(group_element_membership)
+{
+    secp_primitives::GroupElement a, b;
+    a.randomize();
+    b.randomize();
+
+    // sums are in jacobian coordinates, deserialized points are affine
+    secp_primitives::GroupElement sum = a + b;
+    BOOST_CHECK(sum.isMember());
+    BOOST_CHECK((a * secp_primitives::Scalar(uint64_t(3))).isMember());
+    BOOST_CHECK((a + a.inverse()).isMember());
+    BOOST_CHECK(secp_primitives::GroupElement().isMember());
+
+    unsigned char buffer[secp_primitives::GroupElement::serialize_size];
+    sum.serialize(buffer);
+    secp_primitives::GroupElement deserialized;
+    deserialized.deserialize(buffer);
+    BOOST_CHECK(deserialized.isMember());
+
+    // x of a point but y of another
+    unsigned char affine[secp_primitives::GroupElement::affine_size];
+    a.serializeAffine(affine);
+    unsigned char other[secp_primitives::GroupElement::affine_size];
+    b.serializeAffine(other);
+    std::copy(other + 32, other + 64, affine + 32);
+    secp_primitives::GroupElement mixed;
+    mixed.deserializeAffine(affine);
+    BOOST_CHECK(!mixed.isMember());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
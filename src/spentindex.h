@@ -11,6 +11,8 @@
 #include "script/script.h"
 #include "addresstype.h"
 
+#include <map>
+
 struct CSpentIndexKey {
     uint256 txid;
     unsigned int outputIndex;
@@ -232,6 +234,36 @@ struct CAddressUnspentValue {
     }
 };
 
+struct CAddressBalanceValue {
+    CAmount balance;
+    CAmount received;
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream, typename Operation>
+    inline void SerializationOp(Stream& s, Operation ser_action) {
+        READWRITE(balance);
+        READWRITE(received);
+    }
+
+    CAddressBalanceValue(CAmount balanceIn, CAmount receivedIn) {
+        balance = balanceIn;
+        received = receivedIn;
+    }
+
+    CAddressBalanceValue() {
+        SetNull();
+    }
+
+    void SetNull() {
+        balance = 0;
+        received = 0;
+    }
+};
+
+/** Changes of the running address balances, keyed by address type and hash */
+typedef std::map<std::pair<AddressType, uint160>, CAddressBalanceValue> CAddressBalanceDeltas;
+
 struct CAddressIndexKey {
     AddressType type;
     uint160 hashBytes;
@@ -0,0 +1,117 @@
+// Copyright (c) 2020 The Firo Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "chainparams.h"
+#include "script/standard.h"
+#include "txdb.h"
+#include "validation.h"
+
+#include "test/test_bitcoin.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace {
+
+struct AddressIndexArgs {
+    AddressIndexArgs() { ForceSetArg("-addressindex", "1"); }
+    ~AddressIndexArgs() { ForceSetArg("-addressindex", "0"); }
+};
+
+struct AddressBalanceTestingSetup : public AddressIndexArgs, public TestChain100Setup {
+    uint160 addressHash;
+    CScript scriptPubKey;
+
+    AddressBalanceTestingSetup()
+    {
+        addressHash = coinbaseKey.GetPubKey().GetID();
+        scriptPubKey = GetScriptForDestination(CKeyID(addressHash));
+    }
+
+    //! Checks the running totals against the address index entries and returns the balance
+    CAmount CheckTotals()
+    {
+        LOCK(cs_main);
+
+        CAmount balance = 0, received = 0;
+        BOOST_REQUIRE(GetAddressBalance(addressHash, AddressType::payToPubKeyHash, balance, received));
+
+        std::vector<std::pair<CAddressIndexKey, CAmount>> entries;
+        BOOST_REQUIRE(GetAddressIndex(addressHash, AddressType::payToPubKeyHash, entries));
+
+        CAmount sum = 0, sumReceived = 0;
+        for (const auto& entry : entries) {
+            sum += entry.second;
+            if (entry.second > 0)
+                sumReceived += entry.second;
+        }
+
+        BOOST_CHECK_EQUAL(balance, sum);
+        BOOST_CHECK_EQUAL(received, sumReceived);
+        return balance;
+    }
+
+    CAmount PaidToAddress(const CBlock& block)
+    {
+        CAmount amount = 0;
+        for (const CTxOut& out : block.vtx[0]->vout) {
+            if (out.scriptPubKey == scriptPubKey)
+                amount += out.nValue;
+        }
+        return amount;
+    }
+};
+
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(addressbalance_tests, AddressBalanceTestingSetup)
+
+BOOST_AUTO_TEST_CASE(connect_disconnect_reconnect)
+{
+    // the coinbases of the test chain pay to the key as well, to its pubkey
+    CAmount initial = CheckTotals();
+    BOOST_CHECK(initial > 0);
+
+    CBlock block = CreateAndProcessBlock({}, scriptPubKey);
+    CAmount paid = PaidToAddress(block);
+    BOOST_CHECK(paid > 0);
+    BOOST_CHECK_EQUAL(CheckTotals(), initial + paid);
+
+    CBlockIndex* pindex;
+    {
+        LOCK(cs_main);
+        pindex = mapBlockIndex[block.GetHash()];
+        BOOST_REQUIRE(chainActive.Tip() == pindex);
+
+        uint256 hashBalanceTip;
+        BOOST_CHECK(pblocktree->ReadAddressBalanceTip(hashBalanceTip));
+        BOOST_CHECK(hashBalanceTip == pindex->GetBlockHash());
+    }
+
+    // disconnect
+    {
+        LOCK(cs_main);
+        CValidationState state;
+        BOOST_CHECK(InvalidateBlock(state, Params(), pindex));
+        BOOST_CHECK(chainActive.Tip() == pindex->pprev);
+    }
+    BOOST_CHECK_EQUAL(CheckTotals(), initial);
+
+    // reconnect
+    {
+        LOCK(cs_main);
+        BOOST_CHECK(ResetBlockFailureFlags(pindex));
+    }
+    {
+        CValidationState state;
+        BOOST_CHECK(ActivateBestChain(state, Params()));
+    }
+    BOOST_CHECK(chainActive.Tip() == pindex);
+    BOOST_CHECK_EQUAL(CheckTotals(), initial + paid);
+
+    // blocks connected again by the verification don't count twice
+    BOOST_CHECK(CVerifyDB().VerifyDB(Params(), pcoinsTip, 4, 5));
+    BOOST_CHECK_EQUAL(CheckTotals(), initial + paid);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
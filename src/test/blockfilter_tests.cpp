@@ -0,0 +1,88 @@
+// Copyright (c) 2020 The Firo Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "blockfilter.h"
+#include "random.h"
+
+#include "test/test_bitcoin.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace {
+
+GCSFilter::Element RandomElement(FastRandomContext& rng)
+{
+    GCSFilter::Element element(20 + rng.randrange(20));
+    for (auto& byte : element)
+        byte = rng.randbits(8);
+    return element;
+}
+
+uint256 RandomHash(FastRandomContext& rng)
+{
+    uint256 hash;
+    for (auto& byte : hash)
+        byte = rng.randbits(8);
+    return hash;
+}
+
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(blockfilter_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(gcsfilter_match)
+{
+    FastRandomContext rng(true);
+    uint256 blockHash = RandomHash(rng);
+
+    GCSFilter::ElementSet included, excluded;
+    for (int i = 0; i < 100; i++) {
+        included.insert(RandomElement(rng));
+        excluded.insert(RandomElement(rng));
+    }
+
+    GCSFilter filter(blockHash, included);
+    BOOST_CHECK_EQUAL(filter.GetN(), included.size());
+
+    // decoding the stored filter gives the same answers
+    GCSFilter decoded(blockHash, filter.GetEncoded());
+    BOOST_CHECK_EQUAL(decoded.GetN(), included.size());
+
+    for (const auto& element : included) {
+        BOOST_CHECK(filter.Match(element));
+        BOOST_CHECK(decoded.Match(element));
+    }
+
+    // false positives happen once in M queries
+    int falsePositives = 0;
+    for (const auto& element : excluded) {
+        if (decoded.Match(element))
+            falsePositives++;
+    }
+    BOOST_CHECK(falsePositives <= 1);
+    BOOST_CHECK(!decoded.MatchAny(excluded) || falsePositives > 0);
+
+    GCSFilter::ElementSet mixed(excluded);
+    mixed.insert(*included.rbegin());
+    BOOST_CHECK(decoded.MatchAny(mixed));
+
+    // the elements are hashed with the block hash
+    GCSFilter otherBlock(RandomHash(rng), filter.GetEncoded());
+    BOOST_CHECK(!otherBlock.MatchAny(included));
+}
+
+BOOST_AUTO_TEST_CASE(gcsfilter_empty)
+{
+    FastRandomContext rng(true);
+
+    GCSFilter filter;
+    BOOST_CHECK_EQUAL(filter.GetN(), 0);
+    BOOST_CHECK_EQUAL(filter.GetEncoded().size(), 1);
+    BOOST_CHECK(!filter.Match(RandomElement(rng)));
+
+    GCSFilter decoded(uint256(), filter.GetEncoded());
+    BOOST_CHECK(!decoded.MatchAny({RandomElement(rng), RandomElement(rng)}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
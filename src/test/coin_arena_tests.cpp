@@ -0,0 +1,241 @@
+// Copyright (c) 2020 The Firo Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "chain.h"
+#include "coin_arena.h"
+#include "lelantus.h"
+#include "streams.h"
+#include "version.h"
+
+#include "test/test_bitcoin.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+sigma::PublicCoin RandomSigmaCoin(sigma::CoinDenomination denomination)
+{
+    GroupElement value;
+    value.randomize();
+    return sigma::PublicCoin(value, denomination);
+}
+
+std::pair<lelantus::PublicCoin, uint256> RandomLelantusMint()
+{
+    GroupElement value;
+    value.randomize();
+    return {lelantus::PublicCoin(value), GetRandHash()};
+}
+
+template <typename T>
+std::vector<unsigned char> SerializeToBytes(const T& obj)
+{
+    CDataStream stream(SER_DISK, CLIENT_VERSION);
+    stream << obj;
+    return std::vector<unsigned char>(stream.begin(), stream.end());
+}
+
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(coin_arena_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(affine_roundtrip)
+{
+    GroupElement value, decoded;
+    value.randomize();
+
+    unsigned char buffer[GroupElement::affine_size];
+    BOOST_CHECK(value.serializeAffine(buffer) == buffer + GroupElement::affine_size);
+    decoded.deserializeAffine(buffer);
+    BOOST_CHECK(value == decoded);
+
+    GroupElement infinity;
+    infinity.serializeAffine(buffer);
+    decoded.deserializeAffine(buffer);
+    BOOST_CHECK(decoded.isInfinity());
+}
+
+BOOST_AUTO_TEST_CASE(sigma_mints_serialization)
+{
+    std::map<std::pair<sigma::CoinDenomination, int>, std::vector<sigma::PublicCoin>> expected;
+    sigma::block_mint_container mints;
+
+    auto denom1 = std::make_pair(sigma::CoinDenomination::SIGMA_DENOM_1, 1);
+    auto denom10 = std::make_pair(sigma::CoinDenomination::SIGMA_DENOM_10, 2);
+    for (int i = 0; i < 3; i++) {
+        // added out of order, kept ordered by group like the map
+        auto coin = RandomSigmaCoin(denom10.first);
+        expected[denom10].push_back(coin);
+        mints.Add(denom10, coin);
+
+        coin = RandomSigmaCoin(denom1.first);
+        expected[denom1].push_back(coin);
+        mints.Add(denom1, coin);
+    }
+
+    // the block index database format stays the same
+    auto bytes = SerializeToBytes(mints);
+    BOOST_CHECK(bytes == SerializeToBytes(expected));
+
+    sigma::block_mint_container decoded;
+    CDataStream stream(bytes, SER_DISK, CLIENT_VERSION);
+    stream >> decoded;
+
+    BOOST_CHECK_EQUAL(2, decoded.size());
+    BOOST_CHECK_EQUAL(1, decoded.count(denom1));
+    BOOST_CHECK_EQUAL(0, decoded.count(std::make_pair(sigma::CoinDenomination::SIGMA_DENOM_1, 2)));
+    for (auto const &group : expected) {
+        auto coins = decoded.Get(group.first);
+        BOOST_CHECK(std::vector<sigma::PublicCoin>(coins.begin(), coins.end()) == group.second);
+    }
+    BOOST_CHECK(decoded.Get(std::make_pair(sigma::CoinDenomination::SIGMA_DENOM_100, 1)).empty());
+}
+
+BOOST_AUTO_TEST_CASE(lelantus_mints_interleaved)
+{
+    typedef std::vector<std::pair<lelantus::PublicCoin, uint256>> mints_vector;
+    mints_vector expected1, expected2;
+    lelantus::block_mint_container block1, block2;
+
+    // blocks filled in turns have their coins moved to stay contiguous
+    for (int i = 0; i < 5; i++) {
+        expected1.push_back(RandomLelantusMint());
+        block1.Add(1, expected1.back());
+
+        expected2.push_back(RandomLelantusMint());
+        block2.Add(1, expected2.back());
+    }
+
+    auto coins1 = block1.Get(1), coins2 = block2.Get(1);
+    BOOST_CHECK(mints_vector(coins1.begin(), coins1.end()) == expected1);
+    BOOST_CHECK(mints_vector(coins2.begin(), coins2.end()) == expected2);
+    BOOST_CHECK(coins2[2] == expected2[2]);
+
+    // copies share the records until either of them gets more coins
+    lelantus::block_mint_container copy = block1;
+    BOOST_CHECK(SerializeToBytes(copy) == SerializeToBytes(block1));
+
+    auto extra1 = RandomLelantusMint(), extra2 = RandomLelantusMint();
+    block1.Add(1, extra1);
+    copy.Add(1, extra2);
+    BOOST_CHECK(block1.Get(1)[5] == extra1);
+    BOOST_CHECK(copy.Get(1)[5] == extra2);
+    BOOST_CHECK(copy.Get(1)[4] == expected1[4]);
+
+    block1.clear();
+    BOOST_CHECK(block1.empty());
+    BOOST_CHECK_EQUAL(0, block1.count(1));
+    BOOST_CHECK_EQUAL(6, copy.Get(1).size());
+}
+
+BOOST_AUTO_TEST_CASE(spent_serials_serialization)
+{
+    Scalar serial;
+    serial.randomize();
+
+    std::unordered_map<Scalar, sigma::CSpendCoinInfo, sigma::CScalarHash> expected;
+    expected[serial] = sigma::CSpendCoinInfo::make(sigma::CoinDenomination::SIGMA_DENOM_0_1, 7);
+
+    sigma::block_spend_container serials;
+    serials.insert(*expected.begin());
+    BOOST_CHECK(SerializeToBytes(serials) == SerializeToBytes(expected));
+
+    Scalar serial2;
+    serial2.randomize();
+    serials.insert({serial2, sigma::CSpendCoinInfo::make(sigma::CoinDenomination::SIGMA_DENOM_100, 3)});
+
+    sigma::block_spend_container decoded;
+    auto bytes = SerializeToBytes(serials);
+    CDataStream stream(bytes, SER_DISK, CLIENT_VERSION);
+    stream >> decoded;
+
+    BOOST_CHECK_EQUAL(2, decoded.size());
+    auto it = decoded.begin();
+    auto first = *it++;
+    BOOST_CHECK(first.first == serial);
+    BOOST_CHECK(first.second.denomination == sigma::CoinDenomination::SIGMA_DENOM_0_1);
+    BOOST_CHECK_EQUAL(7, first.second.coinGroupId);
+    auto second = *it++;
+    BOOST_CHECK(second.first == serial2);
+    BOOST_CHECK_EQUAL(3, second.second.coinGroupId);
+    BOOST_CHECK(it == decoded.end());
+
+    lelantus::block_spend_container lelantusSerials;
+    lelantusSerials.insert({serial, 12});
+    BOOST_CHECK_EQUAL(12, (*lelantusSerials.begin()).second);
+    BOOST_CHECK(SerializeToBytes(lelantusSerials) == SerializeToBytes(std::unordered_map<Scalar, int>{{serial, 12}}));
+}
+
+BOOST_AUTO_TEST_CASE(lelantus_block_index_containers)
+{
+    typedef std::vector<std::pair<lelantus::PublicCoin, uint256>> mints_vector;
+    CCoinArena &mintArena = lelantus::CMintArenaCodec::Arena();
+    CCoinArena &spendArena = lelantus::CSpendArenaCodec::Arena();
+
+    uint256 hash = GetRandHash();
+    CBlockIndex index;
+    index.nHeight = 1;
+    index.phashBlock = &hash;
+
+    CBlock block;
+    block.lelantusTxInfo = std::make_shared<lelantus::CLelantusTxInfo>();
+    mints_vector mints;
+    for (int i = 0; i < 3; i++) {
+        mints.push_back(RandomLelantusMint());
+        block.lelantusTxInfo->mints.emplace_back(mints.back().first, std::make_pair(COIN, mints.back().second));
+    }
+
+    Scalar serial;
+    serial.randomize();
+
+    // the state writes the coins of a connected block to the arena
+    uint32_t mintRecords = mintArena.Size();
+    lelantus::CLelantusState state(6, 2);
+    state.AddMintsToStateAndBlockIndex(&index, &block);
+    index.lelantusSpentSerials.insert({serial, 1});
+    state.AddSpend(serial, 1);
+    BOOST_CHECK_EQUAL(mintRecords + 3, mintArena.Size());
+
+    auto coins = index.lelantusMintedPubCoins.Get(1);
+    BOOST_CHECK(mints_vector(coins.begin(), coins.end()) == mints);
+
+    // and reads them back when it is rebuilt from the index
+    lelantus::CLelantusState rebuilt(6, 2);
+    rebuilt.AddBlock(&index);
+    for (auto const &mint : mints) {
+        BOOST_CHECK(rebuilt.HasCoin(mint.first));
+        BOOST_CHECK(rebuilt.GetMintedCoinHeightAndId(mint.first) == std::make_pair(1, 1));
+    }
+    BOOST_CHECK(rebuilt.IsUsedCoinSerial(serial));
+    BOOST_CHECK_EQUAL(3, rebuilt.GetTotalCoins());
+
+    rebuilt.RemoveBlock(&index);
+    BOOST_CHECK(!rebuilt.HasCoin(mints[0].first));
+    BOOST_CHECK(!rebuilt.IsUsedCoinSerial(serial));
+    // the disconnected block keeps its records
+    BOOST_CHECK_EQUAL(3, index.lelantusMintedPubCoins.Get(1).size());
+    BOOST_CHECK_EQUAL(mintRecords + 3, mintArena.Size());
+
+    // connecting it again appends new records, the old ones are abandoned
+    uint32_t spendRecords = spendArena.Size();
+    auto oldCoins = index.lelantusMintedPubCoins.Get(1);
+    index.lelantusMintedPubCoins.clear();
+    index.lelantusSpentSerials.clear();
+
+    lelantus::CLelantusState reconnected(6, 2);
+    reconnected.AddMintsToStateAndBlockIndex(&index, &block);
+    index.lelantusSpentSerials.insert({serial, 1});
+    BOOST_CHECK_EQUAL(mintRecords + 6, mintArena.Size());
+    BOOST_CHECK_EQUAL(spendRecords + 1, spendArena.Size());
+
+    coins = index.lelantusMintedPubCoins.Get(1);
+    BOOST_CHECK(mints_vector(coins.begin(), coins.end()) == mints);
+    BOOST_CHECK(mints_vector(oldCoins.begin(), oldCoins.end()) == mints);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,88 @@
+// Copyright (c) 2020 The Firo Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "dandelion.h"
+#include "random.h"
+
+#include "test/test_bitcoin.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <map>
+#include <set>
+
+BOOST_FIXTURE_TEST_SUITE(dandelion_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(embargoes_expire_once)
+{
+    FastRandomContext rng(true);
+    CDandelionEmbargoes embargoes;
+
+    // embargoes spread over more than the wheel, some of them removed again
+    const int64_t nStart = 1600000000LL * 1000000;
+    const int64_t nSpan = 2 * DANDELION_EMBARGO_SLOTS * DANDELION_EMBARGO_SLOT_MICROS;
+    std::map<uint256, int64_t> expected;
+    for (int i = 0; i < 100000; i++) {
+        uint256 hash = GetRandHash();
+        int64_t nEmbargo = nStart + rng.randrange(nSpan);
+        BOOST_CHECK(embargoes.Insert(hash, nEmbargo));
+        BOOST_CHECK(!embargoes.Insert(hash, nEmbargo + 1));
+        if (i % 10 == 0) {
+            BOOST_CHECK(embargoes.Remove(hash));
+            BOOST_CHECK(!embargoes.Contains(hash));
+        } else {
+            expected.emplace(hash, nEmbargo);
+        }
+    }
+    BOOST_CHECK_EQUAL(embargoes.Size(), expected.size());
+    size_t nUsage = embargoes.DynamicMemoryUsage();
+    BOOST_CHECK(nUsage > 0);
+
+    BOOST_CHECK(embargoes.PopExpired(nStart - 1).empty());
+
+    // collect in uneven steps, every embargo comes out once and not early
+    std::set<uint256> popped;
+    for (int64_t nTime = nStart; nTime <= nStart + nSpan; nTime += 1 + rng.randrange(3 * DANDELION_EMBARGO_SLOT_MICROS)) {
+        for (const uint256& hash : embargoes.PopExpired(nTime)) {
+            auto it = expected.find(hash);
+            BOOST_REQUIRE(it != expected.end());
+            BOOST_CHECK(it->second <= nTime);
+            BOOST_CHECK(popped.insert(hash).second);
+            BOOST_CHECK(!embargoes.Contains(hash));
+        }
+        BOOST_CHECK_EQUAL(embargoes.Size(), expected.size() - popped.size());
+    }
+    embargoes.PopExpired(nStart + nSpan);
+    BOOST_CHECK_EQUAL(embargoes.Size(), 0);
+    BOOST_CHECK(embargoes.DynamicMemoryUsage() < nUsage);
+}
+
+BOOST_AUTO_TEST_CASE(embargoes_late_insert)
+{
+    CDandelionEmbargoes embargoes(10, 4);
+    uint256 a = GetRandHash(), b = GetRandHash(), c = GetRandHash();
+
+    BOOST_CHECK(embargoes.PopExpired(100).empty());
+
+    // an embargo ending in the past comes out with the next collection
+    BOOST_CHECK(embargoes.Insert(a, 50));
+    // one ending a few turns of the wheel ahead stays until its time
+    BOOST_CHECK(embargoes.Insert(b, 195));
+    BOOST_CHECK(embargoes.Insert(c, 105));
+
+    BOOST_CHECK(embargoes.PopExpired(101) == std::vector<uint256>{a});
+    BOOST_CHECK(embargoes.PopExpired(104).empty());
+    BOOST_CHECK(embargoes.PopExpired(105) == std::vector<uint256>{c});
+    BOOST_CHECK(embargoes.PopExpired(194).empty());
+    BOOST_CHECK(embargoes.Contains(b));
+
+    // removed and embargoed again with a later end
+    BOOST_CHECK(embargoes.Remove(b));
+    BOOST_CHECK(embargoes.Insert(b, 300));
+    BOOST_CHECK(embargoes.PopExpired(299).empty());
+    BOOST_CHECK(embargoes.PopExpired(1000) == std::vector<uint256>{b});
+    BOOST_CHECK_EQUAL(embargoes.Size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
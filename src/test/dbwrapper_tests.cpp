@@ -122,6 +122,42 @@ BOOST_AUTO_TEST_CASE(dbwrapper_iterator)
     }
 }
 
+BOOST_AUTO_TEST_CASE(dbwrapper_tuning)
+{
+    CDBTuning tuning = GetDBTuning("chainstate", 8 << 20);
+    BOOST_CHECK_EQUAL(tuning.nBlockCacheSize, 4U << 20);
+    BOOST_CHECK_EQUAL(tuning.nWriteBufferSize, 2U << 20);
+
+    tuning = GetDBTuning("blockindex", 8 << 20);
+    BOOST_CHECK_EQUAL(tuning.nBlockCacheSize, 4U << 20);
+    BOOST_CHECK_EQUAL(tuning.nMaxFileSize, 32U << 20);
+
+    // Only named databases are listed, with their block cache lookups counted.
+    boost::filesystem::path ph = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    CDBWrapper unnamed(ph, (1 << 20), true, false, false);
+    BOOST_CHECK(GetDBStats().empty());
+    {
+        CDBWrapper dbw(ph, (1 << 20), true, false, false, "blockindex");
+        std::vector<CDBStats> vStats = GetDBStats();
+        BOOST_REQUIRE_EQUAL(vStats.size(), 1U);
+        BOOST_CHECK_EQUAL(vStats[0].strName, "blockindex");
+
+        char key = 'k';
+        uint256 in = GetRandHash();
+        uint256 res;
+        BOOST_CHECK(dbw.Write(key, in));
+        // move the entry from the memtable into a table, reads look up the block cache then
+        dbw.CompactFull();
+        BOOST_CHECK(dbw.Read(key, res));
+        BOOST_CHECK_EQUAL(res.ToString(), in.ToString());
+
+        // blocks served straight from memory, like the memory env does, are not cached
+        CDBStats stats = dbw.GetStats();
+        BOOST_CHECK(stats.nCacheHits + stats.nCacheMisses > 0);
+    }
+    BOOST_CHECK(GetDBStats().empty());
+}
+
 // Test that we do not obfuscation if there is existing data.
 BOOST_AUTO_TEST_CASE(existing_data_no_obfuscate)
 {
@@ -0,0 +1,152 @@
+// Copyright (c) 2020 The Firo Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "chainparams.h"
+#include "consensus/validation.h"
+#include "lelantus.h"
+#include "validation.h"
+#include "wallet/wallet.h"
+
+#include "test/fixtures.h"
+#include "test/test_bitcoin.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace lelantus;
+
+namespace {
+
+//! Joinsplit with a valid proof over coins which were never minted
+CMutableTransaction BuildJoinSplit(lelantus::Params const *params, size_t inputs, uint32_t groupId, uint256 const &blockHash)
+{
+    std::vector<std::pair<PrivateCoin, uint32_t>> coins;
+    std::map<uint32_t, std::vector<PublicCoin>> anons;
+    for (size_t i = 0; i != inputs; i++) {
+        PrivateCoin coin(params, 0);
+        coins.emplace_back(coin, groupId);
+        anons[groupId].push_back(coin.getPublicCoin());
+    }
+
+    JoinSplit joinSplit(params, coins, anons, Scalar(uint64_t(0)), {PrivateCoin(params, 0)}, 0, {{groupId, blockHash}}, uint256());
+    joinSplit.setVersion(LELANTUS_TX_VERSION_4);
+
+    CDataStream ss(SER_NETWORK, PROTOCOL_VERSION);
+    ss << joinSplit;
+
+    CMutableTransaction tx;
+    tx.vin.resize(1);
+    tx.vin[0].scriptSig << OP_LELANTUSJOINSPLIT;
+    tx.vin[0].scriptSig.insert(tx.vin[0].scriptSig.end(), ss.begin(), ss.end());
+    return tx;
+}
+
+//! Rejected by the prefilter, and so by the mempool before the proof is looked at
+void CheckRejected(CMutableTransaction const &tx, unsigned int code, std::string const &reason, int expectedDoS)
+{
+    LOCK(cs_main);
+    CValidationState headerState;
+    BOOST_CHECK(!CheckLelantusJoinSplitHeader(tx, headerState));
+    BOOST_CHECK_EQUAL(reason, headerState.GetRejectReason());
+
+    CValidationState state;
+    BOOST_CHECK(!AcceptToMemoryPool(mempool, state, MakeTransactionRef(tx), false, nullptr, nullptr, true));
+    int nDoS = -1;
+    BOOST_CHECK(state.IsInvalid(nDoS));
+    BOOST_CHECK_EQUAL(code, state.GetRejectCode());
+    BOOST_CHECK_EQUAL(reason, state.GetRejectReason());
+    BOOST_CHECK_EQUAL(expectedDoS, nDoS);
+}
+
+bool PassesPrefilter(CMutableTransaction const &tx)
+{
+    LOCK(cs_main);
+    CValidationState state;
+    bool result = CheckLelantusJoinSplitHeader(tx, state);
+    BOOST_CHECK(state.IsValid());
+    return result;
+}
+
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(lelantus_mempool_tests, LelantusTestingSetup)
+
+BOOST_AUTO_TEST_CASE(joinsplit_header_prefilter)
+{
+    auto &consensus = const_cast<Consensus::Params &>(::Params().GetConsensus());
+    CLelantusState *lelantusState = CLelantusState::GetState();
+
+    GenerateBlocks(1000);
+
+    std::vector<CMutableTransaction> txs;
+    GenerateMints({10 * CENT, 11 * CENT}, txs);
+    GenerateBlock(txs);
+    GenerateBlocks(10);
+
+    CLelantusState::LelantusCoinGroupInfo group;
+    BOOST_REQUIRE(lelantusState->GetCoinGroupInfo(1, group));
+    uint256 groupBlockHash = group.lastBlock->GetBlockHash();
+
+    // a joinsplit of both coins, not committed to the wallet
+    std::vector<CLelantusEntry> spendCoins;
+    std::vector<CHDMint> mintCoins;
+    CAmount fee;
+    CWalletTx wtx = pwalletMain->CreateLelantusJoinSplitTransaction({{script, 15 * CENT, false}}, fee, {}, spendCoins, mintCoins);
+    CMutableTransaction tx(*wtx.tx);
+    BOOST_REQUIRE_EQUAL(2, spendCoins.size());
+
+    auto serials = GetLelantusJoinSplitSerialNumbers(tx, tx.vin[0]);
+    BOOST_REQUIRE_EQUAL(2, serials.size());
+
+    // headers which can't be parsed are left to the full check
+    CMutableTransaction malformed(tx);
+    malformed.vin[0].scriptSig = CScript() << OP_LELANTUSJOINSPLIT;
+    BOOST_CHECK(PassesPrefilter(malformed));
+    malformed.vin[0].scriptSig = CScript(tx.vin[0].scriptSig.begin(), tx.vin[0].scriptSig.begin() + 20);
+    BOOST_CHECK(PassesPrefilter(malformed));
+
+    // more inputs than a transaction may have
+    {
+        auto nMaxInputs = consensus.nMaxLelantusInputPerTransaction;
+        consensus.nMaxLelantusInputPerTransaction = 1;
+        CheckRejected(tx, REJECT_INVALID, "bad-txns-spend-invalid", 100);
+        consensus.nMaxLelantusInputPerTransaction = nMaxInputs;
+    }
+
+    // within the limit the joinsplit gets into the mempool
+    BOOST_CHECK(PassesPrefilter(tx));
+    {
+        LOCK(cs_main);
+        CValidationState state;
+        BOOST_CHECK(AcceptToMemoryPool(mempool, state, MakeTransactionRef(tx), false, nullptr, nullptr, true));
+    }
+    BOOST_CHECK(mempool.exists(tx.GetHash()));
+
+    // a replay spends the serials again
+    CMutableTransaction replayTx(tx);
+    replayTx.vout[0].nValue -= 1;
+    CheckRejected(replayTx, REJECT_CONFLICT, "txn-mempool-conflict", 0);
+
+    // and into a block
+    auto index = GenerateBlock({tx});
+    BOOST_REQUIRE(index);
+    BOOST_CHECK(index == chainActive.Tip());
+    BOOST_CHECK_EQUAL(2, index->lelantusSpentSerials.size());
+    BOOST_CHECK(!mempool.exists(tx.GetHash()));
+    for (auto const &serial : serials)
+        BOOST_CHECK(lelantusState->IsUsedCoinSerial(serial));
+
+    CheckRejected(replayTx, REJECT_CONFLICT, "txn-mempool-conflict", 0);
+
+    // a group which doesn't exist
+    CheckRejected(BuildJoinSplit(params, 1, 2, groupBlockHash), NO_MINT_ZEROCOIN,
+        "CheckLelantusJoinSplitHeader: Error: no coins were minted with such parameters", 100);
+
+    // an anonymity set ending at a block which is unknown, or not a block of the group, is
+    // verified against the group up to its first block like consensus does
+    BOOST_CHECK(PassesPrefilter(BuildJoinSplit(params, 1, 1, groupBlockHash)));
+    BOOST_CHECK(PassesPrefilter(BuildJoinSplit(params, 1, 1, GetRandHash())));
+    BOOST_CHECK(PassesPrefilter(BuildJoinSplit(params, 1, 1, chainActive.Genesis()->GetBlockHash())));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,410 @@
+// Copyright (c) 2020 The Firo Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "chain.h"
+#include "lelantus.h"
+#include "streams.h"
+#include "util.h"
+#include "validation.h"
+
+#include "test/fixtures.h"
+#include "test/test_bitcoin.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+using namespace lelantus;
+
+namespace {
+
+std::pair<PublicCoin, uint256> RandomMint()
+{
+    GroupElement value;
+    value.randomize();
+    return {PublicCoin(value), GetRandHash()};
+}
+
+//! Keeps a chain of block index entries outside of the global block index
+struct LelantusSnapshotTestingSetup : public TestingSetup {
+    std::vector<std::unique_ptr<CBlockIndex>> blocks;
+    std::deque<uint256> hashes;
+
+    CBlockIndex* NewBlock()
+    {
+        CBlockIndex *prev = blocks.empty() ? nullptr : blocks.back().get();
+        blocks.emplace_back(new CBlockIndex());
+        hashes.push_back(GetRandHash());
+
+        CBlockIndex *index = blocks.back().get();
+        index->pprev = prev;
+        index->nHeight = prev ? prev->nHeight + 1 : 0;
+        index->phashBlock = &hashes.back();
+        return index;
+    }
+
+    //! Block spending the given serials
+    CBlockIndex* NewSpendBlock(std::vector<Scalar> const &serials, int groupId)
+    {
+        CBlockIndex *index = NewBlock();
+        for (auto const &serial : serials)
+            index->lelantusSpentSerials.insert({serial, groupId});
+        return index;
+    }
+
+    //! Connects a block with new mints the way ConnectBlockLelantus does
+    CBlockIndex* NewMintBlock(CLelantusState &state, size_t mints)
+    {
+        CBlock block;
+        block.lelantusTxInfo = std::make_shared<CLelantusTxInfo>();
+        for (size_t i = 0; i < mints; i++) {
+            auto mint = RandomMint();
+            block.lelantusTxInfo->mints.emplace_back(mint.first, std::make_pair(COIN, mint.second));
+        }
+
+        CBlockIndex *index = NewBlock();
+        state.AddMintsToStateAndBlockIndex(index, &block);
+        state.UpdateSnapshot(index, true);
+        return index;
+    }
+};
+
+//! The snapshot answers the coin set queries the same as the state
+void CheckCoinSets(CLelantusState &state, CLelantusStateSnapshot const &snapshot, std::vector<CBlockIndex*> const &mintBlocks)
+{
+    BOOST_CHECK_EQUAL(state.GetLatestCoinID(), snapshot.GetLatestCoinID());
+    BOOST_CHECK_EQUAL(state.GetTotalCoins(), snapshot.GetTotalCoins());
+
+    for (int id = 1; id <= state.GetLatestCoinID() + 1; id++) {
+        for (auto maxBlock : mintBlocks) {
+            for (int startHeight : {-1, mintBlocks.front()->nHeight, mintBlocks[mintBlocks.size() / 2]->nHeight}) {
+                uint256 expectedHash, hash;
+                std::vector<PublicCoin> expectedCoins, coins;
+                std::vector<uint256> expectedTags, tags;
+
+                BOOST_CHECK_EQUAL(
+                    state.GetCoinSetForSpend(&chainActive, maxBlock->nHeight, id, expectedHash, expectedCoins, startHeight, &expectedTags),
+                    snapshot.GetCoinSetForSpend(maxBlock->nHeight, id, hash, coins, startHeight, &tags));
+                BOOST_CHECK(expectedHash == hash);
+                BOOST_CHECK(expectedCoins == coins);
+                BOOST_CHECK(expectedTags == tags);
+            }
+        }
+    }
+
+    for (auto block : mintBlocks) {
+        for (auto const &group : block->lelantusMintedPubCoins) {
+            for (auto const &coin : group.second) {
+                BOOST_CHECK(state.GetMintedCoinHeightAndId(coin.first) == snapshot.GetMintedCoinHeightAndId(coin.first));
+            }
+        }
+    }
+}
+
+std::vector<Scalar> RandomSerials(size_t n)
+{
+    std::vector<Scalar> serials(n);
+    for (auto &serial : serials)
+        serial.randomize();
+    return serials;
+}
+
+std::string ReadFile(boost::filesystem::path const &path)
+{
+    std::ifstream file(path.string(), std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+void WriteFile(boost::filesystem::path const &path, std::string const &data)
+{
+    std::ofstream file(path.string(), std::ios::binary | std::ios::trunc);
+    file.write(data.data(), data.size());
+}
+
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(lelantus_snapshot_tests, LelantusSnapshotTestingSetup)
+
+BOOST_AUTO_TEST_CASE(snapshot_follows_state)
+{
+    // groups of 6 coins, a new group takes over the last 2 coins of the previous one
+    CLelantusState state(6, 2);
+
+    auto empty = state.GetSnapshot();
+    BOOST_CHECK_EQUAL(-1, empty->GetHeight());
+    BOOST_CHECK_EQUAL(0, empty->GetTotalCoins());
+
+    NewBlock();
+
+    std::vector<CBlockIndex*> mintBlocks;
+    for (int i = 0; i < 6; i++) {
+        mintBlocks.push_back(NewMintBlock(state, 2));
+
+        auto snapshot = state.GetSnapshot();
+        BOOST_CHECK_EQUAL(mintBlocks.back()->nHeight, snapshot->GetHeight());
+        BOOST_CHECK(mintBlocks.back()->GetBlockHash() == snapshot->GetBlockHash());
+        CheckCoinSets(state, *snapshot, mintBlocks);
+    }
+
+    Scalar serial;
+    serial.randomize();
+
+    auto spendBlock = NewBlock();
+    spendBlock->lelantusSpentSerials.insert({serial, 2});
+    state.AddBlock(spendBlock);
+
+    auto beforeRemoval = state.GetSnapshot();
+    BOOST_CHECK_EQUAL(spendBlock->nHeight, beforeRemoval->GetHeight());
+    BOOST_CHECK(beforeRemoval->IsUsedCoinSerial(serial));
+    BOOST_CHECK_EQUAL(3, beforeRemoval->GetLatestCoinID());
+    BOOST_CHECK_EQUAL(12, beforeRemoval->GetTotalCoins());
+
+    auto removedCoin = mintBlocks.back()->lelantusMintedPubCoins.Get(3)[0].first;
+    BOOST_CHECK(beforeRemoval->HasCoin(removedCoin));
+
+    // a snapshot taken before blocks were disconnected stays as it was
+    state.RemoveBlock(spendBlock);
+    state.RemoveBlock(mintBlocks.back());
+    mintBlocks.pop_back();
+
+    auto afterRemoval = state.GetSnapshot();
+    BOOST_CHECK(afterRemoval->GetVersion() > beforeRemoval->GetVersion());
+    BOOST_CHECK_EQUAL(mintBlocks.back()->nHeight, afterRemoval->GetHeight());
+    BOOST_CHECK(mintBlocks.back()->GetBlockHash() == afterRemoval->GetBlockHash());
+    BOOST_CHECK(!afterRemoval->IsUsedCoinSerial(serial));
+    BOOST_CHECK(!afterRemoval->HasCoin(removedCoin));
+    BOOST_CHECK_EQUAL(2, afterRemoval->GetLatestCoinID());
+    CheckCoinSets(state, *afterRemoval, mintBlocks);
+
+    CLelantusStateSnapshot::CoinGroupInfo group;
+    BOOST_CHECK(!afterRemoval->GetCoinGroupInfo(3, group));
+    BOOST_CHECK(beforeRemoval->GetCoinGroupInfo(3, group));
+    BOOST_CHECK_EQUAL(4, group.nCoins);
+
+    BOOST_CHECK(beforeRemoval->IsUsedCoinSerial(serial));
+    BOOST_CHECK(beforeRemoval->HasCoin(removedCoin));
+    BOOST_CHECK_EQUAL(3, beforeRemoval->GetLatestCoinID());
+    BOOST_CHECK_EQUAL(12, beforeRemoval->GetTotalCoins());
+
+    state.Reset();
+    BOOST_CHECK_EQUAL(0, state.GetSnapshot()->GetTotalCoins());
+    BOOST_CHECK_EQUAL(10, afterRemoval->GetTotalCoins());
+}
+
+BOOST_AUTO_TEST_CASE(load_snapshot)
+{
+    CLelantusState state(6, 2);
+
+    NewBlock();
+
+    // group 1 is blocks 1-3, group 2 takes over the 2 coins of block 3 and has blocks 4-5
+    std::vector<CBlockIndex*> mintBlocks;
+    for (int i = 0; i < 5; i++)
+        mintBlocks.push_back(NewMintBlock(state, 2));
+
+    // 5 spends of group 2 are less than its 6 coins only if the 2 taken over are counted
+    auto spendBlock = NewSpendBlock(RandomSerials(5), 2);
+    state.AddBlock(spendBlock);
+    BOOST_CHECK(!state.IsSurgeConditionDetected());
+
+    CDataStream stream(SER_DISK, CLIENT_VERSION);
+    stream << *state.GetSnapshot();
+
+    CLelantusStateSnapshot checkpoint;
+    stream >> checkpoint;
+    BOOST_CHECK(stream.empty());
+    BOOST_CHECK_EQUAL(spendBlock->nHeight, checkpoint.GetHeight());
+    BOOST_CHECK(spendBlock->GetBlockHash() == checkpoint.GetBlockHash());
+
+    CChain chain;
+    chain.SetTip(spendBlock);
+
+    CLelantusState loaded(6, 2);
+    BOOST_CHECK(loaded.LoadSnapshot(checkpoint, &chain));
+    BOOST_CHECK_EQUAL(spendBlock->nHeight, loaded.GetSnapshot()->GetHeight());
+    BOOST_CHECK(!loaded.IsSurgeConditionDetected());
+
+    auto checkSame = [&] {
+        BOOST_CHECK_EQUAL(state.GetLatestCoinID(), loaded.GetLatestCoinID());
+        BOOST_CHECK_EQUAL(state.GetTotalCoins(), loaded.GetTotalCoins());
+        BOOST_CHECK_EQUAL(state.IsSurgeConditionDetected(), loaded.IsSurgeConditionDetected());
+
+        for (int id = 1; id <= state.GetLatestCoinID(); id++) {
+            CLelantusState::LelantusCoinGroupInfo expectedGroup, group;
+            BOOST_CHECK(state.GetCoinGroupInfo(id, expectedGroup));
+            BOOST_CHECK(loaded.GetCoinGroupInfo(id, group));
+            BOOST_CHECK_EQUAL(expectedGroup.nCoins, group.nCoins);
+            BOOST_CHECK_EQUAL(expectedGroup.firstBlock, group.firstBlock);
+            BOOST_CHECK_EQUAL(expectedGroup.lastBlock, group.lastBlock);
+
+            for (auto maxBlock : mintBlocks) {
+                uint256 expectedHash, hash;
+                std::vector<PublicCoin> expectedCoins, coins;
+                std::vector<uint256> expectedTags, tags;
+                BOOST_CHECK_EQUAL(
+                    state.GetCoinSetForSpend(&chain, maxBlock->nHeight, id, expectedHash, expectedCoins, -1, &expectedTags),
+                    loaded.GetCoinSetForSpend(&chain, maxBlock->nHeight, id, hash, coins, -1, &tags));
+                BOOST_CHECK(expectedHash == hash);
+                BOOST_CHECK(expectedCoins == coins);
+                BOOST_CHECK(expectedTags == tags);
+            }
+        }
+
+        for (auto block : mintBlocks) {
+            for (auto const &group : block->lelantusMintedPubCoins) {
+                for (auto const &coin : group.second)
+                    BOOST_CHECK(state.GetMintedCoinHeightAndId(coin.first) == loaded.GetMintedCoinHeightAndId(coin.first));
+            }
+        }
+
+        for (auto const &serial : spendBlock->lelantusSpentSerials)
+            BOOST_CHECK(loaded.IsUsedCoinSerial(serial.first));
+    };
+    checkSame();
+
+    // the states go on the same from the checkpoint
+    mintBlocks.push_back(NewMintBlock(state, 2));
+    loaded.AddBlock(mintBlocks.back());
+    chain.SetTip(mintBlocks.back());
+    BOOST_CHECK_EQUAL(3, loaded.GetLatestCoinID());
+    checkSame();
+
+    auto surgeBlock = NewSpendBlock(RandomSerials(2), 2);
+    state.AddBlock(surgeBlock);
+    loaded.AddBlock(surgeBlock);
+    BOOST_CHECK(state.IsSurgeConditionDetected());
+    BOOST_CHECK(loaded.IsSurgeConditionDetected());
+    checkSame();
+
+    // checkpoint of a block that isn't in the chain
+    uint256 checkpointHash = hashes[spendBlock->nHeight];
+    hashes[spendBlock->nHeight] = GetRandHash();
+
+    CLelantusState stale(6, 2);
+    BOOST_CHECK(!stale.LoadSnapshot(checkpoint, &chain));
+    BOOST_CHECK_EQUAL(0, stale.GetTotalCoins());
+    BOOST_CHECK_EQUAL(0, stale.GetLatestCoinID());
+    BOOST_CHECK_EQUAL(-1, stale.GetSnapshot()->GetHeight());
+
+    hashes[spendBlock->nHeight] = checkpointHash;
+
+    // nor is one above the tip
+    chain.SetTip(spendBlock->pprev);
+    BOOST_CHECK(!stale.LoadSnapshot(checkpoint, &chain));
+    BOOST_CHECK_EQUAL(0, stale.GetTotalCoins());
+}
+
+BOOST_AUTO_TEST_CASE(checkpoint_file)
+{
+    CLelantusState *lelantusState = CLelantusState::GetState();
+    lelantusState->Reset();
+
+    CChain chain;
+    chain.SetTip(NewBlock());
+
+    std::vector<CBlockIndex*> mintBlocks;
+    for (int i = 0; i < 3; i++)
+        mintBlocks.push_back(NewMintBlock(*lelantusState, 2));
+
+    DumpLelantusState();
+    auto path = GetDataDir() / "lelantusstate.dat";
+    BOOST_REQUIRE(boost::filesystem::exists(path));
+    auto dump = ReadFile(path);
+
+    mintBlocks.push_back(NewMintBlock(*lelantusState, 2));
+    chain.SetTip(mintBlocks.back());
+
+    // a coin only replaying the index finds, the checkpoint was written before it was there
+    auto hidden = RandomMint();
+    mintBlocks[1]->lelantusMintedPubCoins.Add(1, hidden);
+
+    auto rebuild = [&] {
+        lelantusState->Reset();
+        BuildLelantusStateFromIndex(&chain);
+
+        BOOST_CHECK_EQUAL(mintBlocks.back()->nHeight, lelantusState->GetSnapshot()->GetHeight());
+        BOOST_CHECK_EQUAL(2, lelantusState->GetLatestCoinID());
+        for (auto block : mintBlocks) {
+            for (auto const &coin : block->lelantusMintedPubCoins.Get(block == mintBlocks.back() ? 2 : 1)) {
+                if (!(coin.first == hidden.first))
+                    BOOST_CHECK(lelantusState->HasCoin(coin.first));
+            }
+        }
+        return !lelantusState->HasCoin(hidden.first);
+    };
+
+    BOOST_CHECK(rebuild());
+    BOOST_CHECK_EQUAL(8, lelantusState->GetTotalCoins());
+
+    // the checkpoint block was replaced by a reorg
+    uint256 checkpointHash = hashes[mintBlocks[2]->nHeight];
+    hashes[mintBlocks[2]->nHeight] = GetRandHash();
+    BOOST_CHECK(!rebuild());
+    BOOST_CHECK_EQUAL(9, lelantusState->GetTotalCoins());
+    hashes[mintBlocks[2]->nHeight] = checkpointHash;
+
+    WriteFile(path, dump.substr(0, dump.size() / 2));
+    BOOST_CHECK(!rebuild());
+
+    // the checksum at the end of the file doesn't match
+    std::string corrupted = dump;
+    corrupted.back() ^= 1;
+    WriteFile(path, corrupted);
+    BOOST_CHECK(!rebuild());
+
+    WriteFile(path, dump);
+    BOOST_CHECK(rebuild());
+
+    boost::filesystem::remove(path);
+    BOOST_CHECK(!rebuild());
+
+    lelantusState->Reset();
+}
+
+BOOST_FIXTURE_TEST_CASE(snapshot_of_connected_blocks, LelantusTestingSetup)
+{
+    CLelantusState *lelantusState = CLelantusState::GetState();
+
+    GenerateBlocks(1000);
+
+    std::vector<CMutableTransaction> txs;
+    auto mints = GenerateMints({COIN, 2 * COIN}, txs);
+    auto index = GenerateBlock(txs);
+    BOOST_REQUIRE(index);
+
+    auto snapshot = lelantusState->GetSnapshot();
+    BOOST_CHECK_EQUAL(index->nHeight, snapshot->GetHeight());
+    BOOST_CHECK(index->GetBlockHash() == snapshot->GetBlockHash());
+    BOOST_CHECK_EQUAL(1, snapshot->GetLatestCoinID());
+    BOOST_CHECK_EQUAL(2, snapshot->GetTotalCoins());
+    for (auto const &mint : mints) {
+        BOOST_CHECK(snapshot->GetMintedCoinHeightAndId(mint.GetPubcoinValue()) == std::make_pair(index->nHeight, 1));
+    }
+
+    {
+        LOCK(cs_main);
+        CValidationState state;
+        BOOST_CHECK(InvalidateBlock(state, ::Params(), index));
+    }
+
+    // the disconnected block is gone from the new snapshot only
+    auto afterDisconnect = lelantusState->GetSnapshot();
+    BOOST_CHECK_EQUAL(index->nHeight - 1, afterDisconnect->GetHeight());
+    BOOST_CHECK_EQUAL(0, afterDisconnect->GetLatestCoinID());
+    BOOST_CHECK_EQUAL(0, afterDisconnect->GetTotalCoins());
+    BOOST_CHECK(!afterDisconnect->HasCoin(mints[0].GetPubcoinValue()));
+
+    BOOST_CHECK_EQUAL(index->nHeight, snapshot->GetHeight());
+    BOOST_CHECK_EQUAL(2, snapshot->GetTotalCoins());
+    BOOST_CHECK(snapshot->HasCoin(mints[0].GetPubcoinValue()));
+
+    lelantusState->Reset();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -86,7 +86,7 @@ public:
                 Scalar serial;
                 serial.randomize();
 
-                index->lelantusSpentSerials[serial] = s.first;
+                index->lelantusSpentSerials.insert({serial, s.first});
             }
         }
 
@@ -287,7 +287,8 @@ BOOST_AUTO_TEST_CASE(add_remove_block)
     auto index3 = GenerateBlock({});
     auto block3 = GetCBlock(index3);
     PopulateLelantusTxInfo(block3, {}, {{serial1, 1}, {serial2, 1}});
-    index3->lelantusSpentSerials = block3.lelantusTxInfo->spentSerials;
+    for (auto const &serial : block3.lelantusTxInfo->spentSerials)
+        index3->lelantusSpentSerials.insert(serial);
 
     lelantusState->AddBlock(index3);
 
@@ -305,7 +306,8 @@ BOOST_AUTO_TEST_CASE(add_remove_block)
     auto block4 = GetCBlock(index4);
     PopulateLelantusTxInfo(block4, {{mint3, 1}}, {{serial3, 1}});
     lelantusState->AddMintsToStateAndBlockIndex(index4, &block4);
-    index4->lelantusSpentSerials = block4.lelantusTxInfo->spentSerials;
+    for (auto const &serial : block4.lelantusTxInfo->spentSerials)
+        index4->lelantusSpentSerials.insert(serial);
 
     lelantusState->AddBlock(index4);
 
@@ -490,6 +492,33 @@ BOOST_AUTO_TEST_CASE(get_coin_group)
     verifyMints(0, 2, coinOut6);
     BOOST_CHECK(indexes[0]->GetBlockHash() == blockHashOut6);
 
+    // Get only the coins of the first group minted after its first block
+    uint256 blockHashOut7;
+    std::vector<PublicCoin> coinOut7;
+    std::vector<uint256> tagsOut7;
+    BOOST_CHECK_EQUAL(4, lelantusState->GetCoinSetForSpend(
+        &chainActive,
+        indexes[5]->nHeight,
+        1,
+        blockHashOut7,
+        coinOut7,
+        indexes[0]->nHeight,
+        &tagsOut7));
+
+    verifyMints(2, 6, coinOut7);
+    BOOST_CHECK_EQUAL(4, tagsOut7.size());
+    BOOST_CHECK(indexes[2]->GetBlockHash() == blockHashOut7);
+
+    // Nothing was minted after the last block of the group
+    BOOST_CHECK_EQUAL(0, lelantusState->GetCoinSetForSpend(
+        &chainActive,
+        indexes[5]->nHeight,
+        1,
+        blockHashOut7,
+        coinOut7,
+        indexes[2]->nHeight));
+    BOOST_CHECK(coinOut7.empty());
+
     lelantusState->RemoveBlock(indexes[5]);
     verifyGroup(2, 6, indexes[2], indexes[4]);
     verifyGroup(1, 6, indexes[0], indexes[2], 1);
@@ -0,0 +1,156 @@
+// Copyright (c) 2020 The Firo Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "../lelantus.h"
+
+#include "test_bitcoin.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace {
+
+// Surge detection as done before the scan states were cached, rescanning all the groups
+class FullRecompute {
+public:
+    void AddMint(int group) { mintMetaInfo[group] += 1; }
+    void RemoveMint(int group) { mintMetaInfo[group] -= 1; }
+    void AddSpend(int group) { spendMetaInfo[group] += 1; }
+    void RemoveSpend(int group) { spendMetaInfo[group] -= 1; }
+    void AddExtendedMints(int group, size_t mints) { extendedMintMetaInfo[group] = mints; }
+    void RemoveExtendedMints(int group) { extendedMintMetaInfo.erase(group); }
+
+    bool IsSurgeCondition(std::pair<int, int> &range) {
+        size_t serials = 0;
+        size_t mints = 0;
+        int start = 0;
+
+        for (auto it = mintMetaInfo.begin(); it != mintMetaInfo.end(); it++) {
+            auto id = it->first;
+
+            serials += spendMetaInfo.count(id) ? spendMetaInfo[id] : 0;
+            mints += it->second;
+
+            if (serials > mints) {
+                range = std::make_pair(start, id);
+                return true;
+            }
+
+            auto extendedMints = extendedMintMetaInfo.count(id + 1) ?
+                extendedMintMetaInfo[id + 1] : 0;
+
+            if (serials <= mints - extendedMints) {
+                start = id + 1;
+                serials = 0;
+                mints = extendedMints;
+            }
+        }
+
+        return false;
+    }
+
+    std::map<int, size_t> extendedMintMetaInfo, mintMetaInfo, spendMetaInfo;
+};
+
+size_t Count(std::map<int, size_t> const &metaInfo, int group) {
+    auto it = metaInfo.find(group);
+    return it != metaInfo.end() ? it->second : 0;
+}
+
+void CheckSame(lelantus::CSurgeConditionTracker const &tracker, FullRecompute &expected) {
+    std::pair<int, int> range;
+    bool surge = expected.IsSurgeCondition(range);
+
+    BOOST_CHECK_EQUAL(surge, tracker.IsSurgeCondition());
+    if (surge && tracker.IsSurgeCondition()) {
+        BOOST_CHECK_EQUAL(range.first, tracker.GetSurgeRange().first);
+        BOOST_CHECK_EQUAL(range.second, tracker.GetSurgeRange().second);
+    }
+}
+
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(lelantus_surge_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(surge_in_group_range)
+{
+    lelantus::CSurgeConditionTracker tracker;
+
+    // group 1: 4 mints, group 2 takes over 2 of them and gets 1 more
+    for (int i = 0; i < 4; i++)
+        tracker.AddMint(1);
+    tracker.AddExtendedMints(2, 2);
+    tracker.AddMint(2);
+
+    for (int i = 0; i < 4; i++)
+        tracker.AddSpend(1);
+    BOOST_CHECK(!tracker.IsSurgeCondition());
+
+    // the range covers group 1 and 2 as the extended mints are counted in both
+    tracker.AddSpend(2);
+    BOOST_CHECK(!tracker.IsSurgeCondition());
+    tracker.AddSpend(2);
+    BOOST_CHECK(tracker.IsSurgeCondition());
+    BOOST_CHECK(tracker.GetSurgeRange() == std::make_pair(0, 2));
+
+    // group 1 has no more spends than its own coins left, the range restarts after it
+    tracker.RemoveSpend(1);
+    tracker.RemoveSpend(1);
+    BOOST_CHECK(!tracker.IsSurgeCondition());
+
+    tracker.AddSpend(2);
+    tracker.AddSpend(2);
+    BOOST_CHECK(tracker.IsSurgeCondition());
+    BOOST_CHECK(tracker.GetSurgeRange() == std::make_pair(2, 2));
+
+    BOOST_CHECK(tracker.HasMints(2));
+    BOOST_CHECK(!tracker.HasMints(3));
+
+    tracker.Reset();
+    BOOST_CHECK(!tracker.IsSurgeCondition());
+    BOOST_CHECK(!tracker.HasMints(1));
+}
+
+BOOST_AUTO_TEST_CASE(same_as_full_recompute)
+{
+    lelantus::CSurgeConditionTracker tracker;
+    FullRecompute expected;
+
+    FastRandomContext rng(true);
+    int latestGroup = 1;
+
+    // few groups so spends in every group come and go, switching the condition on and off
+    for (int i = 0; i < 20000; i++) {
+        int group = 1 + rng.randrange(latestGroup);
+        uint32_t op = rng.randrange(100);
+
+        if (op < 30) {
+            tracker.AddMint(group);
+            expected.AddMint(group);
+        } else if (op < 40 && Count(expected.mintMetaInfo, group) > 0) {
+            tracker.RemoveMint(group);
+            expected.RemoveMint(group);
+        } else if (op < 70 && expected.mintMetaInfo.count(group)) {
+            tracker.AddSpend(group);
+            expected.AddSpend(group);
+        } else if (op < 95 && Count(expected.spendMetaInfo, group) > 0) {
+            tracker.RemoveSpend(group);
+            expected.RemoveSpend(group);
+        } else if (op < 99) {
+            // a new group takes over some coins of the previous one
+            if (latestGroup < 8)
+                latestGroup++;
+            group = std::max(2, group);
+            size_t mints = rng.randrange(Count(expected.mintMetaInfo, group - 1) + 1);
+            tracker.AddExtendedMints(group, mints);
+            expected.AddExtendedMints(group, mints);
+        } else {
+            tracker.RemoveExtendedMints(group);
+            expected.RemoveExtendedMints(group);
+        }
+
+        CheckSame(tracker, expected);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -2,16 +2,48 @@
 // Distributed under the MIT software license, see the accompanying
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
+#include "chain.h"
+#include "lelantus.h"
+#include "liblelantus/joinsplit.h"
+#include "memusage.h"
 #include "policy/policy.h"
 #include "txmempool.h"
 #include "util.h"
+#include "validation.h"
 
 #include "test/test_bitcoin.h"
 
 #include <boost/test/unit_test.hpp>
+#include <algorithm>
 #include <list>
 #include <vector>
 
+// A joinsplit spending the coins out of an anonymity set of the group ending at the block,
+// the mempool only reads the fields following the proof
+static CMutableTransaction BuildJoinSplit(const std::vector<lelantus::PrivateCoin>& coins, uint32_t groupId, const uint256& blockHash, CAmount nValue)
+{
+    auto params = lelantus::Params::get_default();
+
+    std::vector<std::pair<lelantus::PrivateCoin, uint32_t>> cin;
+    std::map<uint32_t, std::vector<lelantus::PublicCoin>> anonymitySets;
+    for (const auto& coin : coins) {
+        cin.emplace_back(coin, groupId);
+        anonymitySets[groupId].push_back(coin.getPublicCoin());
+    }
+
+    lelantus::JoinSplit joinSplit(params, cin, anonymitySets, Scalar(uint64_t(0)), {lelantus::PrivateCoin(params, 0)}, 0, {{groupId, blockHash}}, uint256());
+
+    CDataStream serialized(SER_NETWORK, PROTOCOL_VERSION);
+    serialized << joinSplit;
+
+    CMutableTransaction tx;
+    tx.vin.resize(1);
+    tx.vin[0].scriptSig << OP_LELANTUSJOINSPLIT;
+    tx.vin[0].scriptSig.insert(tx.vin[0].scriptSig.end(), serialized.begin(), serialized.end());
+    tx.vout.emplace_back(nValue, CScript() << OP_TRUE);
+    return tx;
+}
+
 BOOST_FIXTURE_TEST_SUITE(mempool_tests, TestingSetup)
 
 BOOST_AUTO_TEST_CASE(MempoolRemoveTest)
@@ -584,4 +616,84 @@ BOOST_AUTO_TEST_CASE(MempoolSizeLimitTest)
     SetMockTime(0);
 }
 
+BOOST_AUTO_TEST_CASE(MempoolPrivacySpendIndexTest)
+{
+    auto params = lelantus::Params::get_default();
+    std::vector<lelantus::PrivateCoin> coins;
+    for (int i = 0; i < 4; i++)
+        coins.emplace_back(params, 0);
+
+    uint256 blockA = ArithToUint256(1), blockB = ArithToUint256(2);
+
+    // stem transactions aren't checked against each other, so two of them can spend a serial
+    CMutableTransaction tx1 = BuildJoinSplit({coins[0], coins[1]}, 1, blockA, 1 * COIN);
+    CMutableTransaction tx2 = BuildJoinSplit({coins[1]}, 1, blockB, 2 * COIN);
+    CMutableTransaction tx3 = BuildJoinSplit({coins[2]}, 1, blockA, 3 * COIN);
+    CMutableTransaction tx4 = BuildJoinSplit({coins[3]}, 2, blockB, 4 * COIN);
+
+    TestMemPoolEntryHelper entry;
+
+    // the entries account for the values the serials allocate
+    CTxMemPoolEntry entry1 = entry.FromTx(tx1);
+    BOOST_CHECK_EQUAL(entry1.GetPrivacySpend().serials.size(), 2U);
+    BOOST_CHECK(entry1.DynamicMemoryUsage() >= memusage::DynamicUsage(entry1.GetPrivacySpend().serials) +
+                                               2 * memusage::MallocUsage(Scalar::memoryRequired()));
+
+    CTxMemPool pool(CFeeRate(0));
+    {
+        LOCK(pool.cs);
+        for (const CMutableTransaction& tx : {tx1, tx2, tx3, tx4})
+            pool.addUnchecked(tx.GetHash(), entry.FromTx(tx));
+    }
+
+    BOOST_CHECK(pool.getSerialSpenders(coins[0].getSerialNumber()) == std::vector<uint256>{tx1.GetHash()});
+    std::vector<uint256> spenders = pool.getSerialSpenders(coins[1].getSerialNumber());
+    BOOST_CHECK_EQUAL(spenders.size(), 2U);
+    BOOST_CHECK(std::count(spenders.begin(), spenders.end(), tx1.GetHash()) == 1);
+    BOOST_CHECK(std::count(spenders.begin(), spenders.end(), tx2.GetHash()) == 1);
+    BOOST_CHECK_EQUAL(pool.getJoinSplitsReferencingBlock(blockA).size(), 2U);
+    BOOST_CHECK_EQUAL(pool.getJoinSplitsReferencingBlock(blockB).size(), 2U);
+
+    // removing one spender of a serial leaves the other indexed
+    pool.removeRecursive(CTransaction(tx1));
+    BOOST_CHECK(pool.getSerialSpenders(coins[0].getSerialNumber()).empty());
+    BOOST_CHECK(pool.getSerialSpenders(coins[1].getSerialNumber()) == std::vector<uint256>{tx2.GetHash()});
+    BOOST_CHECK_EQUAL(pool.getJoinSplitsReferencingBlock(blockA).size(), 1U);
+
+    // the joinsplits referring to a disconnected block are removed with their serials
+    CBlockIndex index;
+    index.phashBlock = &blockB;
+    lelantus::RemoveLelantusJoinSplitReferencingBlock(pool, &index);
+    BOOST_CHECK_EQUAL(pool.size(), 1U);
+    BOOST_CHECK(pool.exists(tx3.GetHash()));
+    BOOST_CHECK(pool.getJoinSplitsReferencingBlock(blockB).empty());
+    BOOST_CHECK(pool.getSerialSpenders(coins[1].getSerialNumber()).empty());
+    BOOST_CHECK(pool.getSerialSpenders(coins[3].getSerialNumber()).empty());
+
+    // clearing the pool clears the indexes
+    pool.clear();
+    BOOST_CHECK(pool.getSerialSpenders(coins[2].getSerialNumber()).empty());
+    BOOST_CHECK(pool.getJoinSplitsReferencingBlock(blockA).empty());
+
+    // a block spending serials of several mempool transactions removes all of them but its own
+    CMutableTransaction blockTx = BuildJoinSplit({coins[0], coins[2], coins[3]}, 1, blockA, 5 * COIN);
+    {
+        LOCK(mempool.cs);
+        for (const CMutableTransaction& tx : {tx1, tx2, tx3, tx4, blockTx})
+            mempool.addUnchecked(tx.GetHash(), entry.FromTx(tx));
+    }
+
+    CBlock block;
+    block.vtx.push_back(MakeTransactionRef(blockTx));
+    RemoveConflictingPrivacyTransactionsFromMempool(block);
+
+    BOOST_CHECK_EQUAL(mempool.size(), 2U);
+    BOOST_CHECK(mempool.exists(tx2.GetHash()));
+    BOOST_CHECK(mempool.exists(blockTx.GetHash()));
+    BOOST_CHECK(mempool.getSerialSpenders(coins[1].getSerialNumber()) == std::vector<uint256>{tx2.GetHash()});
+    BOOST_CHECK(mempool.getSerialSpenders(coins[3].getSerialNumber()) == std::vector<uint256>{blockTx.GetHash()});
+
+    mempool.clear();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -294,4 +294,52 @@ BOOST_AUTO_TEST_CASE(remint_blacklist)
     BOOST_CHECK_MESSAGE(mempool.size() == 0, "Remint was added to the mempool despite blacklisted public coin value");
 }
 
+BOOST_AUTO_TEST_CASE(remint_rescan)
+{
+    string stringError;
+
+    pwalletMain->SetBroadcastTransactions(true);
+
+    BOOST_CHECK_MESSAGE(pwalletMain->CreateZerocoinMintModel(stringError, "1"), stringError + " - Create Mint failed");
+
+    // get to the sigma portion
+    for (int i=0; i<400; i++) {
+        CBlock b = CreateAndProcessBlock(scriptPubKey);
+    }
+
+    CWalletTx remintTx;
+    BOOST_CHECK_MESSAGE(pwalletMain->CreateZerocoinToSigmaRemintModel(stringError, ZEROCOIN_TX_VERSION_2, (libzerocoin::CoinDenomination)1, &remintTx), stringError + " - Remint failed");
+    BOOST_CHECK_MESSAGE(mempool.size() == 1, "Zerocoin remint was not added to mempool");
+
+    CreateAndProcessBlock(scriptPubKey);
+    BOOST_CHECK_MESSAGE(mempool.size() == 0, "Zerocoin remint was not mined");
+    CBlockIndex *remintBlockIndex = chainActive.Tip();
+
+    // forget the remint along with the sigma mints it created, so the rescan can
+    // only find it by the zerocoin serial it spends
+    CWalletDB walletdb(pwalletMain->strWalletFile);
+    for (const CHDMint& dMint : walletdb.ListHDMints(false)) {
+        if (dMint.GetTxHash() == remintTx.GetHash())
+            BOOST_CHECK(walletdb.EraseHDMint(dMint));
+    }
+
+    {
+        LOCK(pwalletMain->cs_wallet);
+        auto it = pwalletMain->mapWallet.find(remintTx.GetHash());
+        BOOST_REQUIRE(it != pwalletMain->mapWallet.end());
+        for (auto ordered = pwalletMain->wtxOrdered.begin(); ordered != pwalletMain->wtxOrdered.end(); ) {
+            if (ordered->second.first == &it->second)
+                ordered = pwalletMain->wtxOrdered.erase(ordered);
+            else
+                ++ordered;
+        }
+        pwalletMain->mapWallet.erase(it);
+        walletdb.EraseTx(remintTx.GetHash());
+    }
+    BOOST_CHECK(!pwalletMain->GetWalletTx(remintTx.GetHash()));
+
+    pwalletMain->ScanForWalletTransactions(remintBlockIndex, true);
+    BOOST_CHECK_MESSAGE(pwalletMain->GetWalletTx(remintTx.GetHash()), "Remint was not found by the rescan");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -4,6 +4,7 @@
 
 #include "rpc/server.h"
 #include "rpc/client.h"
+#include "rpc/jsonwriter.h"
 
 #include "base58.h"
 #include "netbase.h"
@@ -237,6 +238,52 @@ BOOST_AUTO_TEST_CASE(json_parse_errors)
     BOOST_CHECK_THROW(ParseNonRFCJSONValue("3J98t1WpEZ73CNmQviecrnyiWrnqRhWNL"), std::runtime_error);
 }
 
+BOOST_AUTO_TEST_CASE(json_writer)
+{
+    UniValue payload(UniValue::VOBJ);
+    payload.push_back(Pair("version", 1));
+    payload.push_back(Pair("height", 100));
+
+    UniValue expected(UniValue::VOBJ);
+    expected.push_back(Pair("hash", "00ab"));
+    expected.push_back(Pair("escaped", std::string("\"\\\n\x01\x7f/\xc3\xa9", 8)));
+    expected.push_back(Pair("confirmations", -1));
+    expected.push_back(Pair("nonce", uint64_t(4294967295U)));
+    expected.push_back(Pair("value", ValueFromAmount(COIN / 2)));
+    expected.push_back(Pair("spent", false));
+    UniValue txs(UniValue::VARR);
+    UniValue tx(UniValue::VOBJ);
+    tx.push_back(Pair("vin", UniValue(UniValue::VARR)));
+    tx.push_back(Pair("coinbase", true));
+    txs.push_back(tx);
+    txs.push_back("ff");
+    txs.push_back(NullUniValue);
+    expected.push_back(Pair("tx", txs));
+    expected.pushKVs(payload);
+
+    std::string json;
+    CJSONWriter writer(json);
+    writer.BeginObject();
+    writer.KeyValue("hash", "00ab");
+    writer.KeyValue("escaped", std::string("\"\\\n\x01\x7f/\xc3\xa9", 8));
+    writer.KeyValue("confirmations", -1);
+    writer.KeyValue("nonce", uint64_t(4294967295U));
+    writer.KeyValue("value", ValueFromAmount(COIN / 2));
+    writer.KeyValue("spent", false);
+    writer.Key("tx").BeginArray();
+    writer.BeginObject();
+    writer.Key("vin").BeginArray().EndArray();
+    writer.KeyValue("coinbase", true);
+    writer.EndObject();
+    writer.Value("ff");
+    writer.Null();
+    writer.EndArray();
+    writer.Members(payload);
+    writer.EndObject();
+
+    BOOST_CHECK_EQUAL(expected.write(), json);
+}
+
 BOOST_AUTO_TEST_CASE(rpc_ban)
 {
     BOOST_CHECK_NO_THROW(CallRPC(std::string("clearbanned")));
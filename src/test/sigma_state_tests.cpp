@@ -639,8 +639,8 @@ BOOST_AUTO_TEST_CASE(zerocoin_sigma_addblock_minted_spend)
     std::pair<sigma::CoinDenomination, int> denomination1Group1(
         sigma::CoinDenomination::SIGMA_DENOM_1,1);
 
-	index.sigmaMintedPubCoins[denomination1Group1].push_back(pubcoin1);
-	index.sigmaMintedPubCoins[denomination1Group1].push_back(pubcoin2);
+	index.sigmaMintedPubCoins.Add(denomination1Group1, pubcoin1);
+	index.sigmaMintedPubCoins.Add(denomination1Group1, pubcoin2);
 
 	sigmaState->AddBlock(&index);
 	BOOST_CHECK_MESSAGE(sigmaState->GetMints().size() == 2,
@@ -678,7 +678,7 @@ BOOST_AUTO_TEST_CASE(zerocoin_sigma_addblock_minted_spend)
     pubcoin3 = privcoin3.getPublicCoin();
     CBlockIndex index3 = CreateBlockIndex(3);
 
-    index3.sigmaMintedPubCoins[denomination1Group1].push_back(pubcoin3);
+    index3.sigmaMintedPubCoins.Add(denomination1Group1, pubcoin3);
     sigmaState->AddBlock(&index3);
     BOOST_CHECK_MESSAGE(sigmaState->GetMints().size() == 3,
 	  "Unexpected mintedPubCoins size, add new block with one more minted.");
@@ -701,7 +701,8 @@ BOOST_AUTO_TEST_CASE(zerocoin_sigma_removeblock_remove)
 
     auto index1 = CreateBlockIndex(1);
     std::pair<sigma::CoinDenomination, int> denomination1Group1(sigma::CoinDenomination::SIGMA_DENOM_1, 1);
-    index1.sigmaMintedPubCoins[denomination1Group1] = pubCoins;
+    for (auto const &pubCoin : pubCoins)
+        index1.sigmaMintedPubCoins.Add(denomination1Group1, pubCoin);
 
     // add index 2 with 10 minted and 1 spend
     auto coins2 = generateCoins(params,10, sigma::CoinDenomination::SIGMA_DENOM_1);
@@ -709,7 +710,8 @@ BOOST_AUTO_TEST_CASE(zerocoin_sigma_removeblock_remove)
 
     auto index2 = CreateBlockIndex(2);
     std::pair<sigma::CoinDenomination, int> denomination1Group2(sigma::CoinDenomination::SIGMA_DENOM_1, 2);
-    index2.sigmaMintedPubCoins[denomination1Group2] = pubCoins2;
+    for (auto const &pubCoin : pubCoins2)
+        index2.sigmaMintedPubCoins.Add(denomination1Group2, pubCoin);
 
     // Doesn't really matter what metadata we give here, it must pass.
     sigma::SpendMetaData metaData(0, uint256S("120"), uint256S("120"));
@@ -760,6 +762,74 @@ BOOST_AUTO_TEST_CASE(zerocoin_sigma_removeblock_remove)
     sigmaState->Reset();
 }
 
+BOOST_AUTO_TEST_CASE(sigma_snapshot)
+{
+    sigma::CSigmaState *sigmaState = sigma::CSigmaState::GetState();
+    auto params = sigma::Params::get_default();
+
+    auto coins = generateCoins(params, 10, sigma::CoinDenomination::SIGMA_DENOM_1);
+    auto pubCoins = getPubcoins(coins);
+    auto coins2 = generateCoins(params, 10, sigma::CoinDenomination::SIGMA_DENOM_1);
+    auto pubCoins2 = getPubcoins(coins2);
+
+    std::pair<sigma::CoinDenomination, int> denomination1Group1(sigma::CoinDenomination::SIGMA_DENOM_1, 1);
+    std::pair<sigma::CoinDenomination, int> denomination1Group2(sigma::CoinDenomination::SIGMA_DENOM_1, 2);
+
+    auto index1 = CreateBlockIndex(chainActive.Height() + 1);
+    for (auto const &pubCoin : pubCoins)
+        index1.sigmaMintedPubCoins.Add(denomination1Group1, pubCoin);
+
+    auto index2 = CreateBlockIndex(chainActive.Height() + 2);
+    index2.pprev = &index1;
+    for (auto const &pubCoin : pubCoins2)
+        index2.sigmaMintedPubCoins.Add(denomination1Group2, pubCoin);
+
+    Scalar serial;
+    serial.randomize();
+    index2.sigmaSpentSerials.insert(std::make_pair(serial, sigma::CSpendCoinInfo::make(sigma::CoinDenomination::SIGMA_DENOM_1, 1)));
+
+    sigmaState->AddBlock(&index1);
+    sigmaState->AddBlock(&index2);
+
+    auto snapshot = sigmaState->GetSnapshot();
+    BOOST_CHECK_EQUAL(index2.nHeight, snapshot->GetHeight());
+    BOOST_CHECK_EQUAL(2, snapshot->GetLatestCoinID(sigma::CoinDenomination::SIGMA_DENOM_1));
+    BOOST_CHECK_EQUAL(0, snapshot->GetLatestCoinID(sigma::CoinDenomination::SIGMA_DENOM_10));
+    BOOST_CHECK(snapshot->HasCoin(pubCoins2[0]));
+    BOOST_CHECK(snapshot->IsUsedCoinSerial(serial));
+    BOOST_CHECK(snapshot->GetMintedCoinHeightAndId(pubCoins[0]) == std::make_pair(index1.nHeight, 1));
+
+    for (int id : {1, 2, 3}) {
+        uint256 expectedHash, hash;
+        std::vector<sigma::PublicCoin> expectedCoins, coinSet;
+        BOOST_CHECK_EQUAL(
+            sigmaState->GetCoinSetForSpend(&chainActive, index2.nHeight, sigma::CoinDenomination::SIGMA_DENOM_1, id, expectedHash, expectedCoins),
+            snapshot->GetCoinSetForSpend(index2.nHeight, sigma::CoinDenomination::SIGMA_DENOM_1, id, hash, coinSet));
+        BOOST_CHECK(expectedHash == hash);
+        BOOST_CHECK(expectedCoins == coinSet);
+    }
+
+    // the snapshot doesn't change with the state
+    sigmaState->RemoveBlock(&index2);
+
+    auto afterRemoval = sigmaState->GetSnapshot();
+    BOOST_CHECK_EQUAL(index1.nHeight, afterRemoval->GetHeight());
+    BOOST_CHECK_EQUAL(1, afterRemoval->GetLatestCoinID(sigma::CoinDenomination::SIGMA_DENOM_1));
+    BOOST_CHECK(!afterRemoval->HasCoin(pubCoins2[0]));
+    BOOST_CHECK(!afterRemoval->IsUsedCoinSerial(serial));
+
+    sigma::CSigmaStateSnapshot::CoinGroupInfo group;
+    BOOST_CHECK(!afterRemoval->GetCoinGroupInfo(sigma::CoinDenomination::SIGMA_DENOM_1, 2, group));
+    BOOST_CHECK(snapshot->GetCoinGroupInfo(sigma::CoinDenomination::SIGMA_DENOM_1, 2, group));
+    BOOST_CHECK_EQUAL(10, group.nCoins);
+    BOOST_CHECK(snapshot->HasCoin(pubCoins2[0]));
+    BOOST_CHECK(snapshot->IsUsedCoinSerial(serial));
+
+    sigmaState->Reset();
+    BOOST_CHECK_EQUAL(0, sigmaState->GetSnapshot()->GetTotalCoins());
+    BOOST_CHECK_EQUAL(10, afterRemoval->GetTotalCoins());
+}
+
 BOOST_AUTO_TEST_CASE(getmempoolconflictingtxhash_added_no)
 {
     sigma::CSigmaState state;
@@ -934,7 +1004,8 @@ BOOST_AUTO_TEST_CASE(sigma_build_state)
     std::pair<sigma::CoinDenomination, int> denomination1Group1(sigma::CoinDenomination::SIGMA_DENOM_1, 1);
     std::pair<sigma::CoinDenomination, int> denomination10Group1(sigma::CoinDenomination::SIGMA_DENOM_10, 1);
 
-    index1.sigmaMintedPubCoins[denomination1Group1] = pubCoins;
+    for (auto const &pubCoin : pubCoins)
+        index1.sigmaMintedPubCoins.Add(denomination1Group1, pubCoin);
 
     chainActive.SetTip(&index1);
 
@@ -951,8 +1022,10 @@ BOOST_AUTO_TEST_CASE(sigma_build_state)
 
     index2.sigmaSpentSerials.insert(std::make_pair(serial, sigma::CSpendCoinInfo::make(sigma::CoinDenomination::SIGMA_DENOM_1, 0)));
 
-    index2.sigmaMintedPubCoins[denomination1Group1] = pubCoins2;
-    index2.sigmaMintedPubCoins[denomination10Group1] = pubCoins3;
+    for (auto const &pubCoin : pubCoins2)
+        index2.sigmaMintedPubCoins.Add(denomination1Group1, pubCoin);
+    for (auto const &pubCoin : pubCoins3)
+        index2.sigmaMintedPubCoins.Add(denomination10Group1, pubCoin);
 
     chainActive.SetTip(&index2);
 
@@ -1042,6 +1115,77 @@ BOOST_AUTO_TEST_CASE(sigma_build_state_no_sigma)
 }
 
 
+BOOST_AUTO_TEST_CASE(sigma_build_state_from_checkpoint)
+{
+    sigma::CSigmaState *sigmaState = sigma::CSigmaState::GetState();
+    auto params = sigma::Params::get_default();
+    chainActive.SetTip(NULL);
+
+    std::pair<sigma::CoinDenomination, int> denomination1Group1(sigma::CoinDenomination::SIGMA_DENOM_1, 1);
+    std::pair<sigma::CoinDenomination, int> denomination10Group1(sigma::CoinDenomination::SIGMA_DENOM_10, 1);
+
+    std::vector<CBlockIndex> indices;
+    indices.reserve(4);
+    for (int i = 0; i < 4; i++) {
+        indices.emplace_back(CreateBlockIndex(i));
+        indices.back().phashBlock = new uint256(GetRandHash());
+        chainActive.SetTip(&indices.back());
+    }
+
+    auto pubCoins = getPubcoins(generateCoins(params, 3, sigma::CoinDenomination::SIGMA_DENOM_1));
+    for (auto const &pubCoin : pubCoins)
+        indices[1].sigmaMintedPubCoins.Add(denomination1Group1, pubCoin);
+
+    auto pubCoins10 = getPubcoins(generateCoins(params, 1, sigma::CoinDenomination::SIGMA_DENOM_10));
+    indices[2].sigmaMintedPubCoins.Add(denomination10Group1, pubCoins10[0]);
+
+    secp_primitives::Scalar serial;
+    serial.randomize();
+    indices[2].sigmaSpentSerials.insert(std::make_pair(serial, sigma::CSpendCoinInfo::make(sigma::CoinDenomination::SIGMA_DENOM_1, 1)));
+
+    // checkpoint at index 2, index 3 is replayed on top of it
+    chainActive.SetTip(&indices[2]);
+    sigma::BuildSigmaStateFromIndex(&chainActive);
+    sigma::DumpSigmaState();
+    auto checkpoint = sigmaState->GetSnapshot();
+    sigmaState->Reset();
+
+    auto pubCoins2 = getPubcoins(generateCoins(params, 2, sigma::CoinDenomination::SIGMA_DENOM_1));
+    for (auto const &pubCoin : pubCoins2)
+        indices[3].sigmaMintedPubCoins.Add(denomination1Group1, pubCoin);
+    chainActive.SetTip(&indices[3]);
+
+    sigma::BuildSigmaStateFromIndex(&chainActive);
+
+    sigma::CSigmaState::SigmaCoinGroupInfo group;
+    BOOST_CHECK(sigmaState->GetCoinGroupInfo(sigma::CoinDenomination::SIGMA_DENOM_1, 1, group));
+    BOOST_CHECK(group.firstBlock == &indices[1]);
+    BOOST_CHECK(group.lastBlock == &indices[3]);
+    BOOST_CHECK_EQUAL(group.nCoins, 5);
+
+    BOOST_CHECK(sigmaState->GetCoinGroupInfo(sigma::CoinDenomination::SIGMA_DENOM_10, 1, group));
+    BOOST_CHECK(group.firstBlock == &indices[2]);
+    BOOST_CHECK_EQUAL(group.nCoins, 1);
+    BOOST_CHECK_EQUAL(sigmaState->GetLatestCoinID(sigma::CoinDenomination::SIGMA_DENOM_10), 1);
+
+    BOOST_CHECK(sigmaState->IsUsedCoinSerial(serial));
+    BOOST_CHECK(sigmaState->GetMintedCoinHeightAndId(pubCoins[0]) == std::make_pair(1, 1));
+    BOOST_CHECK(sigmaState->GetMintedCoinHeightAndId(pubCoins10[0]) == std::make_pair(2, 1));
+    BOOST_CHECK(sigmaState->GetMintedCoinHeightAndId(pubCoins2[1]) == std::make_pair(3, 1));
+
+    auto snapshot = sigmaState->GetSnapshot();
+    BOOST_CHECK_EQUAL(snapshot->GetHeight(), 3);
+    BOOST_CHECK_EQUAL(snapshot->GetTotalCoins(), 6);
+
+    // a checkpoint of a block that is no longer in the chain is ignored
+    indices[2].phashBlock = new uint256(GetRandHash());
+    BOOST_CHECK(!sigmaState->LoadSnapshot(*checkpoint, &chainActive));
+    BOOST_CHECK(!sigmaState->HasCoin(pubCoins[0]));
+
+    sigmaState->Reset();
+    chainActive.SetTip(NULL);
+}
+
 BOOST_AUTO_TEST_CASE(sigma_getcoinsetforspend)
 {
     sigma::CSigmaState *sigmaState = sigma::CSigmaState::GetState();
@@ -1072,7 +1216,8 @@ BOOST_AUTO_TEST_CASE(sigma_getcoinsetforspend)
     auto coins3 = generateCoins(params, 5, sigma::CoinDenomination::SIGMA_DENOM_10);
     auto pubCoins3 = getPubcoins(coins3);
 
-    indexes[nextIndex].sigmaMintedPubCoins[denomination1Group1] = pubCoins;
+    for (auto const &pubCoin : pubCoins)
+        indexes[nextIndex].sigmaMintedPubCoins.Add(denomination1Group1, pubCoin);
     chainActive.SetTip(&indexes[nextIndex]);
 
     nextIndex++;
@@ -1083,8 +1228,10 @@ BOOST_AUTO_TEST_CASE(sigma_getcoinsetforspend)
     serial.randomize();
 
     indexes[nextIndex].sigmaSpentSerials.insert(std::make_pair(serial, sigma::CSpendCoinInfo::make(sigma::CoinDenomination::SIGMA_DENOM_1, 0)));
-    indexes[nextIndex].sigmaMintedPubCoins[denomination1Group1] = pubCoins2;
-    indexes[nextIndex].sigmaMintedPubCoins[denomination10Group1] = pubCoins3;
+    for (auto const &pubCoin : pubCoins2)
+        indexes[nextIndex].sigmaMintedPubCoins.Add(denomination1Group1, pubCoin);
+    for (auto const &pubCoin : pubCoins3)
+        indexes[nextIndex].sigmaMintedPubCoins.Add(denomination10Group1, pubCoin);
 
     chainActive.SetTip(&indexes[nextIndex]);
 
@@ -73,7 +73,12 @@ BOOST_AUTO_TEST_CASE(dbindexhelper_coinbase)
             BOOST_CHECK(dbIndexHelper.getAddressUnspentIndex()[i].second.blockHeight == 7980);
             BOOST_CHECK(dbIndexHelper.getAddressUnspentIndex()[i].second.satoshis == amounts[i]*100000);
             BOOST_CHECK(dbIndexHelper.getAddressUnspentIndex()[i].second.script == tx.vout[i].scriptPubKey);
+
+            CAddressBalanceValue const & delta = dbIndexHelper.getAddressBalanceDeltas().at(std::make_pair(type, key));
+            BOOST_CHECK(delta.balance == amounts[i]*100000);
+            BOOST_CHECK(delta.received == amounts[i]*100000);
         }
+        BOOST_CHECK(dbIndexHelper.getAddressBalanceDeltas().size() == outNum);
     }
     {
         CDbIndexHelper dbIndexHelper(true, true);
@@ -101,6 +106,10 @@ BOOST_AUTO_TEST_CASE(dbindexhelper_coinbase)
             BOOST_CHECK(dbIndexHelper.getAddressUnspentIndex()[i].second.blockHeight == 0);
             BOOST_CHECK(dbIndexHelper.getAddressUnspentIndex()[i].second.satoshis == -1);
             BOOST_CHECK(dbIndexHelper.getAddressUnspentIndex()[i].second.script.empty());
+
+            CAddressBalanceValue const & delta = dbIndexHelper.getAddressBalanceDeltas().at(std::make_pair(type, key));
+            BOOST_CHECK(delta.balance == -amounts[outNum-1-i]*100000);
+            BOOST_CHECK(delta.received == -amounts[outNum-1-i]*100000);
         }
     }
 }
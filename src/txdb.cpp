@@ -5,6 +5,7 @@
 
 #include "txdb.h"
 
+#include "blockfilter.h"
 #include "chainparams.h"
 #include "hash.h"
 #include "pow.h"
@@ -25,6 +26,7 @@ static const char DB_ADDRESSINDEX = 'a';
 static const char DB_ADDRESSUNSPENTINDEX = 'u';
 static const char DB_TIMESTAMPINDEX = 's';
 static const char DB_SPENTINDEX = 'p';
+static const char DB_BLOCKFILTER = 'g';
 static const char DB_BLOCK_INDEX = 'b';
 
 static const char DB_BEST_BLOCK = 'B';
@@ -32,6 +34,8 @@ static const char DB_FLAG = 'F';
 static const char DB_REINDEX_FLAG = 'R';
 static const char DB_LAST_BLOCK = 'l';
 static const char DB_TOTAL_SUPPLY = 'S';
+static const char DB_ADDRESSBALANCEINDEX = 'w';
+static const char DB_ADDRESSBALANCETIP = 'W';
 
 namespace {
 
@@ -57,7 +61,7 @@ struct CoinEntry {
 
 }
 
-CCoinsViewDB::CCoinsViewDB(size_t nCacheSize, bool fMemory, bool fWipe) : db(GetDataDir() / "chainstate", nCacheSize, fMemory, fWipe, true)
+CCoinsViewDB::CCoinsViewDB(size_t nCacheSize, bool fMemory, bool fWipe) : db(GetDataDir() / "chainstate", nCacheSize, fMemory, fWipe, true, "chainstate")
 {
 }
 
@@ -106,7 +110,7 @@ size_t CCoinsViewDB::EstimateSize() const
     return db.EstimateSize(DB_COIN, (char)(DB_COIN+1));
 }
 
-CBlockTreeDB::CBlockTreeDB(size_t nCacheSize, bool fMemory, bool fWipe) : CDBWrapper(GetDataDir() / "blocks" / "index", nCacheSize, fMemory, fWipe) {
+CBlockTreeDB::CBlockTreeDB(size_t nCacheSize, bool fMemory, bool fWipe) : CDBWrapper(GetDataDir() / "blocks" / "index", nCacheSize, fMemory, fWipe, false, "blockindex") {
 }
 
 bool CBlockTreeDB::ReadBlockFileInfo(int nFile, CBlockFileInfo &info) {
@@ -260,21 +264,71 @@ bool CBlockTreeDB::ReadAddressUnspentIndex(uint160 addressHash, AddressType type
     return true;
 }
 
-bool CBlockTreeDB::WriteAddressIndex(const std::vector<std::pair<CAddressIndexKey, CAmount > >&vect) {
+namespace {
+void WriteAddressBalances(CDBWrapper & db, CDBBatch & batch, const CAddressBalanceDeltas &balanceDeltas) {
+    for (CAddressBalanceDeltas::const_iterator it=balanceDeltas.begin(); it!=balanceDeltas.end(); it++) {
+        std::pair<char, CAddressIndexIteratorKey> key(DB_ADDRESSBALANCEINDEX, CAddressIndexIteratorKey(it->first.first, it->first.second));
+        CAddressBalanceValue value;
+        db.Read(key, value);
+        value.balance += it->second.balance;
+        value.received += it->second.received;
+        if (value.balance == 0 && value.received == 0) {
+            batch.Erase(key);
+        } else {
+            batch.Write(key, value);
+        }
+    }
+}
+}
+
+bool CBlockTreeDB::WriteAddressIndex(const std::vector<std::pair<CAddressIndexKey, CAmount > >&vect, const CAddressBalanceDeltas &balanceDeltas, const uint256 &hashBalanceTip) {
     CDBBatch batch(*this);
+    WriteAddressBalances(*this, batch, balanceDeltas);
+    if (!hashBalanceTip.IsNull())
+        batch.Write(DB_ADDRESSBALANCETIP, hashBalanceTip);
     for (std::vector<std::pair<CAddressIndexKey, CAmount> >::const_iterator it=vect.begin(); it!=vect.end(); it++) {
         batch.Write(make_pair(DB_ADDRESSINDEX, it->first), it->second);
     }
     return WriteBatch(batch);
 }
 
-bool CBlockTreeDB::EraseAddressIndex(const std::vector<std::pair<CAddressIndexKey, CAmount > >&vect) {
+bool CBlockTreeDB::EraseAddressIndex(const std::vector<std::pair<CAddressIndexKey, CAmount > >&vect, const CAddressBalanceDeltas &balanceDeltas, const uint256 &hashBalanceTip) {
     CDBBatch batch(*this);
+    WriteAddressBalances(*this, batch, balanceDeltas);
+    if (!hashBalanceTip.IsNull())
+        batch.Write(DB_ADDRESSBALANCETIP, hashBalanceTip);
     for (std::vector<std::pair<CAddressIndexKey, CAmount> >::const_iterator it=vect.begin(); it!=vect.end(); it++)
     batch.Erase(make_pair(DB_ADDRESSINDEX, it->first));
     return WriteBatch(batch);
 }
 
+bool CBlockTreeDB::ReadAddressBalance(uint160 addressHash, AddressType type, CAddressBalanceValue &value) {
+    value.SetNull();
+    Read(make_pair(DB_ADDRESSBALANCEINDEX, CAddressIndexIteratorKey(type, addressHash)), value);
+    return true;
+}
+
+bool CBlockTreeDB::ReadAddressBalanceTip(uint256 &hash) {
+    return Read(DB_ADDRESSBALANCETIP, hash);
+}
+
+bool CBlockTreeDB::WipeAddressBalances() {
+    boost::scoped_ptr<CDBIterator> pcursor(NewIterator());
+    pcursor->Seek(DB_ADDRESSBALANCEINDEX);
+
+    CDBBatch batch(*this);
+    while (pcursor->Valid()) {
+        boost::this_thread::interruption_point();
+        std::pair<char, CAddressIndexIteratorKey> key;
+        if (!pcursor->GetKey(key) || key.first != DB_ADDRESSBALANCEINDEX)
+            break;
+        batch.Erase(key);
+        pcursor->Next();
+    }
+    batch.Erase(DB_ADDRESSBALANCETIP);
+    return WriteBatch(batch);
+}
+
 bool CBlockTreeDB::ReadAddressIndex(uint160 addressHash, AddressType type,
                                     std::vector<std::pair<CAddressIndexKey, CAmount> > &addressIndex,
                                     int start, int end) {
@@ -336,6 +390,23 @@ bool CBlockTreeDB::ReadTimestampIndex(const unsigned int &high, const unsigned i
     return true;
 }
 
+bool CBlockTreeDB::WriteBlockFilter(const uint256 &blockHash, const GCSFilter &filter) {
+    return Write(make_pair(DB_BLOCKFILTER, blockHash), filter.GetEncoded());
+}
+
+bool CBlockTreeDB::ReadBlockFilter(const uint256 &blockHash, GCSFilter &filter) {
+    std::vector<unsigned char> encoded;
+    if (!Read(make_pair(DB_BLOCKFILTER, blockHash), encoded))
+        return false;
+
+    try {
+        filter = GCSFilter(blockHash, std::move(encoded));
+    } catch (const std::exception &e) {
+        return error("%s: invalid block filter for %s: %s", __func__, blockHash.ToString(), e.what());
+    }
+    return true;
+}
+
 bool CBlockTreeDB::WriteFlag(const std::string &name, bool fValue) {
     return Write(std::make_pair(DB_FLAG, name), fValue ? '1' : '0');
 }
@@ -385,9 +456,11 @@ bool CBlockTreeDB::LoadBlockIndexGuts(boost::function<CBlockIndex*(const uint256
                     pindexNew->reserved[1] = diskindex.reserved[1];
                 }
 
-                pindexNew->accumulatorChanges = diskindex.accumulatorChanges;
-                pindexNew->mintedPubCoins     = diskindex.mintedPubCoins;
-                pindexNew->spentSerials       = diskindex.spentSerials;
+                pindexNew->accumulatorChanges = std::move(diskindex.accumulatorChanges);
+                pindexNew->mintedPubCoins     = std::move(diskindex.mintedPubCoins);
+                pindexNew->spentSerials       = std::move(diskindex.spentSerials);
+
+                // only references into the coin arenas, no coins are copied
 
                 pindexNew->sigmaMintedPubCoins   = diskindex.sigmaMintedPubCoins;
                 pindexNew->sigmaSpentSerials     = diskindex.sigmaSpentSerials;
@@ -407,6 +480,8 @@ bool CBlockTreeDB::LoadBlockIndexGuts(boost::function<CBlockIndex*(const uint256
         }
     }
 
+    LogPrintf("%s: sigma and lelantus coins of the block index use %u kB\n", __func__, CoinArenaDynamicMemoryUsage() / 1024);
+
     return true;
 }
 
@@ -604,6 +679,8 @@ void handleOutput(const CTxOut &out, size_t outNo, uint256 const & txHash, int h
 
 void CDbIndexHelper::ConnectTransaction(CTransaction const & tx, int height, int txNumber, CCoinsViewCache const & view)
 {
+    size_t const pAddressBegin = addressIndex ? addressIndex->size() : 0;
+
     size_t no = 0;
     if(!tx.IsCoinBase() && !tx.IsZerocoinSpend() && !tx.IsSigmaSpend() && !tx.IsZerocoinRemint() && !tx.IsLelantusJoinSplit()) {
         for (CTxIn const & input : tx.vin) {
@@ -631,6 +708,9 @@ void CDbIndexHelper::ConnectTransaction(CTransaction const & tx, int height, int
     for (CTxOut const & out : tx.vout) {
         handleOutput(out, no++, tx.GetHash(), height, txNumber, view, txIsCoinBase, addressIndex, addressUnspentIndex, spentIndex);
     }
+
+    if (addressIndex)
+        addBalanceDeltas(pAddressBegin, addressIndex->size(), false);
 }
 
 
@@ -666,6 +746,8 @@ void CDbIndexHelper::DisconnectTransactionInputs(CTransaction const & tx, int he
         }
 
     if(addressIndex){
+        addBalanceDeltas(pAddressBegin, addressIndex->size(), true);
+
         std::reverse(addressIndex->begin() + pAddressBegin, addressIndex->end());
         std::reverse(addressUnspentIndex->begin() + pUnspentBegin, addressUnspentIndex->end());
 
@@ -679,6 +761,8 @@ void CDbIndexHelper::DisconnectTransactionInputs(CTransaction const & tx, int he
 
 void CDbIndexHelper::DisconnectTransactionOutputs(CTransaction const & tx, int height, int txNumber, CCoinsViewCache const & view)
 {
+    size_t const pAddressBegin = addressIndex ? addressIndex->size() : 0;
+
     if(tx.IsZerocoinSpend() || tx.IsSigmaSpend() || tx.IsLelantusJoinSplit())
         handleZerocoinSpend(tx.vout.begin(), tx.vout.end(), tx.GetHash(), height, txNumber, view, addressIndex, tx);
 
@@ -690,6 +774,8 @@ void CDbIndexHelper::DisconnectTransactionOutputs(CTransaction const & tx, int h
 
     if(addressIndex)
     {
+        addBalanceDeltas(pAddressBegin, addressIndex->size(), true);
+
         std::reverse(addressIndex->begin(), addressIndex->end());
         std::reverse(addressUnspentIndex->begin(), addressUnspentIndex->end());
     }
@@ -715,6 +801,26 @@ CDbIndexHelper::SpentIndex const & CDbIndexHelper::getSpentIndex() const
     return *spentIndex;
 }
 
+
+CAddressBalanceDeltas const & CDbIndexHelper::getAddressBalanceDeltas() const
+{
+    return addressBalanceDeltas;
+}
+
+
+void CDbIndexHelper::addBalanceDeltas(size_t begin, size_t end, bool disconnect)
+{
+    for (size_t i = begin; i < end; ++i) {
+        CAddressIndexKey const & key = (*addressIndex)[i].first;
+        CAmount const amount = disconnect ? -(*addressIndex)[i].second : (*addressIndex)[i].second;
+
+        CAddressBalanceValue & delta = addressBalanceDeltas[std::make_pair(key.type, key.hashBytes)];
+        delta.balance += amount;
+        if ((*addressIndex)[i].second > 0)
+            delta.received += amount;
+    }
+}
+
 namespace {
 
 //! Legacy class to deserialize pre-pertxout database entries without reindex.
@@ -20,6 +20,7 @@
 
 class CBlockIndex;
 class CCoinsViewDBCursor;
+class GCSFilter;
 class uint256;
 
 //! Compensate for extra memory peak (x1.5-x1.9) at flush time.
@@ -130,14 +131,25 @@ public:
     bool UpdateAddressUnspentIndex(const std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue > >&vect);
     bool ReadAddressUnspentIndex(uint160 addressHash, AddressType type,
                                  std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue> > &vect);
-    bool WriteAddressIndex(const std::vector<std::pair<CAddressIndexKey, CAmount> > &vect);
-    bool EraseAddressIndex(const std::vector<std::pair<CAddressIndexKey, CAmount> > &vect);
+    //! hashBalanceTip, if set, records the block the running balances are at after applying balanceDeltas
+    bool WriteAddressIndex(const std::vector<std::pair<CAddressIndexKey, CAmount> > &vect,
+                           const CAddressBalanceDeltas &balanceDeltas = CAddressBalanceDeltas(),
+                           const uint256 &hashBalanceTip = uint256());
+    bool EraseAddressIndex(const std::vector<std::pair<CAddressIndexKey, CAmount> > &vect,
+                           const CAddressBalanceDeltas &balanceDeltas = CAddressBalanceDeltas(),
+                           const uint256 &hashBalanceTip = uint256());
+    bool ReadAddressBalance(uint160 addressHash, AddressType type, CAddressBalanceValue &value);
+    bool ReadAddressBalanceTip(uint256 &hash);
+    //! Removes the running balances, so that they are rebuilt as the blocks are connected again
+    bool WipeAddressBalances();
     bool ReadAddressIndex(uint160 addressHash, AddressType type,
                           std::vector<std::pair<CAddressIndexKey, CAmount> > &addressIndex,
                           int start = 0, int end = 0);
 
     bool WriteTimestampIndex(const CTimestampIndexKey &timestampIndex);
     bool ReadTimestampIndex(const unsigned int &high, const unsigned int &low, std::vector<uint256> &vect);
+    bool WriteBlockFilter(const uint256 &blockHash, const GCSFilter &filter);
+    bool ReadBlockFilter(const uint256 &blockHash, GCSFilter &filter);
     bool WriteFlag(const std::string &name, bool fValue);
     bool ReadFlag(const std::string &name, bool &fValue);
     bool LoadBlockIndexGuts(boost::function<CBlockIndex*(const uint256&)> insertBlockIndex);
@@ -154,7 +166,10 @@ public:
  * @param addressIndex, spentIndex - true if to update the corresponding index
  *
  * It is undefined behavior if the helper was created with addressIndex == false
- * and getAddressIndex was called later (same for spentIndex and unspentIndex).
+ * and getAddressIndex was called later (same for spentIndex, unspentIndex and balances).
+ *
+ * Along with the address index entries the helper sums up how the balance and the
+ * received total of every touched address change, negated for disconnected transactions.
  */
 class CDbIndexHelper : boost::noncopyable
 {
@@ -172,9 +187,14 @@ public:
     AddressIndex const & getAddressIndex() const;
     AddressUnspentIndex const & getAddressUnspentIndex() const;
     SpentIndex const & getSpentIndex() const;
+    CAddressBalanceDeltas const & getAddressBalanceDeltas() const;
+
+private:
+    void addBalanceDeltas(size_t begin, size_t end, bool disconnect);
 
 private:
     boost::optional<AddressIndex> addressIndex;
+    CAddressBalanceDeltas addressBalanceDeltas;
     boost::optional<AddressUnspentIndex> addressUnspentIndex;
     boost::optional<SpentIndex> spentIndex;
 };
@@ -8,7 +8,10 @@
 #include "clientversion.h"
 #include "consensus/consensus.h"
 #include "consensus/validation.h"
+#include "lelantus.h"
 #include "validation.h"
+#include "sigma.h"
+#include "sigma/remint.h"
 #include "policy/policy.h"
 #include "policy/fees.h"
 #include "streams.h"
@@ -22,6 +25,59 @@
 #include "evo/providertx.h"
 #include "evo/deterministicmns.h"
 
+//! Memory of scalars besides their own size, each holds its value in a separate allocation of a secp256k1_scalar
+static size_t ScalarsDynamicUsage(size_t nScalars)
+{
+    return memusage::MallocUsage(Scalar::memoryRequired()) * nScalars;
+}
+
+static CPrivacySpendInfo GetPrivacySpendInfo(const CTransaction& tx)
+{
+    CPrivacySpendInfo info;
+
+    if (tx.IsSigmaSpend()) {
+        info.nInputs = tx.vin.size();
+        for (const CTxIn& in : tx.vin) {
+            if (!in.IsSigmaSpend())
+                continue;
+            try {
+                // the serial and denomination follow the proof, which is skipped
+                Scalar serial;
+                sigma::CoinDenomination denomination;
+                sigma::ParseSigmaSpendSerial(in, serial, denomination);
+                int64_t nDenomination;
+                if (sigma::DenominationToInteger(denomination, nDenomination))
+                    info.nAmount += nDenomination;
+                info.serials.push_back(serial);
+            } catch (const std::ios_base::failure&) {
+            } catch (const CBadTxIn&) {
+            }
+        }
+    } else if (tx.IsZerocoinRemint()) {
+        info.nInputs = tx.vin.size();
+        info.nAmount = sigma::CoinRemintToV3::GetAmount(tx);
+    } else if (tx.IsLelantusJoinSplit()) {
+        info.nAmount = lelantus::GetSpendTransparentAmount(tx);
+        for (const CTxIn& in : tx.vin) {
+            if (!in.IsLelantusJoinSplit())
+                continue;
+            try {
+                lelantus::JoinSplitHeader header;
+                lelantus::ParseLelantusJoinSplitHeader(in, header);
+                info.nInputs += header.serials.size();
+                info.serials.insert(info.serials.end(), header.serials.begin(), header.serials.end());
+                info.groupBlockHashes.insert(info.groupBlockHashes.end(), header.idAndBlockHashes.begin(), header.idAndBlockHashes.end());
+            } catch (const CBadTxIn&) {
+            } catch (const std::exception&) {
+                // leave the joinsplits the header parser can't read to the full parse
+                info.nInputs += lelantus::GetSpendInputs(tx, in);
+            }
+        }
+    }
+
+    return info;
+}
+
 CTxMemPoolEntry::CTxMemPoolEntry(const CTransactionRef& _tx, const CAmount& _nFee,
                                  int64_t _nTime, unsigned int _entryHeight,
                                  CAmount _inChainInputValue,
@@ -32,7 +88,11 @@ CTxMemPoolEntry::CTxMemPoolEntry(const CTransactionRef& _tx, const CAmount& _nFe
 {
     nTxWeight = GetTransactionWeight(*tx);
     nModSize = tx->CalculateModifiedSize(GetTxSize());
-    nUsageSize = RecursiveDynamicUsage(*tx) + memusage::DynamicUsage(tx);
+    if (tx->IsSigmaSpend() || tx->IsZerocoinRemint() || tx->IsLelantusJoinSplit())
+        privacySpend = GetPrivacySpendInfo(*tx);
+    nUsageSize = RecursiveDynamicUsage(*tx) + memusage::DynamicUsage(tx) +
+                 memusage::DynamicUsage(privacySpend.serials) + ScalarsDynamicUsage(privacySpend.serials.size()) +
+                 memusage::DynamicUsage(privacySpend.groupBlockHashes);
 
     nCountWithDescendants = 1;
     nSizeWithDescendants = GetTxSize();
@@ -447,6 +507,11 @@ bool CTxMemPool::addUnchecked(const uint256& hash, const CTxMemPoolEntry &entry,
     vTxHashes.emplace_back(tx.GetWitnessHash(), newit);
     newit->vTxHashesIdx = vTxHashes.size() - 1;
 
+    for (const Scalar& serial : entry.GetPrivacySpend().serials)
+        mapPrivacySerials.emplace(serial, hash);
+    for (const auto& groupBlockHash : entry.GetPrivacySpend().groupBlockHashes)
+        mapJoinSplitBlocks.emplace(std::make_pair(groupBlockHash.second, groupBlockHash.first), hash);
+
     // Invalid ProTxes should never get this far because transactions should be
     // fully checked by AcceptToMemoryPool() at this point, so we just assume that
     // everything is fine here.
@@ -515,6 +580,26 @@ void CTxMemPool::removeUnchecked(txiter it, MemPoolRemovalReason reason)
     } else
         vTxHashes.clear();
 
+    for (const Scalar& serial : it->GetPrivacySpend().serials) {
+        auto its = mapPrivacySerials.equal_range(serial);
+        for (auto itp = its.first; itp != its.second; ++itp) {
+            if (itp->second == hash) {
+                mapPrivacySerials.erase(itp);
+                break;
+            }
+        }
+    }
+    for (const auto& groupBlockHash : it->GetPrivacySpend().groupBlockHashes) {
+        auto its = mapJoinSplitBlocks.equal_range(std::make_pair(groupBlockHash.second, groupBlockHash.first));
+        for (auto itb = its.first; itb != its.second;) {
+            if (itb->second == hash) {
+                itb = mapJoinSplitBlocks.erase(itb);
+            } else {
+                ++itb;
+            }
+        }
+    }
+
     auto eraseProTxRef = [&](const uint256& proTxHash, const uint256& txHash) {
         auto its = mapProTxRefs.equal_range(proTxHash);
         for (auto it = its.first; it != its.second;) {
@@ -1017,6 +1102,8 @@ void CTxMemPool::_clear()
     mapNextTx.clear();
     mapProTxAddresses.clear();
     mapProTxPubKeyIDs.clear();
+    mapPrivacySerials.clear();
+    mapJoinSplitBlocks.clear();
     totalTxSize = 0;
     cachedInnerUsage = 0;
     lastRollingFeeUpdate = GetTime();
@@ -1163,6 +1250,11 @@ void CTxMemPool::check(const CCoinsViewCache *pcoins) const
 
     assert(totalTxSize == checkTotal);
     assert(innerUsage == cachedInnerUsage);
+
+    for (const auto& serialSpender : mapPrivacySerials)
+        assert(mapTx.count(serialSpender.second));
+    for (const auto& blockJoinSplit : mapJoinSplitBlocks)
+        assert(mapTx.count(blockJoinSplit.second));
 }
 
 bool CTxMemPool::CompareDepthAndScore(const uint256& hasha, const uint256& hashb)
@@ -1259,6 +1351,30 @@ TxMempoolInfo CTxMemPool::info(const uint256& hash) const
     return GetInfo(i);
 }
 
+std::vector<uint256> CTxMemPool::getSerialSpenders(const Scalar& serial) const {
+    LOCK(cs);
+    std::vector<uint256> result;
+    auto its = mapPrivacySerials.equal_range(serial);
+    for (auto it = its.first; it != its.second; ++it)
+        result.push_back(it->second);
+    return result;
+}
+
+std::vector<CTransactionRef> CTxMemPool::getJoinSplitsReferencingBlock(const uint256& blockHash) const {
+    LOCK(cs);
+    std::vector<CTransactionRef> result;
+    // a joinsplit may use several anonymity sets ending at the block
+    std::set<uint256> seen;
+    auto it = mapJoinSplitBlocks.lower_bound(std::make_pair(blockHash, std::numeric_limits<uint32_t>::min()));
+    auto end = mapJoinSplitBlocks.upper_bound(std::make_pair(blockHash, std::numeric_limits<uint32_t>::max()));
+    for (; it != end; ++it) {
+        auto txit = mapTx.find(it->second);
+        if (txit != mapTx.end() && seen.insert(it->second).second)
+            result.push_back(txit->GetSharedTx());
+    }
+    return result;
+}
+
 bool CTxMemPool::existsProviderTxConflict(const CTransaction &tx) const {
     LOCK(cs);
 
@@ -1483,7 +1599,8 @@ bool CCoinsViewMemPool::HaveCoin(const COutPoint &outpoint) const {
 size_t CTxMemPool::DynamicMemoryUsage() const {
     LOCK(cs);
     // Estimate the overhead of mapTx to be 15 pointers + an allocation, as no exact formula for boost::multi_index_contained is implemented.
-    return memusage::MallocUsage(sizeof(CTxMemPoolEntry) + 15 * sizeof(void*)) * mapTx.size() + memusage::DynamicUsage(mapNextTx) + memusage::DynamicUsage(mapDeltas) + memusage::DynamicUsage(mapLinks) + memusage::DynamicUsage(vTxHashes) + cachedInnerUsage;
+    return memusage::MallocUsage(sizeof(CTxMemPoolEntry) + 15 * sizeof(void*)) * mapTx.size() + memusage::DynamicUsage(mapNextTx) + memusage::DynamicUsage(mapDeltas) + memusage::DynamicUsage(mapLinks) + memusage::DynamicUsage(vTxHashes) +
+           memusage::DynamicUsage(mapPrivacySerials) + ScalarsDynamicUsage(mapPrivacySerials.size()) + memusage::DynamicUsage(mapJoinSplitBlocks) + cachedInnerUsage;
 }
 
 double CTxMemPool::UsedMemoryShare() const
@@ -23,6 +23,7 @@
 #include "random.h"
 #include "netaddress.h"
 #include "bls/bls.h"
+#include <secp256k1/include/Scalar.h>
 
 #undef foreach
 #include "boost/multi_index_container.hpp"
@@ -66,6 +67,15 @@ struct LockPoints
 
 class CTxMemPool;
 
+/** Sigma and Lelantus spends of a transaction, parsed once when it enters the mempool */
+struct CPrivacySpendInfo
+{
+    size_t nInputs = 0;           //!< Coins spent, counted against the per transaction and per block limits
+    CAmount nAmount = 0;          //!< ... and the spent amount, sigma denominations or lelantus transparent outputs
+    std::vector<Scalar> serials;  //!< Serials of the spent sigma and lelantus coins
+    std::vector<std::pair<uint32_t, uint256>> groupBlockHashes; //!< Coin groups and last blocks of the joinsplit anonymity sets
+};
+
 /** \class CTxMemPoolEntry
  *
  * CTxMemPoolEntry stores data about the corresponding transaction, as well
@@ -98,6 +108,7 @@ private:
     int64_t sigOpCost;         //!< Total sigop cost
     int64_t feeDelta;          //!< Used for determining the priority of the transaction for mining in a block
     LockPoints lockPoints;     //!< Track the height and time at which tx was final
+    CPrivacySpendInfo privacySpend; //!< Cached so that block assembly never parses the spend proofs
 
     // Information about descendants of this transaction that are in the
     // mempool; if we remove this transaction we must remove all of these
@@ -138,6 +149,7 @@ public:
     int64_t GetModifiedFee() const { return nFee + feeDelta; }
     size_t DynamicMemoryUsage() const { return nUsageSize; }
     const LockPoints& GetLockPoints() const { return lockPoints; }
+    const CPrivacySpendInfo& GetPrivacySpend() const { return privacySpend; }
 
     // Adjusts the descendant state, if this entry is not dirty.
     void UpdateDescendantState(int64_t modifySize, CAmount modifyFee, int64_t modifyCount);
@@ -545,6 +557,9 @@ private:
     std::map<uint256, uint256> mapProTxBlsPubKeyHashes;
     std::map<COutPoint, uint256> mapProTxCollaterals;
 
+    std::unordered_multimap<Scalar, uint256> mapPrivacySerials; // sigma or lelantus serial -> transactions spending it, several in the stempool
+    std::multimap<std::pair<uint256, uint32_t>, uint256> mapJoinSplitBlocks; // (block hash, coin group) of an anonymity set -> joinsplits using it
+
     void UpdateParent(txiter entry, txiter parent, bool add);
     void UpdateChild(txiter entry, txiter child, bool add);
 
@@ -725,6 +740,11 @@ public:
 
     bool existsProviderTxConflict(const CTransaction &tx) const;
 
+    /** The transactions spending the sigma or lelantus serial */
+    std::vector<uint256> getSerialSpenders(const Scalar& serial) const;
+    /** The joinsplits whose anonymity sets end at the block */
+    std::vector<CTransactionRef> getJoinSplitsReferencingBlock(const uint256& blockHash) const;
+
     size_t DynamicMemoryUsage() const;
     // returns share of the used memory to maximum allowed memory
     double UsedMemoryShare() const;
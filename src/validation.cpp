@@ -12,6 +12,7 @@
 #include "zerocoin.h"
 
 #include "arith_uint256.h"
+#include "blockfilter.h"
 #include "chainparams.h"
 #include "checkpoints.h"
 #include "checkqueue.h"
@@ -111,8 +112,10 @@ bool fTxIndex = false;
 bool fHavePruned = false;
 bool fPruneMode = false;
 bool fAddressIndex = false;
+bool fAddressBalanceIndex = false;
 bool fSpentIndex = false;
 bool fTimestampIndex = false;
+bool fBlockFilterIndex = DEFAULT_BLOCKFILTERINDEX;
 bool fIsBareMultisigStd = DEFAULT_PERMIT_BAREMULTISIG;
 bool fRequireStandard = true;
 bool fCheckBlockIndex = false;
@@ -785,6 +788,13 @@ bool AcceptToMemoryPoolWorker(CTxMemPool& pool, CValidationState& state, const C
         }
     }
 
+    // Turn away replayed joinsplits and those referring to unknown anonymity sets before
+    // their proofs are deserialized and verified
+    if (tx.IsLelantusJoinSplit() && !pool.exists(hash) && !lelantus::CheckLelantusJoinSplitHeader(tx, state)) {
+        LogPrint("mempool", "%s: joinsplit %s rejected early: %s\n", __func__, hash.ToString(), FormatStateMessage(state));
+        return false;
+    }
+
     if (!CheckTransaction(tx, state, true, hash, false, INT_MAX, isCheckWalletTransaction)) {
         LogPrintf("CheckTransaction() failed!");
         return false; // state filled in by CheckTransaction
@@ -1561,6 +1571,12 @@ bool GetTransaction(const uint256 &hash, CTransactionRef &txOut, const Consensus
     return false;
 }
 
+bool GetBlockFilter(const CBlockIndex *pindex, GCSFilter &filter)
+{
+    // blocks connected before the index was enabled have no filter
+    return fBlockFilterIndex && pblocktree->ReadBlockFilter(pindex->GetBlockHash(), filter);
+}
+
 bool GetTimestampIndex(const unsigned int &high, const unsigned int &low, std::vector<uint256> &hashes)
 {
     if (!fTimestampIndex)
@@ -1599,6 +1615,35 @@ bool GetAddressIndex(uint160 addressHash, AddressType type,
     return true;
 }
 
+bool GetAddressBalance(uint160 addressHash, AddressType type, CAmount &balance, CAmount &received)
+{
+    if (!fAddressIndex || !fAddressBalanceIndex)
+        return false;
+
+    CAddressBalanceValue value;
+    if (!pblocktree->ReadAddressBalance(addressHash, type, value))
+        return error("unable to get balance for address");
+
+    balance = value.balance;
+    received = value.received;
+    return true;
+}
+
+/**
+ * Whether the running address balances include the given block already. They are
+ * updated incrementally, so a block connected again, as by VerifyDB or the replay
+ * after a crash, must not be applied twice.
+ */
+static bool AddressBalancesInclude(const CBlockIndex* pindex)
+{
+    uint256 hashBalanceTip;
+    if (!pblocktree->ReadAddressBalanceTip(hashBalanceTip))
+        return false;
+
+    BlockMap::const_iterator it = mapBlockIndex.find(hashBalanceTip);
+    return it != mapBlockIndex.end() && it->second->GetAncestor(pindex->nHeight) == pindex;
+}
+
 bool GetAddressUnspent(uint160 addressHash, AddressType type,
                        std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue> > &unspentOutputs)
 {
@@ -2089,6 +2134,8 @@ bool UndoWriteToDisk(const CBlockUndo& blockundo, CDiskBlockPos& pos, const uint
     return true;
 }
 
+} // anon namespace
+
 bool UndoReadFromDisk(CBlockUndo& blockundo, const CDiskBlockPos& pos, const uint256& hashBlock)
 {
     // Open history file to read
@@ -2115,8 +2162,6 @@ bool UndoReadFromDisk(CBlockUndo& blockundo, const CDiskBlockPos& pos, const uin
     return true;
 }
 
-} // anon namespace
-
 /** Abort with a message */
 bool AbortNode(const std::string& strMessage, const std::string& userMessage)
 {
@@ -2270,7 +2315,13 @@ static DisconnectResult DisconnectBlock(const CBlock& block, CValidationState& s
     //When called from there, no real disconnect happens.
     if(!pfClean) {
         if (fAddressIndex) {
-            if (!pblocktree->EraseAddressIndex(dbIndexHelper.getAddressIndex())) {
+            // balances written before their tip was recorded are at the disconnected block
+            uint256 hashBalanceTip;
+            bool fRevertBalances = fAddressBalanceIndex && (!pblocktree->ReadAddressBalanceTip(hashBalanceTip)
+                    || hashBalanceTip == pindex->GetBlockHash());
+            if (!pblocktree->EraseAddressIndex(dbIndexHelper.getAddressIndex(),
+                    fRevertBalances ? dbIndexHelper.getAddressBalanceDeltas() : CAddressBalanceDeltas(),
+                    fRevertBalances ? pindex->pprev->GetBlockHash() : uint256())) {
                 AbortNode(state, "Failed to delete address index");
                 error("Failed to delete address index");
                 return DISCONNECT_FAILED;
@@ -2741,7 +2792,10 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
         if (!pblocktree->WriteTxIndex(vPos))
             return AbortNode(state, "Failed to write transaction index");
     if (fAddressIndex) {
-        if (!pblocktree->WriteAddressIndex(dbIndexHelper.getAddressIndex()))
+        bool fApplyBalances = fAddressBalanceIndex && !AddressBalancesInclude(pindex);
+        if (!pblocktree->WriteAddressIndex(dbIndexHelper.getAddressIndex(),
+                fApplyBalances ? dbIndexHelper.getAddressBalanceDeltas() : CAddressBalanceDeltas(),
+                fApplyBalances ? pindex->GetBlockHash() : uint256()))
             return AbortNode(state, "Failed to write address index");
 
         if (!pblocktree->UpdateAddressUnspentIndex(dbIndexHelper.getAddressUnspentIndex()))
@@ -2760,6 +2814,10 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
         if (!pblocktree->WriteTimestampIndex(CTimestampIndexKey(pindex->nTime, pindex->GetBlockHash())))
             return AbortNode(state, "Failed to write timestamp index");
 
+    if (fBlockFilterIndex)
+        if (!pblocktree->WriteBlockFilter(pindex->GetBlockHash(), GCSFilter(pindex->GetBlockHash(), BlockFilterElements(block, blockundo))))
+            return AbortNode(state, "Failed to write block filter index");
+
     // add this block to the view's block chain
     view.SetBestBlock(pindex->GetBlockHash());
 
@@ -2785,7 +2843,7 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
 /**
  * Erase all of zerocoin/sigma transactions conflicting with given block from the mempool
  */
-void static RemoveConflictingPrivacyTransactionsFromMempool(const CBlock &block) {
+void RemoveConflictingPrivacyTransactionsFromMempool(const CBlock &block) {
     LOCK(mempool.cs);
 
     // Erase conflicting zerocoin txs from the mempool
@@ -2817,9 +2875,10 @@ void static RemoveConflictingPrivacyTransactionsFromMempool(const CBlock &block)
             {
                 Scalar zcSpendSerial = sigma::GetSigmaSpendSerialNumber(*tx, txin);
                 uint256 thisTxHash = tx->GetHash();
-                uint256 conflictingTxHash = sigmaState->GetMempoolConflictingTxHash(zcSpendSerial);
-                if (!conflictingTxHash.IsNull() && conflictingTxHash != thisTxHash) {
-                    std::list<CTransaction> removed;
+                // the mempool indexes the serials of sigma spends and of joinsplits spending sigma coins
+                for (const uint256& conflictingTxHash : mempool.getSerialSpenders(zcSpendSerial)) {
+                    if (conflictingTxHash == thisTxHash)
+                        continue;
                     auto pTx = mempool.get(conflictingTxHash);
                     if (pTx)
                         mempool.removeRecursive(*pTx);
@@ -2834,25 +2893,23 @@ void static RemoveConflictingPrivacyTransactionsFromMempool(const CBlock &block)
         else if (tx->IsLelantusJoinSplit()) {
            std::vector<Scalar> serials;
            try {
-               serials = lelantus::GetLelantusJoinSplitSerialNumbers(*tx, tx->vin[0]);
-           } catch (CBadTxIn&) {
+               uint64_t fee;
+               lelantus::ParseLelantusJoinSplitSerials(tx->vin[0], serials, fee);
+           } catch (const std::exception&) {
                // nothing
            }
 
            uint256 thisTxHash = tx->GetHash();
-            uint256 conflictingTxHash;
            for(const auto& serial : serials) {
-                conflictingTxHash = lelantusState->GetMempoolConflictingTxHash(serial);
-                if(!conflictingTxHash.IsNull())
-                    break;
-           }
-           if (!conflictingTxHash.IsNull() && conflictingTxHash != thisTxHash) {
-               std::list<CTransaction> removed;
-               auto pTx = mempool.get(conflictingTxHash);
-               if (pTx)
-                   mempool.removeRecursive(*pTx);
-                LogPrintf("ConnectBlock: removed conflicting lelantus joinsplit tx %s from the mempool\n",
-                           conflictingTxHash.ToString());
+               for (const uint256& conflictingTxHash : mempool.getSerialSpenders(serial)) {
+                   if (conflictingTxHash == thisTxHash)
+                       continue;
+                   auto pTx = mempool.get(conflictingTxHash);
+                   if (pTx)
+                       mempool.removeRecursive(*pTx);
+                   LogPrintf("ConnectBlock: removed conflicting lelantus joinsplit tx %s from the mempool\n",
+                              conflictingTxHash.ToString());
+               }
            }
 
            // In any case we need to remove serial from mempool set
@@ -2984,6 +3041,11 @@ bool static FlushStateToDisk(CValidationState &state, FlushStateMode mode, int n
             return AbortNode(state, "Failed to commit EvoDB");
         }
         nLastFlush = nNow;
+        // Checkpoint the privacy states now and then so a crash doesn't cost a full replay
+        if (fPeriodicFlush) {
+            sigma::DumpSigmaState();
+            lelantus::DumpLelantusState();
+        }
     }
     if (fDoFullFlush || ((mode == FLUSH_STATE_ALWAYS || mode == FLUSH_STATE_PERIODIC) && nNow > nLastSetChain + (int64_t)DATABASE_WRITE_INTERVAL * 1000000)) {
         // Update best block in wallet (so we can detect restored wallets).
@@ -4923,6 +4985,11 @@ bool static LoadBlockIndexDB(const CChainParams& chainparams)
     pblocktree->ReadFlag("addressindex", fAddressIndex);
     LogPrintf("%s: address index %s\n", __func__, fAddressIndex ? "enabled" : "disabled");
 
+    // Check whether the address index keeps running balances, older databases need a reindex for that
+    pblocktree->ReadFlag("addressbalanceindex", fAddressBalanceIndex);
+    fAddressBalanceIndex &= fAddressIndex;
+    LogPrintf("%s: address balance index %s\n", __func__, fAddressBalanceIndex ? "enabled" : "disabled");
+
     // Check whether we have a timestamp index
     pblocktree->ReadFlag("timestampindex", fTimestampIndex);
     LogPrintf("%s: timestamp index %s\n", __func__, fTimestampIndex ? "enabled" : "disabled");
@@ -5209,6 +5276,8 @@ bool InitBlockIndex(const CChainParams& chainparams)
     // Use the provided setting for -addressindex in the new database
     fAddressIndex = GetBoolArg("-addressindex", DEFAULT_ADDRESSINDEX);
     pblocktree->WriteFlag("addressindex", fAddressIndex);
+    fAddressBalanceIndex = fAddressIndex;
+    pblocktree->WriteFlag("addressbalanceindex", fAddressBalanceIndex);
 
     fSpentIndex = GetBoolArg("-spentindex", DEFAULT_SPENTINDEX);
     pblocktree->WriteFlag("spentindex", fSpentIndex);
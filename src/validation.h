@@ -40,6 +40,7 @@
 
 class CBlockIndex;
 class CBlockTreeDB;
+class CBlockUndo;
 class CBloomFilter;
 class CChainParams;
 class CInv;
@@ -49,6 +50,7 @@ class CTxMemPool;
 class CTxPoolAggregate;
 class CValidationInterface;
 class CValidationState;
+class GCSFilter;
 struct ChainTxData;
 
 struct PrecomputedTransactionData;
@@ -146,6 +148,7 @@ static const bool DEFAULT_TXINDEX = true;
 static const bool DEFAULT_TIMESTAMPINDEX = false;
 static const bool DEFAULT_ADDRESSINDEX = false;
 static const bool DEFAULT_SPENTINDEX = false;
+static const bool DEFAULT_BLOCKFILTERINDEX = false;
 static const bool DEFAULT_TOR_SETUP = false;
 static const bool DEFAULT_ZAP_WALLET = false;
 static const unsigned int DEFAULT_BANSCORE_THRESHOLD = 100;
@@ -196,6 +199,9 @@ extern std::atomic_bool fImporting;
 extern bool fReindex;
 extern int nScriptCheckThreads;
 extern bool fTxIndex;
+extern bool fBlockFilterIndex;
+/** Whether the address index keeps running address balances */
+extern bool fAddressBalanceIndex;
 extern bool fIsBareMultisigStd;
 extern bool fRequireStandard;
 extern bool fCheckBlockIndex;
@@ -375,6 +381,9 @@ bool AcceptToMemoryPool(CTxPoolAggregate& poolAggregate, CValidationState &state
                         bool* pfMissingInputs, std::list<CTransactionRef>* plTxnReplaced = NULL,
                         bool fOverrideMempoolLimit=false, const CAmount nAbsurdFee=0, bool isCheckWalletTransaction=false, bool markFiroSpendTransactionSerial=true);
 
+/** Remove the mempool transactions spending the zerocoin, sigma or lelantus serials spent by the block */
+void RemoveConflictingPrivacyTransactionsFromMempool(const CBlock &block);
+
 bool GetUTXOCoin(const COutPoint& outpoint, Coin& coin);
 int GetUTXOHeight(const COutPoint& outpoint);
 int GetUTXOConfirmations(const COutPoint& outpoint);
@@ -524,10 +533,14 @@ public:
 };
 
 bool GetTimestampIndex(const unsigned int &high, const unsigned int &low, std::vector<uint256> &hashes);
+/** Reads the filter of the block, false if the block filter index is off or has no filter for it */
+bool GetBlockFilter(const CBlockIndex *pindex, GCSFilter &filter);
 bool GetSpentIndex(CSpentIndexKey &key, CSpentIndexValue &value);
 bool GetAddressIndex(uint160 addressHash, AddressType type,
                      std::vector<std::pair<CAddressIndexKey, CAmount> > &addressIndex,
                      int start = 0, int end = 0);
+/** Returns false if the address index does not keep running balances, use GetAddressIndex then */
+bool GetAddressBalance(uint160 addressHash, AddressType type, CAmount &balance, CAmount &received);
 bool GetAddressUnspent(uint160 addressHash, AddressType type,
                        std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue> > &unspentOutputs);
 
@@ -535,6 +548,8 @@ bool GetAddressUnspent(uint160 addressHash, AddressType type,
 bool WriteBlockToDisk(const CBlock& block, CDiskBlockPos& pos, const CMessageHeader::MessageStartChars& messageStart);
 bool ReadBlockFromDisk(CBlock& block, const CDiskBlockPos& pos, int nHeight, const Consensus::Params& consensusParams);
 bool ReadBlockFromDisk(CBlock& block, const CBlockIndex* pindex, const Consensus::Params& consensusParams);
+/** Read the undo data of a block, hashBlock is the hash of its parent */
+bool UndoReadFromDisk(CBlockUndo& blockundo, const CDiskBlockPos& pos, const uint256& hashBlock);
 
 /** Functions for validating blocks and updating the block tree */
 
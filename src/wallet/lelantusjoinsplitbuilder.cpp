@@ -396,7 +396,8 @@ void LelantusJoinSplitBuilder::CreateJoinSplit(
         const uint64_t& fee,
         CMutableTransaction& tx) {
 
-    lelantus::CLelantusState* state = lelantus::CLelantusState::GetState();
+    // consistent view of the chain state for all the inputs
+    auto state = lelantus::CLelantusState::GetState()->GetSnapshot();
     auto params = lelantus::Params::get_default();
 
     std::vector<std::pair<lelantus::PrivateCoin, uint32_t>> coins;
@@ -437,8 +438,7 @@ void LelantusJoinSplitBuilder::CreateJoinSplit(
             std::vector<lelantus::PublicCoin> set;
             uint256 blockHash;
             if (state->GetCoinSetForSpend(
-                    &chainActive,
-                    chainActive.Height() - (ZC_MINT_CONFIRMATIONS - 1), // required 6 confirmation for mint to spend
+                    state->GetHeight() - (ZC_MINT_CONFIRMATIONS - 1), // required 6 confirmation for mint to spend
                     groupId,
                     blockHash,
                     set) < 2)
@@ -450,7 +450,7 @@ void LelantusJoinSplitBuilder::CreateJoinSplit(
     }
 
 
-    sigma::CSigmaState* sigmaState = sigma::CSigmaState::GetState();
+    auto sigmaState = sigma::CSigmaState::GetState()->GetSnapshot();
 
     for (const auto &spend : sigmaSpendCoins) {
         int64_t denom = spend.get_denomination_value();
@@ -483,8 +483,7 @@ void LelantusJoinSplitBuilder::CreateJoinSplit(
             std::vector<sigma::PublicCoin> group;
             uint256 blockHash;
             if (sigmaState->GetCoinSetForSpend(
-                    &chainActive,
-                    chainActive.Height() - (ZC_MINT_CONFIRMATIONS - 1), // required 6 confirmation for mint to spend
+                    sigmaState->GetHeight() - (ZC_MINT_CONFIRMATIONS - 1), // required 6 confirmation for mint to spend
                     spend.get_denomination(),
                     groupId,
                     blockHash,
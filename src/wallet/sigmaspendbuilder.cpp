@@ -59,7 +59,7 @@ public:
 
 static std::unique_ptr<SigmaSpendSigner> CreateSigner(const CSigmaEntry& coin)
 {
-    sigma::CSigmaState* state = sigma::CSigmaState::GetState();
+    auto state = sigma::CSigmaState::GetState()->GetSnapshot();
     auto params = sigma::Params::get_default();
     auto denom = coin.get_denomination();
 
@@ -95,8 +95,7 @@ static std::unique_ptr<SigmaSpendSigner> CreateSigner(const CSigmaEntry& coin)
     signer->sequence = CTxIn::SEQUENCE_FINAL;
 
     if (state->GetCoinSetForSpend(
-        &chainActive,
-        chainActive.Height() - (ZC_MINT_CONFIRMATIONS - 1), // required 6 confirmation for mint to spend
+        state->GetHeight() - (ZC_MINT_CONFIRMATIONS - 1), // required 6 confirmation for mint to spend
         denom,
         groupId,
         signer->lastBlockOfGroup,
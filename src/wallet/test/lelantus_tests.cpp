@@ -114,6 +114,32 @@ BOOST_AUTO_TEST_CASE(get_and_list_mints)
     uint256 fakeSerial;
     std::fill(fakeSerial.begin(), fakeSerial.end(), 1);
     BOOST_CHECK(!pwalletMain->GetMint(fakeSerial, entry));
+
+    // unused mints are listed from the tracker index, without a status update
+    auto &tracker = pwalletMain->zwallet->GetTracker();
+    BOOST_CHECK_EQUAL(allAmounts.size(), tracker.ListLelantusMints(true, false, false).size());
+
+    CLelantusMintMeta meta;
+    BOOST_CHECK(tracker.GetMetaFromSerial(mints.front().GetSerialHash(), meta));
+
+    CLelantusMintMeta metaFromPubcoin;
+    BOOST_CHECK(tracker.GetLelantusMetaFromPubcoin(meta.GetPubCoinValueHash(), metaFromPubcoin));
+    BOOST_CHECK(metaFromPubcoin.hashSerial == meta.hashSerial);
+
+    tracker.SetLelantusPubcoinUsed(meta.GetPubCoinValueHash(), uint256());
+    auto unused = tracker.ListLelantusMints(true, false, false);
+    BOOST_CHECK_EQUAL(allAmounts.size() - 1, unused.size());
+    for (auto const &m : unused) {
+        BOOST_CHECK(m.hashSerial != meta.hashSerial);
+    }
+    BOOST_CHECK_EQUAL(allAmounts.size(), tracker.ListLelantusMints(false, false, false).size());
+
+    // nothing is left in the indexes after a clear
+    tracker.Clear();
+    BOOST_CHECK(tracker.ListLelantusMints(true, false, false).empty());
+    BOOST_CHECK(tracker.ListLelantusMints(false, false, false).empty());
+    BOOST_CHECK(!tracker.HasLelantusSerialHash(meta.hashSerial));
+    BOOST_CHECK(!tracker.GetLelantusMetaFromPubcoin(meta.GetPubCoinValueHash(), metaFromPubcoin));
 }
 
 BOOST_AUTO_TEST_CASE(mintlelantus_and_mint_all)
@@ -87,7 +87,7 @@ static void GenerateBlockWithCoins(const std::vector<std::pair<sigma::CoinDenomi
 
             auto& pub = priv.getPublicCoin();
 
-            block->second.sigmaMintedPubCoins[std::make_pair(coin.first, 1)].push_back(pub);
+            block->second.sigmaMintedPubCoins.Add(std::make_pair(coin.first, 1), pub);
 
             if (addToWallet) {
                 pwalletMain->zwallet->GetTracker().Add(walletdb, dMint, true);
@@ -430,6 +430,50 @@ BOOST_FIXTURE_TEST_CASE(rescan, TestChain100Setup)
     }
 }
 
+// Verify the cached balances follow the locked coins and the chain tip without
+// the transactions being marked dirty.
+BOOST_FIXTURE_TEST_CASE(cached_balances, TestChain100Setup)
+{
+    LOCK(cs_main);
+    ForceSetArg("-checkwalletbalances", "1");
+
+    // The coinbase of the first block matures.
+    CreateAndProcessBlock({}, GetScriptForRawPubKey(coinbaseKey.GetPubKey()));
+
+    CWallet wallet;
+    LOCK(wallet.cs_wallet);
+    wallet.AddKeyPubKey(coinbaseKey, coinbaseKey.GetPubKey());
+    wallet.ScanForWalletTransactions(chainActive.Genesis());
+
+    CWalletBalances balances = wallet.GetBalances();
+    BOOST_CHECK(balances.nBalance > 0);
+    BOOST_CHECK(balances.nImmature > 0);
+    BOOST_CHECK_EQUAL(balances.nBalanceExcludingLocked, balances.nBalance);
+    BOOST_CHECK_EQUAL(wallet.GetBalance(), balances.nBalance);
+
+    std::vector<COutput> vCoins;
+    wallet.AvailableCoins(vCoins);
+    BOOST_REQUIRE(!vCoins.empty());
+    const COutput& coin = vCoins.front();
+    CAmount nCoinValue = coin.tx->tx->vout[coin.i].nValue;
+
+    wallet.LockCoin(COutPoint(coin.tx->GetHash(), coin.i));
+    BOOST_CHECK_EQUAL(wallet.GetBalance(true), balances.nBalance - nCoinValue);
+    BOOST_CHECK_EQUAL(wallet.GetBalance(), balances.nBalance);
+    wallet.UnlockAllCoins();
+    BOOST_CHECK_EQUAL(wallet.GetBalance(true), balances.nBalance);
+
+    // The wallet is not registered for the new block, its coinbase is not
+    // seen but the coinbase of the second block matures.
+    CreateAndProcessBlock({}, GetScriptForRawPubKey(coinbaseKey.GetPubKey()));
+
+    CWalletBalances newBalances = wallet.GetBalances();
+    BOOST_CHECK(newBalances.nBalance > balances.nBalance);
+    BOOST_CHECK_EQUAL(newBalances.nBalance + newBalances.nImmature, balances.nBalance + balances.nImmature);
+
+    ForceSetArg("-checkwalletbalances", "0");
+}
+
 // Verify importwallet RPC starts rescan at earliest block with timestamp
 // greater or equal than key birthday. Previously there was a bug where
 // importwallet RPC would start the scan at the latest block with timestamp less
@@ -49,8 +49,13 @@
 #include "hdmint/tracker.h"
 
 #include "evo/deterministicmns.h"
+#include "coin_containers.h"
+#include "ctpl.h"
 
 #include <assert.h>
+#include <deque>
+#include <future>
+#include <unordered_set>
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/filesystem.hpp>
@@ -702,9 +707,9 @@ bool CWallet::IsSpent(const uint256 &hash, unsigned int n) const
         LOCK(cs_wallet);
 
         auto& script = tx->tx->vout[n].scriptPubKey;
-        CWalletDB db(strWalletFile);
 
         if (script.IsZerocoinMint()) {
+            CWalletDB db(strWalletFile);
             auto pub = ParseZerocoinMintScript(script);
             CZerocoinEntry data;
 
@@ -1041,7 +1046,49 @@ void CWallet::MarkDirty()
         LOCK(cs_wallet);
         BOOST_FOREACH(PAIRTYPE(const uint256, CWalletTx)& item, mapWallet)
             item.second.MarkDirty();
+        nBalancesVersion++;
+    }
+}
+
+void CWallet::MarkBalancesDirty(const uint256& hashTx) const
+{
+    LOCK(cs_wallet);
+    setCoinTxs.insert(hashTx);
+    nBalancesVersion++;
+}
+
+bool CWallet::MayHaveCoins(const CWalletTx& wtx) const
+{
+    const uint256& hashTx = wtx.GetHash();
+    for (unsigned int i = 0; i < wtx.tx->vout.size(); i++) {
+        const CTxOut& txout = wtx.tx->vout[i];
+        if (txout.scriptPubKey.IsZerocoinMint() || txout.scriptPubKey.IsSigmaMint()
+            || txout.scriptPubKey.IsLelantusMint() || txout.scriptPubKey.IsLelantusJMint())
+            return true;
+        if (IsMine(txout) != ISMINE_NO && !IsSpent(hashTx, i))
+            return true;
     }
+    return false;
+}
+
+std::vector<const CWalletTx*> CWallet::GetCoinTxs() const
+{
+    AssertLockHeld(cs_wallet);
+
+    std::vector<const CWalletTx*> result;
+    result.reserve(setCoinTxs.size());
+
+    for (auto it = setCoinTxs.begin(); it != setCoinTxs.end(); ) {
+        auto mi = mapWallet.find(*it);
+        if (mi == mapWallet.end() || !MayHaveCoins(mi->second)) {
+            it = setCoinTxs.erase(it);
+            continue;
+        }
+        result.push_back(&mi->second);
+        ++it;
+    }
+
+    return result;
 }
 
 bool CWallet::MarkReplaced(const uint256& originalHash, const uint256& newHash)
@@ -2147,11 +2194,222 @@ void CWalletTx::GetAccountAmounts(const string& strAccount, CAmount& nReceived,
     }
 }
 
+namespace {
+
+/**
+ * Mints and spent serials of the wallet, copied at the start of a rescan, so the
+ * blocks can be matched against them from worker threads without cs_wallet and
+ * without a database lookup for every private output and input.
+ *
+ * Records written later are for transactions the wallet makes itself, which are
+ * in mapWallet already and are picked up by the commit stage of the scan.
+ */
+class CWalletScanFilter
+{
+public:
+    explicit CWalletScanFilter(const CWallet& wallet) : wallet(wallet), fLoaded(false), fUseBlockFilters(false) {}
+
+    void Load(CWalletDB& db)
+    {
+        for (bool isLelantus : {false, true}) {
+            for (const CHDMint& dMint : db.ListHDMints(isLelantus))
+                mintHashes.insert(dMint.GetPubCoinHash());
+        }
+
+        // remints spend zerocoin serials
+        std::list<CZerocoinSpendEntry> zerocoinSpends;
+        db.ListCoinSpendSerial(zerocoinSpends);
+        for (const auto& spend : zerocoinSpends)
+            zerocoinSerials.insert(spend.coinSerial);
+
+        std::list<CSigmaSpendEntry> sigmaSpends;
+        db.ListCoinSpendSerial(sigmaSpends);
+        for (const auto& spend : sigmaSpends)
+            sigmaSerials.insert(spend.coinSerial);
+
+        std::list<CLelantusSpendEntry> lelantusSpends;
+        db.ListLelantusSpendSerial(lelantusSpends);
+        for (const auto& spend : lelantusSpends)
+            lelantusSerials.insert(spend.coinSerial);
+
+        fLoaded = true;
+    }
+
+    /**
+     * Lets the blocks, which can't involve the wallet according to the block filter
+     * index, be skipped without reading them. The mints and serials are added to
+     * the elements of the wallet scripts, so this has to follow Load(). Zerocoin
+     * serials aren't part of the filters, remints are matched by the sigma mints
+     * they create.
+     */
+    void UseBlockFilters(GCSFilter::ElementSet walletElements)
+    {
+        assert(fLoaded);
+
+        filterElements = std::move(walletElements);
+        for (const uint256& mintHash : mintHashes)
+            filterElements.insert(BlockFilterElement(mintHash));
+        for (const Scalar& serial : sigmaSerials)
+            filterElements.insert(BlockFilterElement(primitives::GetSerialHash(serial)));
+        for (const Scalar& serial : lelantusSerials)
+            filterElements.insert(BlockFilterElement(primitives::GetSerialHash(serial)));
+
+        fUseBlockFilters = true;
+    }
+
+    //! Whether the block filter shows the block doesn't touch any of the wallet scripts, mints or serials
+    bool CanSkip(const CBlockIndex* pindex) const
+    {
+        if (!fUseBlockFilters)
+            return false;
+
+        GCSFilter blockFilter;
+        return GetBlockFilter(pindex, blockFilter) && !blockFilter.MatchAny(filterElements);
+    }
+
+    /**
+     * Whether the transaction may pay to or spend from the wallet, judging by the
+     * transaction alone. Spends of transparent outputs of the wallet depend on the
+     * transactions found before, those are checked when committing.
+     */
+    bool MayBeRelevant(const CTransaction& tx) const
+    {
+        for (const CTxOut& txout : tx.vout) {
+            if (IsMine(txout))
+                return true;
+        }
+
+        for (const CTxIn& txin : tx.vin) {
+            if (IsSpendOfMine(txin))
+                return true;
+        }
+
+        return false;
+    }
+
+private:
+    bool IsMine(const CTxOut& txout) const
+    {
+        const CScript& script = txout.scriptPubKey;
+        if (!(script.IsSigmaMint() || script.IsLelantusMint() || script.IsLelantusJMint()))
+            return ::IsMine(wallet, script) != ISMINE_NO;
+
+        if (!fLoaded)
+            return true;
+
+        secp_primitives::GroupElement pub;
+        try {
+            if (script.IsSigmaMint())
+                pub = sigma::ParseSigmaMintScript(script);
+            else
+                lelantus::ParseLelantusMintScript(script, pub);
+        } catch (std::invalid_argument&) {
+            return false;
+        }
+
+        return mintHashes.count(primitives::GetPubCoinValueHash(pub)) > 0;
+    }
+
+    bool IsSpendOfMine(const CTxIn& txin) const
+    {
+        if (!(txin.IsSigmaSpend() || txin.IsLelantusJoinSplit() || txin.IsZerocoinRemint()))
+            return false;
+
+        if (!fLoaded)
+            return true;
+
+        try {
+            if (txin.IsZerocoinRemint()) {
+                CDataStream serializedCoinRemint(
+                    std::vector<char>(txin.scriptSig.begin() + 1, txin.scriptSig.end()),
+                    SER_NETWORK, PROTOCOL_VERSION);
+
+                sigma::CoinRemintToV3 remint(serializedCoinRemint);
+                return zerocoinSerials.count(remint.getSerialNumber()) > 0;
+            }
+
+            if (txin.IsSigmaSpend()) {
+                std::unique_ptr<sigma::CoinSpend> spend;
+                std::tie(spend, std::ignore) = sigma::ParseSigmaSpend(txin);
+                return sigmaSerials.count(spend->getCoinSerialNumber()) > 0;
+            }
+
+            std::unique_ptr<lelantus::JoinSplit> joinsplit = lelantus::ParseLelantusJoinSplit(txin);
+            for (const auto& serial : joinsplit->getCoinSerialNumbers()) {
+                if (lelantusSerials.count(serial))
+                    return true;
+            }
+        } catch (CBadTxIn&) {
+        } catch (std::ios_base::failure&) {
+        }
+
+        return false;
+    }
+
+    const CWallet& wallet;
+    bool fLoaded;
+    std::set<uint256> mintHashes;
+    std::set<Bignum> zerocoinSerials;
+    std::unordered_set<Scalar, sigma::CScalarHash> sigmaSerials;
+    std::unordered_set<Scalar, sigma::CScalarHash> lelantusSerials;
+    bool fUseBlockFilters;
+    GCSFilter::ElementSet filterElements;
+};
+
+/** A block read by the rescan, along with the transactions, which may be relevant to the wallet. */
+struct CRescannedBlock
+{
+    CBlock block;
+    std::vector<size_t> candidates;
+    bool fRead;
+
+    CRescannedBlock() : fRead(false) {}
+};
+
+/**
+ * Reads a block from disk and matches its transactions against the filter.
+ *
+ * Neither the chain nor the wallet state are touched, so this can be run from
+ * worker threads in parallel.
+ */
+CRescannedBlock ReadAndMatchBlock(const CWalletScanFilter& filter, const CBlockIndex* pindex)
+{
+    CRescannedBlock scanned;
+
+    if (filter.CanSkip(pindex)) {
+        // nothing to add, same as an empty block
+        scanned.fRead = true;
+        return scanned;
+    }
+
+    if (!ReadBlockFromDisk(scanned.block, pindex, Params().GetConsensus())) {
+        return scanned;
+    }
+    scanned.fRead = true;
+
+    for (size_t posInBlock = 0; posInBlock < scanned.block.vtx.size(); ++posInBlock) {
+        if (filter.MayBeRelevant(*scanned.block.vtx[posInBlock])) {
+            scanned.candidates.push_back(posInBlock);
+        }
+    }
+
+    return scanned;
+}
+
+} // namespace
+
 /**
  * Scan the block chain (starting in pindexStart) for transactions
  * from or to us. If fUpdate is true, found transactions that already
  * exist in the wallet will be updated.
  *
+ * Blocks are read and matched ahead of time by a pool of worker threads, while
+ * cs_main and cs_wallet are only taken to add the matching transactions of each
+ * block, so the node keeps processing blocks during a long rescan. If the block
+ * being added got disconnected meanwhile, the scan goes on from the fork point.
+ * With -blockfilterindex, blocks whose filter matches nothing of the wallet are
+ * not read at all.
+ *
  * Returns pointer to the first block in the last contiguous range that was
  * successfully scanned.
  *
@@ -2163,6 +2421,8 @@ CBlockIndex* CWallet::ScanForWalletTransactions(CBlockIndex *pindexStart, bool f
     const CChainParams& chainParams = Params();
 
     CBlockIndex* pindex = pindexStart;
+    CWalletScanFilter filter(*this);
+    double dProgressStart, dProgressTip;
     {
         LOCK2(cs_main, cs_wallet);
 
@@ -2177,36 +2437,146 @@ CBlockIndex* CWallet::ScanForWalletTransactions(CBlockIndex *pindexStart, bool f
             while (pindex && nTimeFirstKey && (pindex->GetBlockTime() < (nTimeFirstKey - 7200)))
                 pindex = chainActive.Next(pindex);
 
-        ShowProgress(_("Rescanning..."), 0); // show rescan progress in GUI as dialog or on splashscreen, if -rescan on startup
-        double dProgressStart = GuessVerificationProgress(chainParams.TxData(), pindex);
-        double dProgressTip = GuessVerificationProgress(chainParams.TxData(), chainActive.Tip());
-        while (pindex)
-        {
-            if (pindex->nHeight % 100 == 0 && dProgressTip - dProgressStart > 0.0)
-                ShowProgress(_("Rescanning..."), std::max(1, std::min(99, (int)((GuessVerificationProgress(chainParams.TxData(), pindex) - dProgressStart) / (dProgressTip - dProgressStart) * 100))));
-            if (GetTime() >= nNow + 60) {
-                nNow = GetTime();
-                LogPrintf("Still rescanning. At block %d. Progress=%f\n", pindex->nHeight, GuessVerificationProgress(chainParams.TxData(), pindex));
-            }
+        if (fFileBacked) {
+            CWalletDB db(strWalletFile);
+            filter.Load(db);
+            if (fBlockFilterIndex)
+                filter.UseBlockFilters(GetBlockFilterElements());
+        }
+
+        dProgressStart = GuessVerificationProgress(chainParams.TxData(), pindex);
+        dProgressTip = GuessVerificationProgress(chainParams.TxData(), chainActive.Tip());
+    }
+
+    ShowProgress(_("Rescanning..."), 0); // show rescan progress in GUI as dialog or on splashscreen, if -rescan on startup
+
+    int nThreads = GetArg("-rescanthreads", DEFAULT_RESCAN_THREADS);
+    if (nThreads <= 0) {
+        nThreads = std::max(GetNumCores(), 1);
+    }
+
+    ctpl::thread_pool workerPool(nThreads);
+    RenameThreadPool(workerPool, "wallet-rescan");
+
+    const size_t nMaxPrefetch = nThreads * RESCAN_PREFETCH_PER_THREAD;
+    std::deque<std::pair<CBlockIndex*, std::future<CRescannedBlock>>> prefetched;
+    CBlockIndex* pnext = pindex;
 
-            CBlock block;
-            if (ReadBlockFromDisk(block, pindex, Params().GetConsensus())) {
-                for (size_t posInBlock = 0; posInBlock < block.vtx.size(); ++posInBlock) {
-                    AddToWalletIfInvolvingMe(*block.vtx[posInBlock], pindex, posInBlock, fUpdate);
+    auto prefetch = [&]() {
+        AssertLockHeld(cs_main);
+        while (prefetched.size() < nMaxPrefetch && pnext) {
+            const CBlockIndex* pblock = pnext;
+            prefetched.emplace_back(pnext, workerPool.push([&filter, pblock](int) {
+                return ReadAndMatchBlock(filter, pblock);
+            }));
+            pnext = chainActive.Next(pnext);
+        }
+    };
+
+    {
+        LOCK(cs_main);
+        prefetch();
+    }
+
+    while (!prefetched.empty())
+    {
+        pindex = prefetched.front().first;
+        CRescannedBlock scanned = prefetched.front().second.get();
+        prefetched.pop_front();
+
+        if (pindex->nHeight % 100 == 0 && dProgressTip - dProgressStart > 0.0)
+            ShowProgress(_("Rescanning..."), std::max(1, std::min(99, (int)((GuessVerificationProgress(chainParams.TxData(), pindex) - dProgressStart) / (dProgressTip - dProgressStart) * 100))));
+        if (GetTime() >= nNow + 60) {
+            nNow = GetTime();
+            LogPrintf("Still rescanning. At block %d. Progress=%f\n", pindex->nHeight, GuessVerificationProgress(chainParams.TxData(), pindex));
+        }
+
+        LOCK2(cs_main, cs_wallet);
+
+        if (!chainActive.Contains(pindex)) {
+            // the blocks read ahead are from the stale branch as well
+            prefetched.clear();
+            const CBlockIndex* pfork = chainActive.FindFork(pindex);
+            pnext = pfork ? chainActive.Next(pfork) : chainActive.Genesis();
+            LogPrintf("Rescan block %s was disconnected, continuing at height %d\n", pindex->GetBlockHash().ToString(), pnext ? pnext->nHeight : -1);
+            prefetch();
+            continue;
+        }
+
+        if (scanned.fRead) {
+            const CBlock& block = scanned.block;
+            auto candidate = scanned.candidates.begin();
+            for (size_t posInBlock = 0; posInBlock < block.vtx.size(); ++posInBlock) {
+                const CTransaction& tx = *block.vtx[posInBlock];
+                bool fCandidate = candidate != scanned.candidates.end() && *candidate == posInBlock;
+                if (fCandidate) {
+                    ++candidate;
                 }
-                if (!ret) {
-                    ret = pindex;
+                // whether the transaction is known, spends from or conflicts with the
+                // wallet depends on the transactions added before, so check it here
+                if (fCandidate || IsInvolvedBySpends(tx)) {
+                    AddToWalletIfInvolvingMe(tx, pindex, posInBlock, fUpdate);
                 }
-            } else {
-                ret = nullptr;
             }
-            pindex = chainActive.Next(pindex);
+            if (!ret) {
+                ret = pindex;
+            }
+        } else {
+            ret = nullptr;
         }
-        ShowProgress(_("Rescanning..."), 100); // hide progress dialog in GUI
+
+        prefetch();
     }
+
+    workerPool.clear_queue();
+    workerPool.stop(true);
+
+    ShowProgress(_("Rescanning..."), 100); // hide progress dialog in GUI
     return ret;
 }
 
+GCSFilter::ElementSet CWallet::GetBlockFilterElements() const
+{
+    GCSFilter::ElementSet elements;
+    auto addScript = [&elements](const CScript& script) {
+        elements.emplace(script.begin(), script.end());
+    };
+
+    std::set<CKeyID> keyIDs;
+    GetKeys(keyIDs);
+    for (const CKeyID& keyID : keyIDs) {
+        addScript(GetScriptForDestination(keyID));
+        CPubKey pubKey;
+        if (GetPubKey(keyID, pubKey))
+            addScript(GetScriptForRawPubKey(pubKey));
+    }
+
+    LOCK(cs_KeyStore);
+    for (const auto& script : mapScripts) {
+        addScript(GetScriptForDestination(script.first));
+        addScript(script.second);
+    }
+    for (const CScript& script : setWatchOnly)
+        addScript(script);
+
+    return elements;
+}
+
+bool CWallet::IsInvolvedBySpends(const CTransaction& tx) const
+{
+    AssertLockHeld(cs_wallet);
+
+    if (mapWallet.count(tx.GetHash()))
+        return true;
+
+    for (const CTxIn& txin : tx.vin) {
+        if (mapWallet.count(txin.prevout.hash) || mapTxSpends.count(txin.prevout))
+            return true;
+    }
+
+    return false;
+}
+
 void CWallet::ReacceptWalletTransactions()
 {
     // If transactions aren't being broadcasted, don't let them into local mempool either
@@ -2293,6 +2663,22 @@ set<uint256> CWalletTx::GetConflicts() const
     return result;
 }
 
+void CWalletTx::MarkDirty()
+{
+    fCreditCached = false;
+    fAvailableCreditCached = false;
+    fImmatureCreditCached = false;
+    fWatchDebitCached = false;
+    fWatchCreditCached = false;
+    fAvailableWatchCreditCached = false;
+    fImmatureWatchCreditCached = false;
+    fDebitCached = false;
+    fChangeCached = false;
+
+    if (pwallet != NULL)
+        pwallet->MarkBalancesDirty(GetHash());
+}
+
 CAmount CWalletTx::GetDebit(const isminefilter& filter) const
 {
     if (tx->vin.empty())
@@ -2622,18 +3008,76 @@ void CWallet::ResendWalletTransactions(int64_t nBestBlockTime, CConnman* connman
 
 CAmount CWallet::GetBalance(bool fExcludeLocked) const
 {
-    CAmount nTotal = 0;
-    {
-        LOCK2(cs_main, cs_wallet);
-        for (map<uint256, CWalletTx>::const_iterator it = mapWallet.begin(); it != mapWallet.end(); ++it)
-        {
-            const CWalletTx* pcoin = &(*it).second;
-            if (pcoin->IsTrusted())
-                nTotal += pcoin->GetAvailableCredit(true, fExcludeLocked);
+    CWalletBalances balances = GetBalances();
+    return fExcludeLocked ? balances.nBalanceExcludingLocked : balances.nBalance;
+}
+
+CWallet::CBalancesStamp CWallet::GetBalancesStamp() const
+{
+    AssertLockHeld(cs_main);
+    AssertLockHeld(cs_wallet);
+
+    CBalancesStamp stamp;
+    stamp.pindexTip = chainActive.Tip();
+    stamp.nMempoolUpdated = mempool.GetTransactionsUpdated();
+    stamp.nStempoolUpdated = txpools.getStemTxPool().GetTransactionsUpdated();
+    stamp.nWalletVersion = nBalancesVersion;
+    return stamp;
+}
+
+CWalletBalances CWallet::ComputeBalances(const std::vector<const CWalletTx*>& vTxs) const
+{
+    CWalletBalances balances;
+
+    for (const CWalletTx* pcoin : vTxs) {
+        bool fTrusted = pcoin->IsTrusted();
+        bool fUnconfirmed = !fTrusted && pcoin->GetDepthInMainChain() == 0 &&
+            (pcoin->InMempool() || pcoin->InStempool());
+
+        if (fTrusted) {
+            // the excluding variant overwrites the cached credit, so it goes first
+            if (!setLockedCoins.empty())
+                balances.nBalanceExcludingLocked += pcoin->GetAvailableCredit(true, true);
+            balances.nBalance += pcoin->GetAvailableCredit();
+            balances.nWatchOnly += pcoin->GetAvailableWatchOnlyCredit();
+        } else if (fUnconfirmed) {
+            balances.nUnconfirmed += pcoin->GetAvailableCredit();
+            balances.nUnconfirmedWatchOnly += pcoin->GetAvailableWatchOnlyCredit();
         }
+
+        balances.nImmature += pcoin->GetImmatureCredit();
+        balances.nImmatureWatchOnly += pcoin->GetImmatureWatchOnlyCredit();
+    }
+
+    if (setLockedCoins.empty())
+        balances.nBalanceExcludingLocked = balances.nBalance;
+
+    return balances;
+}
+
+CWalletBalances CWallet::GetBalances() const
+{
+    LOCK2(cs_main, cs_wallet);
+
+    CBalancesStamp stamp = GetBalancesStamp();
+    if (fBalancesCached && balancesStamp == stamp)
+        return cachedBalances;
+
+    // depth and trust of the transactions depend on the chain and the mempools,
+    // so the totals are recomputed over the candidates rather than adjusted
+    cachedBalances = ComputeBalances(GetCoinTxs());
+    balancesStamp = stamp;
+    fBalancesCached = true;
+
+    if (GetBoolArg("-checkwalletbalances", DEFAULT_CHECK_WALLET_BALANCES)) {
+        std::vector<const CWalletTx*> vAllTxs;
+        vAllTxs.reserve(mapWallet.size());
+        for (const auto& item : mapWallet)
+            vAllTxs.push_back(&item.second);
+        assert(ComputeBalances(vAllTxs) == cachedBalances);
     }
 
-    return nTotal;
+    return cachedBalances;
 }
 
 std::vector<CRecipient> CWallet::CreateSigmaMintRecipients(
@@ -3244,71 +3688,24 @@ bool CWallet::GetCoinsToJoinSplit(
 }
 
 CAmount CWallet::GetUnconfirmedBalance() const {
-    CAmount nTotal = 0;
-    {
-        LOCK2(cs_main, cs_wallet);
-        for (map<uint256, CWalletTx>::const_iterator it = mapWallet.begin(); it != mapWallet.end(); ++it) {
-            const CWalletTx *pcoin = &(*it).second;
-            if (!pcoin->IsTrusted() && pcoin->GetDepthInMainChain() == 0 &&
-                (pcoin->InMempool() || pcoin->InStempool()))
-                nTotal += pcoin->GetAvailableCredit();
-        }
-    }
-    return nTotal;
+    return GetBalances().nUnconfirmed;
 }
 
 CAmount CWallet::GetImmatureBalance() const {
-    CAmount nTotal = 0;
-    {
-        LOCK2(cs_main, cs_wallet);
-        for (map<uint256, CWalletTx>::const_iterator it = mapWallet.begin(); it != mapWallet.end(); ++it) {
-            const CWalletTx *pcoin = &(*it).second;
-            nTotal += pcoin->GetImmatureCredit();
-        }
-    }
-    return nTotal;
+    return GetBalances().nImmature;
 }
 
 CAmount CWallet::GetWatchOnlyBalance() const {
-    CAmount nTotal = 0;
-    {
-        LOCK2(cs_main, cs_wallet);
-        for (map<uint256, CWalletTx>::const_iterator it = mapWallet.begin(); it != mapWallet.end(); ++it) {
-            const CWalletTx *pcoin = &(*it).second;
-            if (pcoin->IsTrusted())
-                nTotal += pcoin->GetAvailableWatchOnlyCredit();
-        }
-    }
-
-    return nTotal;
+    return GetBalances().nWatchOnly;
 }
 
 CAmount CWallet::GetUnconfirmedWatchOnlyBalance() const {
-    CAmount nTotal = 0;
-    {
-        LOCK2(cs_main, cs_wallet);
-        for (map<uint256, CWalletTx>::const_iterator it = mapWallet.begin(); it != mapWallet.end(); ++it) {
-            const CWalletTx *pcoin = &(*it).second;
-            if (!pcoin->IsTrusted() && pcoin->GetDepthInMainChain() == 0 &&
-                (pcoin->InMempool() || pcoin->InStempool()))
-                nTotal += pcoin->GetAvailableWatchOnlyCredit();
-        }
-    }
-    return nTotal;
+    return GetBalances().nUnconfirmedWatchOnly;
 }
 
 CAmount CWallet::GetImmatureWatchOnlyBalance() const
 {
-    CAmount nTotal = 0;
-    {
-        LOCK2(cs_main, cs_wallet);
-        for (map<uint256, CWalletTx>::const_iterator it = mapWallet.begin(); it != mapWallet.end(); ++it)
-        {
-            const CWalletTx* pcoin = &(*it).second;
-            nTotal += pcoin->GetImmatureWatchOnlyCredit();
-        }
-    }
-    return nTotal;
+    return GetBalances().nImmatureWatchOnly;
 }
 
 void CWallet::AvailableCoins(vector <COutput> &vCoins, bool fOnlyConfirmed, const CCoinControl *coinControl, bool fIncludeZeroValue) const
@@ -3320,10 +3717,9 @@ void CWallet::AvailableCoins(vector <COutput> &vCoins, bool fOnlyConfirmed, cons
 
     {
         LOCK2(cs_main, cs_wallet);
-        for (map<uint256, CWalletTx>::const_iterator it = mapWallet.begin(); it != mapWallet.end(); ++it)
+        for (const CWalletTx* pcoin : GetCoinTxs())
         {
-            const uint256& wtxid = it->first;
-            const CWalletTx* pcoin = &(*it).second;
+            const uint256& wtxid = pcoin->GetHash();
 
             if (!CheckFinalTx(*pcoin))
                 continue;
@@ -3401,9 +3797,9 @@ void CWallet::AvailableCoins(vector <COutput> &vCoins, bool fOnlyConfirmed, cons
 
 
                 if (!(IsSpent(wtxid, i)) && mine != ISMINE_NO &&
-                    (!IsLockedCoin((*it).first, i) || nCoinType == CoinType::ONLY_1000) &&
+                    (!IsLockedCoin(wtxid, i) || nCoinType == CoinType::ONLY_1000) &&
                     (pcoin->tx->vout[i].nValue > 0 || fIncludeZeroValue || (pcoin->tx->vout[i].scriptPubKey.IsLelantusJMint() && GetCredit(pcoin->tx->vout[i], ISMINE_SPENDABLE) > 0)) &&
-                    (!coinControl || !coinControl->HasSelected() || coinControl->fAllowOtherInputs || coinControl->IsSelected(COutPoint((*it).first, i)))) {
+                    (!coinControl || !coinControl->HasSelected() || coinControl->fAllowOtherInputs || coinControl->IsSelected(COutPoint(wtxid, i)))) {
                         vCoins.push_back(COutput(pcoin, i, nDepth,
                                                  ((mine & ISMINE_SPENDABLE) != ISMINE_NO) ||
                                                   (coinControl && coinControl->fAllowWatchOnly && (mine & ISMINE_WATCH_SOLVABLE) != ISMINE_NO),
@@ -3573,8 +3969,14 @@ void CWallet::ListAvailableSigmaMintCoins(vector<COutput> &vCoins, bool fOnlyCon
     CWalletDB walletdb(pwalletMain->strWalletFile);
     listOwnCoins = zwallet->GetTracker().MintsAsSigmaEntries(true, false);
     LogPrintf("listOwnCoins.size()=%s\n", listOwnCoins.size());
-    for (map<uint256, CWalletTx>::const_iterator it = mapWallet.begin(); it != mapWallet.end(); ++it) {
-        const CWalletTx *pcoin = &(*it).second;
+
+    std::set<uint256> setOwnPubCoins;
+    BOOST_FOREACH(const CSigmaEntry &ownCoinItem, listOwnCoins) {
+        if (ownCoinItem.IsUsed == false && ownCoinItem.randomness != uint64_t(0) && ownCoinItem.serialNumber != uint64_t(0))
+            setOwnPubCoins.insert(primitives::GetPubCoinValueHash(ownCoinItem.value));
+    }
+
+    for (const CWalletTx *pcoin : GetCoinTxs()) {
 //        LogPrintf("pcoin=%s\n", pcoin->GetHash().ToString());
         if (!CheckFinalTx(*pcoin)) {
             LogPrintf("!CheckFinalTx(*pcoin)=%s\n", !CheckFinalTx(*pcoin));
@@ -3605,12 +4007,9 @@ void CWallet::ListAvailableSigmaMintCoins(vector<COutput> &vCoins, bool fOnlyCon
                     txout.scriptPubKey);
                 LogPrintf("Pubcoin=%s\n", pubCoin.tostring());
                 // CHECKING PROCESS
-                BOOST_FOREACH(const CSigmaEntry &ownCoinItem, listOwnCoins) {
-                   if (ownCoinItem.value == pubCoin && ownCoinItem.IsUsed == false &&
-                        ownCoinItem.randomness != uint64_t(0) && ownCoinItem.serialNumber != uint64_t(0)) {
-                        vCoins.push_back(COutput(pcoin, i, nDepth, true, true));
-                        LogPrintf("-->OK\n");
-                    }
+                if (setOwnPubCoins.count(primitives::GetPubCoinValueHash(pubCoin))) {
+                    vCoins.push_back(COutput(pcoin, i, nDepth, true, true));
+                    LogPrintf("-->OK\n");
                 }
             }
         }
@@ -3626,8 +4025,14 @@ void CWallet::ListAvailableLelantusMintCoins(vector<COutput> &vCoins, bool fOnly
     CWalletDB walletdb(pwalletMain->strWalletFile);
     listOwnCoins = zwallet->GetTracker().MintsAsLelantusEntries(true, false);
     LogPrintf("listOwnCoins.size()=%s\n", listOwnCoins.size());
-    for (map<uint256, CWalletTx>::const_iterator it = mapWallet.begin(); it != mapWallet.end(); ++it) {
-        const CWalletTx *pcoin = &(*it).second;
+
+    std::set<uint256> setOwnPubCoins;
+    BOOST_FOREACH(const CLelantusEntry& ownCoinItem, listOwnCoins) {
+        if (ownCoinItem.IsUsed == false && !ownCoinItem.randomness.isZero() && !ownCoinItem.serialNumber.isZero())
+            setOwnPubCoins.insert(primitives::GetPubCoinValueHash(ownCoinItem.value));
+    }
+
+    for (const CWalletTx *pcoin : GetCoinTxs()) {
 //        LogPrintf("pcoin=%s\n", pcoin->GetHash().ToString());
         if (!CheckFinalTx(*pcoin)) {
             LogPrintf("!CheckFinalTx(*pcoin)=%s\n", !CheckFinalTx(*pcoin));
@@ -3658,12 +4063,9 @@ void CWallet::ListAvailableLelantusMintCoins(vector<COutput> &vCoins, bool fOnly
                 lelantus::ParseLelantusMintScript(txout.scriptPubKey, pubCoin);
                 LogPrintf("Pubcoin=%s\n", pubCoin.tostring());
                 // CHECKING PROCESS
-                BOOST_FOREACH(const CLelantusEntry& ownCoinItem, listOwnCoins) {
-                    if (ownCoinItem.value == pubCoin && ownCoinItem.IsUsed == false &&
-                        !ownCoinItem.randomness.isZero() && !ownCoinItem.serialNumber.isZero()) {
-                        vCoins.push_back(COutput(pcoin, i, nDepth, true, true));
-                        LogPrintf("-->OK\n");
-                    }
+                if (setOwnPubCoins.count(primitives::GetPubCoinValueHash(pubCoin))) {
+                    vCoins.push_back(COutput(pcoin, i, nDepth, true, true));
+                    LogPrintf("-->OK\n");
                 }
             }
         }
@@ -4388,6 +4790,7 @@ bool CWallet::EraseFromWallet(uint256 hash) {
         LOCK(cs_wallet);
         if (mapWallet.erase(hash))
             CWalletDB(strWalletFile).EraseTx(hash);
+        nBalancesVersion++;
     }
     return true;
 }
@@ -7244,6 +7647,7 @@ bool CWallet::SetAddressBook(const CTxDestination& address, const string& strNam
         mapAddressBook[address].name = strName;
         if (!strPurpose.empty()) /* update purpose only if requested */
             mapAddressBook[address].purpose = strPurpose;
+        nBalancesVersion++; // account tallies
     }
     NotifyAddressBookChanged(this, address, strName, ::IsMine(*this, address) != ISMINE_NO,
                              strPurpose, (fUpdated ? CT_UPDATED : CT_NEW) );
@@ -7269,6 +7673,7 @@ bool CWallet::DelAddressBook(const CTxDestination& address)
             }
         }
         mapAddressBook.erase(address);
+        nBalancesVersion++; // account tallies
     }
 
     NotifyAddressBookChanged(this, address, "", ::IsMine(*this, address) != ISMINE_NO, "", CT_DELETED);
@@ -7574,12 +7979,11 @@ CAmount CWallet::GetAccountBalance(const std::string& strAccount, int nMinDepth,
     return GetAccountBalance(walletdb, strAccount, nMinDepth, filter);
 }
 
-CAmount CWallet::GetAccountBalance(CWalletDB& walletdb, const std::string& strAccount, int nMinDepth, const isminefilter& filter)
+CAmount CWallet::TallyAccount(const std::string& strAccount, int nMinDepth, const isminefilter& filter) const
 {
     CAmount nBalance = 0;
 
-    // Tally wallet transactions
-    for (map<uint256, CWalletTx>::iterator it = mapWallet.begin(); it != mapWallet.end(); ++it)
+    for (map<uint256, CWalletTx>::const_iterator it = mapWallet.begin(); it != mapWallet.end(); ++it)
     {
         const CWalletTx& wtx = (*it).second;
         if (!CheckFinalTx(wtx) || wtx.GetBlocksToMaturity() > 0 || wtx.GetDepthInMainChain() < 0)
@@ -7593,6 +7997,34 @@ CAmount CWallet::GetAccountBalance(CWalletDB& walletdb, const std::string& strAc
         nBalance -= nSent + nFee;
     }
 
+    return nBalance;
+}
+
+CAmount CWallet::GetAccountBalance(CWalletDB& walletdb, const std::string& strAccount, int nMinDepth, const isminefilter& filter)
+{
+    CAmount nBalance = 0;
+
+    // Tally wallet transactions, the spent outputs count too so all of mapWallet is
+    // walked, the tallies are kept until the chain, the mempools or the wallet change
+    {
+        LOCK2(cs_main, cs_wallet);
+
+        CBalancesStamp stamp = GetBalancesStamp();
+        if (!(accountTalliesStamp == stamp)) {
+            mapAccountTallies.clear();
+            accountTalliesStamp = stamp;
+        }
+
+        auto key = std::make_tuple(strAccount, nMinDepth, filter);
+        auto it = mapAccountTallies.find(key);
+        if (it == mapAccountTallies.end())
+            it = mapAccountTallies.emplace(key, TallyAccount(strAccount, nMinDepth, filter)).first;
+        else if (GetBoolArg("-checkwalletbalances", DEFAULT_CHECK_WALLET_BALANCES))
+            assert(it->second == TallyAccount(strAccount, nMinDepth, filter));
+
+        nBalance += it->second;
+    }
+
     // Tally internal accounting entries
     nBalance += walletdb.GetAccountCreditDebit(strAccount);
 
@@ -7695,18 +8127,21 @@ void CWallet::LockCoin(const COutPoint& output)
 {
     AssertLockHeld(cs_wallet); // setLockedCoins
     setLockedCoins.insert(output);
+    nBalancesVersion++;
 }
 
 void CWallet::UnlockCoin(const COutPoint& output)
 {
     AssertLockHeld(cs_wallet); // setLockedCoins
     setLockedCoins.erase(output);
+    nBalancesVersion++;
 }
 
 void CWallet::UnlockAllCoins()
 {
     AssertLockHeld(cs_wallet); // setLockedCoins
     setLockedCoins.clear();
+    nBalancesVersion++;
 }
 
 bool CWallet::IsLockedCoin(uint256 hash, unsigned int n) const
@@ -7901,6 +8336,7 @@ std::string CWallet::GetWalletHelpString(bool showDebug)
     strUsage += HelpMessageOpt("-paytxfee=<amt>", strprintf(_("Fee (in %s/kB) to add to transactions you send (default: %s)"),
                                                             CURRENCY_UNIT, FormatMoney(payTxFee.GetFeePerK())));
     strUsage += HelpMessageOpt("-rescan", _("Rescan the block chain for missing wallet transactions on startup"));
+    strUsage += HelpMessageOpt("-rescanthreads=<n>", strprintf(_("The number of threads reading and matching blocks during a rescan, 0 for one per core (default: %d)"), DEFAULT_RESCAN_THREADS));
     strUsage += HelpMessageOpt("-salvagewallet", _("Attempt to recover private keys from a corrupt wallet on startup"));
     if (showDebug)
         strUsage += HelpMessageOpt("-sendfreetransactions", strprintf(_("Send transactions as zero-fee transactions if possible (default: %u)"), DEFAULT_SEND_FREE_TRANSACTIONS));
@@ -7926,6 +8362,7 @@ std::string CWallet::GetWalletHelpString(bool showDebug)
     {
         strUsage += HelpMessageGroup(_("Wallet debugging/testing options:"));
 
+        strUsage += HelpMessageOpt("-checkwalletbalances", strprintf("Check the cached wallet balances against a scan of all wallet transactions, slow (default: %u)", DEFAULT_CHECK_WALLET_BALANCES));
         strUsage += HelpMessageOpt("-dblogsize=<n>", strprintf("Flush wallet database activity from memory to disk log every <n> megabytes (default: %u)", DEFAULT_WALLET_DBLOGSIZE));
         strUsage += HelpMessageOpt("-flushwallet", strprintf("Run a thread to flush wallet periodically (default: %u)", DEFAULT_FLUSHWALLET));
         strUsage += HelpMessageOpt("-privdb", strprintf("Sets the DB_PRIVATE flag in the wallet db environment (default: %u)", DEFAULT_WALLET_PRIVDB));
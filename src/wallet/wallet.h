@@ -7,6 +7,7 @@
 #define BITCOIN_WALLET_WALLET_H
 
 #include "amount.h"
+#include "blockfilter.h"
 #include "../libzerocoin/bitcoin_bignum/bignum.h"
 #include "../sigma/coin.h"
 #include "../liblelantus/coin.h"
@@ -38,6 +39,7 @@
 #include <stdexcept>
 #include <stdint.h>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -91,6 +93,14 @@ static const bool DEFAULT_USE_HD_WALLET = true;
 //! if set, all keys will be derived by using BIP39
 static const bool DEFAULT_USE_MNEMONIC = true;
 
+//! Default number of threads reading blocks during a rescan, 0 means one per core
+static const int DEFAULT_RESCAN_THREADS = 0;
+//! Number of blocks read ahead of a rescan per thread
+static const int RESCAN_PREFETCH_PER_THREAD = 8;
+
+//! Whether the cached balances are checked against a scan of all wallet transactions
+static const bool DEFAULT_CHECK_WALLET_BALANCES = false;
+
 extern const char * DEFAULT_WALLET_DAT;
 
 const uint32_t BIP32_HARDENED_KEY_LIMIT = 0x80000000;
@@ -440,18 +450,7 @@ public:
     }
 
     //! make sure balances are recalculated
-    void MarkDirty()
-    {
-        fCreditCached = false;
-        fAvailableCreditCached = false;
-        fImmatureCreditCached = false;
-        fWatchDebitCached = false;
-        fWatchCreditCached = false;
-        fAvailableWatchCreditCached = false;
-        fImmatureWatchCreditCached = false;
-        fDebitCached = false;
-        fChangeCached = false;
-    }
+    void MarkDirty();
 
     void BindWallet(CWallet *pwalletIn)
     {
@@ -630,6 +629,29 @@ private:
     std::vector<char> _ssExtra;
 };
 
+/** Totals over the wallet transactions, see CWallet::GetBalances() */
+struct CWalletBalances
+{
+    CAmount nBalance = 0;
+    CAmount nBalanceExcludingLocked = 0;
+    CAmount nUnconfirmed = 0;
+    CAmount nImmature = 0;
+    CAmount nWatchOnly = 0;
+    CAmount nUnconfirmedWatchOnly = 0;
+    CAmount nImmatureWatchOnly = 0;
+
+    bool operator==(const CWalletBalances& other) const
+    {
+        return nBalance == other.nBalance
+            && nBalanceExcludingLocked == other.nBalanceExcludingLocked
+            && nUnconfirmed == other.nUnconfirmed
+            && nImmature == other.nImmature
+            && nWatchOnly == other.nWatchOnly
+            && nUnconfirmedWatchOnly == other.nUnconfirmedWatchOnly
+            && nImmatureWatchOnly == other.nImmatureWatchOnly;
+    }
+};
+
 /**
  * A CWallet is an extension of a keystore, which also maintains a set of transactions and balances,
  * and provides the ability to create new transactions.
@@ -675,6 +697,47 @@ private:
 
     std::set<COutPoint> setWalletUTXO;
 
+    /**
+     * Wallet transactions which may still have unspent outputs of ours, the balances and
+     * the available coins are computed over these instead of the whole mapWallet. A
+     * transaction is added whenever it is marked dirty and dropped lazily once all of its
+     * outputs are spent or not ours. Transactions with private mints are never dropped,
+     * the spends of the mints are tracked by the mint tracker instead of mapTxSpends.
+     */
+    mutable std::set<uint256> setCoinTxs;
+    //! Bumped whenever something the balances depend on changes in the wallet
+    mutable uint64_t nBalancesVersion;
+
+    //! State of the chain, the mempools and the wallet the cached balances are valid for
+    struct CBalancesStamp
+    {
+        const CBlockIndex* pindexTip;
+        unsigned int nMempoolUpdated;
+        unsigned int nStempoolUpdated;
+        uint64_t nWalletVersion;
+
+        bool operator==(const CBalancesStamp& other) const
+        {
+            return pindexTip == other.pindexTip && nMempoolUpdated == other.nMempoolUpdated
+                && nStempoolUpdated == other.nStempoolUpdated && nWalletVersion == other.nWalletVersion;
+        }
+    };
+
+    mutable bool fBalancesCached;
+    mutable CBalancesStamp balancesStamp;
+    mutable CWalletBalances cachedBalances;
+
+    //! Transaction tallies of GetAccountBalance() by account, min depth and filter
+    std::map<std::tuple<std::string, int, isminefilter>, CAmount> mapAccountTallies;
+    CBalancesStamp accountTalliesStamp;
+
+    bool MayHaveCoins(const CWalletTx& wtx) const;
+    //! Wallet transactions which may have unspent outputs of ours, in mapWallet order
+    std::vector<const CWalletTx*> GetCoinTxs() const;
+    CBalancesStamp GetBalancesStamp() const;
+    CWalletBalances ComputeBalances(const std::vector<const CWalletTx*>& vTxs) const;
+    CAmount TallyAccount(const std::string& strAccount, int nMinDepth, const isminefilter& filter) const;
+
     /* Mark a transaction (and its in-wallet descendants) as conflicting with a particular block. */
     void MarkConflicted(const uint256& hashBlock, const uint256& hashTx);
 
@@ -771,6 +834,9 @@ public:
         vecAnonymizableTallyCached.clear();
         vecAnonymizableTallyCachedNonDenom.clear();
         zwallet = NULL;
+        nBalancesVersion = 0;
+        fBalancesCached = false;
+        accountTalliesStamp = CBalancesStamp();
     }
 
     std::map<uint256, CWalletTx> mapWallet;
@@ -890,6 +956,10 @@ public:
     bool LoadToWallet(const CWalletTx& wtxIn);
     void SyncTransaction(const CTransaction& tx, const CBlockIndex *pindex, int posInBlock) override;
     bool AddToWalletIfInvolvingMe(const CTransaction& tx, const CBlockIndex* pIndex, int posInBlock, bool fUpdate);
+    //! Whether the transaction is in the wallet already, or spends or conflicts with one of its transactions
+    bool IsInvolvedBySpends(const CTransaction& tx) const;
+    //! Scripts of the wallet keys, redeem scripts and watch-only scripts, as block filter elements
+    GCSFilter::ElementSet GetBlockFilterElements() const;
     CBlockIndex* ScanForWalletTransactions(CBlockIndex* pindexStart, bool fUpdate = false, bool fRecoverMnemonic = false);
     void ReacceptWalletTransactions();
     void ResendWalletTransactions(int64_t nBestBlockTime, CConnman* connman) override;
@@ -900,6 +970,10 @@ public:
     CAmount GetWatchOnlyBalance() const;
     CAmount GetUnconfirmedWatchOnlyBalance() const;
     CAmount GetImmatureWatchOnlyBalance() const;
+    //! All of the balances above, cached until the chain, the mempools or the wallet change
+    CWalletBalances GetBalances() const;
+    //! Recompute the balances which depend on the transaction
+    void MarkBalancesDirty(const uint256& hashTx) const;
 
     static std::vector<CRecipient> CreateSigmaMintRecipients(
         std::vector<sigma::PrivateCoin>& coins,
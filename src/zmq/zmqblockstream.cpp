@@ -0,0 +1,347 @@
+// Copyright (c) 2020 The Firo Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "zmqblockstream.h"
+
+#include "chain.h"
+#include "chainparams.h"
+#include "coins.h"
+#include "crypto/common.h"
+#include "rpc/server.h"
+#include "streams.h"
+#include "undo.h"
+#include "util.h"
+#include "validation.h"
+
+#include <algorithm>
+#include <functional>
+
+static const char *MSG_SUBSCRIBE   = "subscribe";
+static const char *MSG_UNSUBSCRIBE = "unsubscribe";
+static const char *MSG_BLOCKDATA   = "block";
+static const char *MSG_DISCONNECT  = "disconnect";
+static const char *MSG_ERROR       = "error";
+
+//! Messages sent to a subscriber per round, so a long backfill does not starve the others
+static const int STREAM_BATCH_SIZE = 16;
+//! How long the stream thread waits for requests when all subscribers are caught up, tips not
+//! announced through NotifyBlock (during initial block download or reorgs that only disconnect) are
+//! picked up after at most this long
+static const long STREAM_POLL_TIMEOUT_MS = 50;
+
+static std::string EncodeLE32(uint32_t n)
+{
+    unsigned char buffer[4];
+    WriteLE32(buffer, n);
+    return std::string(reinterpret_cast<char*>(buffer), sizeof(buffer));
+}
+
+CZMQBlockStreamNotifier::CZMQBlockStreamNotifier() : fStop(false), psocketWakeup(0), psocketNotify(0)
+{
+}
+
+bool CZMQBlockStreamNotifier::Initialize(void *pcontext)
+{
+    assert(!psocket);
+
+    psocket = zmq_socket(pcontext, ZMQ_ROUTER);
+    if (!psocket)
+    {
+        zmqError("Failed to create socket");
+        return false;
+    }
+
+    // report unroutable and full peers instead of silently dropping messages
+    int mandatory = 1;
+    zmq_setsockopt(psocket, ZMQ_ROUTER_MANDATORY, &mandatory, sizeof(mandatory));
+
+    int rc = zmq_bind(psocket, address.c_str());
+    if (rc != 0)
+    {
+        zmqError("Failed to bind address");
+        zmq_close(psocket);
+        psocket = 0;
+        return false;
+    }
+
+    // a PAIR socket pair lets NotifyBlock interrupt the poll of the stream thread
+    std::string wakeupAddress = strprintf("inproc://zmqstreamblock-%p", this);
+    psocketWakeup = zmq_socket(pcontext, ZMQ_PAIR);
+    psocketNotify = zmq_socket(pcontext, ZMQ_PAIR);
+    if (!psocketWakeup || !psocketNotify
+        || zmq_bind(psocketWakeup, wakeupAddress.c_str()) != 0
+        || zmq_connect(psocketNotify, wakeupAddress.c_str()) != 0)
+    {
+        zmqError("Failed to create wakeup socket");
+        CloseSockets();
+        return false;
+    }
+
+    // the sockets are only used by the stream thread from now on
+    fStop = false;
+    thread = std::thread(&TraceThread<std::function<void()> >, "zmqstream", std::function<void()>(std::bind(&CZMQBlockStreamNotifier::ThreadStream, this)));
+    return true;
+}
+
+void CZMQBlockStreamNotifier::Shutdown()
+{
+    assert(psocket);
+
+    fStop = true;
+    if (thread.joinable())
+        thread.join();
+    subscribers.clear();
+
+    LogPrint("zmq", "Close socket at address %s\n", address);
+    CloseSockets();
+}
+
+void CZMQBlockStreamNotifier::CloseSockets()
+{
+    std::lock_guard<std::mutex> lock(cs_notify);
+    int linger = 0;
+    for (void **ppsocket : {&psocket, &psocketWakeup, &psocketNotify})
+    {
+        if (!*ppsocket)
+            continue;
+        zmq_setsockopt(*ppsocket, ZMQ_LINGER, &linger, sizeof(linger));
+        zmq_close(*ppsocket);
+        *ppsocket = 0;
+    }
+}
+
+bool CZMQBlockStreamNotifier::NotifyBlock(const CBlockIndex *pindex)
+{
+    std::lock_guard<std::mutex> lock(cs_notify);
+    if (!psocketNotify)
+        return true;
+
+    // a pending wakeup covers this tip as well, so a full pipe is fine
+    if (zmq_send(psocketNotify, "", 0, ZMQ_DONTWAIT) == -1 && errno != EAGAIN)
+    {
+        zmqError("Unable to wake up the block stream");
+        return false;
+    }
+    return true;
+}
+
+void CZMQBlockStreamNotifier::ThreadStream()
+{
+    bool fIdle = true;
+    while (!fStop)
+    {
+        zmq_pollitem_t items[] = {
+            {psocket, 0, ZMQ_POLLIN, 0},
+            {psocketWakeup, 0, ZMQ_POLLIN, 0},
+        };
+        if (zmq_poll(items, 2, fIdle ? STREAM_POLL_TIMEOUT_MS : 0) == -1)
+        {
+            if (errno == ETERM)
+                break;
+            continue;
+        }
+        if (items[0].revents & ZMQ_POLLIN)
+            ReceiveRequests();
+        if (items[1].revents & ZMQ_POLLIN)
+        {
+            // the wakeups only interrupt the poll, the new tip is read from chainActive
+            zmq_msg_t msg;
+            zmq_msg_init(&msg);
+            while (zmq_msg_recv(&msg, psocketWakeup, ZMQ_DONTWAIT) != -1)
+                ;
+            zmq_msg_close(&msg);
+        }
+
+        fIdle = true;
+        for (std::map<std::string, Subscriber>::iterator it = subscribers.begin(); it != subscribers.end() && !fStop; )
+        {
+            int sent = StreamBlocks(it->first, it->second);
+            if (sent < 0)
+            {
+                LogPrint("zmq", "zmq: Dropping block stream subscriber\n");
+                it = subscribers.erase(it);
+                continue;
+            }
+            if (sent > 0)
+                fIdle = false;
+            ++it;
+        }
+    }
+}
+
+void CZMQBlockStreamNotifier::ReceiveRequests()
+{
+    while (true)
+    {
+        // routing id, command and optional payload
+        std::vector<std::string> parts;
+        bool fMore = true;
+        while (fMore)
+        {
+            zmq_msg_t msg;
+            zmq_msg_init(&msg);
+            if (zmq_msg_recv(&msg, psocket, ZMQ_DONTWAIT) == -1)
+            {
+                zmq_msg_close(&msg);
+                if (errno != EAGAIN)
+                    zmqError("Unable to receive ZMQ msg");
+                return;
+            }
+            parts.emplace_back(static_cast<const char*>(zmq_msg_data(&msg)), zmq_msg_size(&msg));
+            fMore = zmq_msg_more(&msg);
+            zmq_msg_close(&msg);
+        }
+
+        if (parts.size() < 2)
+            continue;
+
+        const std::string& identity = parts[0];
+        const std::string& command = parts[1];
+
+        if (command == MSG_SUBSCRIBE && parts.size() == 3 && parts[2].size() == 4)
+        {
+            Subscriber subscriber;
+            subscriber.nStartHeight = ReadLE32(reinterpret_cast<const unsigned char*>(parts[2].data()));
+            subscriber.nNextHeight = subscriber.nStartHeight;
+            subscriber.nSequence = 0;
+            if (subscriber.nStartHeight < 0)
+                continue;
+
+            LogPrint("zmq", "zmq: Block stream subscriber starting at height %d\n", subscriber.nStartHeight);
+            subscribers[identity] = subscriber;
+        }
+        else if (command == MSG_UNSUBSCRIBE)
+        {
+            subscribers.erase(identity);
+        }
+        else
+        {
+            LogPrint("zmq", "zmq: Ignoring malformed block stream request\n");
+        }
+    }
+}
+
+int CZMQBlockStreamNotifier::StreamBlocks(const std::string& identity, Subscriber& subscriber)
+{
+    const Consensus::Params& consensusParams = Params().GetConsensus();
+
+    int sent = 0;
+    while (sent < STREAM_BATCH_SIZE)
+    {
+        int nHeight;
+        uint256 hash, hashPrev;
+        bool fDisconnect = false, fHaveData = false;
+        CDiskBlockPos blockPos, undoPos;
+        {
+            LOCK(cs_main);
+            if (!subscriber.hashLast.IsNull())
+            {
+                BlockMap::const_iterator mi = mapBlockIndex.find(subscriber.hashLast);
+                assert(mi != mapBlockIndex.end());
+                const CBlockIndex *pindexLast = mi->second;
+                if (!chainActive.Contains(pindexLast))
+                {
+                    fDisconnect = true;
+                    nHeight = pindexLast->nHeight;
+                    hash = pindexLast->GetBlockHash();
+                    hashPrev = pindexLast->pprev->GetBlockHash();
+                }
+            }
+
+            if (!fDisconnect)
+            {
+                const CBlockIndex *pindex = chainActive[subscriber.nNextHeight];
+                if (!pindex)
+                    break; // caught up with the tip
+
+                nHeight = pindex->nHeight;
+                hash = pindex->GetBlockHash();
+                fHaveData = (pindex->nStatus & BLOCK_HAVE_DATA) && (!pindex->pprev || (pindex->nStatus & BLOCK_HAVE_UNDO));
+                if (fHaveData)
+                {
+                    blockPos = pindex->GetBlockPos();
+                    if (pindex->pprev)
+                    {
+                        hashPrev = pindex->pprev->GetBlockHash();
+                        undoPos = pindex->GetUndoPos();
+                    }
+                }
+            }
+        }
+
+        std::vector<std::string> parts;
+        if (fDisconnect)
+        {
+            std::string hashReversed(hash.begin(), hash.end());
+            std::reverse(hashReversed.begin(), hashReversed.end());
+            parts = {MSG_DISCONNECT, EncodeLE32(subscriber.nSequence), EncodeLE32(nHeight), hashReversed};
+        }
+        else
+        {
+            CBlock block;
+            CBlockUndo blockundo;
+            if (!fHaveData
+                || !ReadBlockFromDisk(block, blockPos, nHeight, consensusParams)
+                || (!hashPrev.IsNull() && !UndoReadFromDisk(blockundo, undoPos, hashPrev)))
+            {
+                LogPrint("zmq", "zmq: Block %d is not available for the block stream\n", nHeight);
+                SendMessage(identity, {MSG_ERROR, EncodeLE32(subscriber.nSequence), EncodeLE32(nHeight), "block data not available"});
+                return -1;
+            }
+
+            CDataStream ssBlock(SER_NETWORK, PROTOCOL_VERSION | RPCSerializationFlags());
+            ssBlock << block;
+            CDataStream ssUndo(SER_NETWORK, PROTOCOL_VERSION);
+            if (!hashPrev.IsNull())
+                ssUndo << blockundo;
+
+            parts = {MSG_BLOCKDATA, EncodeLE32(subscriber.nSequence), EncodeLE32(nHeight), ssBlock.str(), ssUndo.str()};
+        }
+
+        int rc = SendMessage(identity, parts);
+        if (rc == EAGAIN)
+            break; // the subscriber is behind, try again next round
+        if (rc != 0)
+            return -1;
+
+        subscriber.nSequence++;
+        sent++;
+
+        if (fDisconnect)
+        {
+            // nothing below the start height was sent, so there is nothing further to disconnect
+            subscriber.nNextHeight = nHeight;
+            subscriber.hashLast = nHeight > subscriber.nStartHeight ? hashPrev : uint256();
+        }
+        else
+        {
+            subscriber.nNextHeight = nHeight + 1;
+            subscriber.hashLast = hash;
+        }
+    }
+    return sent;
+}
+
+int CZMQBlockStreamNotifier::SendMessage(const std::string& identity, const std::vector<std::string>& parts)
+{
+    // with ZMQ_ROUTER_MANDATORY only the routing id can fail, the rest of the message is then queued as a whole
+    if (zmq_send(psocket, identity.data(), identity.size(), ZMQ_SNDMORE | ZMQ_DONTWAIT) == -1)
+    {
+        if (errno == EAGAIN)
+            return EAGAIN;
+        if (errno != EHOSTUNREACH)
+            zmqError("Unable to send ZMQ msg");
+        return -1;
+    }
+
+    for (size_t i = 0; i < parts.size(); i++)
+    {
+        if (zmq_send(psocket, parts[i].data(), parts[i].size(), i + 1 < parts.size() ? ZMQ_SNDMORE : 0) == -1)
+        {
+            zmqError("Unable to send ZMQ msg");
+            return -1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,65 @@
+// Copyright (c) 2020 The Firo Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef FIRO_ZMQ_ZMQBLOCKSTREAM_H
+#define FIRO_ZMQ_ZMQBLOCKSTREAM_H
+
+#include "zmqabstractnotifier.h"
+#include "uint256.h"
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Streams the blocks of the active chain together with their undo data to
+ * subscribers connected to a ROUTER socket. A subscriber names a start height
+ * and gets every block from there on read from disk, then new blocks as they
+ * are connected. Blocks the subscriber received that left the active chain are
+ * reported as disconnected, tip first, before the blocks of the new branch.
+ * Each subscriber is served at its own pace, see doc/zmq.md for the protocol.
+ */
+class CZMQBlockStreamNotifier : public CZMQAbstractNotifier
+{
+public:
+    CZMQBlockStreamNotifier();
+
+    bool Initialize(void *pcontext);
+    void Shutdown();
+
+    /** Wakes up the stream thread to send the new tip to the subscribers that are caught up */
+    bool NotifyBlock(const CBlockIndex *pindex);
+
+private:
+    struct Subscriber
+    {
+        int nStartHeight;
+        int nNextHeight;   //!< height of the next block to send
+        uint256 hashLast;  //!< last block sent, null when there is none to disconnect
+        uint32_t nSequence; //!< upcounting per subscriber message sequence number
+    };
+
+    std::map<std::string, Subscriber> subscribers; //!< by ZMQ routing id, only used by the stream thread
+    std::atomic<bool> fStop;
+    std::thread thread;
+
+    void *psocketWakeup; //!< inproc socket the stream thread polls besides the ROUTER socket
+    void *psocketNotify; //!< its peer, used by NotifyBlock under cs_notify
+    std::mutex cs_notify;
+
+    void ThreadStream();
+    void CloseSockets();
+    void ReceiveRequests();
+
+    /** Sends up to a batch of messages, returns the number sent or -1 if the subscriber is to be dropped */
+    int StreamBlocks(const std::string& identity, Subscriber& subscriber);
+
+    /** Returns 0 when queued, EAGAIN when the subscriber is not reading fast enough and -1 if it is gone */
+    int SendMessage(const std::string& identity, const std::vector<std::string>& parts);
+};
+
+#endif // FIRO_ZMQ_ZMQBLOCKSTREAM_H
@@ -4,6 +4,7 @@
 
 #include "zmqnotificationinterface.h"
 #include "zmqpublishnotifier.h"
+#include "zmqblockstream.h"
 
 #include "version.h"
 #include "validation.h"
@@ -39,6 +40,7 @@ CZMQNotificationInterface* CZMQNotificationInterface::Create()
     factories["pubhashtx"] = CZMQAbstractNotifier::Create<CZMQPublishHashTransactionNotifier>;
     factories["pubrawblock"] = CZMQAbstractNotifier::Create<CZMQPublishRawBlockNotifier>;
     factories["pubrawtx"] = CZMQAbstractNotifier::Create<CZMQPublishRawTransactionNotifier>;
+    factories["streamblock"] = CZMQAbstractNotifier::Create<CZMQBlockStreamNotifier>;
 
     for (std::map<std::string, CZMQNotifierFactory>::const_iterator i=factories.begin(); i!=factories.end(); ++i)
     {